@@ -0,0 +1,321 @@
+/*****************************************************************************\
+*
+*  Module Name    rprConvergenceController.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#include "rprConvergenceController.h"
+#include "rprToolsCommon.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define RPR_CONVERGENCE_SSE 1
+#else
+#define RPR_CONVERGENCE_SSE 0
+#endif
+
+using rprtools::SecondsSince;
+
+
+namespace
+{
+
+// sums of the RGBA values of the pixels [x0,x1) x [y0,y1) of 2 images of width x 4 floats
+void SumTile(const float* color, const float* variance, unsigned width, unsigned x0, unsigned y0, unsigned x1, unsigned y1, float colorSum[4], float varianceSum[4])
+{
+	const unsigned count = x1 - x0;
+
+#if RPR_CONVERGENCE_SSE
+	// 2 accumulators per image, to hide the latency of the additions
+	__m128 color0 = _mm_setzero_ps();
+	__m128 color1 = _mm_setzero_ps();
+	__m128 variance0 = _mm_setzero_ps();
+	__m128 variance1 = _mm_setzero_ps();
+	for(unsigned y=y0; y<y1; y++)
+	{
+		const float* colorRow = color + ((size_t)y * width + x0) * 4;
+		const float* varianceRow = variance + ((size_t)y * width + x0) * 4;
+		unsigned x = 0;
+		for( ; x+2<=count; x+=2)
+		{
+			color0 = _mm_add_ps(color0, _mm_loadu_ps(colorRow + x * 4));
+			color1 = _mm_add_ps(color1, _mm_loadu_ps(colorRow + x * 4 + 4));
+			variance0 = _mm_add_ps(variance0, _mm_loadu_ps(varianceRow + x * 4));
+			variance1 = _mm_add_ps(variance1, _mm_loadu_ps(varianceRow + x * 4 + 4));
+		}
+		if ( x < count )
+		{
+			color0 = _mm_add_ps(color0, _mm_loadu_ps(colorRow + x * 4));
+			variance0 = _mm_add_ps(variance0, _mm_loadu_ps(varianceRow + x * 4));
+		}
+	}
+	_mm_storeu_ps(colorSum, _mm_add_ps(color0, color1));
+	_mm_storeu_ps(varianceSum, _mm_add_ps(variance0, variance1));
+#else
+	for(int c=0; c<4; c++)
+	{
+		colorSum[c] = 0.0f;
+		varianceSum[c] = 0.0f;
+	}
+	for(unsigned y=y0; y<y1; y++)
+	{
+		const float* colorRow = color + ((size_t)y * width + x0) * 4;
+		const float* varianceRow = variance + ((size_t)y * width + x0) * 4;
+		for(unsigned i=0; i<count * 4; i++)
+		{
+			colorSum[i & 3] += colorRow[i];
+			varianceSum[i & 3] += varianceRow[i];
+		}
+	}
+#endif
+}
+
+rpr_status ReadFrameBuffer(rpr_framebuffer framebuffer, std::vector<float>& data)
+{
+	size_t size = 0;
+	rpr_status status = rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_DATA, 0, nullptr, &size);
+	if ( status != RPR_SUCCESS )
+		return status;
+	data.resize(size / sizeof(float));
+	return rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_DATA, size, data.data(), nullptr);
+}
+
+}
+
+
+RPRConvergenceController::RPRConvergenceController(rpr_context context, rpr_framebuffer colorFrameBuffer, rpr_framebuffer varianceFrameBuffer, const Settings& settings) :
+	m_context(context),
+	m_colorFrameBuffer(colorFrameBuffer),
+	m_varianceFrameBuffer(varianceFrameBuffer),
+	m_settings(settings)
+{
+}
+
+RPRConvergenceController::RPRConvergenceController(rpr_context context, rpr_framebuffer colorFrameBuffer, rpr_framebuffer varianceFrameBuffer) :
+	RPRConvergenceController(context, colorFrameBuffer, varianceFrameBuffer, Settings())
+{
+}
+
+RPRConvergenceController::~RPRConvergenceController()
+{
+	if ( m_colorResolved )
+		rprObjectDelete(m_colorResolved);
+	if ( m_varianceResolved )
+		rprObjectDelete(m_varianceResolved);
+}
+
+const std::vector<float>& RPRConvergenceController::GetTileErrors(unsigned& tilesX, unsigned& tilesY) const
+{
+	tilesX = m_tilesX;
+	tilesY = m_tilesY;
+	return m_tileErrors;
+}
+
+rpr_status RPRConvergenceController::Initialize()
+{
+	if ( !m_context || !m_colorFrameBuffer || !m_varianceFrameBuffer || m_settings.tileSize == 0 || m_settings.maxSamples == 0
+		|| m_settings.minBatchSamples == 0 || m_settings.minBatchSamples > m_settings.maxBatchSamples || !(m_settings.targetError > 0.0f) )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	rpr_framebuffer_desc desc = {};
+	rpr_status status = rprFrameBufferGetInfo(m_colorFrameBuffer, RPR_FRAMEBUFFER_DESC, sizeof(desc), &desc, nullptr);
+	if ( status != RPR_SUCCESS )
+		return status;
+	if ( desc.fb_width == 0 || desc.fb_height == 0 )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	if ( m_settings.adaptiveSampling )
+	{
+		status = rprContextSetParameterByKey1u(m_context, RPR_CONTEXT_ADAPTIVE_SAMPLING_TILE_SIZE, m_settings.tileSize);
+		if ( status == RPR_SUCCESS )
+			status = rprContextSetParameterByKey1u(m_context, RPR_CONTEXT_ADAPTIVE_SAMPLING_MIN_SPP, m_settings.minSamples);
+		if ( status == RPR_SUCCESS )
+			status = rprContextSetParameterByKey1f(m_context, RPR_CONTEXT_ADAPTIVE_SAMPLING_THRESHOLD, m_settings.targetError);
+		if ( status != RPR_SUCCESS )
+			return status;
+	}
+
+	// the resolved data is read as RGBA floats
+	const rpr_framebuffer_format format = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	rpr_framebuffer colorResolved = nullptr;
+	rpr_framebuffer varianceResolved = nullptr;
+	status = rprContextCreateFrameBuffer(m_context, format, &desc, &colorResolved);
+	if ( status == RPR_SUCCESS )
+		status = rprContextCreateFrameBuffer(m_context, format, &desc, &varianceResolved);
+	if ( status != RPR_SUCCESS )
+	{
+		if ( colorResolved )
+			rprObjectDelete(colorResolved);
+		return status;
+	}
+
+	m_colorResolved = colorResolved;
+	m_varianceResolved = varianceResolved;
+	m_width = desc.fb_width;
+	m_height = desc.fb_height;
+	m_tilesX = (m_width + m_settings.tileSize - 1) / m_settings.tileSize;
+	m_tilesY = (m_height + m_settings.tileSize - 1) / m_settings.tileSize;
+	m_tileErrors.assign((size_t)m_tilesX * m_tilesY, 0.0f);
+	return RPR_SUCCESS;
+}
+
+rpr_status RPRConvergenceController::EstimateError(unsigned samples, FrameReport& report)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	// linear values: no display gamma
+	rpr_status status = rprContextResolveFrameBuffer(m_context, m_colorFrameBuffer, m_colorResolved, true);
+	if ( status == RPR_SUCCESS )
+		status = rprContextResolveFrameBuffer(m_context, m_varianceFrameBuffer, m_varianceResolved, true);
+	if ( status == RPR_SUCCESS )
+		status = ReadFrameBuffer(m_colorResolved, m_color);
+	if ( status == RPR_SUCCESS )
+		status = ReadFrameBuffer(m_varianceResolved, m_variance);
+	if ( status != RPR_SUCCESS )
+		return status;
+	if ( m_color.size() != (size_t)m_width * m_height * 4 || m_variance.size() != m_color.size() )
+		return RPR_ERROR_INTERNAL_ERROR;
+
+	const unsigned tileSize = m_settings.tileSize;
+	for(unsigned tileY=0; tileY<m_tilesY; tileY++)
+	{
+		for(unsigned tileX=0; tileX<m_tilesX; tileX++)
+		{
+			const unsigned x0 = tileX * tileSize;
+			const unsigned y0 = tileY * tileSize;
+			const unsigned x1 = std::min(x0 + tileSize, m_width);
+			const unsigned y1 = std::min(y0 + tileSize, m_height);
+
+			float colorSum[4];
+			float varianceSum[4];
+			SumTile(m_color.data(), m_variance.data(), m_width, x0, y0, x1, y1, colorSum, varianceSum);
+
+			const float numPixels = (float)((x1 - x0) * (y1 - y0));
+			const float luminance = (0.2126f * colorSum[0] + 0.7152f * colorSum[1] + 0.0722f * colorSum[2]) / numPixels;
+			const float variance = (varianceSum[0] + varianceSum[1] + varianceSum[2]) / (3.0f * numPixels);
+			float error = std::sqrt(std::max(variance, 0.0f) / samples) / (std::max(luminance, 0.0f) + m_settings.luminanceFloor);
+
+			// NaN or infinite pixels: the tile never converges
+			if ( !std::isfinite(error) )
+				error = FLT_MAX;
+			m_tileErrors[(size_t)tileY * m_tilesX + tileX] = error;
+		}
+	}
+
+	// error of the frame: the tiles above it are the ones allowed to stay unconverged
+	const size_t numTiles = m_tileErrors.size();
+	const size_t allowedTiles = (size_t)(m_settings.unconvergedTileRatio * numTiles);
+	m_sortedErrors = m_tileErrors;
+	const size_t rank = numTiles - 1 - std::min(allowedTiles, numTiles - 1);
+	std::nth_element(m_sortedErrors.begin(), m_sortedErrors.begin() + rank, m_sortedErrors.end());
+
+	report.error = m_sortedErrors[rank];
+	report.maxTileError = *std::max_element(m_tileErrors.begin(), m_tileErrors.end());
+	report.unconvergedTiles = (size_t)std::count_if(m_tileErrors.begin(), m_tileErrors.end(), [this](float error) { return error > m_settings.targetError; });
+	report.numTiles = numTiles;
+	report.estimateSeconds += SecondsSince(start);
+	return RPR_SUCCESS;
+}
+
+rpr_status RPRConvergenceController::RenderFrame(FrameReport* report)
+{
+	rpr_status status = RPR_SUCCESS;
+	if ( !m_colorResolved )
+	{
+		status = Initialize();
+		if ( status != RPR_SUCCESS )
+			return status;
+	}
+
+	status = rprFrameBufferClear(m_colorFrameBuffer);
+	if ( status == RPR_SUCCESS )
+		status = rprFrameBufferClear(m_varianceFrameBuffer);
+	if ( status != RPR_SUCCESS )
+		return status;
+
+	const auto start = std::chrono::steady_clock::now();
+	const size_t allowedTiles = (size_t)(m_settings.unconvergedTileRatio * m_tileErrors.size());
+
+	FrameReport frame;
+	unsigned batch = std::min(std::max(m_settings.minSamples, 1u), m_settings.maxSamples);
+	for(;;)
+	{
+		status = rprContextSetParameterByKey1u(m_context, RPR_CONTEXT_ITERATIONS, batch);
+		if ( status != RPR_SUCCESS )
+			return status;
+		const auto renderStart = std::chrono::steady_clock::now();
+		status = rprContextRender(m_context);
+		frame.renderSeconds += SecondsSince(renderStart);
+		if ( status != RPR_SUCCESS )
+			return status;
+		frame.samples += batch;
+		frame.batches++;
+
+		status = EstimateError(frame.samples, frame);
+		if ( status != RPR_SUCCESS )
+			return status;
+
+		bool converged = frame.unconvergedTiles <= allowedTiles;
+		if ( !converged && m_settings.adaptiveSampling )
+		{
+			rpr_uint activePixelCount = 0;
+			status = rprContextGetInfo(m_context, RPR_CONTEXT_ACTIVE_PIXEL_COUNT, sizeof(activePixelCount), &activePixelCount, nullptr);
+			if ( status != RPR_SUCCESS )
+				return status;
+			converged = activePixelCount == 0;
+		}
+		if ( converged && frame.samples >= m_settings.minSamples )
+		{
+			frame.stopReason = STOP_CONVERGED;
+			break;
+		}
+		if ( frame.samples >= m_settings.maxSamples )
+		{
+			frame.stopReason = STOP_MAX_SAMPLES;
+			break;
+		}
+
+		// the error decreases with 1/sqrt(samples): samples * (error/target)^2 are needed in total
+		const double ratio = (double)frame.error / m_settings.targetError;
+		const double needed = frame.samples * ratio * ratio - frame.samples;
+		double next = std::min(std::max(needed, (double)m_settings.minBatchSamples), (double)m_settings.maxBatchSamples);
+		next = std::min(next, (double)(m_settings.maxSamples - frame.samples));
+
+		if ( m_settings.timeBudgetSeconds > 0.0 )
+		{
+			// the samples of the next batch that still fit in the budget, with the time of an estimate
+			const double remaining = m_settings.timeBudgetSeconds - SecondsSince(start) - frame.estimateSeconds / frame.batches;
+			const double secondsPerSample = frame.renderSeconds / frame.samples;
+			next = std::min(next, std::floor(remaining / std::max(secondsPerSample, 1e-9)));
+			if ( next < 1.0 )
+			{
+				frame.stopReason = STOP_TIME_BUDGET;
+				break;
+			}
+		}
+		batch = (unsigned)next;
+	}
+
+	m_stats.frames++;
+	m_stats.samples += frame.samples;
+	m_stats.framesConverged += frame.stopReason == STOP_CONVERGED ? 1 : 0;
+	m_stats.framesTimeBudget += frame.stopReason == STOP_TIME_BUDGET ? 1 : 0;
+	m_stats.framesMaxSamples += frame.stopReason == STOP_MAX_SAMPLES ? 1 : 0;
+	m_stats.renderSeconds += frame.renderSeconds;
+	m_stats.estimateSeconds += frame.estimateSeconds;
+	m_frameReports.push_back(frame);
+
+	if ( report )
+		*report = frame;
+	return RPR_SUCCESS;
+}
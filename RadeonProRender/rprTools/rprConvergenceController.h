@@ -0,0 +1,164 @@
+/*****************************************************************************\
+*
+*  Module Name    rprConvergenceController.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <RadeonProRender.h>
+
+// Renders each frame until it is converged, instead of a fixed RPR_CONTEXT_ITERATIONS.
+//
+// RenderFrame clears the color and variance framebuffers, then calls rprContextRender in batches of samples. After each batch,
+// both AOVs are resolved and read back, and the error of each tile of tileSize x tileSize pixels is estimated:
+//
+//    error = sqrt( mean variance / samples ) / ( mean luminance + luminanceFloor )
+//
+// the standard error of the pixels, relative to the brightness of the tile. The frame stops when at most unconvergedTileRatio
+// of the tiles are above targetError, when the time budget is used, or at maxSamples.
+// As the error decreases with 1/sqrt(samples), the size of the next batch is predicted from the current error, and reduced to
+// fit in the time left.
+//
+// With adaptiveSampling, the RPR_CONTEXT_ADAPTIVE_SAMPLING_* parameters are also set from the settings: the renderer stops
+// sampling the converged tiles itself, and the frame also stops when RPR_CONTEXT_ACTIVE_PIXEL_COUNT is 0.
+//
+// Usage:
+//   rprContextSetAOV(context, RPR_AOV_COLOR, frame_buffer);
+//   rprContextSetAOV(context, RPR_AOV_VARIANCE, frame_buffer_variance);
+//   RPRConvergenceController controller(context, frame_buffer, frame_buffer_variance);
+//   for each frame:
+//       ... update the scene ...
+//       RPRConvergenceController::FrameReport report;
+//       controller.RenderFrame(&report);
+//       ... resolve frame_buffer ...
+//
+// The other AOVs of the context are not cleared by RenderFrame.
+class RPRConvergenceController
+{
+public:
+
+	enum StopReason
+	{
+		STOP_CONVERGED,
+		STOP_TIME_BUDGET,
+		STOP_MAX_SAMPLES,
+	};
+
+	struct Settings
+	{
+		/// Relative error of a converged tile.
+		float targetError = 0.02f;
+
+		/// Added to the luminance of the tiles: the dark tiles are not sampled forever to reach a relative error.
+		float luminanceFloor = 0.05f;
+
+		/// Ratio of the tiles that can stay above targetError in a converged frame ( fireflies ).
+		float unconvergedTileRatio = 0.001f;
+
+		unsigned tileSize = 16;
+
+		/// Samples per pixel of each frame.
+		unsigned minSamples = 16;
+		unsigned maxSamples = 4096;
+
+		/// Samples rendered between two error estimates.
+		unsigned minBatchSamples = 8;
+		unsigned maxBatchSamples = 256;
+
+		/// Seconds of rendering per frame, at most. 0: no limit.
+		double timeBudgetSeconds = 0.0;
+
+		/// Also use the adaptive sampling of the renderer.
+		bool adaptiveSampling = false;
+	};
+
+	/// Sample budget used by a frame.
+	struct FrameReport
+	{
+		unsigned samples = 0;
+		unsigned batches = 0;
+
+		/// error of the tiles when the frame stopped: the one at the 1 - unconvergedTileRatio rank, and the largest one.
+		float error = 0.0f;
+		float maxTileError = 0.0f;
+
+		size_t unconvergedTiles = 0;
+		size_t numTiles = 0;
+
+		StopReason stopReason = STOP_CONVERGED;
+
+		/// time spent in rprContextRender, and to resolve, read and reduce the AOVs.
+		double renderSeconds = 0.0;
+		double estimateSeconds = 0.0;
+	};
+
+	struct Stats
+	{
+		size_t frames = 0;
+		uint64_t samples = 0;
+
+		/// frames by StopReason.
+		size_t framesConverged = 0;
+		size_t framesTimeBudget = 0;
+		size_t framesMaxSamples = 0;
+
+		double renderSeconds = 0.0;
+		double estimateSeconds = 0.0;
+	};
+
+	/// colorFrameBuffer and varianceFrameBuffer are the framebuffers of RPR_AOV_COLOR and RPR_AOV_VARIANCE.
+	RPRConvergenceController(rpr_context context, rpr_framebuffer colorFrameBuffer, rpr_framebuffer varianceFrameBuffer, const Settings& settings);
+	RPRConvergenceController(rpr_context context, rpr_framebuffer colorFrameBuffer, rpr_framebuffer varianceFrameBuffer);
+
+	/// Deletes the framebuffers created for the resolves: must be called before the context is deleted.
+	~RPRConvergenceController();
+
+	RPRConvergenceController(const RPRConvergenceController&) = delete;
+	RPRConvergenceController& operator=(const RPRConvergenceController&) = delete;
+
+	/// Clear the color and variance framebuffers and render the frame until it stops. report is optional.
+	rpr_status RenderFrame(FrameReport* report = nullptr);
+
+	/// Error of each tile estimated after the last batch, tilesX x tilesY values in rows.
+	const std::vector<float>& GetTileErrors(unsigned& tilesX, unsigned& tilesY) const;
+
+	/// One report per RenderFrame call.
+	const std::vector<FrameReport>& GetFrameReports() const { return m_frameReports; }
+
+	Stats GetStats() const { return m_stats; }
+
+private:
+
+	rpr_status Initialize();
+	rpr_status EstimateError(unsigned samples, FrameReport& report);
+
+	rpr_context m_context;
+	rpr_framebuffer m_colorFrameBuffer;
+	rpr_framebuffer m_varianceFrameBuffer;
+	Settings m_settings;
+
+	// created by the first RenderFrame, with the size of the color framebuffer
+	rpr_framebuffer m_colorResolved = nullptr;
+	rpr_framebuffer m_varianceResolved = nullptr;
+	unsigned m_width = 0;
+	unsigned m_height = 0;
+
+	std::vector<float> m_color;
+	std::vector<float> m_variance;
+	std::vector<float> m_tileErrors;
+	std::vector<float> m_sortedErrors;
+	unsigned m_tilesX = 0;
+	unsigned m_tilesY = 0;
+
+	std::vector<FrameReport> m_frameReports;
+	Stats m_stats;
+};
@@ -0,0 +1,333 @@
+/*****************************************************************************\
+*
+*  Module Name    rprCurveBuilder.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#include "rprCurveBuilder.h"
+#include "rprToolsCommon.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <thread>
+
+using rprtools::SecondsSince;
+using rprtools::ParallelFor;
+
+
+namespace
+{
+
+// strands processed by a task
+const size_t STRAND_BATCH = 1024;
+
+// the control points of a rpr_curve are addressed by rpr_uint indices, 4 per segment at most
+const size_t MAX_SEGMENTS_PER_CURVE = 0xFFFFFFFFu / 4;
+
+// where the strand goes in the chunks
+struct StrandInfo
+{
+	size_t firstPoint = 0;       // in Strands::points
+	rpr_uint segments = 0;       // 0: strand decimated
+	rpr_uint chunk = 0;
+	rpr_uint firstSegment = 0;   // in the chunk
+	rpr_uint curve = 0;          // in the chunk
+	float radiusScale = 1.0f;
+};
+
+// uniform in [0, 1), from the index of the strand ( splitmix64 )
+float HashToUnit(uint64_t index)
+{
+	uint64_t x = index + 0x9E3779B97F4A7C15ull;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+	x = x ^ (x >> 31);
+	return (float)(x >> 40) * (1.0f / 16777216.0f);
+}
+
+void StorePoint(float* destination, const float* point)
+{
+	destination[0] = point[0];
+	destination[1] = point[1];
+	destination[2] = point[2];
+}
+
+// a + ( b - c ) * scale
+void StoreOffsetPoint(float* destination, const float* a, const float* b, const float* c, float scale)
+{
+	destination[0] = a[0] + (b[0] - c[0]) * scale;
+	destination[1] = a[1] + (b[1] - c[1]) * scale;
+	destination[2] = a[2] + (b[2] - c[2]) * scale;
+}
+
+}
+
+
+RPRCurveBuilder::RPRCurveBuilder(const Settings& settings)
+	: m_settings(settings)
+{
+	m_settings.maxSegmentsPerCurve = std::min(std::max<size_t>(m_settings.maxSegmentsPerCurve, 1), MAX_SEGMENTS_PER_CURVE);
+}
+
+RPRCurveBuilder::RPRCurveBuilder()
+	: RPRCurveBuilder(Settings())
+{
+}
+
+float RPRCurveBuilder::GetPixelsPerUnit(float focalLength, float sensorHeight, unsigned imageHeight)
+{
+	return sensorHeight > 0.0f ? focalLength / sensorHeight * (float)imageHeight : 0.0f;
+}
+
+rpr_status RPRCurveBuilder::Generate(const Strands& strands, std::vector<Chunk>& chunks)
+{
+	chunks.clear();
+	if ( strands.count > 0 && ( !strands.pointCounts || !strands.points ) )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	const auto start = std::chrono::steady_clock::now();
+
+	const Basis basis = m_settings.basis;
+	const rpr_uint minPoints = basis == BASIS_BEZIER ? 4 : 2;
+	const bool tapered = strands.pointRadius != nullptr;
+	const unsigned hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+	const unsigned numThreads = m_settings.numThreads ? m_settings.numThreads : hardwareThreads;
+	const size_t numBatches = (strands.count + STRAND_BATCH - 1) / STRAND_BATCH;
+
+	std::vector<StrandInfo> infos(strands.count);
+	size_t numPoints = 0;
+	for(size_t s=0; s<strands.count; s++)
+	{
+		infos[s].firstPoint = numPoints;
+		numPoints += strands.pointCounts[s];
+	}
+	if ( numPoints != strands.pointCount )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	////// segments of each strand, decimation //////
+
+	const bool decimate = m_settings.decimate && m_settings.pixelsPerUnit > 0.0f && m_settings.minPixelWidth > 0.0f;
+	const float* camera = m_settings.cameraPosition;
+	std::atomic<bool> valid(true);
+	std::atomic<size_t> inputSegments(0);
+	ParallelFor(numBatches, numThreads, [&](size_t batch)
+	{
+		const size_t strandEnd = std::min(strands.count, (batch + 1) * STRAND_BATCH);
+		size_t batchSegments = 0;
+		for(size_t s=batch*STRAND_BATCH; s<strandEnd; s++)
+		{
+			StrandInfo& info = infos[s];
+			const rpr_uint numStrandPoints = strands.pointCounts[s];
+			if ( numStrandPoints < minPoints || ( basis == BASIS_BEZIER && (numStrandPoints - 1) % 3 != 0 ) )
+			{
+				valid = false;
+				return;
+			}
+			info.segments = basis == BASIS_BEZIER ? (numStrandPoints - 1) / 3 : numStrandPoints - 1;
+			batchSegments += info.segments;
+
+			if ( !decimate )
+				continue;
+
+			// width on screen at the root of the strand
+			const float* root = strands.points + 3 * info.firstPoint;
+			const float dx = root[0] - camera[0];
+			const float dy = root[1] - camera[1];
+			const float dz = root[2] - camera[2];
+			const float distance = std::max(std::sqrt(dx * dx + dy * dy + dz * dz), 1e-6f);
+			const float radius = tapered ? strands.pointRadius[info.firstPoint] : ( strands.radius ? strands.radius[s] : m_settings.defaultRadius );
+			const float pixelWidth = 2.0f * radius * m_settings.pixelsPerUnit / distance;
+			if ( pixelWidth >= m_settings.minPixelWidth )
+				continue;
+
+			const float keepRatio = std::max(pixelWidth / m_settings.minPixelWidth, m_settings.minKeepRatio);
+			if ( HashToUnit(s) >= keepRatio )
+				info.segments = 0;
+			else if ( m_settings.compensateRadius )
+				info.radiusScale = 1.0f / keepRatio;
+		}
+		inputSegments += batchSegments;
+	});
+	if ( !valid )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	////// place the strands in the chunks, allocate the buffers //////
+
+	struct ChunkSize
+	{
+		size_t segments = 0;
+		size_t curves = 0;
+	};
+	std::vector<ChunkSize> chunkSizes;
+	for(StrandInfo& info : infos)
+	{
+		if ( info.segments == 0 )
+			continue;
+		if ( chunkSizes.empty() || ( chunkSizes.back().segments > 0 && chunkSizes.back().segments + info.segments > m_settings.maxSegmentsPerCurve ) )
+			chunkSizes.push_back(ChunkSize());
+
+		ChunkSize& size = chunkSizes.back();
+		info.chunk = (rpr_uint)(chunkSizes.size() - 1);
+		info.firstSegment = (rpr_uint)size.segments;
+		info.curve = (rpr_uint)size.curves;
+		size.segments += info.segments;
+		size.curves++;
+	}
+
+	// each curve has 3 * segments + 1 control points
+	chunks.resize(chunkSizes.size());
+	for(size_t c=0; c<chunks.size(); c++)
+	{
+		const ChunkSize& size = chunkSizes[c];
+		Chunk& chunk = chunks[c];
+		chunk.controlPoints.resize(3 * (3 * size.segments + size.curves));
+		chunk.indices.resize(4 * size.segments);
+		chunk.radius.resize(tapered ? 2 * size.segments : size.curves);
+		chunk.uvs.resize(2 * size.curves);
+		chunk.segmentsPerCurve.resize(size.curves);
+		chunk.tapered = tapered;
+	}
+
+	////// convert the strands to Bezier segments //////
+
+	ParallelFor(numBatches, numThreads, [&](size_t batch)
+	{
+		const size_t strandEnd = std::min(strands.count, (batch + 1) * STRAND_BATCH);
+		for(size_t s=batch*STRAND_BATCH; s<strandEnd; s++)
+		{
+			const StrandInfo& info = infos[s];
+			if ( info.segments == 0 )
+				continue;
+
+			Chunk& chunk = chunks[info.chunk];
+			const rpr_uint numStrandPoints = strands.pointCounts[s];
+			const rpr_uint firstControlPoint = 3 * info.firstSegment + info.curve;
+			const float* points = strands.points + 3 * info.firstPoint;
+			float* controlPoints = &chunk.controlPoints[3 * firstControlPoint];
+
+			if ( basis == BASIS_BEZIER )
+			{
+				std::copy(points, points + 3 * numStrandPoints, controlPoints);
+			}
+			else
+			{
+				for(rpr_uint i=0; i<info.segments; i++)
+				{
+					const float* p0 = points + 3 * (i > 0 ? i - 1 : 0);
+					const float* p1 = points + 3 * i;
+					const float* p2 = points + 3 * (i + 1);
+					const float* p3 = points + 3 * std::min(i + 2, numStrandPoints - 1);
+					float* segment = controlPoints + 9 * i;
+					StorePoint(segment, p1);
+					if ( basis == BASIS_LINEAR )
+					{
+						StoreOffsetPoint(segment + 3, p1, p2, p1, 1.0f / 3.0f);
+						StoreOffsetPoint(segment + 6, p1, p2, p1, 2.0f / 3.0f);
+					}
+					else
+					{
+						// Catmull-Rom tangents, clamped at the ends
+						StoreOffsetPoint(segment + 3, p1, p2, p0, 1.0f / 6.0f);
+						StoreOffsetPoint(segment + 6, p2, p1, p3, 1.0f / 6.0f);
+					}
+				}
+				StorePoint(controlPoints + 9 * info.segments, points + 3 * (numStrandPoints - 1));
+			}
+
+			rpr_uint* indices = &chunk.indices[4 * info.firstSegment];
+			for(rpr_uint i=0; i<info.segments; i++)
+			{
+				for(rpr_uint k=0; k<4; k++)
+					indices[4 * i + k] = firstControlPoint + 3 * i + k;
+			}
+
+			if ( tapered )
+			{
+				// radius at the first and last points of each segment
+				const float* pointRadius = strands.pointRadius + info.firstPoint;
+				const rpr_uint step = basis == BASIS_BEZIER ? 3 : 1;
+				float* radius = &chunk.radius[2 * info.firstSegment];
+				for(rpr_uint i=0; i<info.segments; i++)
+				{
+					radius[2 * i] = pointRadius[step * i] * info.radiusScale;
+					radius[2 * i + 1] = pointRadius[step * (i + 1)] * info.radiusScale;
+				}
+			}
+			else
+			{
+				chunk.radius[info.curve] = (strands.radius ? strands.radius[s] : m_settings.defaultRadius) * info.radiusScale;
+			}
+
+			chunk.uvs[2 * info.curve] = strands.uvs ? strands.uvs[2 * s] : 0.0f;
+			chunk.uvs[2 * info.curve + 1] = strands.uvs ? strands.uvs[2 * s + 1] : 0.0f;
+			chunk.segmentsPerCurve[info.curve] = (rpr_int)info.segments;
+		}
+	});
+
+	Stats stats;
+	stats.inputStrands = strands.count;
+	stats.curves = chunks.size();
+	for(size_t c=0; c<chunks.size(); c++)
+	{
+		const Chunk& chunk = chunks[c];
+		stats.keptStrands += chunkSizes[c].curves;
+		stats.segments += chunkSizes[c].segments;
+		stats.controlPoints += chunk.controlPoints.size() / 3;
+		stats.bytes += chunk.controlPoints.size() * sizeof(float) + chunk.indices.size() * sizeof(rpr_uint) + chunk.radius.size() * sizeof(float)
+			+ chunk.uvs.size() * sizeof(float) + chunk.segmentsPerCurve.size() * sizeof(rpr_int);
+	}
+	// 50_curve: 4 control points and 4 indices per segment, radius, uv and number of segments per strand
+	const size_t radiusBytes = tapered ? 2 * inputSegments * sizeof(float) : strands.count * sizeof(float);
+	stats.naiveBytes = inputSegments * 4 * (3 * sizeof(float) + sizeof(rpr_uint)) + radiusBytes + strands.count * (2 * sizeof(float) + sizeof(rpr_int));
+	stats.generateSeconds = SecondsSince(start);
+	m_stats = stats;
+
+	return RPR_SUCCESS;
+}
+
+rpr_status RPRCurveBuilder::Build(rpr_context context, const Strands& strands, std::vector<rpr_curve>& curves)
+{
+	curves.clear();
+	if ( !context )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	std::vector<Chunk> chunks;
+	rpr_status status = Generate(strands, chunks);
+	if ( status != RPR_SUCCESS )
+		return status;
+
+	const auto start = std::chrono::steady_clock::now();
+	for(Chunk& chunk : chunks)
+	{
+		rpr_curve curve = nullptr;
+		status = rprContextCreateCurve(context, &curve,
+			chunk.controlPoints.size() / 3, chunk.controlPoints.data(), 3 * sizeof(float),
+			chunk.indices.size(), (rpr_uint)chunk.segmentsPerCurve.size(), chunk.indices.data(),
+			chunk.radius.data(), chunk.uvs.data(), chunk.segmentsPerCurve.data(),
+			chunk.tapered ? 1 : 0);
+		if ( status != RPR_SUCCESS )
+			break;
+		curves.push_back(curve);
+
+		// the buffers are copied by rprContextCreateCurve
+		chunk = Chunk();
+	}
+	m_stats.createSeconds = SecondsSince(start);
+
+	if ( status != RPR_SUCCESS )
+	{
+		for(rpr_curve curve : curves)
+			rprObjectDelete(curve);
+		curves.clear();
+	}
+
+	return status;
+}
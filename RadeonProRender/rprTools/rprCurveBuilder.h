@@ -0,0 +1,149 @@
+/*****************************************************************************\
+*
+*  Module Name    rprCurveBuilder.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <RadeonProRender.h>
+
+// Builds the rpr_curve of a groom from its strands, given as arrays ( points, number of points of each strand, radius, uv ).
+//
+// The inputs of rprContextCreateCurve are generated by several threads in buffers allocated once: each strand is converted
+// to cubic Bezier segments sharing their end points ( 3 control points per segment instead of the 4 of 50_curve ), and written
+// at its offset. A groom of more than maxSegmentsPerCurve segments is split into several rpr_curve.
+//
+// Decimation: with the camera position and the pixels covered by a unit at a distance of 1, the width in pixels of each strand
+// is estimated at its root. A strand thinner than minPixelWidth is kept with the probability width / minPixelWidth ( at least
+// minKeepRatio ), from a hash of its index: the strands removed first are always the same, so the groom doesn't flicker when the
+// camera moves. The radius of the strands kept is divided by the same ratio, so the area covered on screen stays the same.
+//
+// Usage:
+//   RPRCurveBuilder::Strands strands;
+//   strands.count = numStrands;
+//   strands.pointCounts = pointsPerStrand;     // rpr_uint[count]
+//   strands.points = points;                   // float3, sum of pointCounts
+//   strands.pointCount = numPoints;
+//   strands.radius = radiusPerStrand;          // optional
+//   strands.uvs = uvPerStrand;                 // optional
+//   RPRCurveBuilder builder;
+//   std::vector<rpr_curve> curves;
+//   builder.Build(context, strands, curves);
+//   for each curve: rprCurveSetMaterial, rprSceneAttachCurve
+class RPRCurveBuilder
+{
+public:
+
+	// interpretation of the points of a strand
+	enum Basis
+	{
+		BASIS_LINEAR,       // polyline: n points, n - 1 segments
+		BASIS_CATMULL_ROM,  // smooth curve through the points: n points, n - 1 segments
+		BASIS_BEZIER,       // cubic Bezier control points, the end point of a segment starting the next one: 3 * segments + 1 points
+	};
+
+	struct Strands
+	{
+		size_t count = 0;
+
+		/// number of points of each strand, at least 2 ( 4 for BASIS_BEZIER ).
+		const rpr_uint* pointCounts = nullptr;
+
+		/// x, y, z of the points, strand after strand. pointCount is the sum of pointCounts, checked by Build.
+		const float* points = nullptr;
+		size_t pointCount = 0;
+
+		/// optional: radius of each strand. If null, Settings::defaultRadius.
+		const float* radius = nullptr;
+
+		/// optional: radius of each point. If set, the curves are tapered and radius is ignored.
+		const float* pointRadius = nullptr;
+
+		/// optional: u, v of each strand. If null, 0.
+		const float* uvs = nullptr;
+	};
+
+	struct Settings
+	{
+		Basis basis = BASIS_CATMULL_ROM;
+
+		/// Segments of one rpr_curve. A strand is never split.
+		size_t maxSegmentsPerCurve = size_t(1) << 22;
+
+		/// Threads of the generation. 0: one per hardware thread.
+		unsigned numThreads = 0;
+
+		float defaultRadius = 0.01f;
+
+		/// Decimation of the strands thinner than minPixelWidth on screen.
+		bool decimate = false;
+		float cameraPosition[3] = { 0.0f, 0.0f, 0.0f };
+
+		/// Pixels covered by a length of 1 at a distance of 1 from the camera: see GetPixelsPerUnit.
+		float pixelsPerUnit = 0.0f;
+		float minPixelWidth = 1.0f;
+		float minKeepRatio = 0.02f;
+
+		/// Scale the radius of the strands kept by 1 / ratio of strands kept.
+		bool compensateRadius = true;
+	};
+
+	struct Stats
+	{
+		size_t inputStrands = 0;
+		size_t keptStrands = 0;
+		size_t segments = 0;
+		size_t controlPoints = 0;
+		size_t curves = 0;
+
+		/// bytes given to rprContextCreateCurve, and the same for all the strands with 4 control points per segment as 50_curve.
+		size_t bytes = 0;
+		size_t naiveBytes = 0;
+
+		double generateSeconds = 0.0;
+		double createSeconds = 0.0;
+	};
+
+	/// inputs of one rprContextCreateCurve
+	struct Chunk
+	{
+		std::vector<float> controlPoints; // x, y, z
+		std::vector<rpr_uint> indices;    // 4 per segment
+		std::vector<float> radius;        // 1 per curve, or 2 per segment if tapered
+		std::vector<float> uvs;           // 2 per curve
+		std::vector<rpr_int> segmentsPerCurve;
+		bool tapered = false;
+	};
+
+	/// pixelsPerUnit of a camera: focal length and sensor height in mm ( RPR_CAMERA_FOCAL_LENGTH, RPR_CAMERA_SENSOR_SIZE ), image height in pixels.
+	static float GetPixelsPerUnit(float focalLength, float sensorHeight, unsigned imageHeight);
+
+	RPRCurveBuilder(const Settings& settings);
+	RPRCurveBuilder();
+
+	RPRCurveBuilder(const RPRCurveBuilder&) = delete;
+	RPRCurveBuilder& operator=(const RPRCurveBuilder&) = delete;
+
+	/// Generate the inputs of rprContextCreateCurve: one chunk per rpr_curve.
+	/// Returns RPR_ERROR_INVALID_PARAMETER if the strands are not consistent.
+	rpr_status Generate(const Strands& strands, std::vector<Chunk>& chunks);
+
+	/// Generate, then create one rpr_curve per chunk. On failure, the curves already created are deleted.
+	rpr_status Build(rpr_context context, const Strands& strands, std::vector<rpr_curve>& curves);
+
+	Stats GetStats() const { return m_stats; }
+
+private:
+
+	Settings m_settings;
+	Stats m_stats;
+};
@@ -0,0 +1,444 @@
+/*****************************************************************************\
+*
+*  Module Name    rprDeformationCache.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#include "rprDeformationCache.h"
+#include "rprToolsCommon.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using rprtools::SecondsSince;
+using rprtools::ParallelFor;
+#if !defined(_WIN32)
+using rprtools::MapFile;
+using rprtools::UnmapFile;
+#endif
+
+
+namespace
+{
+
+const char MAGIC[8] = { 'R', 'P', 'R', 'D', 'E', 'F', '1', 0 };
+const size_t HEADER_BYTES = 64;
+const size_t KEY_HEADER_BYTES = 6 * sizeof(float);
+const uint32_t FLAG_NORMALS = 1;
+
+// vertices decoded by a task
+const size_t VERTEX_BATCH = 16384;
+
+template<typename T>
+T Load(const unsigned char* data)
+{
+	T value;
+	memcpy(&value, data, sizeof(T));
+	return value;
+}
+
+template<typename T>
+void Append(std::vector<unsigned char>& data, T value)
+{
+	const unsigned char* bytes = (const unsigned char*)&value;
+	data.insert(data.end(), bytes, bytes + sizeof(T));
+}
+
+uint64_t GetKeyBytes(uint64_t vertexCount, bool normals)
+{
+	const uint64_t bytes = KEY_HEADER_BYTES + vertexCount * (3 + (normals ? 2 : 0)) * sizeof(uint16_t);
+	return (bytes + 3) & ~uint64_t(3);
+}
+
+float SignNotZero(float value)
+{
+	return value >= 0.0f ? 1.0f : -1.0f;
+}
+
+uint16_t QuantizeUnit(float value)
+{
+	return (uint16_t)std::lround(std::min(std::max(value * 0.5f + 0.5f, 0.0f), 1.0f) * 65535.0f);
+}
+
+// unit vector to 2 x 16 bits: projection on the octahedron, the lower half folded over the upper half
+void EncodeNormal(const float* normal, uint16_t* encoded)
+{
+	const float sum = std::fabs(normal[0]) + std::fabs(normal[1]) + std::fabs(normal[2]);
+	float x = sum > 0.0f ? normal[0] / sum : 0.0f;
+	float y = sum > 0.0f ? normal[1] / sum : 0.0f;
+	if ( sum > 0.0f && normal[2] < 0.0f )
+	{
+		const float foldedX = (1.0f - std::fabs(y)) * SignNotZero(x);
+		const float foldedY = (1.0f - std::fabs(x)) * SignNotZero(y);
+		x = foldedX;
+		y = foldedY;
+	}
+	encoded[0] = QuantizeUnit(x);
+	encoded[1] = QuantizeUnit(y);
+}
+
+void DecodeNormal(uint16_t encodedX, uint16_t encodedY, float* normal)
+{
+	float x = encodedX * (2.0f / 65535.0f) - 1.0f;
+	float y = encodedY * (2.0f / 65535.0f) - 1.0f;
+	const float z = 1.0f - std::fabs(x) - std::fabs(y);
+	if ( z < 0.0f )
+	{
+		const float unfoldedX = (1.0f - std::fabs(y)) * SignNotZero(x);
+		const float unfoldedY = (1.0f - std::fabs(x)) * SignNotZero(y);
+		x = unfoldedX;
+		y = unfoldedY;
+	}
+	const float inverseLength = 1.0f / std::sqrt(x * x + y * y + z * z);
+	normal[0] = x * inverseLength;
+	normal[1] = y * inverseLength;
+	normal[2] = z * inverseLength;
+}
+
+}
+
+
+rpr_status RPRDeformationCache::WriteFile(const std::string& fileName, unsigned vertexCount, const float* restPositions, unsigned frameCount, unsigned keysPerFrame,
+	bool normals, const KeyFunction& function, float* maxError)
+{
+	if ( vertexCount == 0 || !restPositions || frameCount == 0 || keysPerFrame == 0 || !function )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	std::ofstream file(fileName, std::ios::binary);
+	if ( !file )
+		return RPR_ERROR_IO_ERROR;
+
+	const uint64_t restOffset = HEADER_BYTES;
+	const uint64_t keysOffset = restOffset + (uint64_t)vertexCount * 3 * sizeof(float);
+	const uint64_t keyBytes = GetKeyBytes(vertexCount, normals);
+
+	std::vector<unsigned char> header;
+	header.insert(header.end(), MAGIC, MAGIC + sizeof(MAGIC));
+	Append<uint32_t>(header, vertexCount);
+	Append<uint32_t>(header, frameCount);
+	Append<uint32_t>(header, keysPerFrame);
+	Append<uint32_t>(header, normals ? FLAG_NORMALS : 0);
+	Append<uint64_t>(header, restOffset);
+	Append<uint64_t>(header, keysOffset);
+	Append<uint64_t>(header, keyBytes);
+	Append<uint64_t>(header, 0);
+	Append<uint64_t>(header, 0);
+	file.write((const char*)header.data(), header.size());
+	file.write((const char*)restPositions, (size_t)vertexCount * 3 * sizeof(float));
+
+	// keys are written one by one: the memory doesn't depend on the number of frames
+	std::vector<float> positions((size_t)vertexCount * 3);
+	std::vector<float> keyNormals(normals ? (size_t)vertexCount * 3 : 0);
+	std::vector<unsigned char> key;
+	float error = 0.0f;
+	for(unsigned frame=0; frame<frameCount; frame++)
+	{
+		for(unsigned k=0; k<keysPerFrame; k++)
+		{
+			std::copy(restPositions, restPositions + positions.size(), positions.begin());
+			function(frame, k, positions.data(), normals ? keyNormals.data() : nullptr);
+
+			// range of the deltas on each axis
+			float minimum[3] = { 0.0f, 0.0f, 0.0f };
+			float maximum[3] = { 0.0f, 0.0f, 0.0f };
+			for(size_t v=0; v<vertexCount; v++)
+			{
+				for(int a=0; a<3; a++)
+				{
+					const float delta = positions[3 * v + a] - restPositions[3 * v + a];
+					minimum[a] = v == 0 ? delta : std::min(minimum[a], delta);
+					maximum[a] = v == 0 ? delta : std::max(maximum[a], delta);
+				}
+			}
+			float step[3];
+			for(int a=0; a<3; a++)
+				step[a] = (maximum[a] - minimum[a]) / 65535.0f;
+
+			key.clear();
+			for(int a=0; a<3; a++)
+				Append<float>(key, minimum[a]);
+			for(int a=0; a<3; a++)
+				Append<float>(key, step[a]);
+			for(size_t v=0; v<vertexCount; v++)
+			{
+				for(int a=0; a<3; a++)
+				{
+					const float delta = positions[3 * v + a] - restPositions[3 * v + a];
+					const uint16_t q = step[a] > 0.0f ? (uint16_t)std::min(std::lround((delta - minimum[a]) / step[a]), 65535L) : 0;
+					Append<uint16_t>(key, q);
+
+					const float decoded = restPositions[3 * v + a] + (minimum[a] + q * step[a]);
+					error = std::max(error, std::fabs(decoded - positions[3 * v + a]));
+				}
+			}
+			if ( normals )
+			{
+				for(size_t v=0; v<vertexCount; v++)
+				{
+					uint16_t encoded[2];
+					EncodeNormal(&keyNormals[3 * v], encoded);
+					Append<uint16_t>(key, encoded[0]);
+					Append<uint16_t>(key, encoded[1]);
+				}
+			}
+			key.resize((size_t)keyBytes, 0);
+			file.write((const char*)key.data(), key.size());
+		}
+	}
+
+	file.close();
+	if ( !file )
+		return RPR_ERROR_IO_ERROR;
+
+	if ( maxError )
+		*maxError = error;
+	return RPR_SUCCESS;
+}
+
+RPRDeformationCache::RPRDeformationCache(const Settings& settings)
+	: m_settings(settings)
+{
+}
+
+RPRDeformationCache::RPRDeformationCache()
+	: RPRDeformationCache(Settings())
+{
+}
+
+RPRDeformationCache::~RPRDeformationCache()
+{
+	Close();
+}
+
+void RPRDeformationCache::Close()
+{
+#if !defined(_WIN32)
+	UnmapFile(m_mapped, m_size);
+#endif
+	m_mapped = nullptr;
+	m_size = 0;
+	m_fileName.clear();
+	m_frameBuffer.clear();
+	m_vertexCount = 0;
+	m_frameCount = 0;
+	m_keysPerFrame = 0;
+	m_normals = false;
+	m_restPositions.clear();
+}
+
+rpr_status RPRDeformationCache::Open(const std::string& fileName)
+{
+	Close();
+
+	// the header and the rest pose are read from the mapped file, or from the file
+	std::vector<unsigned char> header(HEADER_BYTES);
+	std::ifstream file;
+#if !defined(_WIN32)
+	// the frames are read in order, each frame once
+	if ( m_settings.useMmap )
+		m_mapped = MapFile(fileName, m_size, rprtools::MAP_ACCESS_SEQUENTIAL);
+	if ( m_mapped )
+	{
+		if ( m_size >= HEADER_BYTES )
+			memcpy(header.data(), m_mapped, HEADER_BYTES);
+	}
+	else
+#endif
+	{
+		file.open(fileName, std::ios::binary | std::ios::ate);
+		if ( !file )
+			return RPR_ERROR_IO_ERROR;
+		m_size = (size_t)file.tellg();
+		file.seekg(0);
+		if ( m_size >= HEADER_BYTES )
+			file.read((char*)header.data(), HEADER_BYTES);
+	}
+
+	const unsigned char* data = header.data();
+	const uint32_t flags = Load<uint32_t>(data + 20);
+	const uint64_t restOffset = Load<uint64_t>(data + 24);
+	m_vertexCount = Load<uint32_t>(data + 8);
+	m_frameCount = Load<uint32_t>(data + 12);
+	m_keysPerFrame = Load<uint32_t>(data + 16);
+	m_normals = (flags & FLAG_NORMALS) != 0;
+	m_keysOffset = Load<uint64_t>(data + 32);
+	m_keyBytes = Load<uint64_t>(data + 40);
+
+	// the rest pose and the keys must be inside the file; written as divisions, so that the sizes can't overflow
+	const uint64_t numKeys = (uint64_t)m_frameCount * m_keysPerFrame;
+	const bool valid = m_size >= HEADER_BYTES && memcmp(data, MAGIC, sizeof(MAGIC)) == 0
+		&& m_vertexCount > 0 && numKeys > 0
+		&& m_keyBytes == GetKeyBytes(m_vertexCount, m_normals)
+		&& restOffset <= m_size && m_vertexCount <= (m_size - restOffset) / (3 * sizeof(float))
+		&& m_keysOffset <= m_size && numKeys <= (m_size - m_keysOffset) / m_keyBytes;
+	if ( !valid )
+	{
+		Close();
+		return RPR_ERROR_IO_ERROR;
+	}
+
+	m_restPositions.resize((size_t)m_vertexCount * 3);
+	if ( m_mapped )
+		memcpy(m_restPositions.data(), (const unsigned char*)m_mapped + restOffset, m_restPositions.size() * sizeof(float));
+	else
+	{
+		file.seekg((std::streamoff)restOffset);
+		if ( !file.read((char*)m_restPositions.data(), m_restPositions.size() * sizeof(float)) )
+		{
+			Close();
+			return RPR_ERROR_IO_ERROR;
+		}
+	}
+
+	m_fileName = fileName;
+	m_stats = Stats();
+	m_stats.fileBytes = m_size;
+	m_stats.rawBytes = (size_t)(numKeys * m_vertexCount * (m_normals ? 6 : 3) * sizeof(float));
+	return RPR_SUCCESS;
+}
+
+const unsigned char* RPRDeformationCache::GetKeys(unsigned frame)
+{
+	const uint64_t frameBytes = m_keyBytes * m_keysPerFrame;
+	const uint64_t offset = m_keysOffset + frame * frameBytes;
+
+#if !defined(_WIN32)
+	if ( m_mapped )
+	{
+		// read the next frame in the background while this one is decoded
+		if ( frame + 1 < m_frameCount )
+		{
+			const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+			const size_t nextBegin = (size_t)(offset + frameBytes) & ~(pageSize - 1);
+			const size_t nextEnd = std::min(m_size, (size_t)(offset + 2 * frameBytes));
+			madvise((unsigned char*)m_mapped + nextBegin, nextEnd - nextBegin, MADV_WILLNEED);
+		}
+		return (const unsigned char*)m_mapped + offset;
+	}
+#endif
+
+	std::ifstream file(m_fileName, std::ios::binary);
+	m_frameBuffer.resize((size_t)frameBytes);
+	file.seekg((std::streamoff)offset);
+	if ( !file || !file.read((char*)m_frameBuffer.data(), m_frameBuffer.size()) )
+		return nullptr;
+	return m_frameBuffer.data();
+}
+
+rpr_status RPRDeformationCache::DecodeFrame(unsigned frame, float* positions, float* normals)
+{
+	if ( m_vertexCount == 0 || frame >= m_frameCount || !positions )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	const auto start = std::chrono::steady_clock::now();
+	const unsigned char* keys = GetKeys(frame);
+	if ( !keys )
+		return RPR_ERROR_IO_ERROR;
+
+	// each task decodes a range of vertices of a key, directly at its place in the arrays of the mesh
+	const size_t vertexCount = m_vertexCount;
+	const size_t batchesPerKey = (vertexCount + VERTEX_BATCH - 1) / VERTEX_BATCH;
+	const size_t numTasks = batchesPerKey * m_keysPerFrame;
+	const bool decodeNormals = m_normals && normals;
+	const float* rest = m_restPositions.data();
+	const uint64_t keyBytes = m_keyBytes;
+
+	const unsigned numThreads = m_settings.numThreads ? m_settings.numThreads : std::max(1u, std::thread::hardware_concurrency());
+	ParallelFor(numTasks, numThreads, [&](size_t task)
+	{
+		const size_t k = task / batchesPerKey;
+		const size_t vertexBegin = (task % batchesPerKey) * VERTEX_BATCH;
+		const size_t vertexEnd = std::min(vertexCount, vertexBegin + VERTEX_BATCH);
+		const unsigned char* key = keys + k * keyBytes;
+
+		float minimum[3];
+		float step[3];
+		memcpy(minimum, key, sizeof(minimum));
+		memcpy(step, key + sizeof(minimum), sizeof(step));
+
+		const unsigned char* q = key + KEY_HEADER_BYTES;
+		float* keyPositions = positions + k * vertexCount * 3;
+		for(size_t i=3*vertexBegin; i<3*vertexEnd; i++)
+		{
+			const size_t a = i % 3;
+			keyPositions[i] = rest[i] + (minimum[a] + Load<uint16_t>(q + 2 * i) * step[a]);
+		}
+
+		if ( decodeNormals )
+		{
+			const unsigned char* encoded = q + vertexCount * 3 * sizeof(uint16_t);
+			float* keyNormals = normals + k * vertexCount * 3;
+			for(size_t v=vertexBegin; v<vertexEnd; v++)
+				DecodeNormal(Load<uint16_t>(encoded + 4 * v), Load<uint16_t>(encoded + 4 * v + 2), keyNormals + 3 * v);
+		}
+	});
+
+	m_stats.framesDecoded++;
+	m_stats.decodeSeconds += SecondsSince(start);
+	return RPR_SUCCESS;
+}
+
+rpr_status RPRDeformationCache::CreateMesh(rpr_context context, unsigned frame, const Topology& topology, rpr_shape* mesh)
+{
+	if ( !context || !mesh || !topology.indices || !topology.faceVertexCounts || topology.faceCount == 0 )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	// all the keys of the frame: keysPerFrame * vertexCount vertices, as in 13_deformation_motion_blur
+	const size_t meshVertexCount = (size_t)m_keysPerFrame * m_vertexCount;
+	m_positions.resize(meshVertexCount * 3);
+	m_meshNormals.resize(m_normals ? meshVertexCount * 3 : 0);
+	rpr_status status = DecodeFrame(frame, m_positions.data(), m_normals ? m_meshNormals.data() : nullptr);
+	if ( status != RPR_SUCCESS )
+		return status;
+
+	// the uvs are repeated for each key, like the positions
+	if ( topology.texcoords )
+	{
+		m_texcoords.resize(meshVertexCount * 2);
+		for(unsigned k=0; k<m_keysPerFrame; k++)
+			std::copy(topology.texcoords, topology.texcoords + (size_t)m_vertexCount * 2, m_texcoords.begin() + (size_t)k * m_vertexCount * 2);
+	}
+
+	rpr_mesh_info properties[3];
+	properties[0] = (rpr_mesh_info)RPR_MESH_MOTION_DIMENSION;
+	properties[1] = (rpr_mesh_info)m_keysPerFrame;
+	properties[2] = (rpr_mesh_info)0;
+
+	const rpr_float* texcoords[] = { m_texcoords.data() };
+	size_t texcoordCounts[] = { meshVertexCount };
+	rpr_int texcoordStrides[] = { 2 * sizeof(float) };
+	const rpr_int* texcoordIndices[] = { topology.indices };
+	rpr_int texcoordIndexStrides[] = { sizeof(rpr_int) };
+	const bool hasTexcoords = topology.texcoords != nullptr;
+
+	const auto start = std::chrono::steady_clock::now();
+	status = rprContextCreateMeshEx2(context,
+		m_positions.data(), meshVertexCount, 3 * sizeof(float),
+		m_normals ? m_meshNormals.data() : nullptr, m_normals ? meshVertexCount : 0, 3 * sizeof(float),
+		nullptr, 0, 0,
+		hasTexcoords ? 1 : 0, hasTexcoords ? texcoords : nullptr, hasTexcoords ? texcoordCounts : nullptr, hasTexcoords ? texcoordStrides : nullptr,
+		topology.indices, sizeof(rpr_int),
+		m_normals ? topology.indices : nullptr, m_normals ? sizeof(rpr_int) : 0,
+		hasTexcoords ? texcoordIndices : nullptr, hasTexcoords ? texcoordIndexStrides : nullptr,
+		topology.faceVertexCounts, topology.faceCount, properties, mesh);
+	m_stats.createSeconds += SecondsSince(start);
+
+	return status;
+}
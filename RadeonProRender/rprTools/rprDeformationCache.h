@@ -0,0 +1,149 @@
+/*****************************************************************************\
+*
+*  Module Name    rprDeformationCache.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <RadeonProRender.h>
+
+// Cache of deformation motion blur keys ( RPR_MESH_MOTION_DIMENSION, see 13_deformation_motion_blur ) for cloth and character
+// animations, stored as 16-bit deltas from the rest pose instead of full float arrays.
+//
+// Each key stores, per axis, the minimum and the step of its deltas to the rest pose, then 3 x uint16 per vertex, and optionally
+// its normals in the octahedral encoding ( 2 x uint16 per vertex ): 6 or 10 bytes per vertex and key instead of 12 or 24.
+// The file is memory-mapped: DecodeFrame only reads the keys of the frame, decodes them with several threads directly in the
+// layout of rprContextCreateMeshEx2 ( all the vertices of key 0, then of key 1... ), and asks the system to read the keys of the
+// next frame in advance. CreateMesh decodes into buffers reused from frame to frame, and creates the mesh of the frame.
+//
+// File format, little endian, offsets in bytes from the start of the file:
+//   header, 64 bytes:
+//     char     magic[8]        "RPRDEF1" and a zero
+//     uint32   vertexCount
+//     uint32   frameCount
+//     uint32   keysPerFrame
+//     uint32   flags           1: the keys have normals
+//     uint64   restOffset      float3 positions of the rest pose
+//     uint64   keysOffset      frameCount * keysPerFrame keys, frame after frame
+//     uint64   keyBytes        size of a key, multiple of 4
+//     uint64   reserved[2]     0
+//   key:
+//     float    minimum[3]      delta = minimum + q * step, per axis
+//     float    step[3]
+//     uint16   q[vertexCount * 3]
+//     uint16   normals[vertexCount * 2] if flags & 1
+//
+// Usage:
+//   RPRDeformationCache cache;
+//   cache.Open("character.rprdef");
+//   for each frame:
+//       rpr_shape mesh = nullptr;
+//       cache.CreateMesh(context, frame, topology, &mesh); // the mesh of the previous frame can be deleted
+//
+// The functions must be called from one thread at a time.
+class RPRDeformationCache
+{
+public:
+
+	struct Settings
+	{
+		/// Threads of DecodeFrame. 0: one per hardware thread.
+		unsigned numThreads = 0;
+
+		/// Memory-map the file ( Linux/macOS ). If false, or on Windows, the keys of each frame are read from the file.
+		bool useMmap = true;
+	};
+
+	/// Faces of the mesh created by CreateMesh. The indices point to the vertices of the rest pose, for the positions, the normals and the uvs.
+	struct Topology
+	{
+		const rpr_int* indices = nullptr;
+		const rpr_int* faceVertexCounts = nullptr;
+		size_t faceCount = 0;
+
+		/// optional: u, v of each vertex of the rest pose.
+		const float* texcoords = nullptr;
+	};
+
+	struct Stats
+	{
+		size_t framesDecoded = 0;
+
+		/// size of the file, and of the same keys as float positions ( and normals ).
+		size_t fileBytes = 0;
+		size_t rawBytes = 0;
+
+		double decodeSeconds = 0.0;
+		double createSeconds = 0.0;
+	};
+
+	/// Fill the positions ( and the normals, if not null ) of a key of a frame: x, y, z per vertex.
+	typedef std::function<void(unsigned frame, unsigned key, float* positions, float* normals)> KeyFunction;
+
+	/// Write a cache of the format above. Returns RPR_ERROR_IO_ERROR if the file can't be written. maxError, if not null, receives
+	/// the largest quantization error of the positions.
+	static rpr_status WriteFile(const std::string& fileName, unsigned vertexCount, const float* restPositions, unsigned frameCount, unsigned keysPerFrame,
+		bool normals, const KeyFunction& function, float* maxError = nullptr);
+
+	RPRDeformationCache(const Settings& settings);
+	RPRDeformationCache();
+	~RPRDeformationCache();
+
+	RPRDeformationCache(const RPRDeformationCache&) = delete;
+	RPRDeformationCache& operator=(const RPRDeformationCache&) = delete;
+
+	/// Returns RPR_ERROR_IO_ERROR if the file can't be read or is not valid.
+	rpr_status Open(const std::string& fileName);
+	void Close();
+
+	unsigned GetVertexCount() const { return m_vertexCount; }
+	unsigned GetFrameCount() const { return m_frameCount; }
+	unsigned GetKeysPerFrame() const { return m_keysPerFrame; }
+	bool HasNormals() const { return m_normals; }
+
+	/// Decode the keys of frame: GetKeysPerFrame() * GetVertexCount() x, y, z in positions, and in normals if not null and HasNormals().
+	rpr_status DecodeFrame(unsigned frame, float* positions, float* normals);
+
+	/// Decode frame and create its mesh, with RPR_MESH_MOTION_DIMENSION = GetKeysPerFrame().
+	rpr_status CreateMesh(rpr_context context, unsigned frame, const Topology& topology, rpr_shape* mesh);
+
+	Stats GetStats() const { return m_stats; }
+
+private:
+
+	const unsigned char* GetKeys(unsigned frame);
+
+	Settings m_settings;
+	std::string m_fileName;
+
+	// file mapped, or keys of one frame read into m_frameBuffer
+	void* m_mapped = nullptr;
+	size_t m_size = 0;
+	std::vector<unsigned char> m_frameBuffer;
+
+	unsigned m_vertexCount = 0;
+	unsigned m_frameCount = 0;
+	unsigned m_keysPerFrame = 0;
+	bool m_normals = false;
+	uint64_t m_keysOffset = 0;
+	uint64_t m_keyBytes = 0;
+	std::vector<float> m_restPositions;
+
+	// buffers of CreateMesh
+	std::vector<float> m_positions;
+	std::vector<float> m_meshNormals;
+	std::vector<float> m_texcoords;
+
+	Stats m_stats;
+};
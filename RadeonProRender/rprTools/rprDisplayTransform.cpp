@@ -0,0 +1,369 @@
+/*****************************************************************************\
+*
+*  Module Name    rprDisplayTransform.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#include "rprDisplayTransform.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define RPR_DISPLAYTRANSFORM_SSE 1
+#else
+#define RPR_DISPLAYTRANSFORM_SSE 0
+#endif
+
+
+namespace
+{
+
+// the shaper has one entry every 2^kShaperShift float bits: 256 entries per power of 2.
+const int kShaperShift = 15;
+
+// rows converted by a thread, at least
+const unsigned kMinRowsPerThread = 16;
+
+// 8x8 Bayer matrix: ordered thresholds in [0,64[
+const unsigned char kBayer8[8][8] = {
+	{  0, 32,  8, 40,  2, 34, 10, 42 },
+	{ 48, 16, 56, 24, 50, 18, 58, 26 },
+	{ 12, 44,  4, 36, 14, 46,  6, 38 },
+	{ 60, 28, 52, 20, 62, 30, 54, 22 },
+	{  3, 35, 11, 43,  1, 33,  9, 41 },
+	{ 51, 19, 59, 27, 49, 17, 57, 25 },
+	{ 15, 47,  7, 39, 13, 45,  5, 37 },
+	{ 63, 31, 55, 23, 61, 29, 53, 21 },
+};
+
+int32_t FloatBits(float value)
+{
+	int32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+float BitsFloat(int32_t bits)
+{
+	float value;
+	std::memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+// largest power of 2 <= value, value > 0
+float FloorPowerOf2(float value)
+{
+	return BitsFloat(FloatBits(value) & 0x7F800000);
+}
+
+float CeilPowerOf2(float value)
+{
+	const float floor = FloorPowerOf2(value);
+	return floor == value ? value : floor * 2.0f;
+}
+
+unsigned char Quantize(float value, float threshold)
+{
+	// a NaN result of the baked function fails the comparison and gives 0 ( the NaN pixels are sent to the point 0 by Shape )
+	const float scaled = value * 255.0f + threshold;
+	if ( !(scaled > 0.0f) )
+		return 0;
+	if ( scaled >= 255.0f )
+		return 255;
+	return (unsigned char)scaled;
+}
+
+// weighted sum of 4 corners of the LUT, written to result[0..2]
+inline void Blend(const float* c0, const float* c1, const float* c2, const float* c3, float w0, float w1, float w2, float w3, float* result)
+{
+#if RPR_DISPLAYTRANSFORM_SSE
+	__m128 sum = _mm_mul_ps(_mm_loadu_ps(c0), _mm_set1_ps(w0));
+	sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(c1), _mm_set1_ps(w1)));
+	sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(c2), _mm_set1_ps(w2)));
+	sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(c3), _mm_set1_ps(w3)));
+	float rgba[4];
+	_mm_storeu_ps(rgba, sum);
+	result[0] = rgba[0];
+	result[1] = rgba[1];
+	result[2] = rgba[2];
+#else
+	for(int i=0; i<3; i++)
+		result[i] = c0[i] * w0 + c1[i] * w1 + c2[i] * w2 + c3[i] * w3;
+#endif
+}
+
+// linear interpolation between the corners c0 and c1, for the trilinear interpolation
+inline void Lerp(const float* c0, const float* c1, float t, float* result)
+{
+#if RPR_DISPLAYTRANSFORM_SSE
+	const __m128 a = _mm_loadu_ps(c0);
+	const __m128 b = _mm_loadu_ps(c1);
+	_mm_storeu_ps(result, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), _mm_set1_ps(t))));
+#else
+	for(int i=0; i<4; i++)
+		result[i] = c0[i] + (c1[i] - c0[i]) * t;
+#endif
+}
+
+}
+
+
+RPRDisplayTransform::ColorFunction RPRDisplayTransform::ExposureGamma(float exposure, float gamma)
+{
+	const float invGamma = 1.0f / gamma;
+	return [exposure, invGamma](float* rgb, size_t numPixels)
+	{
+		for(size_t i=0; i<numPixels*3; i++)
+			rgb[i] = std::pow(std::max(rgb[i] * exposure, 0.0f), invGamma);
+	};
+}
+
+RPRDisplayTransform::RPRDisplayTransform(const Settings& settings) :
+	m_settings(settings)
+{
+}
+
+RPRDisplayTransform::RPRDisplayTransform() :
+	RPRDisplayTransform(Settings())
+{
+}
+
+rpr_status RPRDisplayTransform::Bake(const ColorFunction& function)
+{
+	const unsigned n = m_settings.lutSize;
+	if ( !function || n < 3 || n > 256 || !(m_settings.shaperMin > 0.0f) || !(m_settings.shaperMax > m_settings.shaperMin) || !std::isfinite(m_settings.shaperMax) )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	const float shaperMin = FloorPowerOf2(m_settings.shaperMin);
+	const float shaperMax = CeilPowerOf2(m_settings.shaperMax);
+	const double log2Min = std::log2((double)shaperMin);
+	const double log2Range = std::log2((double)shaperMax) - log2Min;
+
+	// the point 0 of each axis is 0, the points 1 to n-1 are spaced by the log2 shaper between shaperMin and shaperMax
+	m_shaperMin = shaperMin;
+	m_invShaperMin = 1.0f / shaperMin;
+
+	// shaper: float bits -> LUT coordinate in [1, n-1]. The entries are exact log2, the lookup is linear between them.
+	m_shaperMinBits = FloatBits(shaperMin);
+	m_shaperMaxBits = FloatBits(shaperMax);
+	const size_t shaperSize = (size_t)((m_shaperMaxBits - m_shaperMinBits) >> kShaperShift) + 2;
+	m_shaper.resize(shaperSize);
+	for(size_t i=0; i<shaperSize; i++)
+	{
+		const float x = BitsFloat(m_shaperMinBits + (int32_t)(i << kShaperShift));
+		const double u = (std::log2((double)x) - log2Min) / log2Range;
+		m_shaper[i] = (float)(1.0 + std::min(u, 1.0) * (n - 2));
+	}
+
+	// LUT: the inverse of the shaper on each grid point, transformed by function in one call
+	std::vector<float> axis(n);
+	axis[0] = 0.0f;
+	for(unsigned i=1; i<n; i++)
+		axis[i] = (float)std::exp2(log2Min + log2Range * (i - 1) / (n - 2));
+
+	const size_t numPoints = (size_t)n * n * n;
+	std::vector<float> rgb(numPoints * 3);
+	for(size_t b=0, i=0; b<n; b++)
+	{
+		for(size_t g=0; g<n; g++)
+		{
+			for(size_t r=0; r<n; r++, i++)
+			{
+				rgb[i*3+0] = axis[r];
+				rgb[i*3+1] = axis[g];
+				rgb[i*3+2] = axis[b];
+			}
+		}
+	}
+	function(rgb.data(), numPoints);
+
+	m_lut.resize(numPoints * 4);
+	for(size_t i=0; i<numPoints; i++)
+	{
+		m_lut[i*4+0] = rgb[i*3+0];
+		m_lut[i*4+1] = rgb[i*3+1];
+		m_lut[i*4+2] = rgb[i*3+2];
+		m_lut[i*4+3] = 0.0f;
+	}
+
+	return RPR_SUCCESS;
+}
+
+float RPRDisplayTransform::Shape(float value) const
+{
+	// toe: linear between the point 0 ( value 0 ) and the point 1 ( shaperMin ). NaN and the negatives go to the point 0.
+	if ( !(value > m_shaperMin) )
+		return value > 0.0f ? value * m_invShaperMin : 0.0f;
+
+	// the positive floats are ordered like their bits: clamping the bits clamps the value
+	int32_t bits = FloatBits(value);
+	bits = bits > m_shaperMaxBits ? m_shaperMaxBits : bits;
+
+	const int32_t relative = bits - m_shaperMinBits;
+	const int32_t index = relative >> kShaperShift;
+	const float t = (float)(relative & ((1 << kShaperShift) - 1)) * (1.0f / (1 << kShaperShift));
+	return m_shaper[index] + (m_shaper[index + 1] - m_shaper[index]) * t;
+}
+
+void RPRDisplayTransform::LookUp(const float* rgb, float* result) const
+{
+	const int n = (int)m_settings.lutSize;
+	const float x = Shape(rgb[0]);
+	const float y = Shape(rgb[1]);
+	const float z = Shape(rgb[2]);
+
+	// base corner clamped to n-2 so that the +1 corners exist, the fraction reaches 1 at the last point
+	const int ix = std::min((int)x, n - 2);
+	const int iy = std::min((int)y, n - 2);
+	const int iz = std::min((int)z, n - 2);
+	const float fx = x - ix;
+	const float fy = y - iy;
+	const float fz = z - iz;
+
+	const size_t dx = 4;
+	const size_t dy = (size_t)n * 4;
+	const size_t dz = (size_t)n * n * 4;
+	const float* c000 = &m_lut[((size_t)iz * n + iy) * n * 4 + ix * 4];
+	const float* c111 = c000 + dx + dy + dz;
+
+	if ( m_settings.interpolation == INTERPOLATION_TETRAHEDRAL )
+	{
+		// the cube is split in 6 tetrahedra along its diagonal: the path from c000 to c111 follows the axes by decreasing fraction.
+		// The tetrahedron is selected by the comparisons of the fractions ( 2 of the 8 combinations can't happen ), without branches.
+		static const unsigned char kLargest[8] = { 2, 1, 1, 1, 2, 0, 0, 0 };
+		static const unsigned char kMiddle[8]  = { 1, 0, 2, 0, 0, 2, 1, 1 };
+		const float f[3] = { fx, fy, fz };
+		const size_t step[3] = { dx, dy, dz };
+		const int order = (fx > fy ? 4 : 0) | (fy > fz ? 2 : 0) | (fx > fz ? 1 : 0);
+		const int largest = kLargest[order];
+		const int middle = kMiddle[order];
+		const int smallest = 3 - largest - middle;
+		const float* c1 = c000 + step[largest];
+		const float* c2 = c1 + step[middle];
+		Blend(c000, c1, c2, c111, 1.0f - f[largest], f[largest] - f[middle], f[middle] - f[smallest], f[smallest], result);
+	}
+	else
+	{
+		float c00[4], c10[4], c01[4], c11[4], c0[4], c1[4], c[4];
+		Lerp(c000,           c000 + dx,           fx, c00);
+		Lerp(c000 + dy,      c000 + dx + dy,      fx, c10);
+		Lerp(c000 + dz,      c000 + dx + dz,      fx, c01);
+		Lerp(c000 + dy + dz, c111,                fx, c11);
+		Lerp(c00, c10, fy, c0);
+		Lerp(c01, c11, fy, c1);
+		Lerp(c0, c1, fz, c);
+		result[0] = c[0];
+		result[1] = c[1];
+		result[2] = c[2];
+	}
+}
+
+template<typename Output>
+rpr_status RPRDisplayTransform::ApplyRows(const float* pixels, unsigned numChannels, unsigned width, unsigned height, const Output& output) const
+{
+	if ( !IsBaked() || !pixels || (numChannels != 3 && numChannels != 4) )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	auto convertRows = [&](unsigned rowBegin, unsigned rowEnd)
+	{
+		float rgb[3];
+		for(unsigned y=rowBegin; y<rowEnd; y++)
+		{
+			const float* src = pixels + (size_t)y * width * numChannels;
+			for(unsigned x=0; x<width; x++, src += numChannels)
+			{
+				LookUp(src, rgb);
+				output(x, y, rgb);
+			}
+		}
+	};
+
+	unsigned numThreads = m_settings.numThreads ? m_settings.numThreads : std::thread::hardware_concurrency();
+	numThreads = std::max(1u, std::min(numThreads, height / kMinRowsPerThread));
+
+	// one band of consecutive rows per thread, the calling thread converts the first one
+	std::vector<std::thread> threads;
+	const unsigned rowsPerThread = (height + numThreads - 1) / numThreads;
+	for(unsigned i=1; i<numThreads; i++)
+	{
+		const unsigned rowBegin = std::min(i * rowsPerThread, height);
+		const unsigned rowEnd = std::min(rowBegin + rowsPerThread, height);
+		threads.emplace_back(convertRows, rowBegin, rowEnd);
+	}
+	convertRows(0, std::min(rowsPerThread, height));
+	for(auto& thread : threads)
+		thread.join();
+
+	return RPR_SUCCESS;
+}
+
+rpr_status RPRDisplayTransform::Apply(const float* pixels, unsigned numChannels, unsigned width, unsigned height, unsigned char* rgb8) const
+{
+	if ( !rgb8 )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	if ( m_settings.dither )
+	{
+		return ApplyRows(pixels, numChannels, width, height, [=](unsigned x, unsigned y, const float* rgb) {
+			const float threshold = (kBayer8[y & 7][x & 7] + 0.5f) * (1.0f / 64.0f);
+			unsigned char* dst = rgb8 + ((size_t)y * width + x) * 3;
+			dst[0] = Quantize(rgb[0], threshold);
+			dst[1] = Quantize(rgb[1], threshold);
+			dst[2] = Quantize(rgb[2], threshold);
+		});
+	}
+
+	return ApplyRows(pixels, numChannels, width, height, [=](unsigned x, unsigned y, const float* rgb) {
+		unsigned char* dst = rgb8 + ((size_t)y * width + x) * 3;
+		dst[0] = Quantize(rgb[0], 0.5f);
+		dst[1] = Quantize(rgb[1], 0.5f);
+		dst[2] = Quantize(rgb[2], 0.5f);
+	});
+}
+
+rpr_status RPRDisplayTransform::ApplyFloat(const float* pixels, unsigned numChannels, unsigned width, unsigned height, float* rgb) const
+{
+	if ( !rgb )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	return ApplyRows(pixels, numChannels, width, height, [=](unsigned x, unsigned y, const float* value) {
+		float* dst = rgb + ((size_t)y * width + x) * 3;
+		dst[0] = value[0];
+		dst[1] = value[1];
+		dst[2] = value[2];
+	});
+}
+
+rpr_status RPRDisplayTransform::ApplyToFrameBuffer(rpr_framebuffer framebuffer, std::vector<unsigned char>& rgb8, unsigned& width, unsigned& height) const
+{
+	rpr_framebuffer_desc desc = {};
+	rpr_status status = rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_DESC, sizeof(desc), &desc, nullptr);
+	if ( status != RPR_SUCCESS )
+		return status;
+
+	size_t size = 0;
+	status = rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_DATA, 0, nullptr, &size);
+	if ( status != RPR_SUCCESS )
+		return status;
+	if ( size != (size_t)desc.fb_width * desc.fb_height * 4 * sizeof(float) )
+		return RPR_ERROR_UNSUPPORTED;
+
+	std::vector<float> pixels(size / sizeof(float));
+	status = rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_DATA, size, pixels.data(), nullptr);
+	if ( status != RPR_SUCCESS )
+		return status;
+
+	width = desc.fb_width;
+	height = desc.fb_height;
+	rgb8.resize((size_t)width * height * 3);
+	return Apply(pixels.data(), 4, width, height, rgb8.data());
+}
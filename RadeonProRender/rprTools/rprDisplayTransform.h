@@ -0,0 +1,107 @@
+/*****************************************************************************\
+*
+*  Module Name    rprDisplayTransform.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <RadeonProRender.h>
+
+// Converts scene-linear framebuffers to 8-bit display pixels through a baked 3D LUT.
+//
+// Bake evaluates the display transform of a look ( an OCIO processor, exposure, gamma... ) once, on the points of a 3D LUT.
+// The LUT is indexed through a 1D log2 shaper, so that its points are spread over the HDR range instead of [0,1].
+// Apply then converts each pixel with a shaper lookup and a trilinear or tetrahedral interpolation of the LUT,
+// on several threads ( one band of rows per thread ), and quantizes the result to 8-bit with an ordered dithering.
+//
+// Usage:
+//   RPRDisplayTransform displayTransform;
+//   displayTransform.Bake( [&](float* rgb, size_t numPixels) { ocioCpuProcessor->apply(OCIO::PackedImageDesc(rgb, numPixels, 1, 3)); } );
+//   for each frame:
+//       displayTransform.ApplyToFrameBuffer(framebuffer, pixels, width, height);
+//
+// The first point of each axis of the LUT is 0, so that black stays black: the values between 0 and shaperMin are interpolated
+// linearly from it. NaN and the negative values are sent to 0, the values above shaperMax are clamped to it.
+class RPRDisplayTransform
+{
+public:
+
+	enum Interpolation
+	{
+		INTERPOLATION_TRILINEAR,
+		INTERPOLATION_TETRAHEDRAL,
+	};
+
+	struct Settings
+	{
+		/// Number of points of the LUT on each axis, at least 3: the point 0, then lutSize-1 points between shaperMin and shaperMax.
+		unsigned lutSize = 33;
+
+		/// Scene-linear range covered by the shaper, rounded to powers of 2.
+		float shaperMin = 1.0f / 16384.0f;
+		float shaperMax = 256.0f;
+
+		Interpolation interpolation = INTERPOLATION_TETRAHEDRAL;
+
+		/// Ordered dithering before the quantization to 8-bit, instead of rounding.
+		bool dither = true;
+
+		/// Threads used by Apply. 0: one per hardware thread.
+		unsigned numThreads = 0;
+	};
+
+	/// Display transform of numPixels RGB pixels, in place.
+	typedef std::function<void(float* rgb, size_t numPixels)> ColorFunction;
+
+	/// pow(rgb * exposure, 1/gamma): the transform used without OCIO.
+	static ColorFunction ExposureGamma(float exposure, float gamma);
+
+	RPRDisplayTransform(const Settings& settings);
+	RPRDisplayTransform();
+
+	RPRDisplayTransform(const RPRDisplayTransform&) = delete;
+	RPRDisplayTransform& operator=(const RPRDisplayTransform&) = delete;
+
+	/// Evaluate function on the points of the LUT. Must be called again when the look changes.
+	/// Returns RPR_ERROR_INVALID_PARAMETER if the settings are not valid.
+	rpr_status Bake(const ColorFunction& function);
+
+	bool IsBaked() const { return !m_lut.empty(); }
+
+	/// Convert width x height pixels of numChannels floats ( 3 or 4, alpha is ignored ) into rgb8 ( width x height x 3 bytes ).
+	/// Returns RPR_ERROR_INVALID_PARAMETER if Bake was not called.
+	rpr_status Apply(const float* pixels, unsigned numChannels, unsigned width, unsigned height, unsigned char* rgb8) const;
+
+	/// Same as Apply without the quantization: rgb receives width x height x 3 floats.
+	rpr_status ApplyFloat(const float* pixels, unsigned numChannels, unsigned width, unsigned height, float* rgb) const;
+
+	/// Read the RGBA float data of framebuffer and convert it with Apply.
+	rpr_status ApplyToFrameBuffer(rpr_framebuffer framebuffer, std::vector<unsigned char>& rgb8, unsigned& width, unsigned& height) const;
+
+private:
+
+	template<typename Output>
+	rpr_status ApplyRows(const float* pixels, unsigned numChannels, unsigned width, unsigned height, const Output& output) const;
+
+	float Shape(float value) const;
+	void LookUp(const float* rgb, float* result) const;
+
+	Settings m_settings;
+
+	float m_shaperMin = 0.0f;
+	float m_invShaperMin = 0.0f;
+	int32_t m_shaperMinBits = 0;
+	int32_t m_shaperMaxBits = 0;
+	std::vector<float> m_shaper; // LUT coordinate, for each step of the float bits between shaperMin and shaperMax
+	std::vector<float> m_lut;    // lutSize^3 RGB values, padded to 4 floats. Red varies fastest.
+};
@@ -0,0 +1,402 @@
+/*****************************************************************************\
+*
+*  Module Name    rprMeshInstancer.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#include "rprMeshInstancer.h"
+#include "rprRprsBufferStore.h"
+#include "rprToolsCommon.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+using rprtools::SecondsSince;
+using rprtools::ParallelFor;
+
+
+namespace
+{
+
+// arrays compared, the positions first
+const rpr_mesh_info MESH_ARRAYS[] =
+{
+	RPR_MESH_VERTEX_ARRAY,
+	RPR_MESH_NORMAL_ARRAY,
+	RPR_MESH_UV_ARRAY,
+	RPR_MESH_UV2_ARRAY,
+	RPR_MESH_VERTEX_INDEX_ARRAY,
+	RPR_MESH_NORMAL_INDEX_ARRAY,
+	RPR_MESH_UV_INDEX_ARRAY,
+	RPR_MESH_UV2_INDEX_ARRAY,
+	RPR_MESH_NUM_FACE_VERTICES_ARRAY,
+};
+const size_t NUM_MESH_ARRAYS = sizeof(MESH_ARRAYS) / sizeof(MESH_ARRAYS[0]);
+
+struct MeshData
+{
+	rpr_shape shape = nullptr;
+	std::vector<unsigned char> arrays[NUM_MESH_ARRAYS];
+	size_t bytes = 0;
+
+	// positions: bytes between two vertices, 0 if they can't be read as float3
+	size_t vertexCount = 0;
+	size_t stride = 0;
+	float firstVertex[3] = { 0.0f, 0.0f, 0.0f };
+	float extent = 0.0f;
+
+	uint64_t key = 0;
+	int64_t prototype = -1; // index of the mesh this one is a copy of
+};
+
+// an array of the mesh: its size first, then its data. A missing array ( no uv2... ) is empty.
+rpr_status ReadMeshArray(rpr_shape shape, rpr_mesh_info info, std::vector<unsigned char>& data)
+{
+	data.clear();
+	size_t size = 0;
+	rpr_status status = rprMeshGetInfo(shape, info, 0, nullptr, &size);
+	if ( status != RPR_SUCCESS || size == 0 )
+		return status;
+	data.resize(size);
+	return rprMeshGetInfo(shape, info, size, data.data(), nullptr);
+}
+
+const float* GetVertex(const MeshData& mesh, size_t vertex)
+{
+	return (const float*)(mesh.arrays[0].data() + vertex * mesh.stride);
+}
+
+// positions relative to the first vertex, and size of the bounding box
+void ComputeExtent(MeshData& mesh)
+{
+	if ( mesh.stride == 0 )
+		return;
+
+	float minimum[3];
+	float maximum[3];
+	memcpy(mesh.firstVertex, GetVertex(mesh, 0), sizeof(mesh.firstVertex));
+	memcpy(minimum, mesh.firstVertex, sizeof(minimum));
+	memcpy(maximum, mesh.firstVertex, sizeof(maximum));
+	for(size_t v=1; v<mesh.vertexCount; v++)
+	{
+		const float* position = GetVertex(mesh, v);
+		for(int a=0; a<3; a++)
+		{
+			minimum[a] = std::min(minimum[a], position[a]);
+			maximum[a] = std::max(maximum[a], position[a]);
+		}
+	}
+	for(int a=0; a<3; a++)
+		mesh.extent = std::max(mesh.extent, maximum[a] - minimum[a]);
+}
+
+bool SameMesh(const MeshData& a, const MeshData& b, bool canonicalTranslation, float tolerance)
+{
+	for(size_t i=1; i<NUM_MESH_ARRAYS; i++)
+	{
+		if ( a.arrays[i] != b.arrays[i] )
+			return false;
+	}
+	if ( a.arrays[0].size() != b.arrays[0].size() )
+		return false;
+	if ( !canonicalTranslation || a.stride == 0 || a.stride != b.stride )
+		return a.arrays[0] == b.arrays[0];
+
+	// written so that a NaN is never equal
+	const float maxDifference = tolerance * std::max(a.extent, b.extent);
+	for(size_t v=0; v<a.vertexCount; v++)
+	{
+		const float* positionA = GetVertex(a, v);
+		const float* positionB = GetVertex(b, v);
+		for(int c=0; c<3; c++)
+		{
+			if ( !( std::fabs((positionA[c] - a.firstVertex[c]) - (positionB[c] - b.firstVertex[c])) <= maxDifference ) )
+				return false;
+		}
+	}
+	return true;
+}
+
+// the instance takes the place of mesh: its transform, translated to the first vertex of mesh with canonicalTranslation, its material and name
+rpr_status CreateInstance(rpr_context context, rpr_scene scene, const MeshData& mesh, const MeshData& prototype, bool canonicalTranslation, rpr_shape& instance)
+{
+	// transform as stored by the shape, given back to rprShapeSetTransform without transpose: the translation is in 12, 13, 14
+	float transform[16] = { 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1 };
+	rpr_status status = rprShapeGetInfo(mesh.shape, RPR_SHAPE_TRANSFORM, sizeof(transform), transform, nullptr);
+	if ( status != RPR_SUCCESS )
+		return status;
+	if ( canonicalTranslation && mesh.stride != 0 && prototype.stride != 0 )
+	{
+		const float offset[3] = { mesh.firstVertex[0] - prototype.firstVertex[0], mesh.firstVertex[1] - prototype.firstVertex[1], mesh.firstVertex[2] - prototype.firstVertex[2] };
+		for(int c=0; c<4; c++)
+			transform[12 + c] += offset[0] * transform[c] + offset[1] * transform[4 + c] + offset[2] * transform[8 + c];
+	}
+
+	rpr_material_node material = nullptr;
+	status = rprShapeGetInfo(mesh.shape, RPR_SHAPE_MATERIAL, sizeof(material), &material, nullptr);
+	if ( status != RPR_SUCCESS )
+		return status;
+
+	std::vector<char> name;
+	size_t nameSize = 0;
+	if ( rprShapeGetInfo(mesh.shape, RPR_SHAPE_NAME, 0, nullptr, &nameSize) == RPR_SUCCESS && nameSize > 1 )
+	{
+		name.resize(nameSize);
+		if ( rprShapeGetInfo(mesh.shape, RPR_SHAPE_NAME, nameSize, name.data(), nullptr) != RPR_SUCCESS )
+			name.clear();
+	}
+
+	status = rprContextCreateInstance(context, prototype.shape, &instance);
+	if ( status != RPR_SUCCESS )
+		return status;
+
+	status = rprShapeSetTransform(instance, RPR_FALSE, transform);
+	if ( status == RPR_SUCCESS && material )
+		status = rprShapeSetMaterial(instance, material);
+	if ( status == RPR_SUCCESS && !name.empty() )
+	{
+		name.back() = 0;
+		status = rprObjectSetName(instance, name.data());
+	}
+	if ( status == RPR_SUCCESS )
+		status = rprSceneAttachShape(scene, instance);
+	if ( status == RPR_SUCCESS )
+	{
+		status = rprSceneDetachShape(scene, mesh.shape);
+		if ( status != RPR_SUCCESS )
+			rprSceneDetachShape(scene, instance);
+	}
+	if ( status != RPR_SUCCESS )
+	{
+		rprObjectDelete(instance);
+		instance = nullptr;
+	}
+	return status;
+}
+
+// a list of shapes: RPR_SCENE_SHAPE_LIST or RPR_CONTEXT_LIST_CREATED_SHAPES, read by getInfo(size, data, sizeRet)
+template<typename GetInfo>
+rpr_status ReadShapeList(const GetInfo& getInfo, std::vector<rpr_shape>& shapes)
+{
+	size_t size = 0;
+	rpr_status status = getInfo(0, nullptr, &size);
+	if ( status != RPR_SUCCESS )
+		return status;
+	shapes.resize(size / sizeof(rpr_shape));
+	if ( shapes.empty() )
+		return RPR_SUCCESS;
+	return getInfo(shapes.size() * sizeof(rpr_shape), shapes.data(), nullptr);
+}
+
+// the shapes used as RPR_INSTANCE_PARENT_SHAPE by the instances among shapes
+void AddInstanceParents(const std::vector<rpr_shape>& shapes, std::unordered_set<rpr_shape>& parents)
+{
+	for(rpr_shape shape : shapes)
+	{
+		rpr_shape_type type = RPR_SHAPE_TYPE_MESH;
+		if ( !shape || rprShapeGetInfo(shape, RPR_SHAPE_TYPE, sizeof(type), &type, nullptr) != RPR_SUCCESS || type != RPR_SHAPE_TYPE_INSTANCE )
+			continue;
+		rpr_shape parent = nullptr;
+		if ( rprShapeGetInfo(shape, (rpr_shape_info)RPR_INSTANCE_PARENT_SHAPE, sizeof(parent), &parent, nullptr) == RPR_SUCCESS && parent )
+			parents.insert(parent);
+	}
+}
+
+}
+
+
+RPRMeshInstancer::RPRMeshInstancer(const Settings& settings)
+	: m_settings(settings)
+{
+}
+
+RPRMeshInstancer::RPRMeshInstancer()
+	: RPRMeshInstancer(Settings())
+{
+}
+
+rpr_status RPRMeshInstancer::Process(rpr_context context, rpr_scene scene)
+{
+	if ( !scene )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	std::vector<rpr_shape> shapes;
+	const rpr_status status = ReadShapeList([scene](size_t size, void* data, size_t* sizeRet)
+	{
+		return rprSceneGetInfo(scene, RPR_SCENE_SHAPE_LIST, size, data, sizeRet);
+	}, shapes);
+	if ( status != RPR_SUCCESS )
+		return status;
+	return Process(context, scene, shapes);
+}
+
+rpr_status RPRMeshInstancer::Process(rpr_context context, rpr_scene scene, const std::vector<rpr_shape>& shapes)
+{
+	m_replacements.clear();
+	m_stats = Stats();
+	if ( !context || !scene )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	const bool canonicalTranslation = m_settings.canonicalTranslation;
+	const unsigned numThreads = m_settings.numThreads ? m_settings.numThreads : std::max(1u, std::thread::hardware_concurrency());
+
+	////// read the arrays of the meshes //////
+
+	// the API is called from this thread only
+	auto start = std::chrono::steady_clock::now();
+	std::vector<MeshData> meshes;
+	meshes.reserve(shapes.size());
+	for(rpr_shape shape : shapes)
+	{
+		rpr_shape_type type = RPR_SHAPE_TYPE_MESH;
+		if ( !shape || rprShapeGetInfo(shape, RPR_SHAPE_TYPE, sizeof(type), &type, nullptr) != RPR_SUCCESS || type != RPR_SHAPE_TYPE_MESH )
+			continue;
+
+		MeshData mesh;
+		mesh.shape = shape;
+		if ( rprMeshGetInfo(shape, RPR_MESH_VERTEX_COUNT, sizeof(mesh.vertexCount), &mesh.vertexCount, nullptr) != RPR_SUCCESS || mesh.vertexCount == 0 )
+			continue;
+		bool valid = true;
+		for(size_t i=0; i<NUM_MESH_ARRAYS && valid; i++)
+		{
+			const rpr_status arrayStatus = ReadMeshArray(shape, MESH_ARRAYS[i], mesh.arrays[i]);
+			valid = arrayStatus == RPR_SUCCESS || i != 0;
+			mesh.bytes += mesh.arrays[i].size();
+		}
+		if ( !valid || mesh.arrays[0].empty() )
+			continue;
+
+		const size_t stride = mesh.arrays[0].size() / mesh.vertexCount;
+		if ( stride >= 3 * sizeof(float) && stride % sizeof(float) == 0 && stride * mesh.vertexCount == mesh.arrays[0].size() )
+			mesh.stride = stride;
+
+		m_stats.meshBytes += mesh.bytes;
+		meshes.push_back(std::move(mesh));
+	}
+	m_stats.meshes = meshes.size();
+	m_stats.readSeconds = SecondsSince(start);
+
+	////// hash //////
+
+	// with canonicalTranslation, the positions are compared with a tolerance and can't be hashed: only their number is
+	start = std::chrono::steady_clock::now();
+	ParallelFor(meshes.size(), numThreads, [&](size_t m)
+	{
+		MeshData& mesh = meshes[m];
+		const bool hashPositions = !canonicalTranslation || mesh.stride == 0;
+		uint64_t key = mesh.arrays[0].size();
+		for(size_t i=hashPositions?0:1; i<NUM_MESH_ARRAYS; i++)
+			key = (key ^ RPRRprsBufferStore::Hash(mesh.arrays[i].data(), mesh.arrays[i].size())) * 0x9E3779B97F4A7C15ull + i;
+		mesh.key = key;
+		if ( canonicalTranslation )
+			ComputeExtent(mesh);
+	});
+
+	std::unordered_map<uint64_t, std::vector<size_t>> buckets;
+	for(size_t m=0; m<meshes.size(); m++)
+		buckets[meshes[m].key].push_back(m);
+	std::vector<const std::vector<size_t>*> candidates;
+	for(const auto& it : buckets)
+	{
+		if ( it.second.size() > 1 )
+			candidates.push_back(&it.second);
+	}
+	m_stats.hashSeconds = SecondsSince(start);
+
+	////// compare //////
+
+	// in each bucket, a mesh is a copy of the first earlier mesh it is equal to, else a prototype
+	start = std::chrono::steady_clock::now();
+	const float tolerance = m_settings.tolerance;
+	ParallelFor(candidates.size(), numThreads, [&](size_t b)
+	{
+		std::vector<size_t> prototypes;
+		for(size_t m : *candidates[b])
+		{
+			for(size_t p : prototypes)
+			{
+				if ( SameMesh(meshes[p], meshes[m], canonicalTranslation, tolerance) )
+				{
+					meshes[m].prototype = (int64_t)p;
+					break;
+				}
+			}
+			if ( meshes[m].prototype < 0 )
+				prototypes.push_back(m);
+		}
+	});
+	m_stats.compareSeconds = SecondsSince(start);
+
+	////// replace //////
+
+	// a copy used as the parent of an instance ( of the context, else of the scene and shapes ) is only detached: deleting it would break the instance
+	start = std::chrono::steady_clock::now();
+	std::unordered_set<rpr_shape> instanceParents;
+	if ( m_settings.deleteDuplicates && !candidates.empty() )
+	{
+		auto getContextShapes = [context](size_t size, void* data, size_t* sizeRet)
+		{
+			return rprContextGetInfo(context, RPR_CONTEXT_LIST_CREATED_SHAPES, size, data, sizeRet);
+		};
+		auto getSceneShapes = [scene](size_t size, void* data, size_t* sizeRet)
+		{
+			return rprSceneGetInfo(scene, RPR_SCENE_SHAPE_LIST, size, data, sizeRet);
+		};
+
+		std::vector<rpr_shape> listedShapes;
+		if ( ReadShapeList(getContextShapes, listedShapes) == RPR_SUCCESS )
+		{
+			AddInstanceParents(listedShapes, instanceParents);
+		}
+		else
+		{
+			if ( ReadShapeList(getSceneShapes, listedShapes) == RPR_SUCCESS )
+				AddInstanceParents(listedShapes, instanceParents);
+			AddInstanceParents(shapes, instanceParents);
+		}
+	}
+
+	rpr_status status = RPR_SUCCESS;
+	for(size_t m=0; m<meshes.size() && status == RPR_SUCCESS; m++)
+	{
+		const MeshData& mesh = meshes[m];
+		if ( mesh.prototype < 0 )
+			continue;
+
+		const MeshData& prototype = meshes[(size_t)mesh.prototype];
+		Replacement replacement;
+		status = CreateInstance(context, scene, mesh, prototype, canonicalTranslation, replacement.instance);
+		if ( status != RPR_SUCCESS )
+			break;
+
+		replacement.mesh = mesh.shape;
+		replacement.prototype = prototype.shape;
+		if ( m_settings.deleteDuplicates && !instanceParents.count(mesh.shape) )
+		{
+			rprObjectDelete(mesh.shape);
+			replacement.deleted = true;
+		}
+		m_replacements.push_back(replacement);
+		m_stats.instances++;
+		if ( replacement.deleted )
+			m_stats.savedBytes += mesh.bytes;
+		else
+			m_stats.detachedBytes += mesh.bytes;
+	}
+	m_stats.uniqueMeshes = m_stats.meshes - m_stats.instances;
+	m_stats.replaceSeconds = SecondsSince(start);
+
+	return status;
+}
@@ -0,0 +1,116 @@
+/*****************************************************************************\
+*
+*  Module Name    rprMeshInstancer.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <RadeonProRender.h>
+
+// Replaces the duplicated meshes of a scene by instances of one of them, after an import ( ImportOBJ, rprImportFromGLTF,
+// rprsImport ) creating a separate rpr_shape for each copy of the same part, like the bolts and screws of a CAD assembly.
+//
+// The arrays of the meshes are read with rprMeshGetInfo, then hashed by several threads: positions, normals, uvs, indices and
+// number of vertices per face. The meshes with the same hash are compared by several threads, and each copy of a mesh is
+// replaced by an instance of the first one ( rprContextCreateInstance ), with the transform and the material of the copy.
+//
+// With canonicalTranslation, the positions are compared relative to the first vertex, so that the copies exported with their
+// vertices in world space are also found: the instance receives the transform of the copy, translated by the offset of its
+// first vertex. Only the translation is handled, the copies rotated or scaled in their vertices are kept as meshes.
+// The positions are then compared with a tolerance, relative to the size of the mesh: a copy may be missed, never a different mesh merged.
+//
+// Only the transform, the material and the name of a copy are given to its instance: the other properties of the shape
+// ( visibility flags, subdivision, per face materials... ) must be set after the pass. The motion dimension is not compared.
+// The shapes of an RPRScenePool are shared and must not be processed. A copy used as RPR_INSTANCE_PARENT_SHAPE by an instance
+// of the context ( of the scene and the processed shapes if the context can't list its shapes ) is only detached, never deleted.
+//
+// Usage:
+//   ImportOBJ / rprImportFromGLTF / rprsImport ... into scene
+//   RPRMeshInstancer instancer;
+//   instancer.Process(context, scene);
+//   for each replacement of instancer.GetReplacements(): forget replacement.mesh if replacement.deleted, keep replacement.instance to delete it later.
+//
+// The functions must be called from one thread at a time.
+class RPRMeshInstancer
+{
+public:
+
+	struct Settings
+	{
+		/// Compare the positions relative to the first vertex, for the copies with their vertices in world space.
+		bool canonicalTranslation = true;
+
+		/// With canonicalTranslation: largest difference of a coordinate, relative to the size of the bounding box of the mesh.
+		float tolerance = 1e-5f;
+
+		/// Delete the meshes replaced by instances. If false, they are only detached from the scene. The parents of instances are never deleted.
+		bool deleteDuplicates = true;
+
+		/// Threads of the hash and the comparison. 0: one per hardware thread.
+		unsigned numThreads = 0;
+	};
+
+	/// a mesh replaced by an instance of prototype. The instance is attached to the scene and owned by the caller.
+	struct Replacement
+	{
+		rpr_shape mesh = nullptr;
+		rpr_shape prototype = nullptr;
+		rpr_shape instance = nullptr;
+
+		/// mesh was deleted. If false, it's only detached from the scene and still owned by the caller:
+		/// deleteDuplicates is false, or mesh is the parent of an instance.
+		bool deleted = false;
+	};
+
+	struct Stats
+	{
+		size_t meshes = 0;
+		size_t uniqueMeshes = 0;
+		size_t instances = 0;
+
+		/// bytes of the arrays of all the meshes read.
+		size_t meshBytes = 0;
+		/// bytes of the arrays of the meshes replaced by instances and deleted.
+		size_t savedBytes = 0;
+		/// bytes of the arrays of the meshes replaced by instances but only detached: still in memory until the caller deletes them.
+		size_t detachedBytes = 0;
+
+		double readSeconds = 0.0;
+		double hashSeconds = 0.0;
+		double compareSeconds = 0.0;
+		double replaceSeconds = 0.0;
+	};
+
+	RPRMeshInstancer(const Settings& settings);
+	RPRMeshInstancer();
+
+	RPRMeshInstancer(const RPRMeshInstancer&) = delete;
+	RPRMeshInstancer& operator=(const RPRMeshInstancer&) = delete;
+
+	/// Process the meshes attached to the scene ( RPR_SCENE_SHAPE_LIST ).
+	rpr_status Process(rpr_context context, rpr_scene scene);
+
+	/// Process the given shapes, attached to scene: for example the shapes listed by rprsListImportedShapes. The instances are skipped.
+	/// On failure, the replacements already done are kept and listed by GetReplacements.
+	rpr_status Process(rpr_context context, rpr_scene scene, const std::vector<rpr_shape>& shapes);
+
+	/// replacements of the last Process, in the order of the shapes.
+	const std::vector<Replacement>& GetReplacements() const { return m_replacements; }
+
+	Stats GetStats() const { return m_stats; }
+
+private:
+
+	Settings m_settings;
+	std::vector<Replacement> m_replacements;
+	Stats m_stats;
+};
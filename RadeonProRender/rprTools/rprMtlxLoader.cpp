@@ -12,15 +12,203 @@
 #include "rprMtlxLoader.h"
 
 #include <MaterialXFormat/Util.h> // mx::loadLibraries
+#include <MaterialXFormat/XmlIo.h> // mx::writeToXmlString
 
+#include <algorithm>
+#include <atomic>
 #include <map>
+#include <mutex>
+#include <thread>
 #include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
 #include <unordered_set>
 
+#include <sys/stat.h>
+
 namespace mx = MaterialX;
 
 namespace {
 
+//------------------------------------------------------------------------------
+// Recording of the RPR calls, for the compiled-material cache, the shared nodes and the batch loading
+//------------------------------------------------------------------------------
+
+/// Final state of the rpr nodes created by RPRMtlxLoader::Load: type, name and last value of each input.
+struct CompiledMaterialRecorder {
+    /// When set, no rpr call is made: the nodes are placeholder handles, created later from the recorded state
+    bool isDeferred = false;
+    uintptr_t numDeferredNodes = 0;
+
+    struct Input {
+        enum Kind : uint8_t { kUInt, kFloat4, kNode };
+
+        rpr_material_node_input key;
+        Kind kind;
+        rpr_uint uintValue;
+        float floatValue[4];
+        rpr_material_node nodeValue;
+    };
+
+    struct NodeRecord {
+        rpr_material_node_type type;
+        std::string name;
+        std::vector<Input> inputs;
+    };
+    std::unordered_map<rpr_material_node, NodeRecord> nodes;
+
+    void SetInput(rpr_material_node node, Input const& input) {
+        auto it = nodes.find(node);
+        if (it == nodes.end()) {
+            return;
+        }
+        for (auto& existingInput : it->second.inputs) {
+            if (existingInput.key == input.key) {
+                existingInput = input;
+                return;
+            }
+        }
+        it->second.inputs.push_back(input);
+    }
+};
+
+/// FNV-1a
+uint64_t HashString(std::string const& value, uint64_t hash = 0xcbf29ce484222325ull) {
+    for (unsigned char c : value) {
+        hash ^= c;
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+/// Set by RPRMtlxLoader::Load and RPRMtlxLoader::LoadBatch when the rpr calls must be recorded
+thread_local CompiledMaterialRecorder* g_compiledMaterialRecorder = nullptr;
+
+bool IsRprCallDeferred() {
+    return g_compiledMaterialRecorder && g_compiledMaterialRecorder->isDeferred;
+}
+
+/// Status of a deferred call on \p node: the handle must be a live placeholder, as the core would require a live node
+rpr_status GetDeferredCallStatus(rpr_material_node node) {
+    auto& nodes = g_compiledMaterialRecorder->nodes;
+    return nodes.find(node) != nodes.end() ? RPR_SUCCESS : RPR_ERROR_INVALID_PARAMETER;
+}
+
+// All the RPR calls of the loader go through these functions
+
+rpr_status CreateRprNode(rpr_material_system matSys, rpr_material_node_type type, rpr_material_node* outNode) {
+    rpr_status status;
+    if (IsRprCallDeferred()) {
+        *outNode = reinterpret_cast<rpr_material_node>(++g_compiledMaterialRecorder->numDeferredNodes);
+        status = RPR_SUCCESS;
+    } else {
+        status = rprMaterialSystemCreateNode(matSys, type, outNode);
+    }
+    if (status == RPR_SUCCESS && g_compiledMaterialRecorder) {
+        g_compiledMaterialRecorder->nodes[*outNode] = {type};
+    }
+    return status;
+}
+
+rpr_status DeleteRprNode(rpr_material_node node) {
+    if (g_compiledMaterialRecorder) {
+        g_compiledMaterialRecorder->nodes.erase(node);
+    }
+    return IsRprCallDeferred() ? RPR_SUCCESS : rprObjectDelete(node);
+}
+
+rpr_status SetRprNodeName(rpr_material_node node, const char* name) {
+    if (g_compiledMaterialRecorder) {
+        auto it = g_compiledMaterialRecorder->nodes.find(node);
+        if (it != g_compiledMaterialRecorder->nodes.end()) {
+            it->second.name = name;
+        }
+    }
+    return IsRprCallDeferred() ? RPR_SUCCESS : rprObjectSetName(node, name);
+}
+
+rpr_status SetRprInputU(rpr_material_node node, rpr_material_node_input key, rpr_uint value) {
+    auto status = IsRprCallDeferred() ? GetDeferredCallStatus(node) : rprMaterialNodeSetInputUByKey(node, key, value);
+    if (status == RPR_SUCCESS && g_compiledMaterialRecorder) {
+        CompiledMaterialRecorder::Input input = {key, CompiledMaterialRecorder::Input::kUInt, value};
+        g_compiledMaterialRecorder->SetInput(node, input);
+    }
+    return status;
+}
+
+rpr_status SetRprInputF(rpr_material_node node, rpr_material_node_input key, float x, float y, float z, float w) {
+    auto status = IsRprCallDeferred() ? GetDeferredCallStatus(node) : rprMaterialNodeSetInputFByKey(node, key, x, y, z, w);
+    if (status == RPR_SUCCESS && g_compiledMaterialRecorder) {
+        CompiledMaterialRecorder::Input input = {key, CompiledMaterialRecorder::Input::kFloat4, 0, {x, y, z, w}};
+        g_compiledMaterialRecorder->SetInput(node, input);
+    }
+    return status;
+}
+
+rpr_status SetRprInputN(rpr_material_node node, rpr_material_node_input key, rpr_material_node value) {
+    rpr_status status;
+    if (IsRprCallDeferred()) {
+        status = GetDeferredCallStatus(node);
+        if (status == RPR_SUCCESS && value) {
+            status = GetDeferredCallStatus(value);
+        }
+    } else {
+        status = rprMaterialNodeSetInputNByKey(node, key, value);
+    }
+    if (status == RPR_SUCCESS && g_compiledMaterialRecorder) {
+        CompiledMaterialRecorder::Input input = {key, CompiledMaterialRecorder::Input::kNode, 0, {}, value};
+        g_compiledMaterialRecorder->SetInput(node, input);
+    }
+    return status;
+}
+
+//------------------------------------------------------------------------------
+// Memoized search path lookups, shared by the workers of RPRMtlxLoader::LoadBatch
+//------------------------------------------------------------------------------
+
+class FileExistenceCache {
+public:
+    /// Same result as searchPath.find(filename), but each candidate path is checked on the file system only once
+    mx::FilePath Find(mx::FileSearchPath const& searchPath, mx::FilePath const& filename) {
+        if (searchPath.isEmpty() || filename.isEmpty() || filename.isAbsolute()) {
+            return filename;
+        }
+        for (auto& path : searchPath) {
+            auto candidate = path / filename;
+            if (Exists(candidate)) {
+                return candidate;
+            }
+        }
+        return filename;
+    }
+
+private:
+    bool Exists(mx::FilePath const& path) {
+        auto pathString = path.asString();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _exists.find(pathString);
+            if (it != _exists.end()) {
+                return it->second;
+            }
+        }
+
+        bool exists = path.exists();
+        std::lock_guard<std::mutex> lock(_mutex);
+        _exists.emplace(std::move(pathString), exists);
+        return exists;
+    }
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, bool> _exists;
+};
+
+/// Set by RPRMtlxLoader::LoadBatch on its workers
+thread_local FileExistenceCache* g_fileExistenceCache = nullptr;
+
 //------------------------------------------------------------------------------
 // Direct mappings of standard mtlx nodes to RPR nodes
 //------------------------------------------------------------------------------
@@ -606,7 +794,7 @@ std::string LoaderContext::ResolveFile(std::string const& filename) {
 }
 
 std::string LoaderContext::FindFile(std::string const& filename) {
-    mx::FilePath filepath = searchPath.find(filename);
+    mx::FilePath filepath = g_fileExistenceCache ? g_fileExistenceCache->Find(searchPath, filename) : searchPath.find(filename);
     if (filepath.isEmpty()) {
         return std::string();
     }
@@ -727,9 +915,9 @@ Node* LoaderContext::GetGeomNode(mx::GeomPropDef* geomPropDef) {
 
     if (lookupValue != kInvalidLookupValue) {
         rpr_material_node apiHandle;
-        auto status = rprMaterialSystemCreateNode(rprMatSys, RPR_MATERIAL_NODE_INPUT_LOOKUP, &apiHandle);
+        auto status = CreateRprNode(rprMatSys, RPR_MATERIAL_NODE_INPUT_LOOKUP, &apiHandle);
         if (apiHandle) {
-            rprMaterialNodeSetInputUByKey(apiHandle, RPR_MATERIAL_INPUT_VALUE, lookupValue);
+            SetRprInputU(apiHandle, RPR_MATERIAL_INPUT_VALUE, lookupValue);
 
             auto geomNodeIt = geomNodes.emplace(geomPropDef->getName(), std::make_unique<RprNode>(apiHandle, true)).first;
             return geomNodeIt->second.get();
@@ -795,17 +983,17 @@ Node::Ptr Node::Create(mx::Node* mtlxNode, LoaderContext* context) {
             rpr_status SetInput(mx::Element* inputElement, std::string const& value, std::string const& valueType, LoaderContext* context) override {
                 if (inputElement->getName() == "displacement") {
                     if (rprNode && isOwningRprNode) {
-                        rprObjectDelete(rprNode);
+                        DeleteRprNode(rprNode);
                     }
 
                     rprNode = nullptr;
-                    auto status = rprMaterialSystemCreateNode(context->rprMatSys, RPR_MATERIAL_NODE_CONSTANT_TEXTURE, &rprNode);
+                    auto status = CreateRprNode(context->rprMatSys, RPR_MATERIAL_NODE_CONSTANT_TEXTURE, &rprNode);
                     if (status == RPR_SUCCESS) {
                         status = RprNode::SetInput(RPR_MATERIAL_INPUT_VALUE, value, valueType, context);
                         if (status == RPR_SUCCESS) {
                             isOwningRprNode = true;
                         } else {
-                            rprObjectDelete(rprNode);
+                            DeleteRprNode(rprNode);
                             rprNode = nullptr;
                         }
                     }
@@ -819,15 +1007,15 @@ Node::Ptr Node::Create(mx::Node* mtlxNode, LoaderContext* context) {
 
         return std::make_unique<DisplacementNode>();
     } else if (mtlxNode->getCategory() == "texcoord") {
-        rprMaterialSystemCreateNode(context->rprMatSys, RPR_MATERIAL_NODE_INPUT_LOOKUP, &rprNode);
-        rprMaterialNodeSetInputUByKey(rprNode, RPR_MATERIAL_INPUT_VALUE, RPR_MATERIAL_NODE_LOOKUP_UV);
+        CreateRprNode(context->rprMatSys, RPR_MATERIAL_NODE_INPUT_LOOKUP, &rprNode);
+        SetRprInputU(rprNode, RPR_MATERIAL_INPUT_VALUE, RPR_MATERIAL_NODE_LOOKUP_UV);
     } else if (mtlxNode->getCategory() == "normal") {
-        rprMaterialSystemCreateNode(context->rprMatSys, RPR_MATERIAL_NODE_INPUT_LOOKUP, &rprNode);
-        rprMaterialNodeSetInputUByKey(rprNode, RPR_MATERIAL_INPUT_VALUE, RPR_MATERIAL_NODE_LOOKUP_N);
+        CreateRprNode(context->rprMatSys, RPR_MATERIAL_NODE_INPUT_LOOKUP, &rprNode);
+        SetRprInputU(rprNode, RPR_MATERIAL_INPUT_VALUE, RPR_MATERIAL_NODE_LOOKUP_N);
     } else if (mtlxNode->getCategory() == "sqrt") {
-        rprMaterialSystemCreateNode(context->rprMatSys, RPR_MATERIAL_NODE_ARITHMETIC, &rprNode);
-        rprMaterialNodeSetInputUByKey(rprNode, RPR_MATERIAL_INPUT_OP, RPR_MATERIAL_NODE_OP_POW);
-        rprMaterialNodeSetInputFByKey(rprNode, RPR_MATERIAL_INPUT_COLOR1, 0.5f, 0.5f, 0.5f, 1.0f);
+        CreateRprNode(context->rprMatSys, RPR_MATERIAL_NODE_ARITHMETIC, &rprNode);
+        SetRprInputU(rprNode, RPR_MATERIAL_INPUT_OP, RPR_MATERIAL_NODE_OP_POW);
+        SetRprInputF(rprNode, RPR_MATERIAL_INPUT_COLOR1, 0.5f, 0.5f, 0.5f, 1.0f);
         static Mtlx2Rpr::Node s_sqrtMapping = {
             RPR_MATERIAL_NODE_ARITHMETIC, {
                 {"in", RPR_MATERIAL_INPUT_COLOR0}
@@ -857,8 +1045,8 @@ Node::Ptr Node::Create(mx::Node* mtlxNode, LoaderContext* context) {
             return nullptr;
         }
 
-        rprMaterialSystemCreateNode(context->rprMatSys, RPR_MATERIAL_NODE_ARITHMETIC, &rprNode);
-        rprMaterialNodeSetInputUByKey(rprNode, RPR_MATERIAL_INPUT_OP, op);
+        CreateRprNode(context->rprMatSys, RPR_MATERIAL_NODE_ARITHMETIC, &rprNode);
+        SetRprInputU(rprNode, RPR_MATERIAL_INPUT_OP, op);
 
         static Mtlx2Rpr::Node s_swizzleMapping = {
             RPR_MATERIAL_NODE_ARITHMETIC, {
@@ -911,7 +1099,7 @@ Node::Ptr Node::Create(mx::Node* mtlxNode, LoaderContext* context) {
     }
 
     if (!rprNode && rprNodeMapping) {
-        auto status = rprMaterialSystemCreateNode(context->rprMatSys, rprNodeMapping->id, &rprNode);
+        auto status = CreateRprNode(context->rprMatSys, rprNodeMapping->id, &rprNode);
         if (status != RPR_SUCCESS) {
             LOG_ERROR(context, "failed to create %s (%s) node: %d\n", mtlxNode->getName().c_str(), mtlxNode->getCategory().c_str(), status);
             return nullptr;
@@ -922,7 +1110,7 @@ Node::Ptr Node::Create(mx::Node* mtlxNode, LoaderContext* context) {
         if (rprNodeMapping->id == RPR_MATERIAL_NODE_ARITHMETIC) {
             auto it = GetMtlx2Rpr().arithmeticOps.find(mtlxNode->getCategory());
             if (it != GetMtlx2Rpr().arithmeticOps.end()) {
-                rprMaterialNodeSetInputUByKey(rprNode, RPR_MATERIAL_INPUT_OP, it->second);
+                SetRprInputU(rprNode, RPR_MATERIAL_INPUT_OP, it->second);
             } else {
                 LOG_ERROR(context, "unknown arithmetic node: %s (%s)", mtlxNode->getName().c_str(), mtlxNode->getCategory().c_str());
             }
@@ -932,7 +1120,7 @@ Node::Ptr Node::Create(mx::Node* mtlxNode, LoaderContext* context) {
     if (!rprNode) {
         return nullptr;
     }
-    rprObjectSetName(rprNode, mtlxNode->getName().c_str());
+    SetRprNodeName(rprNode, mtlxNode->getName().c_str());
 
     if (rprNodeMapping) {
         return std::make_unique<RprMappedNode>(rprNode, rprNodeMapping);
@@ -955,7 +1143,7 @@ RprWrapNode::RprWrapNode(rpr_material_node nodeToWrap, std::string const& output
     : RprNode(nullptr, true) {
     auto& wrapRprNode = rprNode;
 
-    auto status = rprMaterialSystemCreateNode(ctx->rprMatSys, RPR_MATERIAL_NODE_PASSTHROUGH, &wrapRprNode);
+    auto status = CreateRprNode(ctx->rprMatSys, RPR_MATERIAL_NODE_PASSTHROUGH, &wrapRprNode);
     if (!wrapRprNode) {
         LOG_ERROR(ctx, "Failed to create RPR_MATERIAL_NODE_PASSTHROUGH node: %d\n", status);
         throw RprApiError();
@@ -964,7 +1152,7 @@ RprWrapNode::RprWrapNode(rpr_material_node nodeToWrap, std::string const& output
     if (outputType == "color3" || outputType == "color2" ||
         outputType == "vector3" || outputType == "vector2" || outputType == "boolean" || // Should we apply here any conversions?
         outputType == "float") { // XXX: how to create rrr float3 from 1 float? Right now, it works okay because of how RprNode::SetInput implemented
-        status = rprMaterialNodeSetInputNByKey(wrapRprNode, RPR_MATERIAL_INPUT_COLOR, nodeToWrap);
+        status = SetRprInputN(wrapRprNode, RPR_MATERIAL_INPUT_COLOR, nodeToWrap);
         if (status != RPR_SUCCESS) {
             LOG_ERROR(ctx, "Failed to create set RPR_MATERIAL_NODE_PASSTHROUGH node color input: %d\n", status);
             throw RprApiError();
@@ -1306,7 +1494,7 @@ RprNode::RprNode(rpr_material_node node, bool retainNode)
 
 RprNode::~RprNode() {
     if (rprNode && isOwningRprNode) {
-        rprObjectDelete(rprNode);
+        DeleteRprNode(rprNode);
     }
 }
 
@@ -1328,25 +1516,25 @@ rpr_status RprNode::SetInput(rpr_material_node_input inputId, std::string const&
     try {
         if (valueType == "float") {
             auto value = mx::fromValueString<float>(valueString);
-            return rprMaterialNodeSetInputFByKey(rprNode, inputId, value, value, value, 0.0f);
+            return SetRprInputF(rprNode, inputId, value, value, value, 0.0f);
         } else if (
             valueType == "color2" ||
             valueType == "vector2") {
             auto value = mx::fromValueString<mx::Color2>(valueString);
-            return rprMaterialNodeSetInputFByKey(rprNode, inputId, value[0], value[1], 0.0f, 0.0f);
+            return SetRprInputF(rprNode, inputId, value[0], value[1], 0.0f, 0.0f);
         } else if (
             valueType == "color3" ||
             valueType == "vector3") {
             auto value = mx::fromValueString<mx::Color3>(valueString);
-            return rprMaterialNodeSetInputFByKey(rprNode, inputId, value[0], value[1], value[2], 0.0f);
+            return SetRprInputF(rprNode, inputId, value[0], value[1], value[2], 0.0f);
         } else if (
             valueType == "boolean") {
             auto value = static_cast<float>(mx::fromValueString<bool>(valueString));
-            return rprMaterialNodeSetInputFByKey(rprNode, inputId, value, value, value, 0.0f);
+            return SetRprInputF(rprNode, inputId, value, value, value, 0.0f);
         } else if (
             valueType == "integer") {
             auto value = static_cast<float>(mx::fromValueString<int>(valueString));
-            return rprMaterialNodeSetInputFByKey(rprNode, inputId, value, value, value, 0.0f);
+            return SetRprInputF(rprNode, inputId, value, value, value, 0.0f);
         } else {
             LOG_ERROR(context, "failed to parse %s value: unsupported type - %s\n", valueString.c_str(), valueType.c_str());
         }
@@ -1369,7 +1557,7 @@ rpr_status RprMappedNode::SetInput(mx::Element* inputElement, rpr_material_node
         return RPR_ERROR_INVALID_PARAMETER;
     }
 
-    return rprMaterialNodeSetInputNByKey(rprNode, inputIt->second, inputNode);
+    return SetRprInputN(rprNode, inputIt->second, inputNode);
 }
 
 rpr_status RprMappedNode::SetInput(mx::Element* inputElement, std::string const& valueString, std::string const& valueType, LoaderContext* context) {
@@ -1386,7 +1574,7 @@ RprImageNode::RprImageNode(LoaderContext* context)
     : RprMappedNode(
         [context]() {
             rpr_material_node node = nullptr;
-            rprMaterialSystemCreateNode(context->rprMatSys, RPR_MATERIAL_NODE_IMAGE_TEXTURE, &node);
+            CreateRprNode(context->rprMatSys, RPR_MATERIAL_NODE_IMAGE_TEXTURE, &node);
             return node;
         }(),
         []() {
@@ -1732,11 +1920,11 @@ RPRMtlxLoader::RenderableElements RPRMtlxLoader::GetRenderableElements(mx::Docum
     return elements;
 }
 
-RPRMtlxLoader::Result RPRMtlxLoader::Load(
+RPRMtlxLoader::Result RPRMtlxLoader::LoadDocument(
     MaterialX::Document const* mtlxDocument,
     const std::string inputRenderableElements[kOutputsTotal],
     MaterialX::FileSearchPath const& searchPath,
-    rpr_material_system rprMatSys) {
+    rpr_material_system rprMatSys) const {
 
     LoaderContext ctx = {};
     ctx.logEnabled = _loggingEnabled;
@@ -2048,10 +2236,1220 @@ RPRMtlxLoader::Result RPRMtlxLoader::Load(
     return ret;
 }
 
+//------------------------------------------------------------------------------
+// Shared stdlib
+//------------------------------------------------------------------------------
+
+struct RPRMtlxLoader::SharedStdlib {
+    mx::FilePathVec libraryNames;
+    mx::FileSearchPath searchPath;
+
+    /// Set if library files were found in the search path
+    bool hasLibraries = false;
+
+    /// Hash of the MaterialX version and of the path, size and modification time of the library files,
+    /// part of the compiled-material cache key. Computed without parsing the libraries
+    uint64_t version = 0;
+
+    struct Definitions {
+        mx::DocumentPtr document;
+
+        /// nodedefs by node category: all the type variants of a node are imported together
+        std::unordered_map<std::string, std::vector<mx::ConstNodeDefPtr>> nodeDefs;
+        /// implementations and nodegraphs by nodedef name
+        std::unordered_map<std::string, std::vector<mx::ConstElementPtr>> implementations;
+        std::vector<mx::ConstTypeDefPtr> typeDefs;
+    };
+
+    /// The libraries are parsed by the first call, from any thread: a loader that only reads the compiled-material cache never parses them
+    Definitions const& GetDefinitions() const;
+
+private:
+    mutable std::once_flag _parsed;
+    mutable Definitions _definitions;
+};
+
+namespace {
+
+struct SharedStdlibSlot {
+    std::once_flag loaded;
+    std::shared_ptr<const RPRMtlxLoader::SharedStdlib> stdlib;
+};
+
+std::mutex g_sharedStdlibsMutex;
+std::map<std::string, std::shared_ptr<SharedStdlibSlot>> g_sharedStdlibs;
+
+/// Finds the library files like mx::loadLibraries and hashes their path, size and modification time
+std::shared_ptr<const RPRMtlxLoader::SharedStdlib> FindSharedStdlib(mx::FilePathVec const& libraryNames, mx::FileSearchPath const& searchPath) {
+    auto stdlib = std::make_shared<RPRMtlxLoader::SharedStdlib>();
+    stdlib->libraryNames = libraryNames;
+    stdlib->searchPath = searchPath;
+
+    uint64_t version = HashString(mx::getVersionString());
+    for (auto& libraryName : libraryNames) {
+        std::vector<std::string> files;
+        for (auto& directory : searchPath.find(libraryName).getSubDirectories()) {
+            for (auto& file : directory.getFilesInDirectory(mx::MTLX_EXTENSION)) {
+                files.push_back((directory / file).asString());
+            }
+        }
+        std::sort(files.begin(), files.end());
+
+        for (auto& file : files) {
+            struct stat fileStat;
+            if (stat(file.c_str(), &fileStat) != 0) {
+                continue;
+            }
+            stdlib->hasLibraries = true;
+            version = HashString(file, version);
+            version = HashString(std::to_string(fileStat.st_size) + ":" + std::to_string(fileStat.st_mtime), version);
+        }
+    }
+    stdlib->version = version;
+    return stdlib;
+}
+
+// Same copy as mx::Document::importLibrary, for a single element. Returns nullptr if the document already has an element with this name.
+mx::ElementPtr ImportLibraryElement(mx::DocumentPtr const& document, mx::ConstElementPtr const& element, mx::ConstDocumentPtr const& library) {
+    if (document->getChild(element->getName())) {
+        return nullptr;
+    }
+
+    auto copy = document->addChildOfCategory(element->getCategory(), element->getName());
+    copy->copyContentFrom(element);
+    if (!copy->hasFilePrefix() && library->hasFilePrefix()) {
+        copy->setFilePrefix(library->getFilePrefix());
+    }
+    if (!copy->hasSourceUri() && library->hasSourceUri()) {
+        copy->setSourceUri(library->getSourceUri());
+    }
+    return copy;
+}
+
+// Add to categories the node categories used in element and its descendants
+void CollectNodeCategories(mx::Element const* element, std::unordered_set<std::string>* visited, std::vector<std::string>* categories) {
+    for (auto& child : element->getChildren()) {
+        std::string const* category = nullptr;
+        if (child->isA<mx::Node>()) {
+            category = &child->getCategory();
+        } else if (auto shaderRef = child->asA<mx::ShaderRef>()) {
+            category = &shaderRef->getNodeString();
+        }
+        if (category && !category->empty() && visited->insert(*category).second) {
+            categories->push_back(*category);
+        }
+
+        CollectNodeCategories(child.get(), visited, categories);
+    }
+}
+
+} // namespace anonymous
+
+RPRMtlxLoader::SharedStdlib::Definitions const& RPRMtlxLoader::SharedStdlib::GetDefinitions() const {
+    std::call_once(_parsed, [this]() {
+        _definitions.document = mx::createDocument();
+        mx::loadLibraries(libraryNames, searchPath, _definitions.document);
+
+        for (auto& nodeDef : _definitions.document->getNodeDefs()) {
+            _definitions.nodeDefs[nodeDef->getNodeString()].push_back(nodeDef);
+        }
+        for (auto& child : _definitions.document->getChildren()) {
+            if (child->isA<mx::Implementation>() || child->isA<mx::NodeGraph>()) {
+                auto& nodeDefName = child->getAttribute(mx::Implementation::NODE_DEF_ATTRIBUTE);
+                if (!nodeDefName.empty()) {
+                    _definitions.implementations[nodeDefName].push_back(child);
+                }
+            }
+        }
+        for (auto& typeDef : _definitions.document->getTypeDefs()) {
+            _definitions.typeDefs.push_back(typeDef);
+        }
+    });
+    return _definitions;
+}
+
 void RPRMtlxLoader::SetupStdlib(mx::FilePathVec const& libraryNames, mx::FileSearchPath const& searchPath) {
-    _stdlib = mx::createDocument();
-    auto includes = mx::loadLibraries(libraryNames, searchPath, _stdlib);
-    if (!includes.empty()) {
+    std::string key;
+    for (auto& libraryName : libraryNames) {
+        key += libraryName.asString() + "\n";
+    }
+    key += "|" + searchPath.asString();
+
+    std::shared_ptr<SharedStdlibSlot> slot;
+    {
+        std::lock_guard<std::mutex> lock(g_sharedStdlibsMutex);
+        auto& slotEntry = g_sharedStdlibs[key];
+        if (!slotEntry) {
+            slotEntry = std::make_shared<SharedStdlibSlot>();
+        }
+        slot = slotEntry;
+    }
+
+    // The other threads setting up the same libraries wait here for the first one to find them.
+    // They are parsed later, by the first loader that needs their definitions
+    //
+    std::call_once(slot->loaded, [&]() { slot->stdlib = FindSharedStdlib(libraryNames, searchPath); });
+
+    _stdlib = slot->stdlib;
+    if (_stdlib->hasLibraries) {
         _stdSearchPath.append(searchPath);
     }
 }
+
+mx::ConstDocumentPtr RPRMtlxLoader::GetStdlib() const {
+    return _stdlib ? _stdlib->GetDefinitions().document : nullptr;
+}
+
+void RPRMtlxLoader::ImportStdlibDefinitions(mx::DocumentPtr const& mtlxDocument) const {
+    if (!_stdlib || !mtlxDocument) {
+        return;
+    }
+    auto& stdlib = _stdlib->GetDefinitions();
+
+    for (auto& typeDef : stdlib.typeDefs) {
+        ImportLibraryElement(mtlxDocument, typeDef, stdlib.document);
+    }
+
+    std::unordered_set<std::string> visitedCategories;
+    std::vector<std::string> categories;
+    CollectNodeCategories(mtlxDocument.get(), &visitedCategories, &categories);
+
+    while (!categories.empty()) {
+        auto category = std::move(categories.back());
+        categories.pop_back();
+
+        auto nodeDefsIt = stdlib.nodeDefs.find(category);
+        if (nodeDefsIt == stdlib.nodeDefs.end()) {
+            continue;
+        }
+
+        for (auto& nodeDef : nodeDefsIt->second) {
+            if (!ImportLibraryElement(mtlxDocument, nodeDef, stdlib.document)) {
+                continue;
+            }
+
+            auto implementationsIt = stdlib.implementations.find(nodeDef->getName());
+            if (implementationsIt == stdlib.implementations.end()) {
+                continue;
+            }
+            for (auto& implementation : implementationsIt->second) {
+                if (ImportLibraryElement(mtlxDocument, implementation, stdlib.document) &&
+                    implementation->isA<mx::NodeGraph>()) {
+                    // nodegraph implementations are made of other stdlib nodes
+                    CollectNodeCategories(implementation.get(), &visitedCategories, &categories);
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Compiled-material cache
+//------------------------------------------------------------------------------
+
+namespace {
+
+const char kCompiledMaterialMagic[4] = {'R', 'M', 'X', 'C'};
+const uint32_t kCompiledMaterialVersion = 3;
+const uint32_t kNoNodeIndex = uint32_t(-1);
+
+class BinaryWriter {
+public:
+    void U8(uint8_t value) { _data.push_back(char(value)); }
+    void U32(uint32_t value) { Bytes(&value, sizeof(value)); }
+    void U64(uint64_t value) { Bytes(&value, sizeof(value)); }
+    void F32(float value) { Bytes(&value, sizeof(value)); }
+    void String(std::string const& value) {
+        U32(uint32_t(value.size()));
+        _data.append(value);
+    }
+    void Bytes(void const* data, size_t size) { _data.append(static_cast<const char*>(data), size); }
+
+    std::string const& GetData() const { return _data; }
+
+private:
+    std::string _data;
+};
+
+class BinaryReader {
+public:
+    BinaryReader(std::string const& data) : _data(data) {}
+
+    bool U8(uint8_t* value) { return Bytes(value, sizeof(*value)); }
+    bool U32(uint32_t* value) { return Bytes(value, sizeof(*value)); }
+    bool U64(uint64_t* value) { return Bytes(value, sizeof(*value)); }
+    bool F32(float* value) { return Bytes(value, sizeof(*value)); }
+    bool String(std::string* value) {
+        uint32_t size;
+        if (!U32(&size) || size > _data.size() - _offset) {
+            return false;
+        }
+        value->assign(_data, _offset, size);
+        _offset += size;
+        return true;
+    }
+    bool Bytes(void* data, size_t size) {
+        if (size > _data.size() - _offset) {
+            return false;
+        }
+        std::memcpy(data, _data.data() + _offset, size);
+        _offset += size;
+        return true;
+    }
+
+    bool AtEnd() const { return _offset == _data.size(); }
+    size_t GetOffset() const { return _offset; }
+
+private:
+    std::string const& _data;
+    size_t _offset = 0;
+};
+
+/// The files a compiled material was made from ( the document and the files it includes ), with their size and
+/// modification time and the hash of their content when it was compiled
+struct CompiledMaterialSources {
+    struct File {
+        std::string path;
+        uint64_t size;
+        uint64_t modificationTime;
+    };
+    std::vector<File> files;
+    uint64_t contentHash = 0;
+};
+
+bool GetFileStamp(std::string const& path, uint64_t* outSize, uint64_t* outModificationTime) {
+    struct stat fileStat;
+    if (stat(path.c_str(), &fileStat) != 0) {
+        return false;
+    }
+    *outSize = uint64_t(fileStat.st_size);
+    // In nanoseconds where the system has them: a file rewritten with the same size in the same second gets another stamp
+#if defined(__APPLE__)
+    *outModificationTime = uint64_t(fileStat.st_mtimespec.tv_sec) * 1000000000ull + uint64_t(fileStat.st_mtimespec.tv_nsec);
+#elif defined(__linux__)
+    *outModificationTime = uint64_t(fileStat.st_mtim.tv_sec) * 1000000000ull + uint64_t(fileStat.st_mtim.tv_nsec);
+#else
+    *outModificationTime = uint64_t(fileStat.st_mtime);
+#endif
+    return true;
+}
+
+bool ReadFileData(std::string const& path, std::string* outData) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    outData->assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !file.bad();
+}
+
+bool HashFileContents(std::vector<CompiledMaterialSources::File> const& files, uint64_t* outHash) {
+    uint64_t hash = HashString(std::string());
+    std::string content;
+    for (auto& file : files) {
+        if (!ReadFileData(file.path, &content)) {
+            return false;
+        }
+        hash = HashString(std::to_string(content.size()) + ":", hash);
+        hash = HashString(content, hash);
+    }
+    *outHash = hash;
+    return true;
+}
+
+/// Stamps and hashes the files \p paths. Fails if one of them can't be read
+bool GetCompiledMaterialSources(std::vector<std::string> const& paths, CompiledMaterialSources* outSources) {
+    outSources->files.resize(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        auto& file = outSources->files[i];
+        file.path = paths[i];
+        if (!GetFileStamp(file.path, &file.size, &file.modificationTime)) {
+            return false;
+        }
+    }
+    return HashFileContents(outSources->files, &outSources->contentHash);
+}
+
+void WriteCompiledMaterialHeader(std::string const& key, CompiledMaterialSources const& sources, BinaryWriter* writer) {
+    writer->Bytes(kCompiledMaterialMagic, sizeof(kCompiledMaterialMagic));
+    writer->U32(kCompiledMaterialVersion);
+    writer->String(key);
+    writer->U32(uint32_t(sources.files.size()));
+    for (auto& file : sources.files) {
+        writer->String(file.path);
+        writer->U64(file.size);
+        writer->U64(file.modificationTime);
+    }
+    writer->U64(sources.contentHash);
+}
+
+bool ReadCompiledMaterialHeader(BinaryReader* reader, std::string* outKey, CompiledMaterialSources* outSources) {
+    char magic[sizeof(kCompiledMaterialMagic)];
+    uint32_t version;
+    uint32_t numFiles;
+    if (!reader->Bytes(magic, sizeof(magic)) || std::memcmp(magic, kCompiledMaterialMagic, sizeof(magic)) != 0 ||
+        !reader->U32(&version) || version != kCompiledMaterialVersion || !reader->String(outKey) || !reader->U32(&numFiles)) {
+        return false;
+    }
+    outSources->files.clear();
+    for (uint32_t i = 0; i < numFiles; ++i) {
+        CompiledMaterialSources::File file;
+        if (!reader->String(&file.path) || !reader->U64(&file.size) || !reader->U64(&file.modificationTime)) {
+            return false;
+        }
+        outSources->files.push_back(std::move(file));
+    }
+    return reader->U64(&outSources->contentHash);
+}
+
+/// Serializes the nodes of \p result with the inputs recorded while they were created, after a header with the cache \p key
+/// and the files the material was made from. Fails if the result references nodes that were not created through the recorder
+/// or that are not in the result.
+bool SerializeCompiledMaterial(RPRMtlxLoader::Result const& result, CompiledMaterialRecorder const& recorder, std::string const& key,
+    CompiledMaterialSources const& sources, std::string* outData) {
+    std::unordered_map<rpr_material_node, uint32_t> nodeIndices;
+    for (size_t i = 0; i < result.numNodes; ++i) {
+        nodeIndices.emplace(result.nodes[i], uint32_t(i));
+    }
+    auto getNodeIndex = [&nodeIndices](rpr_material_node node, uint32_t* outIndex) {
+        if (!node) {
+            *outIndex = kNoNodeIndex;
+            return true;
+        }
+        auto it = nodeIndices.find(node);
+        if (it == nodeIndices.end()) {
+            return false;
+        }
+        *outIndex = it->second;
+        return true;
+    };
+
+    BinaryWriter writer;
+    WriteCompiledMaterialHeader(key, sources, &writer);
+
+    writer.U32(uint32_t(result.numNodes));
+    for (size_t i = 0; i < result.numNodes; ++i) {
+        auto recordIt = recorder.nodes.find(result.nodes[i]);
+        if (recordIt == recorder.nodes.end()) {
+            return false;
+        }
+        auto& record = recordIt->second;
+
+        writer.U32(record.type);
+        writer.String(record.name);
+        writer.U32(uint32_t(record.inputs.size()));
+        for (auto& input : record.inputs) {
+            writer.U32(input.key);
+            writer.U8(input.kind);
+            if (input.kind == CompiledMaterialRecorder::Input::kUInt) {
+                writer.U32(input.uintValue);
+            } else if (input.kind == CompiledMaterialRecorder::Input::kFloat4) {
+                for (float value : input.floatValue) {
+                    writer.F32(value);
+                }
+            } else {
+                uint32_t index;
+                if (!getNodeIndex(input.nodeValue, &index)) {
+                    return false;
+                }
+                writer.U32(index);
+            }
+        }
+    }
+
+    for (size_t rootNodeIndex : result.rootNodeIndices) {
+        writer.U64(rootNodeIndex);
+    }
+
+    writer.U32(uint32_t(result.numImageNodes));
+    for (size_t i = 0; i < result.numImageNodes; ++i) {
+        auto& imageNode = result.imageNodes[i];
+        uint32_t index;
+        if (!getNodeIndex(imageNode.rprNode, &index)) {
+            return false;
+        }
+        writer.String(imageNode.file);
+        writer.String(imageNode.layer);
+        writer.String(imageNode.defaultValue ? imageNode.defaultValue->getTypeString() : std::string());
+        writer.String(imageNode.defaultValue ? imageNode.defaultValue->getValueString() : std::string());
+        writer.String(imageNode.uaddressmode);
+        writer.String(imageNode.vaddressmode);
+        writer.U32(index);
+    }
+
+    *outData = writer.GetData();
+    return true;
+}
+
+/// Creates the rpr nodes described by \p data. On failure, all created nodes are released.
+/// The nodes are created through the recording functions, as if they were loaded from the document.
+bool DeserializeCompiledMaterial(std::string const& data, rpr_material_system rprMatSys, RPRMtlxLoader::Result* outResult) {
+    BinaryReader reader(data);
+
+    std::string key;
+    CompiledMaterialSources sources;
+    if (!ReadCompiledMaterialHeader(&reader, &key, &sources)) {
+        return false;
+    }
+
+    uint32_t numNodes;
+    if (!reader.U32(&numNodes) || numNodes > data.size()) {
+        return false;
+    }
+
+    std::vector<rpr_material_node> nodes;
+    nodes.reserve(numNodes);
+    auto fail = [&nodes]() {
+        for (auto node : nodes) {
+            DeleteRprNode(node);
+        }
+        return false;
+    };
+
+    struct Connection {
+        uint32_t node;
+        rpr_material_node_input key;
+        uint32_t value;
+    };
+    std::vector<Connection> connections;
+
+    for (uint32_t i = 0; i < numNodes; ++i) {
+        uint32_t type;
+        std::string name;
+        uint32_t numInputs;
+        if (!reader.U32(&type) || !reader.String(&name) || !reader.U32(&numInputs)) {
+            return fail();
+        }
+
+        rpr_material_node node = nullptr;
+        if (CreateRprNode(rprMatSys, static_cast<rpr_material_node_type>(type), &node) != RPR_SUCCESS) {
+            return fail();
+        }
+        nodes.push_back(node);
+        if (!name.empty()) {
+            SetRprNodeName(node, name.c_str());
+        }
+
+        for (uint32_t j = 0; j < numInputs; ++j) {
+            uint32_t keyValue;
+            uint8_t kind;
+            if (!reader.U32(&keyValue) || !reader.U8(&kind)) {
+                return fail();
+            }
+            auto key = static_cast<rpr_material_node_input>(keyValue);
+
+            rpr_status status = RPR_SUCCESS;
+            if (kind == CompiledMaterialRecorder::Input::kUInt) {
+                uint32_t value;
+                if (!reader.U32(&value)) {
+                    return fail();
+                }
+                status = SetRprInputU(node, key, value);
+            } else if (kind == CompiledMaterialRecorder::Input::kFloat4) {
+                float value[4];
+                if (!reader.F32(&value[0]) || !reader.F32(&value[1]) || !reader.F32(&value[2]) || !reader.F32(&value[3])) {
+                    return fail();
+                }
+                status = SetRprInputF(node, key, value[0], value[1], value[2], value[3]);
+            } else if (kind == CompiledMaterialRecorder::Input::kNode) {
+                // connected once all the nodes exist
+                uint32_t value;
+                if (!reader.U32(&value) || (value != kNoNodeIndex && value >= numNodes)) {
+                    return fail();
+                }
+                connections.push_back(Connection{i, key, value});
+            } else {
+                return fail();
+            }
+            if (status != RPR_SUCCESS) {
+                return fail();
+            }
+        }
+    }
+
+    for (auto& connection : connections) {
+        auto value = connection.value == kNoNodeIndex ? nullptr : nodes[connection.value];
+        if (SetRprInputN(nodes[connection.node], connection.key, value) != RPR_SUCCESS) {
+            return fail();
+        }
+    }
+
+    size_t rootNodeIndices[RPRMtlxLoader::kOutputsTotal];
+    for (auto& rootNodeIndex : rootNodeIndices) {
+        uint64_t value;
+        if (!reader.U64(&value) || (value != RPRMtlxLoader::Result::kInvalidRootNodeIndex && value >= numNodes)) {
+            return fail();
+        }
+        rootNodeIndex = size_t(value);
+    }
+
+    uint32_t numImageNodes;
+    if (!reader.U32(&numImageNodes) || numImageNodes > data.size()) {
+        return fail();
+    }
+    std::vector<RPRMtlxLoader::Result::ImageNode> imageNodes(numImageNodes);
+    for (auto& imageNode : imageNodes) {
+        std::string defaultValueType;
+        std::string defaultValue;
+        uint32_t index;
+        if (!reader.String(&imageNode.file) ||
+            !reader.String(&imageNode.layer) ||
+            !reader.String(&defaultValueType) ||
+            !reader.String(&defaultValue) ||
+            !reader.String(&imageNode.uaddressmode) ||
+            !reader.String(&imageNode.vaddressmode) ||
+            !reader.U32(&index) || index >= numNodes) {
+            return fail();
+        }
+        if (!defaultValueType.empty()) {
+            imageNode.defaultValue = mx::Value::createValueFromStrings(defaultValue, defaultValueType);
+        }
+        imageNode.rprNode = nodes[index];
+    }
+
+    if (!reader.AtEnd()) {
+        return fail();
+    }
+
+    if (!nodes.empty()) {
+        outResult->numNodes = nodes.size();
+        outResult->nodes = new rpr_material_node[nodes.size()];
+        std::copy(nodes.begin(), nodes.end(), outResult->nodes);
+    }
+    std::copy(std::begin(rootNodeIndices), std::end(rootNodeIndices), outResult->rootNodeIndices);
+    if (!imageNodes.empty()) {
+        outResult->numImageNodes = imageNodes.size();
+        outResult->imageNodes = new RPRMtlxLoader::Result::ImageNode[imageNodes.size()];
+        std::copy(imageNodes.begin(), imageNodes.end(), outResult->imageNodes);
+    }
+    return true;
+}
+
+/// Several loaders may store the same material at the same time: the file is written next to its final path and then renamed
+bool WriteCompiledMaterialFile(std::string const& path, std::string const& data) {
+    auto tmpPath = path + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file || !file.write(data.data(), data.size())) {
+            file.close();
+            std::remove(tmpPath.c_str());
+            return false;
+        }
+    }
+#if defined(_WIN32)
+    // std::rename doesn't replace an existing file on Windows
+    std::remove(path.c_str());
+#endif
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+/// The file name is only a 64-bit hash of \p key: the file is rejected if the key of its header is different.
+/// Its source files are only stamped: they are read and hashed when the size or the modification time of one of them changed,
+/// and the file is kept with the new stamps if their content is the same.
+bool ReadCompiledMaterialFile(std::string const& path, std::string const& key, std::string* outData) {
+    if (!ReadFileData(path, outData)) {
+        return false;
+    }
+
+    BinaryReader reader(*outData);
+    std::string fileKey;
+    CompiledMaterialSources sources;
+    if (!ReadCompiledMaterialHeader(&reader, &fileKey, &sources) || fileKey != key) {
+        return false;
+    }
+
+    bool hasSameStamps = true;
+    for (auto& file : sources.files) {
+        uint64_t size, modificationTime;
+        if (!GetFileStamp(file.path, &size, &modificationTime)) {
+            return false;
+        }
+        if (size != file.size || modificationTime != file.modificationTime) {
+            file.size = size;
+            file.modificationTime = modificationTime;
+            hasSameStamps = false;
+        }
+    }
+    if (hasSameStamps) {
+        return true;
+    }
+
+    uint64_t contentHash;
+    if (!HashFileContents(sources.files, &contentHash) || contentHash != sources.contentHash) {
+        return false;
+    }
+    BinaryWriter writer;
+    WriteCompiledMaterialHeader(key, sources, &writer);
+    *outData = writer.GetData() + outData->substr(reader.GetOffset());
+    WriteCompiledMaterialFile(path, *outData);
+    return true;
+}
+
+/// The files \p mtlxDocument was read from: its own file, then the files it includes ( source of its top-level elements ).
+/// Empty for a document made in memory
+std::vector<std::string> GetDocumentFiles(mx::Document const* mtlxDocument) {
+    std::vector<std::string> files;
+    if (mtlxDocument->getSourceUri().empty()) {
+        return files;
+    }
+    std::unordered_set<std::string> knownFiles;
+    auto addFile = [&](std::string const& file) {
+        if (!file.empty() && knownFiles.insert(file).second) {
+            files.push_back(file);
+        }
+    };
+    addFile(mtlxDocument->getSourceUri());
+    for (auto& child : mtlxDocument->getChildren()) {
+        addFile(child->getSourceUri());
+    }
+    return files;
+}
+
+} // namespace anonymous
+
+//------------------------------------------------------------------------------
+// Shared nodes
+//------------------------------------------------------------------------------
+
+class RPRMtlxLoader::SharedNodeTable {
+public:
+    /// Replaces the nodes of \p result by the equal nodes of the table and adds the others to the table.
+    /// \p recorder holds the inputs of the nodes of \p result.
+    void Share(Result* result, CompiledMaterialRecorder const& recorder, rpr_material_system rprMatSys);
+
+    void Release(rpr_material_node const* nodes, size_t numNodes);
+
+private:
+    struct Entry {
+        rpr_material_node node;
+
+        /// Number of results referencing the node
+        size_t refCount;
+    };
+    using Entries = std::unordered_map<std::string, Entry>;
+
+    struct ShareState {
+        Result* result;
+        CompiledMaterialRecorder const* recorder;
+        std::string matSysKey;
+        std::unordered_map<rpr_material_node, size_t> nodeIndices;
+        std::unordered_map<rpr_material_node, Result::ImageNode const*> imageNodes;
+        std::vector<bool> isRoot;
+
+        enum Visit : uint8_t { kUnvisited, kVisiting, kVisited };
+        std::vector<Visit> visits;
+
+        /// The node that replaces each node of the result. Null when the node can't be shared
+        std::vector<rpr_material_node> replacements;
+
+        /// Table nodes already counted in the references of the result
+        std::unordered_set<rpr_material_node> referencedNodes;
+    };
+
+    rpr_material_node Resolve(size_t index, ShareState* state);
+
+    std::mutex _mutex;
+
+    /// Structural key ( node type, inputs, replaced child nodes, image descriptor ) -> node
+    Entries _entries;
+    std::unordered_map<rpr_material_node, Entries::value_type*> _nodeEntries;
+};
+
+std::shared_ptr<RPRMtlxLoader::SharedNodeTable> RPRMtlxLoader::CreateSharedNodeTable() {
+    return std::make_shared<SharedNodeTable>();
+}
+
+namespace {
+
+template <typename T>
+void AppendKey(std::string* key, T const& value) {
+    key->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void AppendKey(std::string* key, std::string const& value) {
+    AppendKey(key, value.size());
+    key->append(value);
+}
+
+} // namespace anonymous
+
+rpr_material_node RPRMtlxLoader::SharedNodeTable::Resolve(size_t index, ShareState* state) {
+    if (state->visits[index] != ShareState::kUnvisited) {
+        // Null while visiting: a cycle can't be shared
+        return state->replacements[index];
+    }
+    state->visits[index] = ShareState::kVisiting;
+
+    auto node = state->result->nodes[index];
+    auto recordIt = state->recorder->nodes.find(node);
+    if (recordIt == state->recorder->nodes.end()) {
+        state->visits[index] = ShareState::kVisited;
+        return nullptr;
+    }
+    auto& record = recordIt->second;
+
+    // Inputs are recorded in the order they were set, the key must not depend on it
+    //
+    std::vector<CompiledMaterialRecorder::Input const*> inputs;
+    for (auto& input : record.inputs) {
+        inputs.push_back(&input);
+    }
+    std::sort(inputs.begin(), inputs.end(), [](CompiledMaterialRecorder::Input const* lhs, CompiledMaterialRecorder::Input const* rhs) {
+        return lhs->key < rhs->key;
+    });
+
+    std::string key = state->matSysKey;
+    AppendKey(&key, record.type);
+    bool isShareable = !state->isRoot[index];
+    for (auto input : inputs) {
+        AppendKey(&key, input->key);
+        AppendKey(&key, input->kind);
+        if (input->kind == CompiledMaterialRecorder::Input::kUInt) {
+            AppendKey(&key, input->uintValue);
+        } else if (input->kind == CompiledMaterialRecorder::Input::kFloat4) {
+            AppendKey(&key, input->floatValue);
+        } else if (input->nodeValue) {
+            // Connections are compared through the nodes that replace the children
+            //
+            rpr_material_node child = nullptr;
+            auto childIt = state->nodeIndices.find(input->nodeValue);
+            if (childIt != state->nodeIndices.end()) {
+                child = Resolve(childIt->second, state);
+            }
+            if (!child) {
+                isShareable = false;
+            }
+            AppendKey(&key, child);
+        } else {
+            AppendKey(&key, input->nodeValue);
+        }
+    }
+
+    auto imageNodeIt = state->imageNodes.find(node);
+    if (imageNodeIt != state->imageNodes.end()) {
+        auto imageNode = imageNodeIt->second;
+        AppendKey(&key, imageNode->file);
+        AppendKey(&key, imageNode->layer);
+        AppendKey(&key, imageNode->defaultValue ? imageNode->defaultValue->getTypeString() : std::string());
+        AppendKey(&key, imageNode->defaultValue ? imageNode->defaultValue->getValueString() : std::string());
+        AppendKey(&key, imageNode->uaddressmode);
+        AppendKey(&key, imageNode->vaddressmode);
+    }
+
+    state->visits[index] = ShareState::kVisited;
+    if (!isShareable) {
+        return nullptr;
+    }
+
+    auto entryIt = _entries.find(key);
+    if (entryIt == _entries.end()) {
+        entryIt = _entries.emplace(std::move(key), Entry{node, 0}).first;
+        _nodeEntries[node] = &*entryIt;
+    }
+    auto& entry = entryIt->second;
+    if (state->referencedNodes.insert(entry.node).second) {
+        ++entry.refCount;
+    }
+    state->replacements[index] = entry.node;
+    return entry.node;
+}
+
+void RPRMtlxLoader::SharedNodeTable::Share(Result* result, CompiledMaterialRecorder const& recorder, rpr_material_system rprMatSys) {
+    ShareState state;
+    state.result = result;
+    state.recorder = &recorder;
+    AppendKey(&state.matSysKey, rprMatSys);
+    for (size_t i = 0; i < result->numNodes; ++i) {
+        state.nodeIndices.emplace(result->nodes[i], i);
+    }
+    for (size_t i = 0; i < result->numImageNodes; ++i) {
+        state.imageNodes.emplace(result->imageNodes[i].rprNode, &result->imageNodes[i]);
+    }
+    state.isRoot.resize(result->numNodes, false);
+    for (auto rootNodeIndex : result->rootNodeIndices) {
+        if (rootNodeIndex != Result::kInvalidRootNodeIndex) {
+            state.isRoot[rootNodeIndex] = true;
+        }
+    }
+    state.visits.resize(result->numNodes, ShareState::kUnvisited);
+    state.replacements.resize(result->numNodes, nullptr);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (size_t i = 0; i < result->numNodes; ++i) {
+        Resolve(i, &state);
+    }
+
+    auto getReplacement = [&state](size_t index) {
+        auto replacement = state.replacements[index];
+        return replacement ? replacement : state.result->nodes[index];
+    };
+
+    // A replaced node that is still connected to a node of the result is kept, with the replaced nodes it's connected to:
+    // they stay owned by the result
+    //
+    std::vector<bool> isKept(result->numNodes, false);
+    auto keep = [&](size_t index) {
+        std::vector<size_t> stack(1, index);
+        while (!stack.empty()) {
+            auto keptIndex = stack.back();
+            stack.pop_back();
+            if (isKept[keptIndex] || getReplacement(keptIndex) == result->nodes[keptIndex]) {
+                continue;
+            }
+            isKept[keptIndex] = true;
+
+            auto recordIt = recorder.nodes.find(result->nodes[keptIndex]);
+            if (recordIt == recorder.nodes.end()) {
+                continue;
+            }
+            for (auto& input : recordIt->second.inputs) {
+                auto childIt = state.nodeIndices.find(input.nodeValue);
+                if (input.kind == CompiledMaterialRecorder::Input::kNode && childIt != state.nodeIndices.end()) {
+                    stack.push_back(childIt->second);
+                }
+            }
+        }
+    };
+
+    // Connect the remaining nodes of the result to the replacements of their children, then delete the replaced nodes
+    //
+    for (size_t i = 0; i < result->numNodes; ++i) {
+        auto node = result->nodes[i];
+        if (getReplacement(i) != node) {
+            continue;
+        }
+
+        auto recordIt = recorder.nodes.find(node);
+        if (recordIt == recorder.nodes.end()) {
+            continue;
+        }
+        for (auto& input : recordIt->second.inputs) {
+            if (input.kind != CompiledMaterialRecorder::Input::kNode) {
+                continue;
+            }
+            auto childIt = state.nodeIndices.find(input.nodeValue);
+            if (childIt != state.nodeIndices.end() && getReplacement(childIt->second) != input.nodeValue) {
+                if (rprMaterialNodeSetInputNByKey(node, input.key, getReplacement(childIt->second)) != RPR_SUCCESS) {
+                    keep(childIt->second);
+                }
+            }
+        }
+    }
+    for (size_t i = 0; i < result->numNodes; ++i) {
+        if (getReplacement(i) != result->nodes[i] && !isKept[i]) {
+            rprObjectDelete(result->nodes[i]);
+        }
+    }
+
+    // Several nodes of the result may have been replaced by the same node
+    //
+    std::vector<rpr_material_node> nodes;
+    std::unordered_map<rpr_material_node, size_t> newNodeIndices;
+    for (size_t i = 0; i < result->numNodes; ++i) {
+        auto node = getReplacement(i);
+        if (newNodeIndices.emplace(node, nodes.size()).second) {
+            nodes.push_back(node);
+        }
+        if (isKept[i] && newNodeIndices.emplace(result->nodes[i], nodes.size()).second) {
+            nodes.push_back(result->nodes[i]);
+        }
+    }
+    for (auto& rootNodeIndex : result->rootNodeIndices) {
+        if (rootNodeIndex != Result::kInvalidRootNodeIndex) {
+            rootNodeIndex = newNodeIndices[result->nodes[rootNodeIndex]];
+        }
+    }
+
+    std::vector<Result::ImageNode> imageNodes;
+    std::unordered_set<rpr_material_node> visitedImageNodes;
+    for (size_t i = 0; i < result->numImageNodes; ++i) {
+        auto& imageNode = result->imageNodes[i];
+        auto indexIt = state.nodeIndices.find(imageNode.rprNode);
+        if (indexIt != state.nodeIndices.end() && !isKept[indexIt->second]) {
+            imageNode.rprNode = getReplacement(indexIt->second);
+        }
+        if (visitedImageNodes.insert(imageNode.rprNode).second) {
+            imageNodes.push_back(std::move(imageNode));
+        }
+    }
+
+    if (nodes.size() != result->numNodes) {
+        delete[] result->nodes;
+        result->numNodes = nodes.size();
+        result->nodes = new rpr_material_node[nodes.size()];
+    }
+    std::copy(nodes.begin(), nodes.end(), result->nodes);
+
+    if (imageNodes.size() != result->numImageNodes) {
+        delete[] result->imageNodes;
+        result->numImageNodes = imageNodes.size();
+        result->imageNodes = imageNodes.empty() ? nullptr : new Result::ImageNode[imageNodes.size()];
+    }
+    std::move(imageNodes.begin(), imageNodes.end(), result->imageNodes);
+}
+
+void RPRMtlxLoader::SharedNodeTable::Release(rpr_material_node const* nodes, size_t numNodes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (size_t i = 0; i < numNodes; ++i) {
+        auto node = nodes[i];
+        if (!node) {
+            continue;
+        }
+
+        auto it = _nodeEntries.find(node);
+        if (it == _nodeEntries.end()) {
+            rprObjectDelete(node);
+            continue;
+        }
+
+        auto entry = it->second;
+        if (--entry->second.refCount == 0) {
+            _nodeEntries.erase(it);
+            _entries.erase(_entries.find(entry->first));
+            rprObjectDelete(node);
+        }
+    }
+}
+
+void RPRMtlxLoader::ReleaseSharedNodes(Result* result) {
+    result->sharedNodeTable->Release(result->nodes, result->numNodes);
+}
+
+namespace {
+
+/// Scopes can be nested: the recorder of the outer scope is restored
+struct RecorderScope {
+    RecorderScope(CompiledMaterialRecorder* recorder) : previous(g_compiledMaterialRecorder) { g_compiledMaterialRecorder = recorder; }
+    ~RecorderScope() { g_compiledMaterialRecorder = previous; }
+
+    CompiledMaterialRecorder* previous;
+};
+
+} // namespace anonymous
+
+std::string RPRMtlxLoader::GetCompiledCacheKey(
+    std::string const& documentFile,
+    std::string const& documentXml,
+    const std::string inputRenderableElements[kOutputsTotal],
+    MaterialX::FileSearchPath const& searchPath) const {
+
+    BinaryWriter key;
+    key.U32(kCompiledMaterialVersion);
+    key.String(documentFile);
+    key.String(documentXml);
+    key.U64(_stdlib ? _stdlib->version : 0);
+    key.U8(inputRenderableElements ? 1 : 0);
+    for (int i = 0; inputRenderableElements && i < kOutputsTotal; ++i) {
+        key.String(inputRenderableElements[i]);
+    }
+    key.String(searchPath.asString());
+    key.String(_stdSearchPath.asString());
+    return key.GetData();
+}
+
+std::string RPRMtlxLoader::GetCompiledCacheFile(std::string const& key) const {
+    char keyHash[17];
+    snprintf(keyHash, sizeof(keyHash), "%016llx", static_cast<unsigned long long>(HashString(key)));
+    return _compiledCacheDirectory + "/" + keyHash + ".rprmtlxc";
+}
+
+RPRMtlxLoader::Result RPRMtlxLoader::Load(
+    MaterialX::Document const* mtlxDocument,
+    const std::string inputRenderableElements[kOutputsTotal],
+    MaterialX::FileSearchPath const& searchPath,
+    rpr_material_system rprMatSys) {
+
+    bool useCache = !_compiledCacheDirectory.empty() && mtlxDocument;
+    if (!useCache && !_sharedNodeTable) {
+        return LoadDocument(mtlxDocument, inputRenderableElements, searchPath, rprMatSys);
+    }
+
+    // Both the cache and the node sharing need the description of the created nodes: the rpr calls are recorded
+    //
+    CompiledMaterialRecorder recorder;
+
+    Result ret = {};
+    {
+        RecorderScope recorderScope(&recorder);
+
+        // A document read from a file is keyed by its file, checked with the stamps of the files it was read from.
+        // A document made in memory is keyed by its XML
+        //
+        std::string cacheKey;
+        std::string cacheFile;
+        std::string data;
+        std::vector<std::string> documentFiles;
+        bool cacheHit = false;
+        if (useCache) {
+            documentFiles = GetDocumentFiles(mtlxDocument);
+            if (documentFiles.empty()) {
+                cacheKey = GetCompiledCacheKey(std::string(), mx::writeToXmlString(const_cast<mx::Document*>(mtlxDocument)->getDocument()), inputRenderableElements, searchPath);
+            } else {
+                cacheKey = GetCompiledCacheKey(documentFiles.front(), std::string(), inputRenderableElements, searchPath);
+            }
+            cacheFile = GetCompiledCacheFile(cacheKey);
+            cacheHit = ReadCompiledMaterialFile(cacheFile, cacheKey, &data) && DeserializeCompiledMaterial(data, rprMatSys, &ret);
+        }
+
+        if (!cacheHit) {
+            ret = LoadDocument(mtlxDocument, inputRenderableElements, searchPath, rprMatSys);
+
+            CompiledMaterialSources sources;
+            if (useCache && ret.nodes && GetCompiledMaterialSources(documentFiles, &sources) &&
+                SerializeCompiledMaterial(ret, recorder, cacheKey, sources, &data)) {
+                WriteCompiledMaterialFile(cacheFile, data);
+            }
+        }
+    }
+
+    if (_sharedNodeTable && ret.nodes) {
+        _sharedNodeTable->Share(&ret, recorder, rprMatSys);
+        ret.sharedNodeTable = _sharedNodeTable;
+    }
+    return ret;
+}
+
+//------------------------------------------------------------------------------
+// Batch loading
+//------------------------------------------------------------------------------
+
+std::string RPRMtlxLoader::CompileFile(std::string const& file, MaterialX::FileSearchPath const& searchPath, bool readCache) const {
+    // The images and includes of the document are searched next to it first
+    //
+    mx::FileSearchPath documentSearchPath(mx::FilePath(file).getParentPath());
+    documentSearchPath.append(searchPath);
+
+    // The file is found like mx::readFromXmlFile does
+    //
+    mx::FileSearchPath fileSearchPath = documentSearchPath;
+    fileSearchPath.append(mx::getEnvironmentPath());
+    mx::FilePath filePath = fileSearchPath.find(file);
+
+    // The cache is keyed by the file and checked before parsing it: only the stamps of the file and of its includes are read
+    //
+    bool useCache = !_compiledCacheDirectory.empty();
+    std::string cacheKey;
+    std::string data;
+    if (useCache) {
+        cacheKey = GetCompiledCacheKey(filePath.asString(), std::string(), nullptr, documentSearchPath);
+        if (readCache && ReadCompiledMaterialFile(GetCompiledCacheFile(cacheKey), cacheKey, &data)) {
+            return data;
+        }
+    }
+
+    mx::DocumentPtr mtlxDocument = mx::createDocument();
+    try {
+        mx::readFromXmlFile(mtlxDocument, filePath, documentSearchPath);
+        mtlxDocument->setSourceUri(filePath.asString());
+    } catch (std::exception const& e) {
+        if (_loggingEnabled) {
+            printf("RPRMtlxLoader error: failed to read %s: %s\n", file.c_str(), e.what());
+        }
+        return std::string();
+    }
+
+    // Before the stdlib definitions are imported: their files are versioned by the stdlib
+    CompiledMaterialSources sources;
+    if (useCache && !GetCompiledMaterialSources(GetDocumentFiles(mtlxDocument.get()), &sources)) {
+        useCache = false;
+    }
+    ImportStdlibDefinitions(mtlxDocument);
+
+    // The nodes are only recorded, they are created by the thread that called LoadBatch
+    //
+    CompiledMaterialRecorder recorder;
+    recorder.isDeferred = true;
+    Result result = {};
+    bool isCompiled = false;
+    {
+        RecorderScope recorderScope(&recorder);
+        try {
+            result = LoadDocument(mtlxDocument.get(), nullptr, documentSearchPath, nullptr);
+            isCompiled = result.nodes && SerializeCompiledMaterial(result, recorder, cacheKey, sources, &data);
+        } catch (std::exception const& e) {
+            if (_loggingEnabled) {
+                printf("RPRMtlxLoader error: failed to load %s: %s\n", file.c_str(), e.what());
+            }
+        }
+    }
+
+    // Placeholder handles: there is no rpr node to release
+    delete[] result.nodes;
+    delete[] result.imageNodes;
+
+    if (!isCompiled) {
+        return std::string();
+    }
+    if (useCache) {
+        WriteCompiledMaterialFile(GetCompiledCacheFile(cacheKey), data);
+    }
+    return data;
+}
+
+std::vector<RPRMtlxLoader::Result> RPRMtlxLoader::LoadBatch(
+    std::vector<std::string> const& files,
+    MaterialX::FileSearchPath const& searchPath,
+    rpr_material_system rprMatSys,
+    unsigned numThreads) {
+
+    if (numThreads == 0) {
+        numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    numThreads = unsigned(std::min<size_t>(numThreads, files.size()));
+
+    // Read, resolve and compile the documents on the workers
+    //
+    std::vector<std::string> compiledMaterials(files.size());
+    FileExistenceCache fileExistenceCache;
+    std::atomic<size_t> nextFile(0);
+    auto compileFiles = [&]() {
+        g_fileExistenceCache = &fileExistenceCache;
+        for (size_t i = nextFile++; i < files.size(); i = nextFile++) {
+            compiledMaterials[i] = CompileFile(files[i], searchPath, true);
+        }
+        g_fileExistenceCache = nullptr;
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned i = 1; i < numThreads; ++i) {
+        workers.emplace_back(compileFiles);
+    }
+    compileFiles();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Create the rpr nodes on this thread only
+    //
+    std::vector<Result> results(files.size());
+    for (size_t i = 0; i < files.size(); ++i) {
+        if (compiledMaterials[i].empty()) {
+            continue;
+        }
+
+        CompiledMaterialRecorder recorder;
+        auto& result = results[i];
+        {
+            RecorderScope recorderScope(&recorder);
+            if (!DeserializeCompiledMaterial(compiledMaterials[i], rprMatSys, &result)) {
+                // Invalid file in the compiled-material cache: compiled again, the new form replaces it
+                auto data = CompileFile(files[i], searchPath, false);
+                if (data.empty() || !DeserializeCompiledMaterial(data, rprMatSys, &result)) {
+                    continue;
+                }
+            }
+        }
+
+        if (_sharedNodeTable && result.nodes) {
+            _sharedNodeTable->Share(&result, recorder, rprMatSys);
+            result.sharedNodeTable = _sharedNodeTable;
+        }
+    }
+    return results;
+}
@@ -17,15 +17,57 @@
 #include <MaterialXCore/Document.h>
 #include <MaterialXFormat/File.h>
 
+#include <memory>
+#include <string>
+#include <vector>
+
 class RPRMtlxLoader {
 public:
     RPRMtlxLoader();
 
+    /// Parsed standard libraries, with an index of their nodedefs and implementations.
+    /// It's immutable and shared by all the loaders set up with the same libraries and search path.
+    struct SharedStdlib;
+
+    /// The libraries are parsed only once per process, and only when needed: the first call with given \p libraryNames and \p searchPath
+    /// finds their files, the next calls, from any thread, reuse the same SharedStdlib. The files are parsed by the first
+    /// \ref GetStdlib or \ref ImportStdlibDefinitions: loads served by the compiled-material cache don't parse them.
     void SetupStdlib(MaterialX::FilePathVec const& libraryNames, MaterialX::FileSearchPath const& searchPath);
-    MaterialX::ConstDocumentPtr GetStdlib() const { return _stdlib; }
+
+    /// The returned document is shared between loaders and must not be modified.
+    MaterialX::ConstDocumentPtr GetStdlib() const;
+
+    /// Import into \p mtlxDocument the stdlib nodedefs used by its nodes and shaderrefs, with their implementations,
+    /// and recursively the nodedefs used by these implementations. Elements already present in \p mtlxDocument are kept.
+    /// Alternative to mtlxDocument->importLibrary(GetStdlib()) that copies the whole library into each document.
+    void ImportStdlibDefinitions(MaterialX::DocumentPtr const& mtlxDocument) const;
 
     void SetLogging(bool enable) { _loggingEnabled = enable; }
 
+    /// Enables the compiled-material cache: each \ref Load result is stored in \p directory as a small binary file
+    /// ( rpr node types, names, input values, connections and image node descriptors ), keyed by the document,
+    /// the stdlib version and the Load arguments. The file is named by the hash of the key and stores the full key,
+    /// compared on load. The next Load of the same document creates the rpr nodes from this file,
+    /// without walking the MaterialX document. \p directory must exist. Empty string disables the cache ( default ).
+    /// A document read from a file ( with a source URI ) is keyed by its file: the stored material is used while the size
+    /// and modification time of this file and of its includes are unchanged, or while their content is if they changed.
+    /// Clear the source URI of such a document before loading it if it was edited in memory.
+    /// A document made in memory is keyed by its XML.
+    void SetCompiledCacheDirectory(std::string const& directory) { _compiledCacheDirectory = directory; }
+
+    /// Table of rpr nodes shared between \ref Load results.
+    /// Nodes with the same type and the same inputs ( constants, connections to shared nodes, image file ) are created once
+    /// and referenced by every result that needs them. They are reference-counted and deleted by the last \ref Release.
+    /// The root nodes of each result are never shared, only the subgraphs below them.
+    /// A table can be used by several loaders in several threads, for a given rpr_material_system.
+    class SharedNodeTable;
+    static std::shared_ptr<SharedNodeTable> CreateSharedNodeTable();
+
+    /// Enables the sharing of nodes between the results of this loader and of the other loaders using \p table.
+    /// As they are shared, the nodes of a result, except its root nodes, must not be modified.
+    /// Null \p table disables the sharing ( default ).
+    void SetSharedNodeTable(std::shared_ptr<SharedNodeTable> const& table) { _sharedNodeTable = table; }
+
     enum OutputType {
         kOutputNone = -1,
         kOutputSurface,
@@ -73,6 +115,9 @@ public:
 
         ImageNode* imageNodes = nullptr;
         size_t numImageNodes;
+
+        /// Set when the nodes are shared with other results, see \ref SetSharedNodeTable
+        std::shared_ptr<SharedNodeTable> sharedNodeTable;
     };
 
     /// \ref Load parses provided \p mtlxDocument;
@@ -95,15 +140,35 @@ public:
         MaterialX::FileSearchPath const& searchPath,
         rpr_material_system rprMatSys);
 
+    /// \ref LoadBatch loads the .mtlx \p files on \p numThreads threads ( 0: one per hardware thread ).
+    ///
+    /// The workers read the documents, import the stdlib definitions they use ( see \ref ImportStdlibDefinitions )
+    /// and resolve them like \ref Load, with the first renderable elements of each document and a search path made of
+    /// the folder of the document followed by \p searchPath. The existence of the files is checked once per batch.
+    /// The rpr nodes are created at the end by the calling thread only, so \p rprMatSys is never used concurrently.
+    ///
+    /// Returns one result per file, in the same order. The result of a file that failed to load has no nodes.
+    /// The compiled-material cache and the shared node table of the loader are used as with \ref Load. The cache is keyed
+    /// by the file and checked before parsing it.
+    std::vector<Result> LoadBatch(
+        std::vector<std::string> const& files,
+        MaterialX::FileSearchPath const& searchPath,
+        rpr_material_system rprMatSys,
+        unsigned numThreads = 0);
+
     /// Reference function on how properly to release RPRMtlxLoader::Result
     static void Release(Result* result) {
         if (!result || !result->nodes) {
             return;
         }
 
-        for (size_t i = 0; i < result->numNodes; ++i) {
-            if (result->nodes[i]) {
-                rprObjectDelete(result->nodes[i]);
+        if (result->sharedNodeTable) {
+            ReleaseSharedNodes(result);
+        } else {
+            for (size_t i = 0; i < result->numNodes; ++i) {
+                if (result->nodes[i]) {
+                    rprObjectDelete(result->nodes[i]);
+                }
             }
         }
         delete[] result->nodes;
@@ -115,8 +180,32 @@ public:
     }
 
 private:
-    MaterialX::DocumentPtr _stdlib;
+    Result LoadDocument(
+        MaterialX::Document const* mtlxDocument,
+        const std::string inputRenderableElements[kOutputsTotal],
+        MaterialX::FileSearchPath const& searchPath,
+        rpr_material_system rprMatSys) const;
+
+    /// Everything a compiled material depends on, except the content of the document files: \p documentFile, or \p documentXml
+    /// for a document made in memory, the stdlib version and the arguments
+    std::string GetCompiledCacheKey(
+        std::string const& documentFile,
+        std::string const& documentXml,
+        const std::string inputRenderableElements[kOutputsTotal],
+        MaterialX::FileSearchPath const& searchPath) const;
+
+    std::string GetCompiledCacheFile(std::string const& key) const;
+
+    /// Reads and loads \p file without any rpr call, returns its compiled form. Empty on failure.
+    /// The compiled form is written in the compiled-material cache. It's read from the cache first if \p readCache is set.
+    std::string CompileFile(std::string const& file, MaterialX::FileSearchPath const& searchPath, bool readCache) const;
+
+    static void ReleaseSharedNodes(Result* result);
+
+    std::shared_ptr<const SharedStdlib> _stdlib;
     MaterialX::FileSearchPath _stdSearchPath;
+    std::string _compiledCacheDirectory;
+    std::shared_ptr<SharedNodeTable> _sharedNodeTable;
     bool _loggingEnabled = false;
 };
 
@@ -0,0 +1,317 @@
+/*****************************************************************************\
+*
+*  Module Name    rprMtlxTextureLoader.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#include "rprMtlxTextureLoader.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+
+
+// one file ( and layer ), shared by all the image nodes using it.
+struct RPRMtlxTextureLoader::Texture
+{
+	std::string m_file;
+	std::string m_layer;
+
+	// written by a worker before the texture is moved to m_read
+	rpr_status m_status = RPR_SUCCESS;
+	std::vector<char> m_data;
+
+	// only used by the thread making the RPR calls
+	rpr_image m_image = nullptr;
+	bool m_done = false;
+	std::vector<PendingNode> m_nodes; // waiting for the image
+};
+
+
+namespace
+{
+
+// ".png" for "folder/image.PNG", as expected by rprContextCreateImageFromFileMemory
+std::string GetExtension(const std::string& fileName)
+{
+	const size_t dot = fileName.find_last_of('.');
+	const size_t slash = fileName.find_last_of("/\\");
+	if ( dot == std::string::npos || (slash != std::string::npos && dot < slash) )
+		return std::string();
+
+	std::string extension = fileName.substr(dot);
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+	return extension;
+}
+
+rpr_status ReadWholeFile(const std::string& fileName, std::vector<char>& data)
+{
+	std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+	if ( !file )
+		return RPR_ERROR_IO_ERROR;
+
+	const std::streamoff size = file.tellg();
+	if ( size <= 0 )
+		return RPR_ERROR_IO_ERROR;
+
+	data.resize((size_t)size);
+	file.seekg(0);
+	if ( !file.read(data.data(), size) )
+	{
+		data.clear();
+		return RPR_ERROR_IO_ERROR;
+	}
+	return RPR_SUCCESS;
+}
+
+// MaterialX address mode -> RPR wrap type. 0 if the mode is not set.
+rpr_uint GetWrapType(const std::string& addressMode)
+{
+	if ( addressMode == "periodic" )
+		return RPR_IMAGE_WRAP_TYPE_REPEAT;
+	if ( addressMode == "mirror" )
+		return RPR_IMAGE_WRAP_TYPE_MIRRORED_REPEAT;
+	if ( addressMode == "clamp" )
+		return RPR_IMAGE_WRAP_TYPE_CLAMP_TO_EDGE;
+	if ( addressMode == "constant" )
+		return RPR_IMAGE_WRAP_TYPE_CLAMP_ZERO;
+	return 0;
+}
+
+}
+
+
+RPRMtlxTextureLoader::RPRMtlxTextureLoader(rpr_context context, const Settings& settings) :
+	m_context(context),
+	m_settings(settings)
+{
+	const unsigned numReadThreads = std::max(m_settings.numReadThreads, 1u);
+	for(unsigned i=0; i<numReadThreads; i++)
+		m_workers.emplace_back(&RPRMtlxTextureLoader::Worker, this);
+}
+
+RPRMtlxTextureLoader::RPRMtlxTextureLoader(rpr_context context) :
+	RPRMtlxTextureLoader(context, Settings())
+{
+}
+
+RPRMtlxTextureLoader::~RPRMtlxTextureLoader()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_workerCondition.notify_all();
+	for(auto& worker : m_workers)
+		worker.join();
+
+	for(auto& texture : m_textures)
+	{
+		if ( texture.second->m_image )
+			rprObjectDelete(texture.second->m_image);
+	}
+	for(auto& defaultImage : m_defaultImages)
+	{
+		if ( defaultImage.second )
+			rprObjectDelete(defaultImage.second);
+	}
+}
+
+void RPRMtlxTextureLoader::Add(const RPRMtlxLoader::Result& result)
+{
+	for(size_t i=0; i<result.numImageNodes; i++)
+		Add(result.imageNodes[i]);
+}
+
+void RPRMtlxTextureLoader::Add(const RPRMtlxLoader::Result::ImageNode& imageNode)
+{
+	if ( !imageNode.rprNode )
+		return;
+
+	// the address modes belong to the node: the image is shared by nodes with different modes
+	if ( const rpr_uint wrapU = GetWrapType(imageNode.uaddressmode) )
+		rprMaterialNodeSetInputUByKey(imageNode.rprNode, RPR_MATERIAL_INPUT_WRAP_U, wrapU);
+	if ( const rpr_uint wrapV = GetWrapType(imageNode.vaddressmode) )
+		rprMaterialNodeSetInputUByKey(imageNode.rprNode, RPR_MATERIAL_INPUT_WRAP_V, wrapV);
+
+	const PendingNode pendingNode = { imageNode.rprNode, imageNode.defaultValue };
+	const std::string key = imageNode.file + '\n' + imageNode.layer;
+
+	Texture* texture = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_progress.nodesTotal++;
+
+		auto& slot = m_textures[key];
+		if ( !slot )
+		{
+			slot.reset(new Texture());
+			slot->m_file = imageNode.file;
+			slot->m_layer = imageNode.layer;
+			m_toRead.push_back(slot.get());
+			m_progress.texturesTotal++;
+			m_workerCondition.notify_one();
+		}
+		texture = slot.get();
+	}
+
+	if ( texture->m_done )
+		Bind(*texture, pendingNode);
+	else
+		texture->m_nodes.push_back(pendingNode);
+}
+
+size_t RPRMtlxTextureLoader::Update(size_t maxTextures)
+{
+	size_t texturesDone = 0;
+	while ( texturesDone < maxTextures )
+	{
+		Texture* texture = nullptr;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if ( m_read.empty() )
+				break;
+			texture = m_read.front();
+			m_read.pop_front();
+		}
+
+		// the core decodes the file from memory, on this thread
+		if ( texture->m_status == RPR_SUCCESS )
+		{
+			const std::string extension = GetExtension(texture->m_file);
+			texture->m_status = rprContextCreateImageFromFileMemory(m_context, extension.c_str(), texture->m_data.data(), texture->m_data.size(), &texture->m_image);
+			if ( texture->m_status != RPR_SUCCESS )
+				texture->m_image = nullptr;
+		}
+		const size_t bytes = texture->m_data.size();
+		std::vector<char>().swap(texture->m_data);
+
+		texture->m_done = true;
+		for(const auto& pendingNode : texture->m_nodes)
+			Bind(*texture, pendingNode);
+		std::vector<PendingNode>().swap(texture->m_nodes);
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_bytesHeld -= bytes;
+			if ( texture->m_image )
+				m_progress.texturesLoaded++;
+			else
+				m_progress.texturesFailed++;
+		}
+		m_workerCondition.notify_all();
+		texturesDone++;
+	}
+	return texturesDone;
+}
+
+void RPRMtlxTextureLoader::Finish()
+{
+	for(;;)
+	{
+		Update();
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		if ( m_progress.texturesLoaded + m_progress.texturesFailed == m_progress.texturesTotal )
+			return;
+		m_readCondition.wait(lock, [this]() { return !m_read.empty(); });
+	}
+}
+
+bool RPRMtlxTextureLoader::IsDone() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_progress.texturesLoaded + m_progress.texturesFailed == m_progress.texturesTotal;
+}
+
+RPRMtlxTextureLoader::Progress RPRMtlxTextureLoader::GetProgress() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_progress;
+}
+
+void RPRMtlxTextureLoader::Worker()
+{
+	for(;;)
+	{
+		Texture* texture = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_workerCondition.wait(lock, [this]() { return m_stop || (!m_toRead.empty() && m_bytesHeld < m_settings.memoryBudgetBytes); });
+			if ( m_stop )
+				return;
+			texture = m_toRead.front();
+			m_toRead.pop_front();
+		}
+
+		texture->m_status = ReadWholeFile(texture->m_file, texture->m_data);
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_bytesHeld += texture->m_data.size();
+			m_progress.bytesRead += texture->m_data.size();
+			m_read.push_back(texture);
+		}
+		m_readCondition.notify_all();
+	}
+}
+
+void RPRMtlxTextureLoader::Bind(const Texture& texture, const PendingNode& pendingNode)
+{
+	rpr_image image = texture.m_image;
+	bool isDefault = false;
+	if ( !image && pendingNode.defaultValue )
+	{
+		image = GetDefaultImage(pendingNode.defaultValue);
+		isDefault = true;
+	}
+	if ( !image || rprMaterialNodeSetInputImageDataByKey(pendingNode.node, RPR_MATERIAL_INPUT_DATA, image) != RPR_SUCCESS )
+		return;
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if ( isDefault )
+		m_progress.nodesDefaulted++;
+	else
+		m_progress.nodesBound++;
+}
+
+rpr_image RPRMtlxTextureLoader::GetDefaultImage(const MaterialX::ValuePtr& defaultValue)
+{
+	const std::string valueString = defaultValue->getValueString();
+	auto it = m_defaultImages.find(valueString);
+	if ( it != m_defaultImages.end() )
+		return it->second;
+
+	// "0.5" or "0.2, 0.3, 0.4" : a single value is used for RGB, alpha is 1 when not given
+	float color[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+	int numComponents = 0;
+	const char* str = valueString.c_str();
+	while ( numComponents < 4 && *str )
+	{
+		char* end = nullptr;
+		const float value = std::strtof(str, &end);
+		if ( end == str )
+			break;
+		color[numComponents++] = value;
+		str = end;
+		while ( *str == ',' || *str == ' ' )
+			str++;
+	}
+	if ( numComponents == 1 )
+		color[1] = color[2] = color[0];
+
+	const rpr_image_format format = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	const rpr_image_desc desc = { 1, 1, 0, sizeof(color), 0 };
+	rpr_image image = nullptr;
+	if ( numComponents == 0 || rprContextCreateImage(m_context, format, &desc, color, &image) != RPR_SUCCESS )
+		image = nullptr;
+
+	m_defaultImages[valueString] = image;
+	return image;
+}
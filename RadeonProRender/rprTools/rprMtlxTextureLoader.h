@@ -0,0 +1,139 @@
+/*****************************************************************************\
+*
+*  Module Name    rprMtlxTextureLoader.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <RadeonProRender.h>
+
+#include "rprMtlxLoader.h"
+
+// Creates the images of the RPRMtlxLoader::Result::ImageNode and binds them to their rpr nodes.
+//
+// Add queues the image nodes of a result. The nodes using the same file ( and layer ) share one rpr_image: each file is read
+// only once, by a pool of worker threads, while the calling thread continues. Update then creates the images of the files
+// already read with rprContextCreateImageFromFileMemory and binds them to all the nodes waiting for them.
+// Only the file reads are in the background: the core decodes the images in rprContextCreateImageFromFileMemory, on the thread
+// calling Update, and it can't be called from the workers. The maxTextures argument of Update bounds this decode time per frame.
+// The uaddressmode / vaddressmode of each node are applied to the node itself ( RPR_MATERIAL_INPUT_WRAP_U / _V ).
+// When a file is missing or can't be decoded, the nodes with a defaultValue are bound to a 1x1 image of this value.
+// The layer is only used to tell textures apart: the core always decodes the default layer of the file.
+//
+// Usage:
+//   RPRMtlxTextureLoader textureLoader(context);
+//   for each material:
+//       RPRMtlxLoader::Result result = mtlxLoader.Load(...);
+//       textureLoader.Add(result);
+//   while ( !textureLoader.IsDone() )
+//   {
+//       textureLoader.Update(4); // create at most 4 images per frame
+//       ... render ...
+//   }
+//
+// The workers only read files. All the RPR calls are made by Add, Update, Finish and the destructor,
+// which must be called from the thread that makes the other RPR calls.
+class RPRMtlxTextureLoader
+{
+public:
+
+	struct Settings
+	{
+		/// Number of threads reading the files. They don't decode them ( see Update ).
+		unsigned numReadThreads = 4;
+
+		/// Files read and not yet turned into images. The workers stop reading above this budget.
+		size_t memoryBudgetBytes = size_t(512) << 20;
+	};
+
+	struct Progress
+	{
+		/// distinct files to load, and the ones done ( loaded or failed ).
+		size_t texturesTotal = 0;
+		size_t texturesLoaded = 0;
+		size_t texturesFailed = 0;
+
+		/// image nodes added, and the ones bound to the image of their file or to their default value.
+		size_t nodesTotal = 0;
+		size_t nodesBound = 0;
+		size_t nodesDefaulted = 0;
+
+		size_t bytesRead = 0;
+	};
+
+	/// The workers start immediately and wait for the first Add.
+	RPRMtlxTextureLoader(rpr_context context, const Settings& settings);
+	explicit RPRMtlxTextureLoader(rpr_context context);
+
+	/// Stops the workers and deletes the created images: the materials using them must be deleted before.
+	~RPRMtlxTextureLoader();
+
+	RPRMtlxTextureLoader(const RPRMtlxTextureLoader&) = delete;
+	RPRMtlxTextureLoader& operator=(const RPRMtlxTextureLoader&) = delete;
+
+	/// Queue the image nodes of result. Their files start to be read by the workers.
+	/// The nodes using a file already loaded are bound immediately.
+	void Add(const RPRMtlxLoader::Result& result);
+	void Add(const RPRMtlxLoader::Result::ImageNode& imageNode);
+
+	/// Create the images of the files read so far, at most maxTextures, and bind them to their nodes.
+	/// The images are decoded by the core during this call, on the calling thread.
+	/// Returns the number of textures done by this call.
+	size_t Update(size_t maxTextures = size_t(-1));
+
+	/// Wait for the workers and bind all the queued nodes.
+	void Finish();
+
+	/// True when all the added nodes are bound ( or have failed ).
+	bool IsDone() const;
+
+	Progress GetProgress() const;
+
+private:
+
+	struct Texture;
+
+	struct PendingNode
+	{
+		rpr_material_node node;
+		MaterialX::ValuePtr defaultValue;
+	};
+
+	void Worker();
+	void Bind(const Texture& texture, const PendingNode& pendingNode);
+	rpr_image GetDefaultImage(const MaterialX::ValuePtr& defaultValue);
+
+	rpr_context m_context;
+	Settings m_settings;
+
+	// only used by the thread making the RPR calls
+	std::map<std::string, rpr_image> m_defaultImages; // by value string
+
+	mutable std::mutex m_mutex;
+	std::condition_variable m_workerCondition; // files to read, or memory released
+	std::condition_variable m_readCondition;   // files read
+	std::unordered_map<std::string, std::unique_ptr<Texture>> m_textures; // by file and layer
+	std::deque<Texture*> m_toRead;
+	std::deque<Texture*> m_read;
+	size_t m_bytesHeld = 0;
+	bool m_stop = false;
+	Progress m_progress;
+
+	std::vector<std::thread> m_workers;
+};
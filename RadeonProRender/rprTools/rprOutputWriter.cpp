@@ -0,0 +1,435 @@
+/*****************************************************************************\
+*
+*  Module Name    rprOutputWriter.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#include "rprOutputWriter.h"
+#include "rprToolsCommon.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#if !defined(RPR_OUTPUTWRITER_NO_STBI_IMPLEMENTATION)
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#endif
+#include "../../3rdParty/stbi/stbi.h"
+
+#if defined(RPR_OUTPUTWRITER_NO_STBI_IMPLEMENTATION)
+extern "C" unsigned int stbi__crc32(unsigned char* buffer, int len);
+#endif
+
+using rprtools::SecondsSince;
+
+
+namespace
+{
+
+// stbi fills its CRC table on the first PNG, without lock: it must be filled before the workers start.
+void InitStbiTables()
+{
+	unsigned char byte = 0;
+	stbi__crc32(&byte, 1);
+}
+
+unsigned char FloatToByte(float value)
+{
+	// NaN fails the comparison and gives 0
+	if ( !(value > 0.0f) )
+		return 0;
+	if ( value >= 1.0f )
+		return 255;
+	return (unsigned char)(value * 255.0f);
+}
+
+
+////// EXR //////
+
+// little endian writes into the header
+void Append(std::vector<char>& data, const void* value, size_t size)
+{
+	const char* bytes = (const char*)value;
+	data.insert(data.end(), bytes, bytes + size);
+}
+
+void AppendInt32(std::vector<char>& data, int32_t value)
+{
+	const char bytes[4] = { (char)(value & 0xFF), (char)((value >> 8) & 0xFF), (char)((value >> 16) & 0xFF), (char)((value >> 24) & 0xFF) };
+	Append(data, bytes, 4);
+}
+
+void AppendFloat(std::vector<char>& data, float value)
+{
+	int32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	AppendInt32(data, bits);
+}
+
+void AppendString(std::vector<char>& data, const char* value)
+{
+	Append(data, value, std::strlen(value) + 1);
+}
+
+void AppendAttribute(std::vector<char>& data, const char* name, const char* type, const std::vector<char>& value)
+{
+	AppendString(data, name);
+	AppendString(data, type);
+	AppendInt32(data, (int32_t)value.size());
+	data.insert(data.end(), value.begin(), value.end());
+}
+
+bool IsLittleEndian()
+{
+	const uint32_t one = 1;
+	unsigned char first;
+	std::memcpy(&first, &one, 1);
+	return first == 1;
+}
+
+// single part scanline file, one line per chunk, without compression: FLOAT channels named R G B A.
+rpr_status WriteExr(const std::string& filePath, const float* pixels, unsigned width, unsigned height, unsigned numComponents)
+{
+	if ( !IsLittleEndian() || numComponents == 0 || numComponents > 4 )
+		return RPR_ERROR_UNSUPPORTED;
+
+	// the channels are stored in alphabetical order, with their index in the pixel
+	static const char* const kNames[4] = { "R", "G", "B", "A" };
+	std::vector<int> channels;
+	for(unsigned i=0; i<numComponents; i++)
+		channels.push_back(i);
+	std::sort(channels.begin(), channels.end(), [](int a, int b) { return std::strcmp(kNames[a], kNames[b]) < 0; });
+
+	std::vector<char> header;
+	AppendInt32(header, 20000630); // magic number
+	AppendInt32(header, 2);        // version 2, scanline file
+
+	std::vector<char> value;
+	for(int channel : channels)
+	{
+		AppendString(value, kNames[channel]);
+		AppendInt32(value, 2); // FLOAT
+		AppendInt32(value, 0); // pLinear and reserved
+		AppendInt32(value, 1); // xSampling
+		AppendInt32(value, 1); // ySampling
+	}
+	value.push_back(0);
+	AppendAttribute(header, "channels", "chlist", value);
+
+	AppendAttribute(header, "compression", "compression", std::vector<char>(1, 0)); // NO_COMPRESSION
+
+	value.clear();
+	AppendInt32(value, 0);
+	AppendInt32(value, 0);
+	AppendInt32(value, (int32_t)width - 1);
+	AppendInt32(value, (int32_t)height - 1);
+	AppendAttribute(header, "dataWindow", "box2i", value);
+	AppendAttribute(header, "displayWindow", "box2i", value);
+
+	AppendAttribute(header, "lineOrder", "lineOrder", std::vector<char>(1, 0)); // INCREASING_Y
+
+	value.clear();
+	AppendFloat(value, 1.0f);
+	AppendAttribute(header, "pixelAspectRatio", "float", value);
+	AppendAttribute(header, "screenWindowWidth", "float", value);
+
+	value.clear();
+	AppendFloat(value, 0.0f);
+	AppendFloat(value, 0.0f);
+	AppendAttribute(header, "screenWindowCenter", "v2f", value);
+
+	header.push_back(0); // end of header
+
+	// offset table: the chunks follow, each one is y, size, and the line of each channel
+	const uint64_t lineSize = (uint64_t)width * numComponents * sizeof(float);
+	const uint64_t chunkSize = 8 + lineSize;
+	const uint64_t firstChunk = header.size() + (uint64_t)height * 8;
+	for(unsigned y=0; y<height; y++)
+	{
+		const uint64_t offset = firstChunk + y * chunkSize;
+		Append(header, &offset, 8);
+	}
+
+	FILE* file = std::fopen(filePath.c_str(), "wb");
+	if ( !file )
+		return RPR_ERROR_IO_ERROR;
+
+	bool ok = std::fwrite(header.data(), 1, header.size(), file) == header.size();
+	std::vector<char> chunk;
+	std::vector<float> line(width);
+	for(unsigned y=0; y<height && ok; y++)
+	{
+		chunk.clear();
+		AppendInt32(chunk, (int32_t)y);
+		AppendInt32(chunk, (int32_t)lineSize);
+		const float* row = pixels + (size_t)y * width * numComponents;
+		for(int channel : channels)
+		{
+			for(unsigned x=0; x<width; x++)
+				line[x] = row[(size_t)x * numComponents + channel];
+			Append(chunk, line.data(), line.size() * sizeof(float));
+		}
+		ok = std::fwrite(chunk.data(), 1, chunk.size(), file) == chunk.size();
+	}
+
+	ok = std::fclose(file) == 0 && ok;
+	return ok ? RPR_SUCCESS : RPR_ERROR_IO_ERROR;
+}
+
+}
+
+
+RPROutputWriter::RPROutputWriter(const Settings& settings) :
+	m_settings(settings)
+{
+	m_settings.maxPendingImages = std::max<size_t>(m_settings.maxPendingImages, 1);
+	InitStbiTables();
+	const unsigned numThreads = std::max(m_settings.numThreads, 1u);
+	for(unsigned i=0; i<numThreads; i++)
+		m_workers.emplace_back(&RPROutputWriter::Worker, this);
+}
+
+RPROutputWriter::RPROutputWriter() :
+	RPROutputWriter(Settings())
+{
+}
+
+RPROutputWriter::~RPROutputWriter()
+{
+	Flush();
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_workerCondition.notify_all();
+	for(auto& worker : m_workers)
+		worker.join();
+}
+
+RPROutputWriter::Format RPROutputWriter::GetFormat(const std::string& filePath)
+{
+	const size_t dot = filePath.find_last_of('.');
+	const size_t slash = filePath.find_last_of("/\\");
+	if ( dot == std::string::npos || (slash != std::string::npos && dot < slash) )
+		return FORMAT_OTHER;
+
+	std::string extension = filePath.substr(dot + 1);
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+	if ( extension == "png" )
+		return FORMAT_PNG;
+	if ( extension == "bmp" )
+		return FORMAT_BMP;
+	if ( extension == "tga" )
+		return FORMAT_TGA;
+	if ( extension == "exr" )
+		return FORMAT_EXR;
+	return FORMAT_OTHER;
+}
+
+rpr_status RPROutputWriter::Write(rpr_framebuffer framebuffer, const std::string& filePath, const Callback& callback)
+{
+	Job job;
+	job.filePath = filePath;
+	job.format = GetFormat(filePath);
+	job.callback = callback;
+
+	rpr_framebuffer_format format = {};
+	rpr_framebuffer_desc desc = {};
+	rpr_status status = rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_FORMAT, sizeof(format), &format, nullptr);
+	if ( status == RPR_SUCCESS )
+		status = rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_DESC, sizeof(desc), &desc, nullptr);
+	if ( status != RPR_SUCCESS )
+		return status;
+
+	// the formats not encoded here are saved by the core, now
+	if ( job.format == FORMAT_OTHER || format.type != RPR_COMPONENT_TYPE_FLOAT32 || format.num_components == 0 || format.num_components > 4 )
+	{
+		status = rprFrameBufferSaveToFile(framebuffer, filePath.c_str());
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stats.imagesSynchronous++;
+		}
+		if ( callback )
+			callback(filePath, status);
+		return status;
+	}
+
+	// the buffer is taken once a slot is free, so that at most maxPendingImages buffers exist
+	job.buffer = AcquireBuffer();
+	const auto copyStart = std::chrono::steady_clock::now();
+
+	size_t size = 0;
+	status = rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_DATA, 0, nullptr, &size);
+	if ( status == RPR_SUCCESS )
+	{
+		job.buffer->resize(size);
+		status = rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_DATA, size, job.buffer->data(), nullptr);
+	}
+	if ( status == RPR_SUCCESS && size != (size_t)desc.fb_width * desc.fb_height * format.num_components * sizeof(float) )
+		status = RPR_ERROR_INTERNAL_ERROR;
+
+	job.width = desc.fb_width;
+	job.height = desc.fb_height;
+	job.numComponents = format.num_components;
+	job.isFloat = true;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stats.copySeconds += SecondsSince(copyStart);
+		if ( status != RPR_SUCCESS )
+		{
+			// give back the slot and the buffer
+			m_freeBuffers.push_back(std::move(job.buffer));
+			m_pendingImages--;
+		}
+	}
+	if ( status != RPR_SUCCESS )
+	{
+		m_slotCondition.notify_all();
+		return status;
+	}
+
+	Push(std::move(job));
+	return RPR_SUCCESS;
+}
+
+rpr_status RPROutputWriter::Write(const unsigned char* pixels, unsigned width, unsigned height, unsigned numComponents, const std::string& filePath, const Callback& callback)
+{
+	Job job;
+	job.filePath = filePath;
+	job.format = GetFormat(filePath);
+	job.callback = callback;
+	if ( !pixels || numComponents == 0 || numComponents > 4 || (job.format != FORMAT_PNG && job.format != FORMAT_BMP && job.format != FORMAT_TGA) )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	job.buffer = AcquireBuffer();
+	const auto copyStart = std::chrono::steady_clock::now();
+	const size_t size = (size_t)width * height * numComponents;
+	job.buffer->assign((const char*)pixels, (const char*)pixels + size);
+	job.width = width;
+	job.height = height;
+	job.numComponents = numComponents;
+	job.isFloat = false;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stats.copySeconds += SecondsSince(copyStart);
+	}
+
+	Push(std::move(job));
+	return RPR_SUCCESS;
+}
+
+void RPROutputWriter::Flush()
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_slotCondition.wait(lock, [this]() { return m_pendingImages == 0; });
+}
+
+RPROutputWriter::Stats RPROutputWriter::GetStats() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_stats;
+}
+
+std::unique_ptr<std::vector<char>> RPROutputWriter::AcquireBuffer()
+{
+	const auto waitStart = std::chrono::steady_clock::now();
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_slotCondition.wait(lock, [this]() { return m_pendingImages < m_settings.maxPendingImages; });
+	m_stats.waitSeconds += SecondsSince(waitStart);
+	m_pendingImages++;
+
+	if ( m_freeBuffers.empty() )
+	{
+		m_stats.buffersAllocated++;
+		return std::unique_ptr<std::vector<char>>(new std::vector<char>());
+	}
+	std::unique_ptr<std::vector<char>> buffer = std::move(m_freeBuffers.back());
+	m_freeBuffers.pop_back();
+	return buffer;
+}
+
+void RPROutputWriter::Push(Job&& job)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_jobs.push_back(std::move(job));
+	}
+	m_workerCondition.notify_one();
+}
+
+void RPROutputWriter::Worker()
+{
+	for(;;)
+	{
+		Job job;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_workerCondition.wait(lock, [this]() { return m_stop || !m_jobs.empty(); });
+			if ( m_jobs.empty() )
+				return;
+			job = std::move(m_jobs.front());
+			m_jobs.pop_front();
+		}
+
+		const auto encodeStart = std::chrono::steady_clock::now();
+		const rpr_status status = Encode(job);
+		const double encodeSeconds = SecondsSince(encodeStart);
+
+		// the callback runs before the slot is released: Flush returns after all the callbacks
+		if ( job.callback )
+			job.callback(job.filePath, status);
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stats.encodeSeconds += encodeSeconds;
+			if ( status == RPR_SUCCESS )
+				m_stats.imagesWritten++;
+			else
+				m_stats.imagesFailed++;
+			m_freeBuffers.push_back(std::move(job.buffer));
+			m_pendingImages--;
+		}
+		m_slotCondition.notify_all();
+	}
+}
+
+rpr_status RPROutputWriter::Encode(const Job& job) const
+{
+	if ( job.format == FORMAT_EXR )
+		return WriteExr(job.filePath, (const float*)job.buffer->data(), job.width, job.height, job.numComponents);
+
+	// stbi takes 8-bit pixels
+	std::vector<unsigned char> converted;
+	const unsigned char* pixels = (const unsigned char*)job.buffer->data();
+	if ( job.isFloat )
+	{
+		const size_t count = (size_t)job.width * job.height * job.numComponents;
+		const float* values = (const float*)job.buffer->data();
+		converted.resize(count);
+		for(size_t i=0; i<count; i++)
+			converted[i] = FloatToByte(values[i]);
+		pixels = converted.data();
+	}
+
+	int written = 0;
+	const int width = (int)job.width;
+	const int height = (int)job.height;
+	const int numComponents = (int)job.numComponents;
+	if ( job.format == FORMAT_PNG )
+		written = stbi_write_png(job.filePath.c_str(), width, height, numComponents, pixels, width * numComponents);
+	else if ( job.format == FORMAT_BMP )
+		written = stbi_write_bmp(job.filePath.c_str(), width, height, numComponents, pixels);
+	else if ( job.format == FORMAT_TGA )
+		written = stbi_write_tga(job.filePath.c_str(), width, height, numComponents, pixels);
+
+	return written ? RPR_SUCCESS : RPR_ERROR_IO_ERROR;
+}
@@ -0,0 +1,141 @@
+/*****************************************************************************\
+*
+*  Module Name    rprOutputWriter.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <RadeonProRender.h>
+
+// Writes framebuffers to image files in the background, instead of rprFrameBufferSaveToFile / stbi_write_png in the render loop.
+//
+// Write copies the framebuffer data once ( rprFrameBufferGetInfo ) into a buffer taken from a pool, and returns:
+// the PNG, BMP, TGA and EXR files are encoded and written by a pool of worker threads while the caller continues to render.
+// When maxPendingImages images are already waiting, Write blocks until a worker is done with one of them ( backpressure ):
+// the memory used stays bounded when the disk is slower than the renderer.
+//
+// PNG, BMP and TGA are written with stbi ( values clamped to [0,1], 8 bits per channel ), EXR as uncompressed 32-bit float channels.
+// The other extensions ( .jpg ... ) are saved by rprFrameBufferSaveToFile, synchronously, when Write is called.
+//
+// Usage:
+//   RPROutputWriter writer;
+//   for each frame:
+//       ... render, resolve ...
+//       writer.Write(frame_buffer_resolved, "frame" + std::to_string(frame) + ".png", [](const std::string& filePath, rpr_status status) { ... });
+//   writer.Flush(); // all the files are written
+//
+// The callbacks are called by the worker threads ( or by Write for the synchronous saves ).
+// rprOutputWriter.cpp contains the stbi implementation: define RPR_OUTPUTWRITER_NO_STBI_IMPLEMENTATION when the application already has it.
+class RPROutputWriter
+{
+public:
+
+	struct Settings
+	{
+		/// Threads encoding and writing the files.
+		unsigned numThreads = 2;
+
+		/// Images copied and not yet written, at most. Write blocks above this count.
+		size_t maxPendingImages = 4;
+	};
+
+	struct Stats
+	{
+		/// files written by the workers, files that failed, and files saved synchronously by rprFrameBufferSaveToFile.
+		size_t imagesWritten = 0;
+		size_t imagesFailed = 0;
+		size_t imagesSynchronous = 0;
+
+		/// pixel buffers created by the pool: the other Write calls reused one.
+		size_t buffersAllocated = 0;
+
+		/// time spent by Write to copy the framebuffers, and waiting for a free slot.
+		double copySeconds = 0.0;
+		double waitSeconds = 0.0;
+
+		/// time spent by the workers to encode and write the files.
+		double encodeSeconds = 0.0;
+	};
+
+	/// Called once the file is written, with RPR_SUCCESS or the error.
+	typedef std::function<void(const std::string& filePath, rpr_status status)> Callback;
+
+	RPROutputWriter(const Settings& settings);
+	RPROutputWriter();
+
+	/// Waits for the queued images.
+	~RPROutputWriter();
+
+	RPROutputWriter(const RPROutputWriter&) = delete;
+	RPROutputWriter& operator=(const RPROutputWriter&) = delete;
+
+	/// Copy the data of framebuffer and queue it to be written to filePath. The format is given by the extension.
+	/// The framebuffer can be rendered again as soon as Write returns.
+	rpr_status Write(rpr_framebuffer framebuffer, const std::string& filePath, const Callback& callback = Callback());
+
+	/// Same for 8-bit pixels ( width x height x numComponents bytes, 1 to 4 components ), as given to stbi_write_png. Only for PNG, BMP and TGA files.
+	rpr_status Write(const unsigned char* pixels, unsigned width, unsigned height, unsigned numComponents, const std::string& filePath, const Callback& callback = Callback());
+
+	/// Wait until all the queued images are written.
+	void Flush();
+
+	Stats GetStats() const;
+
+private:
+
+	enum Format
+	{
+		FORMAT_PNG,
+		FORMAT_BMP,
+		FORMAT_TGA,
+		FORMAT_EXR,
+		FORMAT_OTHER,
+	};
+
+	struct Job
+	{
+		std::string filePath;
+		Format format = FORMAT_OTHER;
+		Callback callback;
+		unsigned width = 0;
+		unsigned height = 0;
+		unsigned numComponents = 0;
+		bool isFloat = false;
+		std::unique_ptr<std::vector<char>> buffer;
+	};
+
+	static Format GetFormat(const std::string& filePath);
+
+	std::unique_ptr<std::vector<char>> AcquireBuffer();
+	void Push(Job&& job);
+	void Worker();
+	rpr_status Encode(const Job& job) const;
+
+	Settings m_settings;
+
+	mutable std::mutex m_mutex;
+	std::condition_variable m_workerCondition; // jobs to write, or stop
+	std::condition_variable m_slotCondition;   // a job is done
+	std::deque<Job> m_jobs;
+	std::vector<std::unique_ptr<std::vector<char>>> m_freeBuffers;
+	size_t m_pendingImages = 0; // queued or being written
+	bool m_stop = false;
+	Stats m_stats;
+
+	std::vector<std::thread> m_workers;
+};
@@ -0,0 +1,1002 @@
+/*****************************************************************************\
+*
+*  Module Name    rprPngWriter.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#include "rprPngWriter.h"
+#include "rprToolsCommon.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <queue>
+#include <thread>
+
+using rprtools::SecondsSince;
+
+
+struct RPRPngWriter::ImageDesc
+{
+	enum Type
+	{
+		TYPE_UINT8,
+		TYPE_UINT16,
+		TYPE_FLOAT,
+	};
+
+	const void* pixels = nullptr;
+	Type type = TYPE_UINT8;
+	unsigned width = 0;
+	unsigned height = 0;
+	unsigned numComponents = 0;    // in pixels
+	unsigned outputComponents = 0; // in the file
+	unsigned bitDepth = 8;
+
+	size_t GetRowBytes() const { return (size_t)width * outputComponents * (bitDepth / 8); }
+
+	// scanline y as stored in the file, before filtering: big endian for 16-bit
+	void GetRow(unsigned y, unsigned char* row) const;
+};
+
+
+namespace
+{
+
+// zlib CMF byte: deflate with a 32K window
+const unsigned char ZLIB_CMF = 0x78;
+
+// symbols of a dynamic block, at most
+const size_t BLOCK_SYMBOLS = 32768;
+
+const int WINDOW_SIZE = 32768;
+const int MIN_MATCH = 4; // the matches are found with a hash of 4 bytes
+const int MAX_MATCH = 258;
+const int HASH_BITS = 15;
+const int MAX_CHAIN = 32; // candidates tested by COMPRESSION_DEFAULT
+
+
+////// checksums //////
+
+const uint32_t* GetCrcTable()
+{
+	struct Table
+	{
+		uint32_t values[256];
+		Table()
+		{
+			for(uint32_t i=0; i<256; i++)
+			{
+				uint32_t c = i;
+				for(int k=0; k<8; k++)
+					c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+				values[i] = c;
+			}
+		}
+	};
+	static const Table table;
+	return table.values;
+}
+
+// crc starts at 0xFFFFFFFF, and is inverted once all the data is added
+uint32_t UpdateCrc(uint32_t crc, const unsigned char* data, size_t size)
+{
+	const uint32_t* table = GetCrcTable();
+	for(size_t i=0; i<size; i++)
+		crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	return crc;
+}
+
+const uint32_t ADLER_BASE = 65521;
+
+uint32_t UpdateAdler(uint32_t adler, const unsigned char* data, size_t size)
+{
+	uint32_t a = adler & 0xFFFF;
+	uint32_t b = adler >> 16;
+	while ( size > 0 )
+	{
+		// largest n such that b doesn't overflow before the modulo
+		const size_t n = std::min<size_t>(size, 5552);
+		for(size_t i=0; i<n; i++)
+		{
+			a += data[i];
+			b += a;
+		}
+		a %= ADLER_BASE;
+		b %= ADLER_BASE;
+		data += n;
+		size -= n;
+	}
+	return a | (b << 16);
+}
+
+// Adler-32 of the concatenation of 2 blocks, from their Adler-32 and the size of the second one
+uint32_t CombineAdler(uint32_t adler1, uint32_t adler2, size_t size2)
+{
+	const uint32_t rem = (uint32_t)(size2 % ADLER_BASE);
+	uint32_t sum1 = adler1 & 0xFFFF;
+	uint32_t sum2 = (uint32_t)(((uint64_t)rem * sum1) % ADLER_BASE);
+	sum1 += (adler2 & 0xFFFF) + ADLER_BASE - 1;
+	sum2 += (adler1 >> 16) + (adler2 >> 16) + ADLER_BASE - rem;
+	if ( sum1 >= ADLER_BASE ) sum1 -= ADLER_BASE;
+	if ( sum1 >= ADLER_BASE ) sum1 -= ADLER_BASE;
+	if ( sum2 >= (ADLER_BASE << 1) ) sum2 -= (ADLER_BASE << 1);
+	if ( sum2 >= ADLER_BASE ) sum2 -= ADLER_BASE;
+	return sum1 | (sum2 << 16);
+}
+
+void AppendBigEndian(std::vector<unsigned char>& data, uint32_t value)
+{
+	data.push_back((unsigned char)(value >> 24));
+	data.push_back((unsigned char)(value >> 16));
+	data.push_back((unsigned char)(value >> 8));
+	data.push_back((unsigned char)value);
+}
+
+void AppendPngChunk(std::vector<unsigned char>& png, const char* type, const std::vector<unsigned char>& data)
+{
+	AppendBigEndian(png, (uint32_t)data.size());
+	const size_t typeOffset = png.size();
+	png.insert(png.end(), type, type + 4);
+	png.insert(png.end(), data.begin(), data.end());
+	AppendBigEndian(png, UpdateCrc(0xFFFFFFFFu, &png[typeOffset], png.size() - typeOffset) ^ 0xFFFFFFFFu);
+}
+
+
+////// deflate //////
+
+struct DeflateTables
+{
+	uint16_t lengthBase[29];
+	uint8_t lengthExtraBits[29];
+	uint16_t distanceBase[30];
+	uint8_t distanceExtraBits[30];
+
+	uint8_t lengthCode[MAX_MATCH + 1];    // match length -> length code ( symbol - 257 )
+	uint8_t distanceCode[WINDOW_SIZE + 1]; // distance -> distance code
+
+	DeflateTables()
+	{
+		static const uint16_t kLengthBase[29] = { 3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,43,51,59,67,83,99,115,131,163,195,227,258 };
+		static const uint8_t kLengthExtraBits[29] = { 0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0 };
+		static const uint16_t kDistanceBase[30] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577 };
+		static const uint8_t kDistanceExtraBits[30] = { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13 };
+		std::memcpy(lengthBase, kLengthBase, sizeof(lengthBase));
+		std::memcpy(lengthExtraBits, kLengthExtraBits, sizeof(lengthExtraBits));
+		std::memcpy(distanceBase, kDistanceBase, sizeof(distanceBase));
+		std::memcpy(distanceExtraBits, kDistanceExtraBits, sizeof(distanceExtraBits));
+
+		// in increasing order: 258 gets the code 28 and not the last value of the code 27
+		for(int code=0; code<29; code++)
+		{
+			for(int length=lengthBase[code]; length<lengthBase[code] + (1 << lengthExtraBits[code]) && length<=MAX_MATCH; length++)
+				lengthCode[length] = (uint8_t)code;
+		}
+		for(int code=0; code<30; code++)
+		{
+			for(int distance=distanceBase[code]; distance<distanceBase[code] + (1 << distanceExtraBits[code]) && distance<=WINDOW_SIZE; distance++)
+				distanceCode[distance] = (uint8_t)code;
+		}
+	}
+};
+
+const DeflateTables& GetDeflateTables()
+{
+	static const DeflateTables tables;
+	return tables;
+}
+
+// literal ( distance = 0, length = byte ) or match
+struct Symbol
+{
+	uint16_t length;
+	uint16_t distance;
+};
+
+class BitWriter
+{
+public:
+
+	explicit BitWriter(std::vector<unsigned char>& out) :
+		m_out(out)
+	{
+	}
+
+	// count bits of value, first bit first
+	void Put(uint32_t value, int count)
+	{
+		m_buffer |= (uint64_t)value << m_count;
+		m_count += count;
+		while ( m_count >= 8 )
+		{
+			m_out.push_back((unsigned char)m_buffer);
+			m_buffer >>= 8;
+			m_count -= 8;
+		}
+	}
+
+	void Align()
+	{
+		if ( m_count > 0 )
+			Put(0, 8 - m_count);
+	}
+
+	// only when aligned
+	void PutBytes(const unsigned char* data, size_t size)
+	{
+		m_out.insert(m_out.end(), data, data + size);
+	}
+
+private:
+
+	std::vector<unsigned char>& m_out;
+	uint64_t m_buffer = 0;
+	int m_count = 0;
+};
+
+// the decoders expect at least 2 codes in each tree
+void EnsureTwoCodes(uint32_t* frequencies, int numSymbols)
+{
+	int used = 0;
+	for(int i=0; i<numSymbols; i++)
+		used += frequencies[i] ? 1 : 0;
+	for(int i=0; i<numSymbols && used<2; i++)
+	{
+		if ( !frequencies[i] )
+		{
+			frequencies[i] = 1;
+			used++;
+		}
+	}
+}
+
+// Huffman code lengths of the symbols, limited to maxLength bits. 0 for the unused symbols.
+void BuildLengths(const uint32_t* frequencies, int numSymbols, int maxLength, uint8_t* lengths)
+{
+	std::fill(lengths, lengths + numSymbols, 0);
+
+	std::vector<int> used;
+	for(int i=0; i<numSymbols; i++)
+	{
+		if ( frequencies[i] )
+			used.push_back(i);
+	}
+	if ( used.size() < 2 )
+	{
+		for(int symbol : used)
+			lengths[symbol] = 1;
+		return;
+	}
+
+	// Huffman tree: the leaves are the used symbols, the nodes are created in increasing order and the last one is the root
+	const int numLeaves = (int)used.size();
+	std::vector<int> parent(numLeaves * 2 - 1, -1);
+	typedef std::pair<uint64_t, int> Node; // weight, index
+	std::priority_queue<Node, std::vector<Node>, std::greater<Node>> heap;
+	for(int i=0; i<numLeaves; i++)
+		heap.push(Node(frequencies[used[i]], i));
+	for(int node=numLeaves; node<numLeaves * 2 - 1; node++)
+	{
+		const Node a = heap.top(); heap.pop();
+		const Node b = heap.top(); heap.pop();
+		parent[a.second] = node;
+		parent[b.second] = node;
+		heap.push(Node(a.first + b.first, node));
+	}
+	std::vector<int> depth(numLeaves * 2 - 1, 0);
+	for(int node=numLeaves * 2 - 3; node>=0; node--)
+		depth[node] = depth[parent[node]] + 1;
+
+	// number of codes of each length, the longest ones moved to maxLength, then the tree rebalanced ( Kraft sum back to 1 )
+	std::vector<int> count(std::max(numLeaves, maxLength) + 1, 0);
+	for(int i=0; i<numLeaves; i++)
+		count[std::min(depth[i], maxLength)]++;
+	uint32_t total = 0;
+	for(int length=1; length<=maxLength; length++)
+		total += (uint32_t)count[length] << (maxLength - length);
+	while ( total > (1u << maxLength) )
+	{
+		count[maxLength]--;
+		for(int length=maxLength - 1; length>0; length--)
+		{
+			if ( count[length] )
+			{
+				count[length]--;
+				count[length + 1] += 2;
+				break;
+			}
+		}
+		total--;
+	}
+
+	// the least frequent symbols get the longest codes
+	std::stable_sort(used.begin(), used.end(), [frequencies](int a, int b) { return frequencies[a] < frequencies[b]; });
+	size_t next = 0;
+	for(int length=maxLength; length>0; length--)
+	{
+		for(int i=0; i<count[length]; i++)
+			lengths[used[next++]] = (uint8_t)length;
+	}
+}
+
+// canonical codes, bit reversed for BitWriter
+void BuildCodes(const uint8_t* lengths, int numSymbols, uint16_t* codes)
+{
+	int lengthCount[16] = {};
+	for(int i=0; i<numSymbols; i++)
+		lengthCount[lengths[i]]++;
+	lengthCount[0] = 0;
+
+	uint32_t nextCode[16] = {};
+	uint32_t code = 0;
+	for(int length=1; length<16; length++)
+	{
+		code = (code + lengthCount[length - 1]) << 1;
+		nextCode[length] = code;
+	}
+
+	for(int i=0; i<numSymbols; i++)
+	{
+		const int length = lengths[i];
+		if ( !length )
+			continue;
+		const uint32_t value = nextCode[length]++;
+		uint32_t reversed = 0;
+		for(int bit=0; bit<length; bit++)
+			reversed |= ((value >> bit) & 1) << (length - 1 - bit);
+		codes[i] = (uint16_t)reversed;
+	}
+}
+
+void WriteDynamicBlock(BitWriter& bits, const Symbol* symbols, size_t numSymbols, bool final)
+{
+	const DeflateTables& tables = GetDeflateTables();
+
+	uint32_t literalFrequencies[286] = {};
+	uint32_t distanceFrequencies[30] = {};
+	for(size_t i=0; i<numSymbols; i++)
+	{
+		if ( symbols[i].distance == 0 )
+		{
+			literalFrequencies[symbols[i].length]++;
+		}
+		else
+		{
+			literalFrequencies[257 + tables.lengthCode[symbols[i].length]]++;
+			distanceFrequencies[tables.distanceCode[symbols[i].distance]]++;
+		}
+	}
+	literalFrequencies[256] = 1; // end of block
+	EnsureTwoCodes(literalFrequencies, 286);
+	EnsureTwoCodes(distanceFrequencies, 30);
+
+	uint8_t literalLengths[286];
+	uint8_t distanceLengths[30];
+	uint16_t literalCodes[286];
+	uint16_t distanceCodes[30];
+	BuildLengths(literalFrequencies, 286, 15, literalLengths);
+	BuildLengths(distanceFrequencies, 30, 15, distanceLengths);
+	BuildCodes(literalLengths, 286, literalCodes);
+	BuildCodes(distanceLengths, 30, distanceCodes);
+
+	int numLiteralCodes = 286;
+	while ( numLiteralCodes > 257 && literalLengths[numLiteralCodes - 1] == 0 )
+		numLiteralCodes--;
+	int numDistanceCodes = 30;
+	while ( numDistanceCodes > 1 && distanceLengths[numDistanceCodes - 1] == 0 )
+		numDistanceCodes--;
+
+	// the code lengths of both trees, run-length encoded with the symbols 16 ( repeat 3-6 ), 17 ( 3-10 zeros ) and 18 ( 11-138 zeros )
+	std::vector<uint8_t> allLengths(literalLengths, literalLengths + numLiteralCodes);
+	allLengths.insert(allLengths.end(), distanceLengths, distanceLengths + numDistanceCodes);
+
+	std::vector<std::pair<uint8_t, uint8_t>> lengthSymbols; // symbol, extra bits value
+	for(size_t i=0; i<allLengths.size(); )
+	{
+		const uint8_t length = allLengths[i];
+		size_t run = 1;
+		while ( i + run < allLengths.size() && allLengths[i + run] == length )
+			run++;
+		i += run;
+
+		if ( length == 0 )
+		{
+			while ( run >= 11 )
+			{
+				const size_t n = std::min<size_t>(run, 138);
+				lengthSymbols.push_back(std::make_pair((uint8_t)18, (uint8_t)(n - 11)));
+				run -= n;
+			}
+			if ( run >= 3 )
+			{
+				lengthSymbols.push_back(std::make_pair((uint8_t)17, (uint8_t)(run - 3)));
+				run = 0;
+			}
+		}
+		else
+		{
+			lengthSymbols.push_back(std::make_pair(length, (uint8_t)0));
+			run--;
+			while ( run >= 3 )
+			{
+				const size_t n = std::min<size_t>(run, 6);
+				lengthSymbols.push_back(std::make_pair((uint8_t)16, (uint8_t)(n - 3)));
+				run -= n;
+			}
+		}
+		for( ; run>0; run--)
+			lengthSymbols.push_back(std::make_pair(length, (uint8_t)0));
+	}
+
+	uint32_t lengthFrequencies[19] = {};
+	for(const auto& lengthSymbol : lengthSymbols)
+		lengthFrequencies[lengthSymbol.first]++;
+	EnsureTwoCodes(lengthFrequencies, 19);
+	uint8_t lengthLengths[19];
+	uint16_t lengthCodes[19];
+	BuildLengths(lengthFrequencies, 19, 7, lengthLengths);
+	BuildCodes(lengthLengths, 19, lengthCodes);
+
+	static const uint8_t kLengthOrder[19] = { 16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15 };
+	int numLengthCodes = 19;
+	while ( numLengthCodes > 4 && lengthLengths[kLengthOrder[numLengthCodes - 1]] == 0 )
+		numLengthCodes--;
+
+	// header
+	bits.Put(final ? 1 : 0, 1);
+	bits.Put(2, 2); // dynamic Huffman codes
+	bits.Put(numLiteralCodes - 257, 5);
+	bits.Put(numDistanceCodes - 1, 5);
+	bits.Put(numLengthCodes - 4, 4);
+	for(int i=0; i<numLengthCodes; i++)
+		bits.Put(lengthLengths[kLengthOrder[i]], 3);
+	static const int kLengthSymbolExtraBits[3] = { 2, 3, 7 };
+	for(const auto& lengthSymbol : lengthSymbols)
+	{
+		bits.Put(lengthCodes[lengthSymbol.first], lengthLengths[lengthSymbol.first]);
+		if ( lengthSymbol.first >= 16 )
+			bits.Put(lengthSymbol.second, kLengthSymbolExtraBits[lengthSymbol.first - 16]);
+	}
+
+	// data
+	for(size_t i=0; i<numSymbols; i++)
+	{
+		const Symbol& symbol = symbols[i];
+		if ( symbol.distance == 0 )
+		{
+			bits.Put(literalCodes[symbol.length], literalLengths[symbol.length]);
+			continue;
+		}
+		const int lengthCode = tables.lengthCode[symbol.length];
+		bits.Put(literalCodes[257 + lengthCode], literalLengths[257 + lengthCode]);
+		if ( tables.lengthExtraBits[lengthCode] )
+			bits.Put(symbol.length - tables.lengthBase[lengthCode], tables.lengthExtraBits[lengthCode]);
+		const int distanceCode = tables.distanceCode[symbol.distance];
+		bits.Put(distanceCodes[distanceCode], distanceLengths[distanceCode]);
+		if ( tables.distanceExtraBits[distanceCode] )
+			bits.Put(symbol.distance - tables.distanceBase[distanceCode], tables.distanceExtraBits[distanceCode]);
+	}
+	bits.Put(literalCodes[256], literalLengths[256]);
+}
+
+void WriteStoredBlocks(BitWriter& bits, const unsigned char* data, size_t size, bool final)
+{
+	do
+	{
+		const size_t n = std::min<size_t>(size, 65535);
+		bits.Put(final && n == size ? 1 : 0, 1);
+		bits.Put(0, 2); // stored
+		bits.Align();
+		bits.Put((uint32_t)n, 16);
+		bits.Put((uint32_t)~n & 0xFFFF, 16);
+		bits.PutBytes(data, n);
+		data += n;
+		size -= n;
+	}
+	while ( size > 0 );
+}
+
+uint32_t Read32(const unsigned char* data)
+{
+	uint32_t value;
+	std::memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+uint32_t Hash(const unsigned char* data)
+{
+	return (Read32(data) * 2654435761u) >> (32 - HASH_BITS);
+}
+
+int MatchLength(const unsigned char* a, const unsigned char* b, int maxLength)
+{
+	int length = 0;
+	while ( length < maxLength && a[length] == b[length] )
+		length++;
+	return length;
+}
+
+// LZ77 symbols of data, which doesn't reference anything before it
+void FindMatches(const unsigned char* data, size_t size, RPRPngWriter::Compression compression, std::vector<Symbol>& symbols)
+{
+	symbols.clear();
+	symbols.reserve(size / 2);
+
+	auto literal = [&](size_t i) { symbols.push_back({ data[i], 0 }); };
+
+	if ( compression == RPRPngWriter::COMPRESSION_RLE )
+	{
+		// repeats of the previous byte only ( distance 1 )
+		size_t i = 0;
+		if ( size > 0 )
+			literal(i++);
+		while ( i < size )
+		{
+			const int maxLength = (int)std::min<size_t>(MAX_MATCH, size - i);
+			const int length = MatchLength(data + i - 1, data + i, maxLength);
+			if ( length >= 3 )
+			{
+				symbols.push_back({ (uint16_t)length, 1 });
+				i += length;
+			}
+			else
+			{
+				literal(i++);
+			}
+		}
+		return;
+	}
+
+	const bool useChains = compression == RPRPngWriter::COMPRESSION_DEFAULT;
+	std::vector<int32_t> head(size_t(1) << HASH_BITS, -1);
+	std::vector<int32_t> previous(useChains ? size : 0);
+
+	auto insert = [&](size_t i) -> int32_t
+	{
+		const uint32_t h = Hash(data + i);
+		const int32_t candidate = head[h];
+		head[h] = (int32_t)i;
+		if ( useChains )
+			previous[i] = candidate;
+		return candidate;
+	};
+
+	size_t i = 0;
+	while ( i + MIN_MATCH <= size )
+	{
+		const int maxLength = (int)std::min<size_t>(MAX_MATCH, size - i);
+		int32_t candidate = insert(i);
+
+		int bestLength = 0;
+		int bestDistance = 0;
+		for(int chain=0; candidate>=0 && (int)i - candidate <= WINDOW_SIZE && chain < (useChains ? MAX_CHAIN : 1); chain++)
+		{
+			if ( Read32(data + candidate) == Read32(data + i) )
+			{
+				const int length = MatchLength(data + candidate, data + i, maxLength);
+				if ( length > bestLength )
+				{
+					bestLength = length;
+					bestDistance = (int)i - candidate;
+					if ( length == maxLength )
+						break;
+				}
+			}
+			if ( !useChains )
+				break;
+			candidate = previous[candidate];
+		}
+
+		if ( bestLength >= MIN_MATCH )
+		{
+			symbols.push_back({ (uint16_t)bestLength, (uint16_t)bestDistance });
+			// FAST only indexes the start of the matches
+			if ( useChains )
+			{
+				for(size_t j=i + 1; j<i + bestLength && j + MIN_MATCH <= size; j++)
+					insert(j);
+			}
+			i += bestLength;
+		}
+		else
+		{
+			literal(i++);
+		}
+	}
+	while ( i < size )
+		literal(i++);
+}
+
+
+////// filters //////
+
+unsigned char Paeth(int a, int b, int c)
+{
+	const int p = a + b - c;
+	const int pa = std::abs(p - a);
+	const int pb = std::abs(p - b);
+	const int pc = std::abs(p - c);
+	if ( pa <= pb && pa <= pc )
+		return (unsigned char)a;
+	return (unsigned char)(pb <= pc ? b : c);
+}
+
+// filter type byte + filtered row. The filter with the smallest sum of absolute values is kept.
+void FilterRow(const unsigned char* row, const unsigned char* previousRow, size_t rowBytes, size_t bpp, bool chooseFilter, std::vector<unsigned char>& scratch, unsigned char* out)
+{
+	if ( !chooseFilter )
+	{
+		out[0] = 0;
+		std::memcpy(out + 1, row, rowBytes);
+		return;
+	}
+
+	scratch.resize(rowBytes * 5);
+	unsigned char* filtered[5];
+	for(int f=0; f<5; f++)
+		filtered[f] = &scratch[rowBytes * f];
+
+	for(size_t x=0; x<rowBytes; x++)
+	{
+		const int a = x >= bpp ? row[x - bpp] : 0;
+		const int b = previousRow[x];
+		const int c = x >= bpp ? previousRow[x - bpp] : 0;
+		filtered[0][x] = row[x];
+		filtered[1][x] = (unsigned char)(row[x] - a);
+		filtered[2][x] = (unsigned char)(row[x] - b);
+		filtered[3][x] = (unsigned char)(row[x] - ((a + b) >> 1));
+		filtered[4][x] = (unsigned char)(row[x] - Paeth(a, b, c));
+	}
+
+	int bestFilter = 0;
+	uint64_t bestSum = UINT64_MAX;
+	for(int f=0; f<5; f++)
+	{
+		uint64_t sum = 0;
+		for(size_t x=0; x<rowBytes; x++)
+			sum += (uint64_t)std::abs((int)(signed char)filtered[f][x]);
+		if ( sum < bestSum )
+		{
+			bestSum = sum;
+			bestFilter = f;
+		}
+	}
+
+	out[0] = (unsigned char)bestFilter;
+	std::memcpy(out + 1, filtered[bestFilter], rowBytes);
+}
+
+unsigned char FloatToByte(float value)
+{
+	// NaN fails the comparison and gives 0
+	if ( !(value > 0.0f) )
+		return 0;
+	if ( value >= 1.0f )
+		return 255;
+	return (unsigned char)(value * 255.0f);
+}
+
+uint16_t FloatToShort(float value)
+{
+	if ( !(value > 0.0f) )
+		return 0;
+	if ( value >= 1.0f )
+		return 65535;
+	return (uint16_t)(value * 65535.0f + 0.5f);
+}
+
+}
+
+
+void RPRPngWriter::ImageDesc::GetRow(unsigned y, unsigned char* row) const
+{
+	const size_t numValues = (size_t)width * numComponents;
+	if ( type == TYPE_UINT8 )
+	{
+		std::memcpy(row, (const unsigned char*)pixels + numValues * y, numValues);
+		return;
+	}
+
+	if ( type == TYPE_UINT16 )
+	{
+		const uint16_t* values = (const uint16_t*)pixels + numValues * y;
+		for(size_t i=0; i<numValues; i++)
+		{
+			row[i * 2 + 0] = (unsigned char)(values[i] >> 8);
+			row[i * 2 + 1] = (unsigned char)values[i];
+		}
+		return;
+	}
+
+	// float: converted to bitDepth, the alpha channel is dropped when outputComponents < numComponents
+	const float* values = (const float*)pixels + numValues * y;
+	for(unsigned x=0; x<width; x++)
+	{
+		for(unsigned c=0; c<outputComponents; c++)
+		{
+			const float value = values[(size_t)x * numComponents + c];
+			const size_t index = (size_t)x * outputComponents + c;
+			if ( bitDepth == 16 )
+			{
+				const uint16_t value16 = FloatToShort(value);
+				row[index * 2 + 0] = (unsigned char)(value16 >> 8);
+				row[index * 2 + 1] = (unsigned char)value16;
+			}
+			else
+			{
+				row[index] = FloatToByte(value);
+			}
+		}
+	}
+}
+
+
+RPRPngWriter::RPRPngWriter(const Settings& settings) :
+	m_settings(settings)
+{
+}
+
+RPRPngWriter::RPRPngWriter() :
+	RPRPngWriter(Settings())
+{
+}
+
+rpr_status RPRPngWriter::Encode(const unsigned char* pixels, unsigned width, unsigned height, unsigned numComponents, std::vector<unsigned char>& png)
+{
+	ImageDesc image;
+	image.pixels = pixels;
+	image.type = ImageDesc::TYPE_UINT8;
+	image.width = width;
+	image.height = height;
+	image.numComponents = numComponents;
+	image.outputComponents = numComponents;
+	image.bitDepth = 8;
+	return EncodeImage(image, png);
+}
+
+rpr_status RPRPngWriter::Encode(const uint16_t* pixels, unsigned width, unsigned height, unsigned numComponents, std::vector<unsigned char>& png)
+{
+	ImageDesc image;
+	image.pixels = pixels;
+	image.type = ImageDesc::TYPE_UINT16;
+	image.width = width;
+	image.height = height;
+	image.numComponents = numComponents;
+	image.outputComponents = numComponents;
+	image.bitDepth = 16;
+	return EncodeImage(image, png);
+}
+
+rpr_status RPRPngWriter::Encode(const float* pixels, unsigned width, unsigned height, unsigned numComponents, std::vector<unsigned char>& png)
+{
+	if ( m_settings.bitDepth != 8 && m_settings.bitDepth != 16 )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	ImageDesc image;
+	image.pixels = pixels;
+	image.type = ImageDesc::TYPE_FLOAT;
+	image.width = width;
+	image.height = height;
+	image.numComponents = numComponents;
+	image.outputComponents = !m_settings.alpha && (numComponents == 2 || numComponents == 4) ? numComponents - 1 : numComponents;
+	image.bitDepth = m_settings.bitDepth;
+	return EncodeImage(image, png);
+}
+
+rpr_status RPRPngWriter::Write(const std::string& filePath, const unsigned char* pixels, unsigned width, unsigned height, unsigned numComponents)
+{
+	std::vector<unsigned char> png;
+	const rpr_status status = Encode(pixels, width, height, numComponents, png);
+	return status == RPR_SUCCESS ? WriteFile(filePath, png) : status;
+}
+
+rpr_status RPRPngWriter::Write(const std::string& filePath, const uint16_t* pixels, unsigned width, unsigned height, unsigned numComponents)
+{
+	std::vector<unsigned char> png;
+	const rpr_status status = Encode(pixels, width, height, numComponents, png);
+	return status == RPR_SUCCESS ? WriteFile(filePath, png) : status;
+}
+
+rpr_status RPRPngWriter::Write(const std::string& filePath, const float* pixels, unsigned width, unsigned height, unsigned numComponents)
+{
+	std::vector<unsigned char> png;
+	const rpr_status status = Encode(pixels, width, height, numComponents, png);
+	return status == RPR_SUCCESS ? WriteFile(filePath, png) : status;
+}
+
+rpr_status RPRPngWriter::WriteFrameBuffer(rpr_framebuffer framebuffer, const std::string& filePath)
+{
+	rpr_framebuffer_format format = {};
+	rpr_framebuffer_desc desc = {};
+	rpr_status status = rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_FORMAT, sizeof(format), &format, nullptr);
+	if ( status == RPR_SUCCESS )
+		status = rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_DESC, sizeof(desc), &desc, nullptr);
+	if ( status != RPR_SUCCESS )
+		return status;
+	if ( format.type != RPR_COMPONENT_TYPE_FLOAT32 )
+		return RPR_ERROR_UNSUPPORTED;
+
+	size_t size = 0;
+	status = rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_DATA, 0, nullptr, &size);
+	if ( status != RPR_SUCCESS )
+		return status;
+	if ( size != (size_t)desc.fb_width * desc.fb_height * format.num_components * sizeof(float) )
+		return RPR_ERROR_INTERNAL_ERROR;
+
+	std::vector<float> pixels(size / sizeof(float));
+	status = rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_DATA, size, pixels.data(), nullptr);
+	if ( status != RPR_SUCCESS )
+		return status;
+
+	return Write(filePath, pixels.data(), desc.fb_width, desc.fb_height, format.num_components);
+}
+
+rpr_status RPRPngWriter::EncodeImage(const ImageDesc& image, std::vector<unsigned char>& png)
+{
+	if ( !image.pixels || image.width == 0 || image.height == 0 || image.numComponents == 0 || image.numComponents > 4 )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	const auto start = std::chrono::steady_clock::now();
+
+	const size_t rowBytes = image.GetRowBytes();
+	const size_t bpp = image.outputComponents * (image.bitDepth / 8);
+	const bool chooseFilter = m_settings.compression != COMPRESSION_STORE;
+	const unsigned rowsPerChunk = (unsigned)std::max<size_t>(1, std::min<size_t>(m_settings.chunkBytes / rowBytes, image.height));
+	const unsigned numChunks = (image.height + rowsPerChunk - 1) / rowsPerChunk;
+
+	struct Chunk
+	{
+		std::vector<unsigned char> deflate; // byte aligned deflate blocks
+		uint32_t adler = 1;                 // of the filtered rows
+		size_t filteredBytes = 0;
+	};
+	std::vector<Chunk> chunks(numChunks);
+
+	// each thread takes the next chunk until all are done
+	std::atomic<unsigned> nextChunk(0);
+	auto encodeChunks = [&]()
+	{
+		std::vector<unsigned char> rows[2] = { std::vector<unsigned char>(rowBytes, 0), std::vector<unsigned char>(rowBytes, 0) };
+		std::vector<unsigned char> filtered;
+		std::vector<unsigned char> scratch;
+		std::vector<Symbol> symbols;
+
+		for(unsigned c=nextChunk++; c<numChunks; c=nextChunk++)
+		{
+			const unsigned rowBegin = c * rowsPerChunk;
+			const unsigned rowEnd = std::min(rowBegin + rowsPerChunk, image.height);
+
+			// the filters of the first row use the last row of the previous chunk, or zeros
+			unsigned char* previousRow = rows[0].data();
+			unsigned char* row = rows[1].data();
+			if ( rowBegin > 0 )
+				image.GetRow(rowBegin - 1, previousRow);
+			else
+				std::fill(rows[0].begin(), rows[0].end(), (unsigned char)0);
+
+			filtered.resize((rowEnd - rowBegin) * (rowBytes + 1));
+			for(unsigned y=rowBegin; y<rowEnd; y++)
+			{
+				image.GetRow(y, row);
+				FilterRow(row, previousRow, rowBytes, bpp, chooseFilter, scratch, &filtered[(y - rowBegin) * (rowBytes + 1)]);
+				std::swap(row, previousRow);
+			}
+
+			Chunk& chunk = chunks[c];
+			chunk.adler = UpdateAdler(1, filtered.data(), filtered.size());
+			chunk.filteredBytes = filtered.size();
+
+			const bool final = c == numChunks - 1;
+			BitWriter bits(chunk.deflate);
+			if ( m_settings.compression == COMPRESSION_STORE )
+			{
+				WriteStoredBlocks(bits, filtered.data(), filtered.size(), final);
+				continue;
+			}
+
+			FindMatches(filtered.data(), filtered.size(), m_settings.compression, symbols);
+			for(size_t s=0; s<symbols.size(); s+=BLOCK_SYMBOLS)
+			{
+				const size_t n = std::min(BLOCK_SYMBOLS, symbols.size() - s);
+				WriteDynamicBlock(bits, &symbols[s], n, final && s + n == symbols.size());
+			}
+			if ( symbols.empty() )
+				WriteStoredBlocks(bits, nullptr, 0, final);
+
+			if ( !final )
+			{
+				// empty stored block: the next chunk starts on a byte boundary
+				bits.Put(0, 3);
+				bits.Align();
+				bits.Put(0x0000, 16);
+				bits.Put(0xFFFF, 16);
+			}
+			bits.Align();
+		}
+	};
+
+	const unsigned hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+	const unsigned numThreads = std::min(m_settings.numThreads ? m_settings.numThreads : hardwareThreads, numChunks);
+	std::vector<std::thread> threads;
+	for(unsigned i=1; i<numThreads; i++)
+		threads.emplace_back(encodeChunks);
+	encodeChunks();
+	for(auto& thread : threads)
+		thread.join();
+
+	// signature, IHDR, one IDAT per chunk ( the zlib header in the first, the Adler-32 in the last ), IEND
+	static const unsigned char kSignature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	static const unsigned char kColorTypes[5] = { 0, 0, 4, 2, 6 }; // by number of components: gray, gray alpha, RGB, RGBA
+
+	size_t totalSize = sizeof(kSignature) + 25 + 12 + 6;
+	for(const Chunk& chunk : chunks)
+		totalSize += chunk.deflate.size() + 12;
+	png.clear();
+	png.reserve(totalSize + 16);
+	png.insert(png.end(), kSignature, kSignature + sizeof(kSignature));
+
+	std::vector<unsigned char> header;
+	AppendBigEndian(header, image.width);
+	AppendBigEndian(header, image.height);
+	header.push_back((unsigned char)image.bitDepth);
+	header.push_back(kColorTypes[image.outputComponents]);
+	header.push_back(0); // deflate
+	header.push_back(0); // adaptive filters
+	header.push_back(0); // no interlace
+	AppendPngChunk(png, "IHDR", header);
+
+	uint32_t adler = 1;
+	for(unsigned c=0; c<numChunks; c++)
+	{
+		const Chunk& chunk = chunks[c];
+		adler = c == 0 ? chunk.adler : CombineAdler(adler, chunk.adler, chunk.filteredBytes);
+
+		std::vector<unsigned char> prefix;
+		std::vector<unsigned char> suffix;
+		if ( c == 0 )
+		{
+			prefix.push_back(ZLIB_CMF);
+			// FLG: compression level hint, and check bits so that CMF.FLG is a multiple of 31
+			const unsigned level = m_settings.compression == COMPRESSION_DEFAULT ? 2 : 0;
+			unsigned flag = level << 6;
+			flag += 31 - ((ZLIB_CMF * 256 + flag) % 31);
+			prefix.push_back((unsigned char)flag);
+		}
+		if ( c == numChunks - 1 )
+			AppendBigEndian(suffix, adler);
+
+		AppendBigEndian(png, (uint32_t)(prefix.size() + chunk.deflate.size() + suffix.size()));
+		const size_t typeOffset = png.size();
+		png.insert(png.end(), { 'I', 'D', 'A', 'T' });
+		png.insert(png.end(), prefix.begin(), prefix.end());
+		png.insert(png.end(), chunk.deflate.begin(), chunk.deflate.end());
+		png.insert(png.end(), suffix.begin(), suffix.end());
+		AppendBigEndian(png, UpdateCrc(0xFFFFFFFFu, &png[typeOffset], png.size() - typeOffset) ^ 0xFFFFFFFFu);
+	}
+
+	AppendPngChunk(png, "IEND", std::vector<unsigned char>());
+
+	m_stats.imagesEncoded++;
+	m_stats.rawBytes += rowBytes * image.height;
+	m_stats.fileBytes += png.size();
+	m_stats.encodeSeconds += SecondsSince(start);
+	return RPR_SUCCESS;
+}
+
+rpr_status RPRPngWriter::WriteFile(const std::string& filePath, const std::vector<unsigned char>& png)
+{
+	FILE* file = std::fopen(filePath.c_str(), "wb");
+	if ( !file )
+		return RPR_ERROR_IO_ERROR;
+	bool ok = std::fwrite(png.data(), 1, png.size(), file) == png.size();
+	ok = std::fclose(file) == 0 && ok;
+	return ok ? RPR_SUCCESS : RPR_ERROR_IO_ERROR;
+}
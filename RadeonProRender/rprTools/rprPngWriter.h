@@ -0,0 +1,114 @@
+/*****************************************************************************\
+*
+*  Module Name    rprPngWriter.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <RadeonProRender.h>
+
+// PNG encoder for frame dumps, faster than stbi_write_png on large images.
+//
+// The scanlines are cut in chunks of about chunkBytes, and each chunk is filtered and deflated independently by a pool of threads:
+// a chunk doesn't reference the data of the previous one, and ends on a byte boundary ( empty stored block ), so that the
+// compressed chunks are simply concatenated, each one in its own IDAT. The Adler-32 of the chunks are combined at the end.
+//
+// Compression presets:
+//  - STORE   : stored deflate blocks, no filter. The file is as large as the raw data, but the encoding only copies it.
+//  - RLE     : only repeats of the previous byte, on filtered rows.
+//  - FAST    : one match candidate per position ( hash of 4 bytes ), on filtered rows.
+//  - DEFAULT : hash chains, better ratio for a lower speed.
+// The blocks use dynamic Huffman codes, except in STORE.
+//
+// The inputs can be 8-bit or 16-bit pixels ( gray, gray+alpha, RGB, RGBA ), or the float RGBA data of a resolved framebuffer,
+// converted to bitDepth bits ( values clamped to [0,1] ).
+//
+// Usage:
+//   RPRPngWriter::Settings settings;
+//   settings.compression = RPRPngWriter::COMPRESSION_FAST;
+//   RPRPngWriter pngWriter(settings);
+//   pngWriter.WriteFrameBuffer(frame_buffer_resolved, "frame.png");
+//
+// An instance encodes one image at a time.
+class RPRPngWriter
+{
+public:
+
+	enum Compression
+	{
+		COMPRESSION_STORE,
+		COMPRESSION_RLE,
+		COMPRESSION_FAST,
+		COMPRESSION_DEFAULT,
+	};
+
+	struct Settings
+	{
+		Compression compression = COMPRESSION_FAST;
+
+		/// Bits per channel of the file for the float inputs: 8 or 16.
+		unsigned bitDepth = 8;
+
+		/// Keep the alpha channel of the float inputs. Without it, RGBA framebuffers are written as RGB.
+		bool alpha = true;
+
+		/// Threads encoding the chunks. 0: one per hardware thread.
+		unsigned numThreads = 0;
+
+		/// Raw scanline bytes compressed independently, at least one row.
+		size_t chunkBytes = size_t(256) << 10;
+	};
+
+	struct Stats
+	{
+		size_t imagesEncoded = 0;
+
+		/// bytes of the raw scanlines and of the PNG files.
+		size_t rawBytes = 0;
+		size_t fileBytes = 0;
+
+		double encodeSeconds = 0.0;
+	};
+
+	RPRPngWriter(const Settings& settings);
+	RPRPngWriter();
+
+	RPRPngWriter(const RPRPngWriter&) = delete;
+	RPRPngWriter& operator=(const RPRPngWriter&) = delete;
+
+	/// Encode width x height pixels of numComponents ( 1 to 4 ) values into the PNG file data png.
+	/// The 8-bit and 16-bit pixels are written with their own depth, the float pixels with settings.bitDepth.
+	rpr_status Encode(const unsigned char* pixels, unsigned width, unsigned height, unsigned numComponents, std::vector<unsigned char>& png);
+	rpr_status Encode(const uint16_t* pixels, unsigned width, unsigned height, unsigned numComponents, std::vector<unsigned char>& png);
+	rpr_status Encode(const float* pixels, unsigned width, unsigned height, unsigned numComponents, std::vector<unsigned char>& png);
+
+	/// Encode and write to filePath.
+	rpr_status Write(const std::string& filePath, const unsigned char* pixels, unsigned width, unsigned height, unsigned numComponents);
+	rpr_status Write(const std::string& filePath, const uint16_t* pixels, unsigned width, unsigned height, unsigned numComponents);
+	rpr_status Write(const std::string& filePath, const float* pixels, unsigned width, unsigned height, unsigned numComponents);
+
+	/// Read the float data of framebuffer ( rprFrameBufferGetInfo ) and write it to filePath.
+	rpr_status WriteFrameBuffer(rpr_framebuffer framebuffer, const std::string& filePath);
+
+	Stats GetStats() const { return m_stats; }
+
+private:
+
+	struct ImageDesc;
+
+	rpr_status EncodeImage(const ImageDesc& image, std::vector<unsigned char>& png);
+	rpr_status WriteFile(const std::string& filePath, const std::vector<unsigned char>& png);
+
+	Settings m_settings;
+	Stats m_stats;
+};
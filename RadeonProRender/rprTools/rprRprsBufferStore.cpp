@@ -0,0 +1,614 @@
+/*****************************************************************************\
+*
+*  Module Name    rprRprsBufferStore.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#include "rprRprsBufferStore.h"
+
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <thread>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(RPR_BUFFERSTORE_ZSTD)
+#include <zstd.h>
+#endif
+
+
+namespace
+{
+
+const char* const COMPRESSED_EXTENSION = ".zst";
+const char* const MANIFEST_HEADER = "# RPRS external buffers 1";
+
+
+////// file system helpers //////
+
+bool IsSeparator(char c)
+{
+	return c == '/' || c == '\\';
+}
+
+std::string JoinPath(const std::string& directory, const std::string& name)
+{
+	if ( directory.empty() )
+		return name;
+	if ( IsSeparator(directory.back()) )
+		return directory + name;
+	return directory + "/" + name;
+}
+
+std::string ParentDirectory(const std::string& path)
+{
+	size_t pos = path.size();
+	while ( pos > 0 && !IsSeparator(path[pos-1]) )
+		pos--;
+	while ( pos > 1 && IsSeparator(path[pos-1]) )
+		pos--;
+	return path.substr(0, pos);
+}
+
+std::string BaseName(const std::string& path)
+{
+	size_t pos = path.size();
+	while ( pos > 0 && !IsSeparator(path[pos-1]) )
+		pos--;
+	return path.substr(pos);
+}
+
+// the file names of a manifest must stay inside the work directory: relative, without ".." component, drive letter or UNC prefix.
+bool IsSafeRelativePath(const std::string& path)
+{
+	if ( path.empty() || IsSeparator(path[0]) || path.find(':') != std::string::npos )
+		return false;
+	size_t begin = 0;
+	while ( begin <= path.size() )
+	{
+		size_t end = begin;
+		while ( end < path.size() && !IsSeparator(path[end]) )
+			end++;
+		if ( path.compare(begin, end - begin, "..") == 0 )
+			return false;
+		begin = end + 1;
+	}
+	return true;
+}
+
+bool FileExists(const std::string& path)
+{
+#if defined(_WIN32)
+	const DWORD attributes = GetFileAttributesA(path.c_str());
+	return attributes != INVALID_FILE_ATTRIBUTES && !(attributes & FILE_ATTRIBUTE_DIRECTORY);
+#else
+	struct stat fileStat;
+	return stat(path.c_str(), &fileStat) == 0 && S_ISREG(fileStat.st_mode);
+#endif
+}
+
+bool MakeDirectory(const std::string& path)
+{
+	if ( path.empty() )
+		return true;
+#if defined(_WIN32)
+	const DWORD attributes = GetFileAttributesA(path.c_str());
+	if ( attributes != INVALID_FILE_ATTRIBUTES )
+		return (attributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+	if ( !MakeDirectory(ParentDirectory(path)) )
+		return false;
+	return CreateDirectoryA(path.c_str(), nullptr) || GetLastError() == ERROR_ALREADY_EXISTS;
+#else
+	struct stat fileStat;
+	if ( stat(path.c_str(), &fileStat) == 0 )
+		return S_ISDIR(fileStat.st_mode);
+	if ( !MakeDirectory(ParentDirectory(path)) )
+		return false;
+	return mkdir(path.c_str(), 0755) == 0 || errno == EEXIST;
+#endif
+}
+
+// list the files of a directory and its sub-directories, relative to directory.
+// subDirectories receives the sub-directories, children before parents.
+void ListFiles(const std::string& directory, const std::string& relative, std::vector<std::string>& files, std::vector<std::string>& subDirectories)
+{
+	const std::string path = JoinPath(directory, relative);
+#if defined(_WIN32)
+	WIN32_FIND_DATAA findData;
+	HANDLE find = FindFirstFileA(JoinPath(path, "*").c_str(), &findData);
+	if ( find == INVALID_HANDLE_VALUE )
+		return;
+	do
+	{
+		const std::string name = findData.cFileName;
+		if ( name == "." || name == ".." )
+			continue;
+		const std::string child = JoinPath(relative, name);
+		if ( findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY )
+		{
+			ListFiles(directory, child, files, subDirectories);
+			subDirectories.push_back(child);
+		}
+		else
+			files.push_back(child);
+	} while ( FindNextFileA(find, &findData) );
+	FindClose(find);
+#else
+	DIR* dir = opendir(path.c_str());
+	if ( !dir )
+		return;
+	while ( dirent* entry = readdir(dir) )
+	{
+		const std::string name = entry->d_name;
+		if ( name == "." || name == ".." )
+			continue;
+		const std::string child = JoinPath(relative, name);
+		struct stat fileStat;
+		if ( stat(JoinPath(directory, child).c_str(), &fileStat) != 0 )
+			continue;
+		if ( S_ISDIR(fileStat.st_mode) )
+		{
+			ListFiles(directory, child, files, subDirectories);
+			subDirectories.push_back(child);
+		}
+		else
+			files.push_back(child);
+	}
+	closedir(dir);
+#endif
+}
+
+bool RemoveEmptyDirectory(const std::string& path)
+{
+#if defined(_WIN32)
+	return RemoveDirectoryA(path.c_str()) != 0;
+#else
+	return rmdir(path.c_str()) == 0;
+#endif
+}
+
+bool ReadWholeFile(const std::string& fileName, std::vector<char>& data)
+{
+	std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+	if ( !file )
+		return false;
+	data.resize((size_t)file.tellg());
+	file.seekg(0);
+	return (bool)file.read(data.data(), data.size());
+}
+
+bool WriteWholeFile(const std::string& fileName, const char* data, size_t size)
+{
+	std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+	if ( !file )
+		return false;
+	file.write(data, size);
+	file.close();
+	return !file.fail();
+}
+
+bool CopyFileData(const std::string& source, const std::string& destination)
+{
+	std::vector<char> data;
+	return ReadWholeFile(source, data) && WriteWholeFile(destination, data.data(), data.size());
+}
+
+// rename, replacing destination. Falls back to a copy when the two paths are not on the same volume.
+bool MoveFileReplace(const std::string& source, const std::string& destination)
+{
+#if defined(_WIN32)
+	if ( MoveFileExA(source.c_str(), destination.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_COPY_ALLOWED) )
+		return true;
+#else
+	if ( rename(source.c_str(), destination.c_str()) == 0 )
+		return true;
+#endif
+	if ( !CopyFileData(source, destination) )
+		return false;
+	std::remove(source.c_str());
+	return true;
+}
+
+bool LinkOrCopyFile(const std::string& source, const std::string& destination, bool hardLink)
+{
+	std::remove(destination.c_str());
+	if ( hardLink )
+	{
+#if defined(_WIN32)
+		if ( CreateHardLinkA(destination.c_str(), source.c_str(), nullptr) )
+			return true;
+#else
+		if ( link(source.c_str(), destination.c_str()) == 0 )
+			return true;
+#endif
+	}
+	return CopyFileData(source, destination);
+}
+
+// unique name in the directory of path, so that concurrent writers never write the same file.
+std::string TemporaryName(const std::string& path)
+{
+	static std::atomic<unsigned int> counter(0);
+	std::ostringstream name;
+	name << path << ".tmp" << std::hash<std::thread::id>()(std::this_thread::get_id()) << "_"
+		<< std::chrono::steady_clock::now().time_since_epoch().count() << "_" << counter++;
+	return name.str();
+}
+
+// write the file under a temporary name then rename it, so that a reader never sees a partial file.
+bool WriteFileAtomic(const std::string& fileName, const char* data, size_t size)
+{
+	const std::string temporary = TemporaryName(fileName);
+	if ( !WriteWholeFile(temporary, data, size) )
+	{
+		std::remove(temporary.c_str());
+		return false;
+	}
+	if ( !MoveFileReplace(temporary, fileName) )
+	{
+		std::remove(temporary.c_str());
+		return false;
+	}
+	return true;
+}
+
+
+////// xxHash64 //////
+
+const uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+const uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+const uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+const uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+uint64_t RotateLeft(uint64_t x, int r)
+{
+	return (x << r) | (x >> (64 - r));
+}
+
+uint64_t Read64(const unsigned char* p)
+{
+	uint64_t v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+uint32_t Read32(const unsigned char* p)
+{
+	uint32_t v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+uint64_t HashRound(uint64_t acc, uint64_t input)
+{
+	acc += input * PRIME64_2;
+	acc = RotateLeft(acc, 31);
+	return acc * PRIME64_1;
+}
+
+uint64_t HashMerge(uint64_t acc, uint64_t value)
+{
+	acc ^= HashRound(0, value);
+	return acc * PRIME64_1 + PRIME64_4;
+}
+
+std::string ObjectName(const std::vector<char>& data)
+{
+	char name[64];
+	snprintf(name, sizeof(name), "%016llx-%llx", (unsigned long long)RPRRprsBufferStore::Hash(data.data(), data.size()), (unsigned long long)data.size());
+	return name;
+}
+
+// name written by ObjectName for a file of this size: 16 lowercase hex digits, '-', the size in lowercase hex.
+bool IsValidObjectName(const std::string& object, size_t size)
+{
+	if ( object.size() < 18 || object[16] != '-' )
+		return false;
+	for(size_t i=0; i<16; i++)
+	{
+		if ( !( (object[i] >= '0' && object[i] <= '9') || (object[i] >= 'a' && object[i] <= 'f') ) )
+			return false;
+	}
+	char sizeText[32];
+	snprintf(sizeText, sizeof(sizeText), "%llx", (unsigned long long)size);
+	return object.compare(17, std::string::npos, sizeText) == 0;
+}
+
+}
+
+
+RPRRprsBufferStore::RPRRprsBufferStore(const Settings& settings)
+	: m_settings(settings)
+{
+#if !defined(RPR_BUFFERSTORE_ZSTD)
+	m_settings.compressionLevel = 0;
+#endif
+}
+
+std::string RPRRprsBufferStore::ManifestFileName(const std::string& rprsFileName)
+{
+	return rprsFileName + ".buffers";
+}
+
+uint64_t RPRRprsBufferStore::Hash(const void* data, size_t size)
+{
+	const unsigned char* p = (const unsigned char*)data;
+	const unsigned char* const end = p + size;
+	uint64_t h;
+
+	if ( size >= 32 )
+	{
+		uint64_t v1 = PRIME64_1 + PRIME64_2;
+		uint64_t v2 = PRIME64_2;
+		uint64_t v3 = 0;
+		uint64_t v4 = 0 - PRIME64_1;
+		for( ; p + 32 <= end; p += 32 )
+		{
+			v1 = HashRound(v1, Read64(p));
+			v2 = HashRound(v2, Read64(p + 8));
+			v3 = HashRound(v3, Read64(p + 16));
+			v4 = HashRound(v4, Read64(p + 24));
+		}
+		h = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+		h = HashMerge(h, v1);
+		h = HashMerge(h, v2);
+		h = HashMerge(h, v3);
+		h = HashMerge(h, v4);
+	}
+	else
+		h = PRIME64_5;
+
+	h += (uint64_t)size;
+
+	for( ; p + 8 <= end; p += 8 )
+		h = RotateLeft(h ^ HashRound(0, Read64(p)), 27) * PRIME64_1 + PRIME64_4;
+	if ( p + 4 <= end )
+	{
+		h = RotateLeft(h ^ (Read32(p) * PRIME64_1), 23) * PRIME64_2 + PRIME64_3;
+		p += 4;
+	}
+	for( ; p < end; p++ )
+		h = RotateLeft(h ^ (*p * PRIME64_5), 11) * PRIME64_1;
+
+	h ^= h >> 33;
+	h *= PRIME64_2;
+	h ^= h >> 29;
+	h *= PRIME64_3;
+	h ^= h >> 32;
+	return h;
+}
+
+std::string RPRRprsBufferStore::ObjectPath(const std::string& directory, const std::string& object, bool compressed) const
+{
+	// first 2 characters of the hash as sub-directory, to keep the directories small
+	return JoinPath(JoinPath(directory, object.substr(0, 2)), object) + ( compressed ? COMPRESSED_EXTENSION : "" );
+}
+
+rpr_status RPRRprsBufferStore::StoreObject(const std::vector<char>& data, const std::string& object, size_t& bytesStored)
+{
+	bytesStored = 0;
+	const bool compress = m_settings.compressionLevel > 0;
+	const std::string path = ObjectPath(m_settings.storeDirectory, object, compress);
+
+	// the content is already in the store ( compressed or not )
+	if ( FileExists(ObjectPath(m_settings.storeDirectory, object, false)) || FileExists(ObjectPath(m_settings.storeDirectory, object, true)) )
+		return RPR_SUCCESS;
+
+	if ( !MakeDirectory(ParentDirectory(path)) )
+		return RPR_ERROR_IO_ERROR;
+
+#if defined(RPR_BUFFERSTORE_ZSTD)
+	if ( compress )
+	{
+		std::vector<char> compressed(ZSTD_compressBound(data.size()));
+		const size_t compressedSize = ZSTD_compress(compressed.data(), compressed.size(), data.data(), data.size(), m_settings.compressionLevel);
+		if ( ZSTD_isError(compressedSize) )
+			return RPR_ERROR_INTERNAL_ERROR;
+		if ( !WriteFileAtomic(path, compressed.data(), compressedSize) )
+			return RPR_ERROR_IO_ERROR;
+		bytesStored = compressedSize;
+		return RPR_SUCCESS;
+	}
+#endif
+
+	if ( !WriteFileAtomic(path, data.data(), data.size()) )
+		return RPR_ERROR_IO_ERROR;
+	bytesStored = data.size();
+	return RPR_SUCCESS;
+}
+
+rpr_status RPRRprsBufferStore::StoreExport(const std::string& exportedRprsFileName, const std::string& rprsFileName, ExportStats* stats)
+{
+	ExportStats exportStats;
+	const std::string stagingDirectory = ParentDirectory(exportedRprsFileName);
+	const std::string exportedName = BaseName(exportedRprsFileName);
+
+	std::vector<std::string> files;
+	std::vector<std::string> subDirectories;
+	ListFiles(stagingDirectory, "", files, subDirectories);
+
+	std::ostringstream manifest;
+	manifest << MANIFEST_HEADER << "\n";
+	for(const std::string& file : files)
+	{
+		if ( file == exportedName )
+			continue;
+
+		const std::string path = JoinPath(stagingDirectory, file);
+		std::vector<char> data;
+		if ( !ReadWholeFile(path, data) )
+			return RPR_ERROR_IO_ERROR;
+
+		const std::string object = ObjectName(data);
+		size_t bytesStored = 0;
+		const rpr_status status = StoreObject(data, object, bytesStored);
+		if ( status != RPR_SUCCESS )
+			return status;
+		std::remove(path.c_str());
+
+		manifest << object << " " << data.size() << " " << file << "\n";
+		exportStats.filesTotal++;
+		exportStats.bytesTotal += data.size();
+		if ( bytesStored > 0 )
+		{
+			exportStats.filesStored++;
+			exportStats.bytesStored += bytesStored;
+		}
+	}
+
+	for(const std::string& subDirectory : subDirectories)
+		RemoveEmptyDirectory(JoinPath(stagingDirectory, subDirectory));
+
+	// the RPRS is moved after its buffers, so that a reader never finds an RPRS without its manifest and objects.
+	const std::string manifestText = manifest.str();
+	if ( !MakeDirectory(ParentDirectory(rprsFileName))
+		|| !WriteFileAtomic(ManifestFileName(rprsFileName), manifestText.data(), manifestText.size())
+		|| !MoveFileReplace(exportedRprsFileName, rprsFileName) )
+		return RPR_ERROR_IO_ERROR;
+
+	if ( stats )
+		*stats = exportStats;
+	return RPR_SUCCESS;
+}
+
+rpr_status RPRRprsBufferStore::Export(const std::string& rprsFileName, rpr_context context, rpr_scene scene, rpr_uint exportFlags, RPRS_context rprsCtx, ExportStats* stats)
+{
+	const std::string stagingDirectory = rprsFileName + ".staging";
+	if ( !MakeDirectory(stagingDirectory) )
+		return RPR_ERROR_IO_ERROR;
+
+	const std::string exportedRprsFileName = JoinPath(stagingDirectory, BaseName(rprsFileName));
+	rpr_status status = rprsExport(exportedRprsFileName.c_str(), context, scene, 0, nullptr, nullptr, 0, nullptr, nullptr, exportFlags | RPRLOADSTORE_EXPORTFLAG_EXTERNALFILES, rprsCtx);
+	if ( status == RPR_SUCCESS )
+		status = StoreExport(exportedRprsFileName, rprsFileName, stats);
+
+	RemoveEmptyDirectory(stagingDirectory);
+	return status;
+}
+
+rpr_status RPRRprsBufferStore::FetchObject(const ManifestEntry& entry, std::string& localPath, ResolveStats* stats)
+{
+	const std::string plainPath = ObjectPath(m_settings.storeDirectory, entry.object, false);
+	const bool compressed = !FileExists(plainPath);
+
+	// without local cache, the uncompressed objects are used from the store directly,
+	// and the compressed ones are decompressed next to them.
+	const std::string& cacheDirectory = m_settings.localCacheDirectory.empty() ? m_settings.storeDirectory : m_settings.localCacheDirectory;
+	localPath = ObjectPath(cacheDirectory, entry.object, false);
+	if ( FileExists(localPath) )
+		return RPR_SUCCESS;
+
+	std::vector<char> data;
+	if ( !compressed )
+	{
+		if ( !ReadWholeFile(plainPath, data) )
+			return RPR_ERROR_IO_ERROR;
+	}
+	else
+	{
+#if defined(RPR_BUFFERSTORE_ZSTD)
+		std::vector<char> compressedData;
+		if ( !ReadWholeFile(ObjectPath(m_settings.storeDirectory, entry.object, true), compressedData) )
+			return RPR_ERROR_IO_ERROR;
+		data.resize(entry.size);
+		const size_t size = ZSTD_decompress(data.data(), data.size(), compressedData.data(), compressedData.size());
+		if ( ZSTD_isError(size) )
+			return RPR_ERROR_IO_ERROR;
+		data.resize(size);
+#else
+		return RPR_ERROR_UNSUPPORTED;
+#endif
+	}
+
+	// the object name is its content: reject a file corrupted in the store or during the copy.
+	if ( data.size() != entry.size || ObjectName(data) != entry.object )
+		return RPR_ERROR_IO_ERROR;
+
+	if ( !MakeDirectory(ParentDirectory(localPath)) || !WriteFileAtomic(localPath, data.data(), data.size()) )
+		return RPR_ERROR_IO_ERROR;
+
+	if ( stats )
+	{
+		stats->filesFetched++;
+		stats->bytesFetched += data.size();
+	}
+	return RPR_SUCCESS;
+}
+
+rpr_status RPRRprsBufferStore::Resolve(const std::string& rprsFileName, const std::string& workDirectory, std::string& resolvedRprsFileName, ResolveStats* stats)
+{
+	std::ifstream manifest(ManifestFileName(rprsFileName));
+	if ( !manifest )
+	{
+		resolvedRprsFileName = rprsFileName;
+		return RPR_SUCCESS;
+	}
+
+	std::string line;
+	if ( !std::getline(manifest, line) || line != MANIFEST_HEADER )
+		return RPR_ERROR_IO_ERROR;
+
+	std::vector<ManifestEntry> entries;
+	while ( std::getline(manifest, line) )
+	{
+		if ( line.empty() )
+			continue;
+		// "<object> <size> <file name>" : the file name is the end of the line, it can contain spaces.
+		std::istringstream stream(line);
+		ManifestEntry entry;
+		if ( !(stream >> entry.object >> entry.size) )
+			return RPR_ERROR_IO_ERROR;
+		stream.get();
+		std::getline(stream, entry.fileName);
+		// the manifest comes with the RPRS file: its names are checked before being used as paths.
+		if ( !IsValidObjectName(entry.object, entry.size) || !IsSafeRelativePath(entry.fileName) )
+			return RPR_ERROR_IO_ERROR;
+		entries.push_back(entry);
+	}
+
+	for(const ManifestEntry& entry : entries)
+	{
+		std::string localPath;
+		const rpr_status status = FetchObject(entry, localPath, stats);
+		if ( status != RPR_SUCCESS )
+			return status;
+
+		const std::string path = JoinPath(workDirectory, entry.fileName);
+		if ( !MakeDirectory(ParentDirectory(path)) || !LinkOrCopyFile(localPath, path, m_settings.useHardLinks) )
+			return RPR_ERROR_IO_ERROR;
+		if ( stats )
+			stats->filesResolved++;
+	}
+
+	resolvedRprsFileName = JoinPath(workDirectory, BaseName(rprsFileName));
+	if ( !MakeDirectory(workDirectory) || !LinkOrCopyFile(rprsFileName, resolvedRprsFileName, m_settings.useHardLinks) )
+		return RPR_ERROR_IO_ERROR;
+	return RPR_SUCCESS;
+}
+
+rpr_status RPRRprsBufferStore::Import(const std::string& rprsFileName, const std::string& workDirectory, rpr_context context, rpr_material_system materialSystem, rpr_scene* scene, bool useAlreadyExistingScene, RPRS_context rprsCtx, ResolveStats* stats)
+{
+	std::string resolvedRprsFileName;
+	const rpr_status status = Resolve(rprsFileName, workDirectory, resolvedRprsFileName, stats);
+	if ( status != RPR_SUCCESS )
+		return status;
+	return rprsImport(resolvedRprsFileName.c_str(), context, materialSystem, scene, useAlreadyExistingScene, rprsCtx);
+}
@@ -0,0 +1,126 @@
+/*****************************************************************************\
+*
+*  Module Name    rprRprsBufferStore.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <RadeonProRender.h>
+#include <RprLoadStore.h>
+
+// Content-addressed store for the external buffer files of RPRS exports.
+//
+// With RPRLOADSTORE_EXPORTFLAG_EXTERNALFILES, each rprsExport writes its big buffers in separate files. When exporting an animation,
+// most of those files are identical from one frame to the next. RPRRprsBufferStore moves them into a store directory where each file
+// is named by the hash of its content: a buffer already in the store is not written again, so a frame only adds what changed.
+//
+// Export side:  the RPRS file is exported in an empty staging directory, then its external files are moved into the store and
+//               replaced by a manifest "<file>.rprs.buffers" next to the RPRS, listing the original names and their hash.
+// Import side:  Resolve fetches the files of the manifest from the store into a local cache ( optional, for a store on a network drive ),
+//               then links them under their original names into a work directory, next to a link of the RPRS file.
+//               rprsImport is then called on the RPRS file of the work directory.
+//
+// The RPRS file itself is not modified: the names of the external files it contains are kept, and recreated by Resolve.
+//
+// Usage:
+//   RPRRprsBufferStore store(settings);
+//   store.Export("frame_0001.rprs", context, scene, 0, nullptr);
+//   ...
+//   store.Import("frame_0001.rprs", "work/", context, matsys, &scene, true, nullptr);
+//
+// Different instances can use the same store directory concurrently: objects are written under a temporary name and renamed.
+class RPRRprsBufferStore
+{
+public:
+
+	struct Settings
+	{
+		/// Directory of the content-addressed files. Created if needed.
+		std::string storeDirectory;
+
+		/// Optional local copy of the store used by Resolve. Empty: Resolve links the files directly from the store directory.
+		std::string localCacheDirectory;
+
+		/// zstd level used for the files written in the store. 0 = no compression.
+		/// Only used if rprTools is compiled with RPR_BUFFERSTORE_ZSTD ( and linked with zstd ), ignored otherwise.
+		int compressionLevel = 0;
+
+		/// Resolve creates hard links to the cache instead of copies when the file system allows it.
+		bool useHardLinks = true;
+	};
+
+	struct ExportStats
+	{
+		/// external files produced by rprsExport
+		size_t filesTotal = 0;
+		size_t bytesTotal = 0;
+
+		/// files that were not yet in the store. bytesStored is the size after compression.
+		size_t filesStored = 0;
+		size_t bytesStored = 0;
+	};
+
+	struct ResolveStats
+	{
+		size_t filesResolved = 0;
+
+		/// files copied from the store into the local cache ( decompressed size )
+		size_t filesFetched = 0;
+		size_t bytesFetched = 0;
+	};
+
+	RPRRprsBufferStore(const Settings& settings);
+
+	RPRRprsBufferStore(const RPRRprsBufferStore&) = delete;
+	RPRRprsBufferStore& operator=(const RPRRprsBufferStore&) = delete;
+
+	/// Export post-processor: exportedRprsFileName was written by rprsExport with RPRLOADSTORE_EXPORTFLAG_EXTERNALFILES
+	/// in a directory containing nothing else. All the other files of this directory are moved into the store,
+	/// the RPRS file is moved to rprsFileName and the manifest is written next to it. The staging directory is left empty.
+	/// The external file names may be derived from the RPRS file name: keep the same file name in the staging directory and in rprsFileName.
+	/// Returns RPR_ERROR_IO_ERROR if a file can't be read, written or moved.
+	rpr_status StoreExport(const std::string& exportedRprsFileName, const std::string& rprsFileName, ExportStats* stats = nullptr);
+
+	/// rprsExport with RPRLOADSTORE_EXPORTFLAG_EXTERNALFILES added to exportFlags, in a staging directory "<rprsFileName>.staging", then StoreExport.
+	rpr_status Export(const std::string& rprsFileName, rpr_context context, rpr_scene scene, rpr_uint exportFlags, RPRS_context rprsCtx, ExportStats* stats = nullptr);
+
+	/// Import pre-resolver: materializes the external files listed in the manifest of rprsFileName in workDirectory.
+	/// resolvedRprsFileName receives the file to give to rprsImport. If rprsFileName has no manifest, it's returned unchanged.
+	/// Returns RPR_ERROR_IO_ERROR if the manifest is invalid ( object name not written by the store, file name absolute or going out of workDirectory )
+	/// or if a file is missing from the store.
+	rpr_status Resolve(const std::string& rprsFileName, const std::string& workDirectory, std::string& resolvedRprsFileName, ResolveStats* stats = nullptr);
+
+	/// Resolve then rprsImport. The other arguments are the ones of rprsImport.
+	rpr_status Import(const std::string& rprsFileName, const std::string& workDirectory, rpr_context context, rpr_material_system materialSystem, rpr_scene* scene, bool useAlreadyExistingScene, RPRS_context rprsCtx, ResolveStats* stats = nullptr);
+
+	/// Name of the manifest of an RPRS file.
+	static std::string ManifestFileName(const std::string& rprsFileName);
+
+	/// 64-bit hash ( xxHash64 ) used to name the files of the store.
+	static uint64_t Hash(const void* data, size_t size);
+
+private:
+
+	struct ManifestEntry
+	{
+		std::string object; // name of the file in the store
+		size_t size = 0;
+		std::string fileName; // original name, relative to the RPRS file
+	};
+
+	std::string ObjectPath(const std::string& directory, const std::string& object, bool compressed) const;
+	rpr_status StoreObject(const std::vector<char>& data, const std::string& object, size_t& bytesStored);
+	rpr_status FetchObject(const ManifestEntry& entry, std::string& localPath, ResolveStats* stats);
+
+	Settings m_settings;
+};
@@ -0,0 +1,203 @@
+/*****************************************************************************\
+*
+*  Module Name    rprRprsPrefetcher.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#include "rprRprsPrefetcher.h"
+#include "rprToolsCommon.h"
+
+#include <chrono>
+#include <fstream>
+
+using rprtools::SecondsSince;
+using rprtools::ReadFile;
+#if !defined(_WIN32)
+using rprtools::MapFile;
+using rprtools::UnmapFile;
+#endif
+
+
+// bytes of one RPRS file: mapped in memory or read into a buffer.
+struct RPRRprsPrefetcher::FileData
+{
+	~FileData()
+	{
+#if !defined(_WIN32)
+		UnmapFile(m_mapped, m_size);
+#endif
+	}
+
+	const rpr_uchar* Data() const { return m_mapped ? (const rpr_uchar*)m_mapped : m_buffer.data(); }
+
+	std::string m_fileName;
+	rpr_status m_status = RPR_SUCCESS;
+	size_t m_size = 0;
+	void* m_mapped = nullptr;
+	std::vector<rpr_uchar> m_buffer;
+};
+
+
+namespace
+{
+
+// 0 if it's not a regular file: it won't be read
+size_t GetFileSize(const std::string& fileName)
+{
+#if !defined(_WIN32)
+	struct stat fileStat;
+	if ( stat(fileName.c_str(), &fileStat) != 0 || !S_ISREG(fileStat.st_mode) )
+		return 0;
+	return (size_t)fileStat.st_size;
+#else
+	std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+	if ( !file )
+		return 0;
+	const std::streamoff fileSize = file.tellg();
+	return fileSize > 0 ? (size_t)fileSize : 0;
+#endif
+}
+
+}
+
+
+RPRRprsPrefetcher::RPRRprsPrefetcher(const std::vector<std::string>& files, const Settings& settings)
+	: m_files(files)
+	, m_settings(settings)
+{
+	if ( m_settings.maxFilesAhead == 0 )
+		m_settings.maxFilesAhead = 1;
+	if ( !m_settings.validate )
+		m_settings.validate = [](const rpr_uchar* data, size_t size) { return data != nullptr && size > 0; };
+
+	m_ioThread = std::thread(&RPRRprsPrefetcher::IOThread, this);
+}
+
+RPRRprsPrefetcher::RPRRprsPrefetcher(const std::vector<std::string>& files)
+	: RPRRprsPrefetcher(files, Settings())
+{
+}
+
+RPRRprsPrefetcher::~RPRRprsPrefetcher()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_condition.notify_all();
+	if ( m_ioThread.joinable() )
+		m_ioThread.join();
+}
+
+bool RPRRprsPrefetcher::HasNext() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_nextToImport < m_files.size();
+}
+
+std::string RPRRprsPrefetcher::NextFileName() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_nextToImport < m_files.size() ? m_files[m_nextToImport] : std::string();
+}
+
+RPRRprsPrefetcher::Stats RPRRprsPrefetcher::GetStats() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_stats;
+}
+
+void RPRRprsPrefetcher::IOThread()
+{
+	for(size_t i=0; i<m_files.size(); i++)
+	{
+		const size_t fileSize = GetFileSize(m_files[i]);
+
+		// wait for a slot and for enough memory budget
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [&]() {
+				return m_stop || ( m_ready.size() < m_settings.maxFilesAhead && ( m_bytesHeld == 0 || m_bytesHeld + fileSize <= m_settings.memoryBudgetBytes ) );
+			});
+			if ( m_stop )
+				return;
+			// reserve the budget now, the file will be counted until it's imported
+			m_bytesHeld += fileSize;
+			if ( m_bytesHeld > m_stats.peakBytesHeld )
+				m_stats.peakBytesHeld = m_bytesHeld;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+		std::unique_ptr<FileData> file(new FileData());
+		file->m_fileName = m_files[i];
+#if !defined(_WIN32)
+		// load all the pages now, so that rprsImportFromData doesn't wait for the disk
+		if ( m_settings.useMmap )
+			file->m_mapped = MapFile(m_files[i], file->m_size, rprtools::MAP_ACCESS_POPULATE);
+		if ( !file->m_mapped )
+#endif
+		{
+			// m_size stays 0 if the file can't be read: nothing is held or imported
+			if ( ReadFile(m_files[i], file->m_buffer) )
+				file->m_size = file->m_buffer.size();
+			else
+				file->m_status = RPR_ERROR_IO_ERROR;
+		}
+		if ( file->m_status == RPR_SUCCESS && !m_settings.validate(file->Data(), file->m_size) )
+			file->m_status = RPR_ERROR_IO_ERROR;
+		const double ioSeconds = SecondsSince(start);
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			// the real size can differ from the one reserved if the file changed in the meantime
+			m_bytesHeld = m_bytesHeld - fileSize + file->m_size;
+			m_stats.filesRead++;
+			m_stats.bytesRead += file->m_size;
+			m_stats.ioSeconds += ioSeconds;
+			m_ready.push_back(std::move(file));
+		}
+		m_condition.notify_all();
+	}
+}
+
+rpr_status RPRRprsPrefetcher::ImportNext(rpr_context context, rpr_material_system materialSystem, rpr_scene* scene, bool useAlreadyExistingScene, RPRS_context rprsCtx)
+{
+	std::unique_ptr<FileData> file;
+	{
+		const auto start = std::chrono::steady_clock::now();
+		std::unique_lock<std::mutex> lock(m_mutex);
+		if ( m_nextToImport >= m_files.size() )
+			return RPR_ERROR_INVALID_PARAMETER;
+		m_condition.wait(lock, [&]() { return !m_ready.empty(); });
+		file = std::move(m_ready.front());
+		m_ready.pop_front();
+		m_nextToImport++;
+		m_stats.waitSeconds += SecondsSince(start);
+	}
+
+	rpr_status status = file->m_status;
+	double importSeconds = 0.0;
+	if ( status == RPR_SUCCESS )
+	{
+		const auto start = std::chrono::steady_clock::now();
+		status = rprsImportFromData(file->Data(), file->m_size, context, materialSystem, scene, useAlreadyExistingScene, rprsCtx);
+		importSeconds = SecondsSince(start);
+	}
+
+	const size_t size = file->m_size;
+	file.reset();
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_bytesHeld -= size;
+		m_stats.importSeconds += importSeconds;
+	}
+	m_condition.notify_all();
+
+	return status;
+}
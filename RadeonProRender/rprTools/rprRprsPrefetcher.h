@@ -0,0 +1,119 @@
+/*****************************************************************************\
+*
+*  Module Name    rprRprsPrefetcher.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <RadeonProRender.h>
+#include <RprLoadStore.h>
+
+// Imports a sequence of RPRS files while the next ones are read in advance by an I/O thread.
+//
+// Instead of rprsImport doing its file I/O synchronously, the files are memory-mapped ( or read ) and validated by the I/O thread,
+// and ImportNext hands the bytes to rprsImportFromData. The disk latency of the next shots overlaps the rendering of the current one.
+//
+// Usage:
+//   RPRRprsPrefetcher prefetcher(files);
+//   while ( prefetcher.HasNext() )
+//   {
+//       prefetcher.ImportNext(context, matsys, &scene, true, nullptr); // rprsImportFromData with the bytes of the next file
+//       ... render ...
+//       rprsDeleteListImportedObjects(nullptr);
+//   }
+//
+// ImportNext must be called from one thread at a time ( the same rules as rprsImport apply ).
+class RPRRprsPrefetcher
+{
+public:
+
+	struct Settings
+	{
+		/// Maximum number of files read ahead of the next import.
+		size_t maxFilesAhead = 2;
+
+		/// Maximum number of bytes held by the files read ahead.
+		/// A file bigger than the budget is still read, but only when no other file is held.
+		size_t memoryBudgetBytes = size_t(1) << 30;
+
+		/// Memory-map the files ( Linux/macOS ). If false, or on Windows, the files are read into memory.
+		bool useMmap = true;
+
+		/// Called by the I/O thread on the bytes of each file. If it returns false, ImportNext returns RPR_ERROR_IO_ERROR for this file.
+		/// The default validation only rejects empty files.
+		std::function<bool(const rpr_uchar* data, size_t size)> validate;
+	};
+
+	struct Stats
+	{
+		size_t filesRead = 0;
+		size_t bytesRead = 0;
+		size_t peakBytesHeld = 0;
+
+		/// time spent by the I/O thread to map/read the files
+		double ioSeconds = 0.0;
+
+		/// time spent by ImportNext waiting for the I/O thread. Close to 0 when the I/O is fully overlapped.
+		double waitSeconds = 0.0;
+
+		/// time spent inside rprsImportFromData
+		double importSeconds = 0.0;
+	};
+
+	/// The I/O thread starts reading the first files immediately.
+	RPRRprsPrefetcher(const std::vector<std::string>& files, const Settings& settings);
+	explicit RPRRprsPrefetcher(const std::vector<std::string>& files);
+
+	/// Stops the I/O thread and releases the files not imported.
+	~RPRRprsPrefetcher();
+
+	RPRRprsPrefetcher(const RPRRprsPrefetcher&) = delete;
+	RPRRprsPrefetcher& operator=(const RPRRprsPrefetcher&) = delete;
+
+	bool HasNext() const;
+
+	/// Name of the file imported by the next call of ImportNext. Empty if HasNext() is false.
+	std::string NextFileName() const;
+
+	/// Import the next file of the sequence with rprsImportFromData. The arguments are the ones of rprsImportFromData.
+	/// Waits if the I/O thread hasn't finished reading this file.
+	/// Returns RPR_ERROR_IO_ERROR if the file can't be read or is not valid, RPR_ERROR_INVALID_PARAMETER if there is no file left.
+	/// In both cases, the sequence moves to the next file.
+	rpr_status ImportNext(rpr_context context, rpr_material_system materialSystem, rpr_scene* scene, bool useAlreadyExistingScene, RPRS_context rprsCtx);
+
+	Stats GetStats() const;
+
+private:
+
+	struct FileData;
+
+	void IOThread();
+
+	std::vector<std::string> m_files;
+	Settings m_settings;
+
+	mutable std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::deque<std::unique_ptr<FileData>> m_ready; // files read, in the order of m_files
+	size_t m_nextToImport = 0;
+	size_t m_bytesHeld = 0;
+	bool m_stop = false;
+	Stats m_stats;
+
+	std::thread m_ioThread;
+};
@@ -0,0 +1,439 @@
+/*****************************************************************************\
+*
+*  Module Name    rprScenePool.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#include "rprScenePool.h"
+#include "rprRprsBufferStore.h"
+
+#include <ProRenderGLTF.h>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <fstream>
+
+#include <sys/stat.h>
+
+
+// objects created by the import of one file, owned by the pool.
+struct RPRScenePool::Entry
+{
+	uint64_t hash = 0;
+	std::string fileName; // file of the first import, for the Detach by name
+	size_t bytes = 0;
+	std::list<uint64_t>::iterator lru;
+	std::map<rpr_scene, int> scenes; // scenes the objects are attached to, and number of Attach
+
+	std::vector<rpr_shape> shapes;
+	std::vector<rpr_curve> curves;
+	std::vector<rpr_hetero_volume> heteroVolumes;
+	std::vector<rpr_light> lights;
+	std::vector<rpr_camera> cameras;
+	std::vector<void*> materialXNodes;
+	std::vector<rpr_material_node> materialNodes;
+	std::vector<rpr_image> images;
+	std::vector<rpr_buffer> buffers;
+	std::vector<rpr_grid> grids;
+	std::vector<rpr_post_effect> postEffects;
+};
+
+
+namespace
+{
+
+bool IsGltf(const std::string& fileName)
+{
+	std::string extension = fileName.substr(std::min(fileName.size(), fileName.find_last_of('.')));
+	std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)tolower(c); });
+	return extension == ".gltf" || extension == ".glb";
+}
+
+// call a rprsListImported* / rprGLTF_ListImported_* function twice: for the count, then for the objects.
+template<typename T, typename ListFunction>
+rpr_status ListObjects(ListFunction list, std::vector<T>& objects)
+{
+	int count = 0;
+	rpr_status status = (rpr_status)list(nullptr, 0, &count);
+	if ( status != RPR_SUCCESS || count <= 0 )
+		return status;
+	objects.resize(count);
+	return (rpr_status)list(objects.data(), (int)(count * sizeof(T)), nullptr);
+}
+
+template<typename T>
+void DeleteObjects(std::vector<T>& objects)
+{
+	for(T object : objects)
+		rprObjectDelete(object);
+	objects.clear();
+}
+
+// memory used by the data of the imported objects. Only the meshes, images and buffers are counted.
+size_t EstimateBytes(const std::vector<rpr_shape>& shapes, const std::vector<rpr_image>& images, const std::vector<rpr_buffer>& buffers)
+{
+	size_t bytes = 0;
+	for(rpr_shape shape : shapes)
+	{
+		rpr_shape_type type = RPR_SHAPE_TYPE_MESH;
+		if ( rprShapeGetInfo(shape, RPR_SHAPE_TYPE, sizeof(type), &type, nullptr) != RPR_SUCCESS || type != RPR_SHAPE_TYPE_MESH )
+			continue;
+		size_t polygons = 0, vertices = 0, normals = 0, uvs = 0;
+		rprMeshGetInfo(shape, RPR_MESH_POLYGON_COUNT, sizeof(polygons), &polygons, nullptr);
+		rprMeshGetInfo(shape, RPR_MESH_VERTEX_COUNT, sizeof(vertices), &vertices, nullptr);
+		rprMeshGetInfo(shape, RPR_MESH_NORMAL_COUNT, sizeof(normals), &normals, nullptr);
+		rprMeshGetInfo(shape, RPR_MESH_UV_COUNT, sizeof(uvs), &uvs, nullptr);
+		// 3 indices ( vertex, normal, uv ) per corner, counting triangles
+		bytes += (vertices + normals) * 3 * sizeof(float) + uvs * 2 * sizeof(float) + polygons * 3 * 3 * sizeof(rpr_int);
+	}
+	for(rpr_image image : images)
+	{
+		size_t size = 0;
+		if ( rprImageGetInfo(image, RPR_IMAGE_DATA_SIZEBYTE, sizeof(size), &size, nullptr) == RPR_SUCCESS )
+			bytes += size;
+	}
+	for(rpr_buffer buffer : buffers)
+	{
+		rpr_buffer_desc desc = {};
+		if ( rprBufferGetInfo(buffer, RPR_BUFFER_DESC, sizeof(desc), &desc, nullptr) == RPR_SUCCESS )
+			bytes += (size_t)desc.nb_element * desc.element_channel_size * 4;
+	}
+	return bytes;
+}
+
+}
+
+
+RPRScenePool::RPRScenePool(rpr_context context, rpr_material_system materialSystem, const Settings& settings)
+	: m_context(context)
+	, m_materialSystem(materialSystem)
+	, m_settings(settings)
+{
+}
+
+RPRScenePool::RPRScenePool(rpr_context context, rpr_material_system materialSystem)
+	: RPRScenePool(context, materialSystem, Settings())
+{
+}
+
+RPRScenePool::~RPRScenePool()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for(auto& it : m_entries)
+		DeleteEntry(*it.second);
+	m_entries.clear();
+	m_lru.clear();
+}
+
+RPRScenePool::Stats RPRScenePool::GetStats() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_stats;
+}
+
+rpr_status RPRScenePool::GetFileHash(const std::string& fileName, uint64_t& hash)
+{
+#if defined(_WIN32)
+	struct _stat64 fileStat;
+	if ( _stat64(fileName.c_str(), &fileStat) != 0 )
+		return RPR_ERROR_IO_ERROR;
+#else
+	struct stat fileStat;
+	if ( stat(fileName.c_str(), &fileStat) != 0 )
+		return RPR_ERROR_IO_ERROR;
+#endif
+
+	// same size and modification time as the last time: the file is not read again.
+	FileKey& key = m_fileKeys[fileName];
+	if ( key.size == (int64_t)fileStat.st_size && key.modificationTime == (int64_t)fileStat.st_mtime )
+	{
+		hash = key.hash;
+		return RPR_SUCCESS;
+	}
+
+	std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+	if ( !file )
+		return RPR_ERROR_IO_ERROR;
+	std::vector<char> data((size_t)file.tellg());
+	file.seekg(0);
+	if ( !file.read(data.data(), data.size()) )
+		return RPR_ERROR_IO_ERROR;
+
+	// the extension is part of the key: the same bytes are not imported the same way as RPRS and as GLTF.
+	hash = RPRRprsBufferStore::Hash(data.data(), data.size()) ^ ( IsGltf(fileName) ? 1 : 0 );
+	key.hash = hash;
+	key.size = (int64_t)fileStat.st_size;
+	key.modificationTime = (int64_t)fileStat.st_mtime;
+	return RPR_SUCCESS;
+}
+
+rpr_status RPRScenePool::Import(const std::string& fileName, Entry& entry)
+{
+	rpr_scene importScene = nullptr;
+	rpr_status status = RPR_SUCCESS;
+
+	if ( IsGltf(fileName) )
+	{
+		status = (rpr_status)rprImportFromGLTF(fileName.c_str(), m_context, m_materialSystem, &importScene, nullptr, 0, nullptr);
+		if ( status == RPR_SUCCESS ) status = ListObjects(rprGLTF_ListImported_Shapes, entry.shapes);
+		if ( status == RPR_SUCCESS ) status = ListObjects(rprGLTF_ListImported_HeteroVolumes, entry.heteroVolumes);
+		if ( status == RPR_SUCCESS ) status = ListObjects(rprGLTF_ListImported_Lights, entry.lights);
+		if ( status == RPR_SUCCESS ) status = ListObjects(rprGLTF_ListImported_Cameras, entry.cameras);
+		if ( status == RPR_SUCCESS ) status = ListObjects(rprGLTF_ListImported_MaterialNodes, entry.materialNodes);
+		if ( status == RPR_SUCCESS ) status = ListObjects(rprGLTF_ListImported_Images, entry.images);
+		if ( status == RPR_SUCCESS ) status = ListObjects(rprGLTF_ListImported_Buffer, entry.buffers);
+		if ( status == RPR_SUCCESS ) status = ListObjects(rprGLTF_ListImported_PostEffects, entry.postEffects);
+		if ( status != RPR_SUCCESS )
+			rprGLTF_DeleteListImportedObjects();
+		rprGLTF_ReleaseImportedData();
+	}
+	else
+	{
+		// each import has its own RPRS context, so that the lists are not mixed with the imports done outside of the pool.
+		RPRS_context rprsCtx = nullptr;
+		status = rprsCreateContext(&rprsCtx);
+		if ( status != RPR_SUCCESS )
+			return status;
+
+		status = rprsImport(fileName.c_str(), m_context, m_materialSystem, &importScene, false, rprsCtx);
+		if ( status == RPR_SUCCESS ) status = ListObjects([rprsCtx](rpr_shape* o, int s, int* c) { return rprsListImportedShapesEx(rprsCtx, o, s, c); }, entry.shapes);
+		if ( status == RPR_SUCCESS ) status = ListObjects([rprsCtx](rpr_curve* o, int s, int* c) { return rprsListImportedCurvesEx(rprsCtx, o, s, c); }, entry.curves);
+		if ( status == RPR_SUCCESS ) status = ListObjects([rprsCtx](rpr_hetero_volume* o, int s, int* c) { return rprsListImportedHeteroVolumesEx(rprsCtx, o, s, c); }, entry.heteroVolumes);
+		if ( status == RPR_SUCCESS ) status = ListObjects([rprsCtx](rpr_light* o, int s, int* c) { return rprsListImportedLightsEx(rprsCtx, o, s, c); }, entry.lights);
+		if ( status == RPR_SUCCESS ) status = ListObjects([rprsCtx](rpr_camera* o, int s, int* c) { return rprsListImportedCamerasEx(rprsCtx, o, s, c); }, entry.cameras);
+		if ( status == RPR_SUCCESS ) status = ListObjects([rprsCtx](void** o, int s, int* c) { return rprsListImportedMaterialXEx(rprsCtx, o, s, c); }, entry.materialXNodes);
+		if ( status == RPR_SUCCESS ) status = ListObjects([rprsCtx](rpr_material_node* o, int s, int* c) { return rprsListImportedMaterialNodesEx(rprsCtx, o, s, c); }, entry.materialNodes);
+		if ( status == RPR_SUCCESS ) status = ListObjects([rprsCtx](rpr_image* o, int s, int* c) { return rprsListImportedImagesEx(rprsCtx, o, s, c); }, entry.images);
+		if ( status == RPR_SUCCESS ) status = ListObjects([rprsCtx](rpr_buffer* o, int s, int* c) { return rprsListImportedBuffersEx(rprsCtx, o, s, c); }, entry.buffers);
+		if ( status == RPR_SUCCESS ) status = ListObjects([rprsCtx](rpr_grid* o, int s, int* c) { return rprsListImportedGridsEx(rprsCtx, o, s, c); }, entry.grids);
+		if ( status == RPR_SUCCESS ) status = ListObjects([rprsCtx](rpr_post_effect* o, int s, int* c) { return rprsListImportedPostEffectsEx(rprsCtx, o, s, c); }, entry.postEffects);
+		if ( status != RPR_SUCCESS )
+			rprsDeleteListImportedObjectsEx(rprsCtx);
+		// only releases the lists: the objects now belong to the pool.
+		rprsDeleteContext(rprsCtx);
+	}
+
+	// the objects are attached to the scenes of the Attach calls, not to the scene created by the import.
+	if ( importScene )
+		rprObjectDelete(importScene);
+
+	// on error, the objects were deleted by the importer and the entry is discarded.
+	if ( status != RPR_SUCCESS )
+		return status;
+
+	entry.bytes = EstimateBytes(entry.shapes, entry.images, entry.buffers);
+	return RPR_SUCCESS;
+}
+
+rpr_status RPRScenePool::AttachEntry(Entry& entry, rpr_scene scene)
+{
+	rpr_status status = RPR_SUCCESS;
+	for(size_t i=0; i<entry.shapes.size() && status == RPR_SUCCESS; i++)
+		status = rprSceneAttachShape(scene, entry.shapes[i]);
+	for(size_t i=0; i<entry.curves.size() && status == RPR_SUCCESS; i++)
+		status = rprSceneAttachCurve(scene, entry.curves[i]);
+	for(size_t i=0; i<entry.heteroVolumes.size() && status == RPR_SUCCESS; i++)
+		status = rprSceneAttachHeteroVolume(scene, entry.heteroVolumes[i]);
+	for(size_t i=0; i<entry.lights.size() && status == RPR_SUCCESS; i++)
+		status = rprSceneAttachLight(scene, entry.lights[i]);
+	if ( status == RPR_SUCCESS && m_settings.attachCamera && !entry.cameras.empty() )
+		status = rprSceneSetCamera(scene, entry.cameras[0]);
+
+	if ( status != RPR_SUCCESS )
+		DetachEntry(entry, scene);
+	return status;
+}
+
+rpr_status RPRScenePool::DetachEntry(Entry& entry, rpr_scene scene)
+{
+	// continue on errors: the objects not attached ( after a failed AttachEntry ) return an error.
+	rpr_status status = RPR_SUCCESS;
+	auto check = [&status](rpr_status s) { if ( status == RPR_SUCCESS ) status = s; };
+	for(rpr_shape shape : entry.shapes)
+		check(rprSceneDetachShape(scene, shape));
+	for(rpr_curve curve : entry.curves)
+		check(rprSceneDetachCurve(scene, curve));
+	for(rpr_hetero_volume heteroVolume : entry.heteroVolumes)
+		check(rprSceneDetachHeteroVolume(scene, heteroVolume));
+	for(rpr_light light : entry.lights)
+		check(rprSceneDetachLight(scene, light));
+
+	rpr_camera camera = nullptr;
+	if ( !entry.cameras.empty() && rprSceneGetInfo(scene, RPR_SCENE_CAMERA, sizeof(camera), &camera, nullptr) == RPR_SUCCESS && camera == entry.cameras[0] )
+		check(rprSceneSetCamera(scene, nullptr));
+	return status;
+}
+
+void RPRScenePool::DeleteEntry(Entry& entry)
+{
+	for(auto& it : entry.scenes)
+		DetachEntry(entry, it.first);
+	entry.scenes.clear();
+
+	// instances before the meshes they reference
+	std::stable_partition(entry.shapes.begin(), entry.shapes.end(), [](rpr_shape shape) {
+		rpr_shape_type type = RPR_SHAPE_TYPE_MESH;
+		rprShapeGetInfo(shape, RPR_SHAPE_TYPE, sizeof(type), &type, nullptr);
+		return type == RPR_SHAPE_TYPE_INSTANCE;
+	});
+	DeleteObjects(entry.shapes);
+	DeleteObjects(entry.curves);
+	DeleteObjects(entry.heteroVolumes);
+	DeleteObjects(entry.lights);
+	DeleteObjects(entry.cameras);
+	DeleteObjects(entry.materialXNodes);
+	DeleteObjects(entry.materialNodes);
+	DeleteObjects(entry.images);
+	DeleteObjects(entry.buffers);
+	DeleteObjects(entry.grids);
+	DeleteObjects(entry.postEffects);
+}
+
+void RPRScenePool::Evict(size_t budget)
+{
+	// from the least recently used, skipping the files attached to a scene
+	std::vector<uint64_t> evicted;
+	size_t residentBytes = m_stats.residentBytes;
+	for(auto it = m_lru.rbegin(); it != m_lru.rend() && residentBytes > budget; ++it)
+	{
+		const Entry& entry = *m_entries[*it];
+		if ( !entry.scenes.empty() )
+			continue;
+		evicted.push_back(*it);
+		residentBytes -= entry.bytes;
+	}
+
+	for(uint64_t hash : evicted)
+	{
+		RemoveEntry(hash);
+		m_stats.evictions++;
+	}
+}
+
+void RPRScenePool::RemoveEntry(uint64_t hash)
+{
+	auto it = m_entries.find(hash);
+	Entry& entry = *it->second;
+	m_stats.residentBytes -= entry.bytes;
+	m_stats.residentFiles--;
+	m_lru.erase(entry.lru);
+	DeleteEntry(entry);
+	m_entries.erase(it);
+}
+
+void RPRScenePool::Trim()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	std::vector<uint64_t> unused;
+	for(auto& it : m_entries)
+	{
+		if ( it.second->scenes.empty() )
+			unused.push_back(it.first);
+	}
+	for(uint64_t hash : unused)
+		RemoveEntry(hash);
+}
+
+rpr_status RPRScenePool::Attach(const std::string& fileName, rpr_scene scene)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	uint64_t hash = 0;
+	rpr_status status = GetFileHash(fileName, hash);
+	if ( status != RPR_SUCCESS )
+		return status;
+
+	auto it = m_entries.find(hash);
+	if ( it == m_entries.end() )
+	{
+		std::unique_ptr<Entry> entry(new Entry());
+		entry->hash = hash;
+		entry->fileName = fileName;
+
+		const auto start = std::chrono::steady_clock::now();
+		status = Import(fileName, *entry);
+		m_stats.importSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		if ( status != RPR_SUCCESS )
+			return status;
+		// the file size is a lower bound, for the objects not counted by the estimation ( or a core that doesn't return the sizes )
+		entry->bytes = std::max(entry->bytes, (size_t)m_fileKeys[fileName].size);
+
+		m_stats.misses++;
+		m_stats.residentFiles++;
+		m_stats.residentBytes += entry->bytes;
+		m_lru.push_front(hash);
+		entry->lru = m_lru.begin();
+		it = m_entries.emplace(hash, std::move(entry)).first;
+	}
+	else
+	{
+		m_stats.hits++;
+		m_lru.splice(m_lru.begin(), m_lru, it->second->lru);
+	}
+
+	Entry& entry = *it->second;
+	int& attachCount = entry.scenes[scene];
+	if ( attachCount == 0 )
+	{
+		status = AttachEntry(entry, scene);
+		if ( status != RPR_SUCCESS )
+		{
+			entry.scenes.erase(scene);
+			return status;
+		}
+	}
+	attachCount++;
+
+	// the new file can be bigger than the budget alone: it stays resident while it's attached.
+	Evict(m_settings.memoryBudgetBytes);
+	return RPR_SUCCESS;
+}
+
+rpr_status RPRScenePool::Detach(const std::string& fileName, rpr_scene scene)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	auto keyIt = m_fileKeys.find(fileName);
+	if ( keyIt == m_fileKeys.end() )
+		return RPR_ERROR_INVALID_PARAMETER;
+	auto it = m_entries.find(keyIt->second.hash);
+	if ( it == m_entries.end() )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	Entry& entry = *it->second;
+	auto sceneIt = entry.scenes.find(scene);
+	if ( sceneIt == entry.scenes.end() )
+		return RPR_ERROR_INVALID_PARAMETER;
+	if ( --sceneIt->second > 0 )
+		return RPR_SUCCESS;
+	entry.scenes.erase(sceneIt);
+
+	const rpr_status status = DetachEntry(entry, scene);
+	Evict(m_settings.memoryBudgetBytes);
+	return status;
+}
+
+rpr_status RPRScenePool::DetachScene(rpr_scene scene)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	rpr_status status = RPR_SUCCESS;
+	for(auto& it : m_entries)
+	{
+		Entry& entry = *it.second;
+		if ( entry.scenes.erase(scene) == 0 )
+			continue;
+		const rpr_status detachStatus = DetachEntry(entry, scene);
+		if ( status == RPR_SUCCESS )
+			status = detachStatus;
+	}
+	Evict(m_settings.memoryBudgetBytes);
+	return status;
+}
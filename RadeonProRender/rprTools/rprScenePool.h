@@ -0,0 +1,131 @@
+/*****************************************************************************\
+*
+*  Module Name    rprScenePool.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <RadeonProRender.h>
+#include <RprLoadStore.h>
+
+// Keeps the objects of imported RPRS / GLTF files resident, so that the same asset is imported only once per session.
+//
+// Attach imports the file the first time ( rprsImport or rprImportFromGLTF, depending on the extension ), takes the ownership
+// of the created objects ( listed with rprsListImported* / rprGLTF_ListImported_* ), and attaches its shapes, curves, lights and volumes to the scene.
+// The next Attach of a file with the same content only attaches the objects already created to the new scene.
+// The files are identified by the hash of their content: two copies of the same asset share the same objects.
+//
+// Detach removes the objects from the scene. Files not attached to any scene stay resident until the memory budget is exceeded,
+// then the least recently used ones are deleted.
+//
+// Only the objects are kept: the settings of the imported scene itself ( background image, environment override... ) are not.
+// As the objects are shared, the caller must not modify them ( transforms, materials ) or delete them.
+//
+// Usage:
+//   RPRScenePool pool(context, matsys);
+//   for each job:
+//       rprContextCreateScene(context, &scene);
+//       pool.Attach("asset.rprs", scene);
+//       ... render ...
+//       pool.DetachScene(scene);
+//       rprObjectDelete(scene);
+//
+// All the methods can be called from several threads, the imports are serialized.
+class RPRScenePool
+{
+public:
+
+	struct Settings
+	{
+		/// Estimated memory of the resident files. Unused files are deleted above this budget.
+		size_t memoryBudgetBytes = size_t(2) << 30;
+
+		/// Attach also sets the first camera of the file as the camera of the scene.
+		bool attachCamera = true;
+	};
+
+	struct Stats
+	{
+		/// Attach calls that reused resident objects / that imported the file.
+		size_t hits = 0;
+		size_t misses = 0;
+
+		/// files deleted to respect the memory budget
+		size_t evictions = 0;
+
+		size_t residentFiles = 0;
+		size_t residentBytes = 0;
+
+		/// time spent in rprsImport / rprImportFromGLTF
+		double importSeconds = 0.0;
+	};
+
+	RPRScenePool(rpr_context context, rpr_material_system materialSystem, const Settings& settings);
+	RPRScenePool(rpr_context context, rpr_material_system materialSystem);
+
+	/// Deletes all the resident objects. They must not be attached to a scene anymore.
+	~RPRScenePool();
+
+	RPRScenePool(const RPRScenePool&) = delete;
+	RPRScenePool& operator=(const RPRScenePool&) = delete;
+
+	/// Attach the objects of fileName ( .rprs, .gltf or .glb ) to scene, importing the file if it's not resident.
+	/// Attaching twice the same file to the same scene only counts the attachment once more.
+	/// Returns RPR_ERROR_IO_ERROR if the file can't be read, or the error of the import.
+	rpr_status Attach(const std::string& fileName, rpr_scene scene);
+
+	/// Detach the objects of fileName from scene. Returns RPR_ERROR_INVALID_PARAMETER if they are not attached to it.
+	rpr_status Detach(const std::string& fileName, rpr_scene scene);
+
+	/// Detach all the objects of the pool from scene.
+	rpr_status DetachScene(rpr_scene scene);
+
+	/// Delete all the files not attached to a scene.
+	void Trim();
+
+	Stats GetStats() const;
+
+private:
+
+	struct Entry;
+
+	struct FileKey
+	{
+		uint64_t hash = 0;
+		int64_t size = -1;
+		int64_t modificationTime = 0;
+	};
+
+	rpr_status GetFileHash(const std::string& fileName, uint64_t& hash);
+	rpr_status Import(const std::string& fileName, Entry& entry);
+	rpr_status AttachEntry(Entry& entry, rpr_scene scene);
+	rpr_status DetachEntry(Entry& entry, rpr_scene scene);
+	void DeleteEntry(Entry& entry);
+	void RemoveEntry(uint64_t hash);
+	void Evict(size_t budget);
+
+	rpr_context m_context;
+	rpr_material_system m_materialSystem;
+	Settings m_settings;
+
+	mutable std::mutex m_mutex;
+	std::unordered_map<uint64_t, std::unique_ptr<Entry>> m_entries;
+	std::list<uint64_t> m_lru; // most recently used first
+	std::map<std::string, FileKey> m_fileKeys; // avoids to hash again a file that didn't change
+	Stats m_stats;
+};
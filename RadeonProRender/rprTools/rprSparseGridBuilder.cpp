@@ -0,0 +1,367 @@
+/*****************************************************************************\
+*
+*  Module Name    rprSparseGridBuilder.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#include "rprSparseGridBuilder.h"
+#include "rprToolsCommon.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using rprtools::SecondsSince;
+
+
+namespace
+{
+
+// blocks expanded by a task of Expand
+const size_t EXPAND_BATCH = 64;
+
+unsigned CountTrailingZeros(uint64_t value)
+{
+#if defined(_MSC_VER)
+	unsigned long index = 0;
+	_BitScanForward64(&index, value);
+	return (unsigned)index;
+#else
+	return (unsigned)__builtin_ctzll(value);
+#endif
+}
+
+size_t GetIndexBytes(rpr_grid_indices_topology topology)
+{
+	switch (topology)
+	{
+	case RPR_GRID_INDICES_TOPOLOGY_I_U64:
+	case RPR_GRID_INDICES_TOPOLOGY_I_S64:
+		return 8;
+	case RPR_GRID_INDICES_TOPOLOGY_XYZ_U32:
+	case RPR_GRID_INDICES_TOPOLOGY_XYZ_S32:
+		return 12;
+	default:
+		return 0;
+	}
+}
+
+template<typename T>
+void StoreIndex(char* destination, T value)
+{
+	memcpy(destination, &value, sizeof(T));
+}
+
+template<typename T>
+void StoreIndex(char* destination, T x, T y, T z)
+{
+	const T xyz[3] = { x, y, z };
+	memcpy(destination, xyz, sizeof(xyz));
+}
+
+} // namespace
+
+
+const unsigned RPRSparseGridBuilder::BLOCK_SIZE;
+const unsigned RPRSparseGridBuilder::BLOCK_VOXELS;
+
+RPRSparseGridBuilder::RPRSparseGridBuilder(const Settings& settings)
+	: m_settings(settings)
+{
+}
+
+RPRSparseGridBuilder::RPRSparseGridBuilder()
+	: RPRSparseGridBuilder(Settings())
+{
+}
+
+unsigned RPRSparseGridBuilder::GetNumThreads(size_t numTasks) const
+{
+	const unsigned hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+	const size_t numThreads = std::min<size_t>(m_settings.numThreads ? m_settings.numThreads : hardwareThreads, numTasks);
+	return (unsigned)std::max<size_t>(1, numThreads);
+}
+
+rpr_status RPRSparseGridBuilder::Build(unsigned sizeX, unsigned sizeY, unsigned sizeZ, const BlockFunction& function)
+{
+	if ( sizeX == 0 || sizeY == 0 || sizeZ == 0 || !function )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	const size_t indexBytes = GetIndexBytes(m_settings.topology);
+	if ( indexBytes == 0 )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	// the signed topologies can't address the whole range of unsigned
+	const bool signedIndices = m_settings.topology == RPR_GRID_INDICES_TOPOLOGY_I_S64 || m_settings.topology == RPR_GRID_INDICES_TOPOLOGY_XYZ_S32;
+	if ( signedIndices && std::max(sizeX, std::max(sizeY, sizeZ)) > 0x7FFFFFFFu )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	const auto start = std::chrono::steady_clock::now();
+
+	const unsigned numBlocksX = (sizeX + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	const unsigned numBlocksY = (sizeY + BLOCK_SIZE - 1) / BLOCK_SIZE;
+	const unsigned numBlocksZ = (sizeZ + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+	// one task per row of blocks along x; the rows are concatenated in order, so the result doesn't depend on the threads
+	struct Row
+	{
+		std::vector<Block> blocks;
+		std::vector<float> values;
+	};
+	const size_t numRows = (size_t)numBlocksY * numBlocksZ;
+	std::vector<Row> rows(numRows);
+
+	const float background = m_settings.background;
+	const float tolerance = m_settings.tolerance;
+
+	std::atomic<size_t> nextRow(0);
+	auto fillRows = [&]()
+	{
+		float values[BLOCK_VOXELS];
+		for(size_t r=nextRow++; r<numRows; r=nextRow++)
+		{
+			Row& row = rows[r];
+			const unsigned y0 = (unsigned)(r % numBlocksY) * BLOCK_SIZE;
+			const unsigned z0 = (unsigned)(r / numBlocksY) * BLOCK_SIZE;
+			const unsigned countY = std::min(BLOCK_SIZE, sizeY - y0);
+			const unsigned countZ = std::min(BLOCK_SIZE, sizeZ - z0);
+
+			for(unsigned bx=0; bx<numBlocksX; bx++)
+			{
+				const unsigned x0 = bx * BLOCK_SIZE;
+				const unsigned countX = std::min(BLOCK_SIZE, sizeX - x0);
+
+				std::fill(values, values + BLOCK_VOXELS, background);
+				function(x0, y0, z0, values);
+
+				Block block;
+				block.x = x0;
+				block.y = y0;
+				block.z = z0;
+				block.valueOffset = row.values.size();
+
+				// the voxels outside of the grid stay inactive
+				for(unsigned z=0; z<countZ; z++)
+				{
+					for(unsigned y=0; y<countY; y++)
+					{
+						for(unsigned x=0; x<countX; x++)
+						{
+							const float value = values[x + BLOCK_SIZE * (y + BLOCK_SIZE * z)];
+							if ( std::fabs(value - background) > tolerance )
+							{
+								block.mask[z] |= uint64_t(1) << (x + BLOCK_SIZE * y);
+								row.values.push_back(value);
+								block.activeCount++;
+							}
+						}
+					}
+				}
+
+				if ( block.activeCount == 0 )
+					continue;
+
+				// uniform block: keep one value
+				if ( block.activeCount == BLOCK_VOXELS )
+				{
+					const float* first = &row.values[block.valueOffset];
+					if ( std::all_of(first, first + BLOCK_VOXELS, [first](float value) { return value == first[0]; }) )
+					{
+						row.values.resize(block.valueOffset + 1);
+						block.constant = true;
+					}
+				}
+
+				row.blocks.push_back(block);
+			}
+		}
+	};
+
+	const unsigned numThreads = GetNumThreads(numRows);
+	std::vector<std::thread> threads;
+	for(unsigned i=1; i<numThreads; i++)
+		threads.emplace_back(fillRows);
+	fillRows();
+	for(auto& thread : threads)
+		thread.join();
+
+	// concatenate the rows
+	size_t numBlocks = 0;
+	size_t numValues = 0;
+	for(const Row& row : rows)
+	{
+		numBlocks += row.blocks.size();
+		numValues += row.values.size();
+	}
+
+	std::vector<Block> blocks;
+	std::vector<float> values;
+	blocks.reserve(numBlocks);
+	values.reserve(numValues);
+
+	Stats stats;
+	for(Row& row : rows)
+	{
+		for(Block block : row.blocks)
+		{
+			block.valueOffset += values.size();
+			blocks.push_back(block);
+
+			stats.activeVoxels += block.activeCount;
+			if ( block.constant )
+				stats.constantBlocks++;
+		}
+		values.insert(values.end(), row.values.begin(), row.values.end());
+		row = Row();
+	}
+
+	m_sizeX = sizeX;
+	m_sizeY = sizeY;
+	m_sizeZ = sizeZ;
+	m_blocks.swap(blocks);
+	m_values.swap(values);
+
+	stats.blocks = m_blocks.size();
+	stats.blockBytes = m_blocks.size() * sizeof(Block) + m_values.size() * sizeof(float);
+	stats.uploadBytes = stats.activeVoxels * (indexBytes + sizeof(float));
+	stats.naiveBytes = stats.activeVoxels * (3 * sizeof(uint32_t) + sizeof(float));
+	stats.buildSeconds = SecondsSince(start);
+	m_stats = stats;
+
+	return RPR_SUCCESS;
+}
+
+rpr_status RPRSparseGridBuilder::BuildFromDense(const float* values, unsigned sizeX, unsigned sizeY, unsigned sizeZ)
+{
+	if ( !values )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	return Build(sizeX, sizeY, sizeZ, [=](unsigned x0, unsigned y0, unsigned z0, float* block)
+	{
+		const unsigned countX = std::min(BLOCK_SIZE, sizeX - x0);
+		const unsigned countY = std::min(BLOCK_SIZE, sizeY - y0);
+		const unsigned countZ = std::min(BLOCK_SIZE, sizeZ - z0);
+		for(unsigned z=0; z<countZ; z++)
+		{
+			for(unsigned y=0; y<countY; y++)
+			{
+				const float* source = values + x0 + (size_t)sizeX * ((y0 + y) + (size_t)sizeY * (z0 + z));
+				std::copy(source, source + countX, block + BLOCK_SIZE * (y + BLOCK_SIZE * z));
+			}
+		}
+	});
+}
+
+rpr_status RPRSparseGridBuilder::Expand(std::vector<char>& indices, std::vector<float>& values)
+{
+	const size_t indexBytes = GetIndexBytes(m_settings.topology);
+	if ( m_sizeX == 0 || indexBytes == 0 )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	const auto start = std::chrono::steady_clock::now();
+
+	// first voxel of each block in the arrays
+	std::vector<size_t> offsets(m_blocks.size());
+	size_t numVoxels = 0;
+	for(size_t b=0; b<m_blocks.size(); b++)
+	{
+		offsets[b] = numVoxels;
+		numVoxels += m_blocks[b].activeCount;
+	}
+
+	indices.resize(numVoxels * indexBytes);
+	values.resize(numVoxels);
+
+	const rpr_grid_indices_topology topology = m_settings.topology;
+	const uint64_t strideY = m_sizeX;
+	const uint64_t strideZ = (uint64_t)m_sizeX * m_sizeY;
+
+	const size_t numBatches = (m_blocks.size() + EXPAND_BATCH - 1) / EXPAND_BATCH;
+	std::atomic<size_t> nextBatch(0);
+	auto expandBlocks = [&]()
+	{
+		for(size_t batch=nextBatch++; batch<numBatches; batch=nextBatch++)
+		{
+			const size_t blockEnd = std::min(m_blocks.size(), (batch + 1) * EXPAND_BATCH);
+			for(size_t b=batch*EXPAND_BATCH; b<blockEnd; b++)
+			{
+				const Block& block = m_blocks[b];
+				const float* blockValues = &m_values[block.valueOffset];
+				size_t voxel = offsets[b];
+				for(unsigned z=0; z<BLOCK_SIZE; z++)
+				{
+					for(uint64_t word=block.mask[z]; word; word&=word-1)
+					{
+						const unsigned bit = CountTrailingZeros(word);
+						const unsigned x = block.x + bit % BLOCK_SIZE;
+						const unsigned y = block.y + bit / BLOCK_SIZE;
+						const unsigned vz = block.z + z;
+
+						char* index = &indices[voxel * indexBytes];
+						switch (topology)
+						{
+						case RPR_GRID_INDICES_TOPOLOGY_I_U64:
+							StoreIndex<uint64_t>(index, x + y * strideY + vz * strideZ);
+							break;
+						case RPR_GRID_INDICES_TOPOLOGY_I_S64:
+							StoreIndex<int64_t>(index, (int64_t)(x + y * strideY + vz * strideZ));
+							break;
+						case RPR_GRID_INDICES_TOPOLOGY_XYZ_U32:
+							StoreIndex<uint32_t>(index, x, y, vz);
+							break;
+						default:
+							StoreIndex<int32_t>(index, (int32_t)x, (int32_t)y, (int32_t)vz);
+							break;
+						}
+
+						values[voxel] = block.constant ? blockValues[0] : blockValues[voxel - offsets[b]];
+						voxel++;
+					}
+				}
+			}
+		}
+	};
+
+	const unsigned numThreads = GetNumThreads(numBatches);
+	std::vector<std::thread> threads;
+	for(unsigned i=1; i<numThreads; i++)
+		threads.emplace_back(expandBlocks);
+	expandBlocks();
+	for(auto& thread : threads)
+		thread.join();
+
+	m_stats.expandSeconds = SecondsSince(start);
+	return RPR_SUCCESS;
+}
+
+rpr_status RPRSparseGridBuilder::CreateGrid(rpr_context context, rpr_grid* grid)
+{
+	if ( !context || !grid )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	std::vector<char> indices;
+	std::vector<float> values;
+	rpr_status status = Expand(indices, values);
+	if ( status != RPR_SUCCESS )
+		return status;
+
+	const auto start = std::chrono::steady_clock::now();
+	status = rprContextCreateGrid(context, grid, m_sizeX, m_sizeY, m_sizeZ,
+		indices.data(), values.size(), m_settings.topology,
+		values.data(), values.size() * sizeof(float), 0);
+	m_stats.createSeconds = SecondsSince(start);
+
+	return status;
+}
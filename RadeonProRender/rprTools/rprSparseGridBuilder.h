@@ -0,0 +1,129 @@
+/*****************************************************************************\
+*
+*  Module Name    rprSparseGridBuilder.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <RadeonProRender.h>
+
+// Builds the sparse grids of rprContextCreateGrid, instead of pushing 3 indices and 1 value per voxel in a loop.
+//
+// The grid is cut in blocks of 8x8x8 voxels, filled in parallel ( one slab of blocks per task ) from a function or a dense array.
+// The voxels equal to the background ( within tolerance ) are pruned: a block keeps a 512-bit mask of its active voxels and their
+// values only, or a single value when all its voxels are active with the same value. The empty blocks are not stored.
+//
+// CreateGrid expands the blocks into the indices and values of rprContextCreateGrid, in parallel, with the topology of the settings:
+// RPR_GRID_INDICES_TOPOLOGY_XYZ_U32 by default, the topology of the volume tutorials. With this default the arrays given to
+// rprContextCreateGrid are exactly as large as with the loop ( 16 bytes per active voxel ): the builder saves build time, not memory.
+// RPR_GRID_INDICES_TOPOLOGY_I_U64 takes 12 bytes per voxel instead of 16, with index = x + y * sizeX + z * sizeX * sizeY: the API
+// does not document the order of the linear index, it has not been checked with the renderer and must be before it's used.
+// The expanded arrays are released once the grid is created.
+//
+// Usage:
+//   RPRSparseGridBuilder builder;
+//   builder.Build(128, 128, 128, [](unsigned x0, unsigned y0, unsigned z0, float* values)
+//   {
+//       for each voxel ( x, y, z ) of the block: values[x + 8 * ( y + 8 * z )] = density( x0 + x, y0 + y, z0 + z );
+//   });
+//   rpr_grid grid = nullptr;
+//   builder.CreateGrid(context, &grid);
+class RPRSparseGridBuilder
+{
+public:
+
+	static const unsigned BLOCK_SIZE = 8;
+	static const unsigned BLOCK_VOXELS = BLOCK_SIZE * BLOCK_SIZE * BLOCK_SIZE;
+
+	struct Settings
+	{
+		/// Value of the voxels not stored in the grid.
+		float background = 0.0f;
+
+		/// Voxels within tolerance of the background are pruned.
+		float tolerance = 0.0f;
+
+		/// RPR_GRID_INDICES_TOPOLOGY_XYZ_U32, RPR_GRID_INDICES_TOPOLOGY_XYZ_S32, RPR_GRID_INDICES_TOPOLOGY_I_U64 or RPR_GRID_INDICES_TOPOLOGY_I_S64.
+		/// The linear topologies assume index = x + y * sizeX + z * sizeX * sizeY.
+		/// With the default, Stats::uploadBytes equals Stats::naiveBytes: only a linear topology uploads less.
+		rpr_grid_indices_topology topology = RPR_GRID_INDICES_TOPOLOGY_XYZ_U32;
+
+		/// Threads of Build and CreateGrid. 0: one per hardware thread.
+		unsigned numThreads = 0;
+	};
+
+	struct Stats
+	{
+		size_t activeVoxels = 0;
+		size_t blocks = 0;
+		size_t constantBlocks = 0;
+
+		/// memory of the blocks, bytes given to rprContextCreateGrid, and the same with 3 x 32-bit indices + 1 float per voxel.
+		size_t blockBytes = 0;
+		size_t uploadBytes = 0;
+		size_t naiveBytes = 0;
+
+		double buildSeconds = 0.0;
+		double expandSeconds = 0.0;
+		double createSeconds = 0.0;
+	};
+
+	/// Fill the BLOCK_VOXELS values of the block at voxel ( x0, y0, z0 ), x fastest: values[x + 8 * ( y + 8 * z )].
+	/// values is filled with the background before the call. The voxels outside of the grid are ignored.
+	/// Called by several threads at the same time.
+	typedef std::function<void(unsigned x0, unsigned y0, unsigned z0, float* values)> BlockFunction;
+
+	RPRSparseGridBuilder(const Settings& settings);
+	RPRSparseGridBuilder();
+
+	RPRSparseGridBuilder(const RPRSparseGridBuilder&) = delete;
+	RPRSparseGridBuilder& operator=(const RPRSparseGridBuilder&) = delete;
+
+	/// Replace the content with a grid of sizeX x sizeY x sizeZ voxels filled by function.
+	rpr_status Build(unsigned sizeX, unsigned sizeY, unsigned sizeZ, const BlockFunction& function);
+
+	/// Same from a dense array, x fastest: values[x + sizeX * ( y + sizeY * z )].
+	rpr_status BuildFromDense(const float* values, unsigned sizeX, unsigned sizeY, unsigned sizeZ);
+
+	/// Create a grid with the active voxels.
+	rpr_status CreateGrid(rpr_context context, rpr_grid* grid);
+
+	/// Expand the active voxels into the arrays given to rprContextCreateGrid: 1 or 3 indices per voxel depending on the topology.
+	/// indices holds uint64_t, int64_t, uint32_t or int32_t values.
+	rpr_status Expand(std::vector<char>& indices, std::vector<float>& values);
+
+	Stats GetStats() const { return m_stats; }
+
+private:
+
+	struct Block
+	{
+		unsigned x = 0;
+		unsigned y = 0;
+		unsigned z = 0;
+		uint64_t mask[BLOCK_SIZE] = {}; // one word per z: bit x + 8 * y
+		size_t valueOffset = 0;         // in m_values
+		unsigned activeCount = 0;
+		bool constant = false;          // all voxels active, one value
+	};
+
+	unsigned GetNumThreads(size_t numTasks) const;
+
+	Settings m_settings;
+	unsigned m_sizeX = 0;
+	unsigned m_sizeY = 0;
+	unsigned m_sizeZ = 0;
+	std::vector<Block> m_blocks;
+	std::vector<float> m_values;
+	Stats m_stats;
+};
@@ -0,0 +1,559 @@
+/*****************************************************************************\
+*
+*  Module Name    rprTelemetry.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#include "rprTelemetry.h"
+#include "rprToolsCommon.h"
+
+#include <cstring>
+
+#if defined(_WIN32)
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+using rprtools::SecondsSince;
+
+
+namespace
+{
+
+#if defined(_WIN32)
+typedef SOCKET SocketHandle;
+const SocketHandle INVALID_SOCKET_HANDLE = INVALID_SOCKET;
+void CloseSocket(SocketHandle socket) { closesocket(socket); }
+#else
+typedef int SocketHandle;
+const SocketHandle INVALID_SOCKET_HANDLE = -1;
+void CloseSocket(SocketHandle socket) { close(socket); }
+#endif
+
+#if defined(MSG_NOSIGNAL)
+const int SEND_FLAGS = MSG_NOSIGNAL; // no SIGPIPE when the client is gone
+#else
+const int SEND_FLAGS = 0;
+#endif
+
+const char* const PHASE_NAMES[RPRTelemetry::PHASE_COUNT] = { "commit", "render", "resolve", "readback" };
+
+struct ObjectList
+{
+	rpr_context_info info;
+	const char* name;
+};
+
+const ObjectList OBJECT_LISTS[] = {
+	{ RPR_CONTEXT_LIST_CREATED_CAMERAS, "cameras" },
+	{ RPR_CONTEXT_LIST_CREATED_MATERIALNODES, "material_nodes" },
+	{ RPR_CONTEXT_LIST_CREATED_LIGHTS, "lights" },
+	{ RPR_CONTEXT_LIST_CREATED_SHAPES, "shapes" },
+	{ RPR_CONTEXT_LIST_CREATED_POSTEFFECTS, "post_effects" },
+	{ RPR_CONTEXT_LIST_CREATED_HETEROVOLUMES, "hetero_volumes" },
+	{ RPR_CONTEXT_LIST_CREATED_GRIDS, "grids" },
+	{ RPR_CONTEXT_LIST_CREATED_BUFFERS, "buffers" },
+	{ RPR_CONTEXT_LIST_CREATED_IMAGES, "images" },
+	{ RPR_CONTEXT_LIST_CREATED_FRAMEBUFFERS, "framebuffers" },
+	{ RPR_CONTEXT_LIST_CREATED_SCENES, "scenes" },
+	{ RPR_CONTEXT_LIST_CREATED_CURVES, "curves" },
+	{ RPR_CONTEXT_LIST_CREATED_MATERIALSYSTEM, "material_systems" },
+	{ RPR_CONTEXT_LIST_CREATED_COMPOSITE, "composites" },
+	{ RPR_CONTEXT_LIST_CREATED_LUT, "luts" },
+};
+
+int64_t SteadyNanoseconds(const std::chrono::steady_clock::time_point& time)
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+std::string FormatNumber(double value)
+{
+	char text[32];
+	snprintf(text, sizeof(text), "%.9g", value);
+	return text;
+}
+
+// for the JSON strings and the Prometheus label values: same escapes for \ " and new lines
+std::string Escape(const std::string& text)
+{
+	std::string escaped;
+	for(char c : text)
+	{
+		if ( c == '\\' || c == '"' )
+		{
+			escaped += '\\';
+			escaped += c;
+		}
+		else if ( c == '\n' )
+		{
+			escaped += "\\n";
+		}
+		else if ( (unsigned char)c >= 0x20 )
+		{
+			escaped += c;
+		}
+	}
+	return escaped;
+}
+
+void AppendMetric(std::string& text, const char* name, const char* type, const char* help, const std::string& labels, double value)
+{
+	text += std::string("# HELP ") + name + " " + help + "\n";
+	text += std::string("# TYPE ") + name + " " + type + "\n";
+	text += std::string(name) + "{" + labels + "} " + FormatNumber(value) + "\n";
+}
+
+}
+
+
+RPRTelemetry::Scope::Scope(RPRTelemetry& telemetry, Phase phase) :
+	m_telemetry(telemetry),
+	m_phase(phase),
+	m_start(std::chrono::steady_clock::now())
+{
+}
+
+RPRTelemetry::Scope::~Scope()
+{
+	m_telemetry.AddPhaseTime(m_phase, SecondsSince(m_start));
+}
+
+
+RPRTelemetry::RPRTelemetry(rpr_context context, const Settings& settings) :
+	m_context(context),
+	m_settings(settings),
+	m_eventHead(0),
+	m_droppedEvents(0),
+	m_stopServer(false)
+{
+	size_t capacity = 2;
+	while ( capacity < m_settings.maxProgressEvents )
+		capacity *= 2;
+	m_events.reset(new ProgressEvent[capacity]);
+	for(size_t i=0; i<capacity; i++)
+		m_events[i].sequence.store(i, std::memory_order_relaxed);
+	m_eventMask = capacity - 1;
+}
+
+RPRTelemetry::RPRTelemetry(rpr_context context) :
+	RPRTelemetry(context, Settings())
+{
+}
+
+RPRTelemetry::~RPRTelemetry()
+{
+	if ( m_installed )
+	{
+		rprContextSetParameterByKeyPtr(m_context, RPR_CONTEXT_RENDER_UPDATE_CALLBACK_FUNC, nullptr);
+		rprContextSetParameterByKeyPtr(m_context, RPR_CONTEXT_RENDER_UPDATE_CALLBACK_DATA, nullptr);
+	}
+	StopServer();
+	if ( m_jsonFile )
+		fclose(m_jsonFile);
+}
+
+rpr_status RPRTelemetry::Install()
+{
+	if ( m_installed )
+		return RPR_SUCCESS;
+	if ( !m_context )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	if ( !m_settings.jsonPath.empty() )
+	{
+		m_jsonFile = fopen(m_settings.jsonPath.c_str(), "ab");
+		if ( !m_jsonFile )
+			return RPR_ERROR_IO_ERROR;
+	}
+	if ( m_settings.prometheusPort != 0 && !StartServer() )
+	{
+		if ( m_jsonFile )
+			fclose(m_jsonFile);
+		m_jsonFile = nullptr;
+		return RPR_ERROR_IO_ERROR;
+	}
+
+	rpr_status status = rprContextSetParameterByKeyPtr(m_context, RPR_CONTEXT_RENDER_UPDATE_CALLBACK_DATA, this);
+	if ( status == RPR_SUCCESS )
+		status = rprContextSetParameterByKeyPtr(m_context, RPR_CONTEXT_RENDER_UPDATE_CALLBACK_FUNC, (void*)&RPRTelemetry::OnRenderUpdate);
+	if ( status != RPR_SUCCESS )
+	{
+		rprContextSetParameterByKeyPtr(m_context, RPR_CONTEXT_RENDER_UPDATE_CALLBACK_DATA, nullptr);
+		StopServer();
+		if ( m_jsonFile )
+			fclose(m_jsonFile);
+		m_jsonFile = nullptr;
+		return status;
+	}
+
+	m_installed = true;
+	return RPR_SUCCESS;
+}
+
+void RPRTelemetry::OnRenderUpdate(float progress, void* data)
+{
+	((RPRTelemetry*)data)->PushProgress(progress);
+}
+
+// called by the threads of the renderer: no lock, no allocation
+void RPRTelemetry::PushProgress(float progress)
+{
+	const int64_t time = SteadyNanoseconds(std::chrono::steady_clock::now());
+
+	uint64_t position = m_eventHead.load(std::memory_order_relaxed);
+	for(;;)
+	{
+		ProgressEvent& event = m_events[position & m_eventMask];
+		const uint64_t sequence = event.sequence.load(std::memory_order_acquire);
+		const int64_t difference = (int64_t)(sequence - position);
+		if ( difference == 0 )
+		{
+			// the slot is free: take it
+			if ( m_eventHead.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) )
+			{
+				event.time = time;
+				event.progress = progress;
+				event.sequence.store(position + 1, std::memory_order_release);
+				return;
+			}
+		}
+		else if ( difference < 0 )
+		{
+			// full until EndFrame
+			m_droppedEvents.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		else
+		{
+			position = m_eventHead.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+void RPRTelemetry::AddPhaseTime(Phase phase, double seconds)
+{
+	m_frame.phaseSeconds[phase] += seconds;
+}
+
+void RPRTelemetry::BeginFrame()
+{
+	const uint64_t frame = m_totals.frames;
+	m_frame = FrameMetrics();
+	m_frame.frame = frame;
+	m_frame.timestamp = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+	m_frameStart = std::chrono::steady_clock::now();
+	m_frameStarted = true;
+}
+
+rpr_status RPRTelemetry::Render()
+{
+	// 1 iteration per call when the context doesn't give RPR_CONTEXT_ITERATIONS
+	rpr_uint iterations = 0;
+	if ( rprContextGetInfo(m_context, RPR_CONTEXT_ITERATIONS, sizeof(iterations), &iterations, nullptr) != RPR_SUCCESS || iterations == 0 )
+		iterations = 1;
+
+	Scope scope(*this, PHASE_RENDER);
+	const rpr_status status = rprContextRender(m_context);
+	if ( status == RPR_SUCCESS )
+		m_frame.iterations += iterations;
+	return status;
+}
+
+rpr_status RPRTelemetry::Resolve(rpr_framebuffer source, rpr_framebuffer destination, rpr_bool noDisplayGamma)
+{
+	Scope scope(*this, PHASE_RESOLVE);
+	return rprContextResolveFrameBuffer(m_context, source, destination, noDisplayGamma);
+}
+
+rpr_status RPRTelemetry::ReadFrameBuffer(rpr_framebuffer framebuffer, std::vector<float>& data)
+{
+	Scope scope(*this, PHASE_READBACK);
+	size_t size = 0;
+	rpr_status status = rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_DATA, 0, nullptr, &size);
+	if ( status != RPR_SUCCESS )
+		return status;
+	data.resize(size / sizeof(float));
+	return rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_DATA, size, data.data(), nullptr);
+}
+
+rpr_status RPRTelemetry::EndFrame(FrameMetrics* metrics)
+{
+	if ( !m_frameStarted )
+		return RPR_ERROR_INVALID_PARAMETER;
+	m_frameStarted = false;
+
+	FrameMetrics& frame = m_frame;
+	frame.frameSeconds = SecondsSince(m_frameStart);
+	const double renderSeconds = frame.phaseSeconds[PHASE_RENDER];
+	frame.iterationsPerSecond = renderSeconds > 0.0 ? frame.iterations / renderSeconds : 0.0;
+
+	// progress updates of the frame. The ones received between EndFrame and BeginFrame are ignored.
+	const int64_t frameStart = SteadyNanoseconds(m_frameStart);
+	for(;;)
+	{
+		ProgressEvent& event = m_events[m_eventTail & m_eventMask];
+		if ( event.sequence.load(std::memory_order_acquire) != m_eventTail + 1 )
+			break;
+		if ( event.time >= frameStart )
+		{
+			if ( frame.progressEvents == 0 )
+				frame.timeToFirstPixel = (event.time - frameStart) * 1e-9;
+			frame.progressEvents++;
+		}
+		event.sequence.store(m_eventTail + m_eventMask + 1, std::memory_order_release);
+		m_eventTail++;
+	}
+	frame.droppedProgressEvents = (size_t)m_droppedEvents.exchange(0, std::memory_order_relaxed);
+
+	rpr_render_statistics statistics = {};
+	if ( rprContextGetInfo(m_context, RPR_CONTEXT_RENDER_STATISTICS, sizeof(statistics), &statistics, nullptr) == RPR_SUCCESS )
+	{
+		frame.gpuMemoryBytes = statistics.gpumem_usage;
+		frame.systemMemoryBytes = statistics.sysmem_usage;
+	}
+
+	if ( m_settings.queryObjectCounts )
+	{
+		// the size of the lists only, as in CheckNoLeak
+		for(const ObjectList& list : OBJECT_LISTS)
+		{
+			size_t size = 0;
+			if ( rprContextGetInfo(m_context, list.info, 0, nullptr, &size) == RPR_SUCCESS )
+				frame.objectCounts.push_back({ list.name, size / sizeof(void*) });
+		}
+	}
+
+	m_totals.frames++;
+	m_totals.iterations += frame.iterations;
+	m_totals.progressEvents += frame.progressEvents;
+	m_totals.droppedProgressEvents += frame.droppedProgressEvents;
+	m_totals.frameSeconds += frame.frameSeconds;
+	for(int phase=0; phase<PHASE_COUNT; phase++)
+		m_totals.phaseSeconds[phase] += frame.phaseSeconds[phase];
+
+	rpr_status status = RPR_SUCCESS;
+	if ( m_jsonFile )
+	{
+		const std::string line = FormatJson(frame) + "\n";
+		if ( fwrite(line.data(), 1, line.size(), m_jsonFile) != line.size() || fflush(m_jsonFile) != 0 )
+			status = RPR_ERROR_IO_ERROR;
+	}
+	if ( m_settings.prometheusPort != 0 )
+	{
+		std::string text = FormatPrometheus(frame, m_totals);
+		std::lock_guard<std::mutex> lock(m_prometheusMutex);
+		m_prometheusText.swap(text);
+	}
+
+	if ( metrics )
+		*metrics = frame;
+	return status;
+}
+
+std::string RPRTelemetry::GetPrometheusText() const
+{
+	if ( m_settings.prometheusPort == 0 )
+		return FormatPrometheus(m_frame, m_totals);
+	std::lock_guard<std::mutex> lock(m_prometheusMutex);
+	return m_prometheusText;
+}
+
+std::string RPRTelemetry::FormatJson(const FrameMetrics& metrics) const
+{
+	std::string json = "{\"node\":\"" + Escape(m_settings.nodeName) + "\"";
+	json += ",\"frame\":" + std::to_string(metrics.frame);
+	json += ",\"timestamp\":" + std::to_string(metrics.timestamp); // microseconds: %g would round it
+	json += ",\"iterations\":" + std::to_string(metrics.iterations);
+	json += ",\"iterations_per_second\":" + FormatNumber(metrics.iterationsPerSecond);
+	if ( metrics.timeToFirstPixel >= 0.0 )
+		json += ",\"time_to_first_pixel\":" + FormatNumber(metrics.timeToFirstPixel);
+	json += ",\"frame_seconds\":" + FormatNumber(metrics.frameSeconds);
+	for(int phase=0; phase<PHASE_COUNT; phase++)
+		json += std::string(",\"") + PHASE_NAMES[phase] + "_seconds\":" + FormatNumber(metrics.phaseSeconds[phase]);
+	json += ",\"progress_events\":" + std::to_string(metrics.progressEvents);
+	json += ",\"dropped_progress_events\":" + std::to_string(metrics.droppedProgressEvents);
+	if ( metrics.gpuMemoryBytes >= 0 )
+		json += ",\"gpu_memory_bytes\":" + std::to_string(metrics.gpuMemoryBytes);
+	if ( metrics.systemMemoryBytes >= 0 )
+		json += ",\"system_memory_bytes\":" + std::to_string(metrics.systemMemoryBytes);
+	json += ",\"objects\":{";
+	for(size_t i=0; i<metrics.objectCounts.size(); i++)
+		json += std::string(i ? "," : "") + "\"" + metrics.objectCounts[i].name + "\":" + std::to_string(metrics.objectCounts[i].count);
+	json += "}}";
+	return json;
+}
+
+std::string RPRTelemetry::FormatPrometheus(const FrameMetrics& last, const Totals& totals) const
+{
+	const std::string node = "node=\"" + Escape(m_settings.nodeName) + "\"";
+
+	std::string text;
+	AppendMetric(text, "rpr_frames_total", "counter", "Frames rendered.", node, (double)totals.frames);
+	AppendMetric(text, "rpr_iterations_total", "counter", "Iterations rendered.", node, (double)totals.iterations);
+	AppendMetric(text, "rpr_frame_seconds_total", "counter", "Seconds from BeginFrame to EndFrame.", node, totals.frameSeconds);
+
+	text += "# HELP rpr_phase_seconds_total Seconds spent in each phase of the frames.\n";
+	text += "# TYPE rpr_phase_seconds_total counter\n";
+	for(int phase=0; phase<PHASE_COUNT; phase++)
+		text += "rpr_phase_seconds_total{" + node + ",phase=\"" + PHASE_NAMES[phase] + "\"} " + FormatNumber(totals.phaseSeconds[phase]) + "\n";
+
+	AppendMetric(text, "rpr_progress_events_total", "counter", "Render progress updates received.", node, (double)totals.progressEvents);
+	AppendMetric(text, "rpr_progress_events_dropped_total", "counter", "Render progress updates dropped by a full queue.", node, (double)totals.droppedProgressEvents);
+
+	AppendMetric(text, "rpr_iterations_per_second", "gauge", "Iterations per second of rendering of the last frame.", node, last.iterationsPerSecond);
+	if ( last.timeToFirstPixel >= 0.0 )
+		AppendMetric(text, "rpr_time_to_first_pixel_seconds", "gauge", "Seconds from the start of the last frame to its first progress update.", node, last.timeToFirstPixel);
+	AppendMetric(text, "rpr_last_frame_seconds", "gauge", "Seconds of the last frame.", node, last.frameSeconds);
+	if ( last.gpuMemoryBytes >= 0 )
+		AppendMetric(text, "rpr_gpu_memory_bytes", "gauge", "GPU memory used by the context.", node, (double)last.gpuMemoryBytes);
+	if ( last.systemMemoryBytes >= 0 )
+		AppendMetric(text, "rpr_system_memory_bytes", "gauge", "System memory used by the context.", node, (double)last.systemMemoryBytes);
+
+	if ( !last.objectCounts.empty() )
+	{
+		text += "# HELP rpr_objects Objects created in the context.\n";
+		text += "# TYPE rpr_objects gauge\n";
+		for(const ObjectCount& objectCount : last.objectCounts)
+			text += "rpr_objects{" + node + ",type=\"" + objectCount.name + "\"} " + std::to_string(objectCount.count) + "\n";
+	}
+	return text;
+}
+
+
+////// Prometheus endpoint //////
+
+bool RPRTelemetry::StartServer()
+{
+#if defined(_WIN32)
+	WSADATA wsaData;
+	if ( WSAStartup(MAKEWORD(2, 2), &wsaData) != 0 )
+		return false;
+#endif
+
+	const SocketHandle serverSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	bool ok = serverSocket != INVALID_SOCKET_HANDLE;
+	if ( ok )
+	{
+		const int reuse = 1;
+		setsockopt(serverSocket, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuse, sizeof(reuse));
+
+		// loopback only: the farm agent scrapes it or forwards it
+		sockaddr_in address;
+		memset(&address, 0, sizeof(address));
+		address.sin_family = AF_INET;
+		address.sin_port = htons(m_settings.prometheusPort);
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		ok = bind(serverSocket, (const sockaddr*)&address, sizeof(address)) == 0 && listen(serverSocket, 8) == 0;
+		if ( !ok )
+			CloseSocket(serverSocket);
+	}
+	if ( !ok )
+	{
+#if defined(_WIN32)
+		WSACleanup();
+#endif
+		return false;
+	}
+
+	// served before the first frame: the counters at 0
+	m_prometheusText = FormatPrometheus(m_frame, m_totals);
+
+	m_serverSocket = (intptr_t)serverSocket;
+	m_stopServer = false;
+	m_server = std::thread(&RPRTelemetry::Serve, this);
+	return true;
+}
+
+void RPRTelemetry::StopServer()
+{
+	if ( !m_server.joinable() )
+		return;
+	m_stopServer = true;
+	m_server.join();
+	CloseSocket((SocketHandle)m_serverSocket);
+	m_serverSocket = -1;
+#if defined(_WIN32)
+	WSACleanup();
+#endif
+}
+
+void RPRTelemetry::Serve()
+{
+	const SocketHandle serverSocket = (SocketHandle)m_serverSocket;
+
+	// waits at most timeoutMilliseconds for socket to be readable
+	auto waitReadable = [](SocketHandle socket, int timeoutMilliseconds)
+	{
+		fd_set sockets;
+		FD_ZERO(&sockets);
+		FD_SET(socket, &sockets);
+		timeval timeout;
+		timeout.tv_sec = timeoutMilliseconds / 1000;
+		timeout.tv_usec = (timeoutMilliseconds % 1000) * 1000;
+		return select((int)socket + 1, &sockets, nullptr, nullptr, &timeout) > 0;
+	};
+
+	while ( !m_stopServer )
+	{
+		// short timeout: StopServer doesn't wait for a client
+		if ( !waitReadable(serverSocket, 100) )
+			continue;
+		const SocketHandle client = accept(serverSocket, nullptr, nullptr);
+		if ( client == INVALID_SOCKET_HANDLE )
+			continue;
+#if defined(SO_NOSIGPIPE)
+		const int noSigPipe = 1;
+		setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, (const char*)&noSigPipe, sizeof(noSigPipe));
+#endif
+
+		// the request line is enough: "GET /metrics HTTP/1.1"
+		std::string request;
+		char buffer[1024];
+		while ( request.find("\r\n") == std::string::npos && request.size() < 8192 && waitReadable(client, 1000) )
+		{
+			const int received = (int)recv(client, buffer, sizeof(buffer), 0);
+			if ( received <= 0 )
+				break;
+			request.append(buffer, received);
+		}
+
+		std::string response;
+		const bool isMetrics = request.compare(0, 12, "GET /metrics") == 0 && request.size() > 12 && (request[12] == ' ' || request[12] == '?');
+		if ( isMetrics )
+		{
+			std::string body;
+			{
+				std::lock_guard<std::mutex> lock(m_prometheusMutex);
+				body = m_prometheusText;
+			}
+			response = "HTTP/1.1 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: " + std::to_string(body.size())
+				+ "\r\nConnection: close\r\n\r\n" + body;
+		}
+		else
+		{
+			response = "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+		}
+
+		for(size_t sent=0; sent<response.size(); )
+		{
+			const int count = (int)send(client, response.data() + sent, (int)(response.size() - sent), SEND_FLAGS);
+			if ( count <= 0 )
+				break;
+			sent += count;
+		}
+		CloseSocket(client);
+	}
+}
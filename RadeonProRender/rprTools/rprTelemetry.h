@@ -0,0 +1,221 @@
+/*****************************************************************************\
+*
+*  Module Name    rprTelemetry.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <RadeonProRender.h>
+
+// Render metrics for the dashboards of a render farm: throughput, latency and memory of each frame, exported as JSON lines
+// and / or as a Prometheus text endpoint.
+//
+// Install sets RPR_CONTEXT_RENDER_UPDATE_CALLBACK_FUNC: each progress update of the renderer is timestamped and pushed
+// in a lock-free ring buffer, drained by EndFrame. The phases of the frame are timed by the wrappers Render, Resolve and
+// ReadFrameBuffer, or by a Scope around the code of the application ( PHASE_COMMIT: scene updates ).
+//
+// For each frame, EndFrame computes:
+//  - iterations ( RPR_CONTEXT_ITERATIONS of each Render ) and iterations per second of rendering
+//  - time to first pixel: from BeginFrame to the first progress update
+//  - seconds spent in each phase
+//  - number of objects created in the context ( RPR_CONTEXT_LIST_CREATED_* ) and memory ( RPR_CONTEXT_RENDER_STATISTICS )
+// then appends a line to jsonPath, and updates the text served on http://127.0.0.1:prometheusPort/metrics.
+//
+// Usage:
+//   RPRTelemetry::Settings settings;
+//   settings.nodeName = "node-042";
+//   settings.jsonPath = "render_metrics.jsonl";
+//   settings.prometheusPort = 9464;
+//   RPRTelemetry telemetry(context, settings);
+//   telemetry.Install();
+//   for each frame:
+//       telemetry.BeginFrame();
+//       { RPRTelemetry::Scope scope(telemetry, RPRTelemetry::PHASE_COMMIT); ... update the scene ... }
+//       telemetry.Render();
+//       telemetry.Resolve(frame_buffer, frame_buffer_resolved, false);
+//       telemetry.ReadFrameBuffer(frame_buffer_resolved, pixels);
+//       telemetry.EndFrame();
+//
+// The context must outlive the telemetry: the destructor removes the callback.
+// BeginFrame, EndFrame and the wrappers must be called by the same thread.
+class RPRTelemetry
+{
+public:
+
+	enum Phase
+	{
+		PHASE_COMMIT,
+		PHASE_RENDER,
+		PHASE_RESOLVE,
+		PHASE_READBACK,
+		PHASE_COUNT,
+	};
+
+	struct Settings
+	{
+		/// Value of the "node" label of the metrics: the host name, for example.
+		std::string nodeName;
+
+		/// JSON lines file, appended by EndFrame. Empty: no file.
+		std::string jsonPath;
+
+		/// Port of the Prometheus endpoint, on the loopback interface only. 0: no endpoint.
+		unsigned short prometheusPort = 0;
+
+		/// Query the RPR_CONTEXT_LIST_CREATED_* counts in EndFrame.
+		bool queryObjectCounts = true;
+
+		/// Progress updates kept between BeginFrame and EndFrame, rounded up to a power of 2. The next ones are dropped.
+		size_t maxProgressEvents = 4096;
+	};
+
+	struct ObjectCount
+	{
+		const char* name;
+		size_t count;
+	};
+
+	struct FrameMetrics
+	{
+		uint64_t frame = 0;
+
+		/// seconds since 1970 at BeginFrame.
+		double timestamp = 0.0;
+
+		uint64_t iterations = 0;
+		double iterationsPerSecond = 0.0;
+
+		/// -1 when no progress update was received.
+		double timeToFirstPixel = -1.0;
+		double frameSeconds = 0.0;
+		double phaseSeconds[PHASE_COUNT] = {};
+
+		size_t progressEvents = 0;
+		size_t droppedProgressEvents = 0;
+
+		/// -1 when RPR_CONTEXT_RENDER_STATISTICS is not available.
+		int64_t gpuMemoryBytes = -1;
+		int64_t systemMemoryBytes = -1;
+
+		std::vector<ObjectCount> objectCounts;
+	};
+
+	/// Times a phase of the current frame, until the end of the scope.
+	class Scope
+	{
+	public:
+		Scope(RPRTelemetry& telemetry, Phase phase);
+		~Scope();
+
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+
+	private:
+		RPRTelemetry& m_telemetry;
+		Phase m_phase;
+		std::chrono::steady_clock::time_point m_start;
+	};
+
+	RPRTelemetry(rpr_context context, const Settings& settings);
+	RPRTelemetry(rpr_context context);
+
+	/// Removes the callback, stops the endpoint and closes the file.
+	~RPRTelemetry();
+
+	RPRTelemetry(const RPRTelemetry&) = delete;
+	RPRTelemetry& operator=(const RPRTelemetry&) = delete;
+
+	/// Set the callback of the context, open the JSON file and start the endpoint.
+	/// Returns RPR_ERROR_IO_ERROR if the file can't be opened or the port can't be used.
+	rpr_status Install();
+
+	void BeginFrame();
+
+	/// rprContextRender, timed as PHASE_RENDER.
+	rpr_status Render();
+
+	/// rprContextResolveFrameBuffer, timed as PHASE_RESOLVE.
+	rpr_status Resolve(rpr_framebuffer source, rpr_framebuffer destination, rpr_bool noDisplayGamma);
+
+	/// Read the float data of framebuffer ( rprFrameBufferGetInfo ), timed as PHASE_READBACK.
+	rpr_status ReadFrameBuffer(rpr_framebuffer framebuffer, std::vector<float>& data);
+
+	/// Compute the metrics of the frame and export them. metrics is optional.
+	rpr_status EndFrame(FrameMetrics* metrics = nullptr);
+
+	/// Metrics of all the frames in the Prometheus text format, as served by the endpoint.
+	std::string GetPrometheusText() const;
+
+private:
+
+	struct ProgressEvent
+	{
+		std::atomic<uint64_t> sequence;
+		int64_t time; // steady_clock nanoseconds
+		float progress;
+	};
+
+	// totals of the frames, for the counters of the Prometheus endpoint
+	struct Totals
+	{
+		uint64_t frames = 0;
+		uint64_t iterations = 0;
+		uint64_t progressEvents = 0;
+		uint64_t droppedProgressEvents = 0;
+		double frameSeconds = 0.0;
+		double phaseSeconds[PHASE_COUNT] = {};
+	};
+
+	static void OnRenderUpdate(float progress, void* data);
+
+	void PushProgress(float progress);
+	void AddPhaseTime(Phase phase, double seconds);
+	std::string FormatJson(const FrameMetrics& metrics) const;
+	std::string FormatPrometheus(const FrameMetrics& last, const Totals& totals) const;
+
+	bool StartServer();
+	void StopServer();
+	void Serve();
+
+	rpr_context m_context;
+	Settings m_settings;
+	bool m_installed = false;
+
+	// progress updates: bounded multi-producer queue, one sequence number per slot
+	std::unique_ptr<ProgressEvent[]> m_events;
+	size_t m_eventMask = 0;
+	std::atomic<uint64_t> m_eventHead;
+	uint64_t m_eventTail = 0;
+	std::atomic<uint64_t> m_droppedEvents;
+
+	FrameMetrics m_frame;
+	bool m_frameStarted = false;
+	std::chrono::steady_clock::time_point m_frameStart;
+	Totals m_totals;
+
+	FILE* m_jsonFile = nullptr;
+
+	// text of the endpoint, updated by EndFrame
+	mutable std::mutex m_prometheusMutex;
+	std::string m_prometheusText;
+
+	std::atomic<bool> m_stopServer;
+	std::thread m_server;
+	intptr_t m_serverSocket = -1;
+};
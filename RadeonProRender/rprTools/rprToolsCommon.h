@@ -0,0 +1,145 @@
+/*****************************************************************************\
+*
+*  Module Name    rprToolsCommon.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#pragma once
+
+// Helpers shared by the implementation of the rprTools classes: timing, task loop and file access.
+// Internal to rprTools: only included by its .cpp files, not by its headers.
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace rprtools
+{
+
+inline double SecondsSince(const std::chrono::steady_clock::time_point& start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// run task(0) ... task(numTasks-1) on numThreads threads, the calling thread included
+inline void ParallelFor(size_t numTasks, unsigned numThreads, const std::function<void(size_t)>& task)
+{
+	std::atomic<size_t> nextTask(0);
+	auto run = [&]()
+	{
+		for(size_t t=nextTask++; t<numTasks; t=nextTask++)
+			task(t);
+	};
+
+	std::vector<std::thread> threads;
+	for(unsigned i=1; i<numThreads && i<numTasks; i++)
+		threads.emplace_back(run);
+	run();
+	for(auto& thread : threads)
+		thread.join();
+}
+
+// read the whole regular file into buffer. false if it can't be read: for example a directory, whose size isn't its content.
+inline bool ReadFile(const std::string& fileName, std::vector<unsigned char>& buffer)
+{
+#if !defined(_WIN32)
+	struct stat fileStat;
+	if ( stat(fileName.c_str(), &fileStat) != 0 || !S_ISREG(fileStat.st_mode) )
+		return false;
+#endif
+	std::ifstream file(fileName, std::ios::binary | std::ios::ate);
+	if ( !file )
+		return false;
+	const std::streamoff fileSize = file.tellg();
+	if ( fileSize < 0 )
+		return false;
+	buffer.resize((size_t)fileSize);
+	file.seekg(0);
+	return (bool)file.read((char*)buffer.data(), buffer.size());
+}
+
+#if !defined(_WIN32)
+
+// how the pages of a mapped file are read
+enum MapAccess
+{
+	MAP_ACCESS_SEQUENTIAL, // in order, each page once
+	MAP_ACCESS_WILL_NEED,  // soon: the system loads the pages in the background
+	MAP_ACCESS_POPULATE,   // now: all the pages are loaded before MapFile returns
+};
+
+// map the regular file read-only. nullptr if it can't be mapped or is empty, the caller then reads it with ReadFile.
+// size is only written when the file is mapped.
+inline void* MapFile(const std::string& fileName, size_t& size, MapAccess access)
+{
+	const int fd = open(fileName.c_str(), O_RDONLY);
+	if ( fd < 0 )
+		return nullptr;
+
+	struct stat fileStat;
+	if ( fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode) || fileStat.st_size == 0 )
+	{
+		close(fd);
+		return nullptr;
+	}
+	const size_t fileSize = (size_t)fileStat.st_size;
+
+	int flags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+	if ( access == MAP_ACCESS_POPULATE )
+		flags |= MAP_POPULATE;
+#endif
+	void* mapped = mmap(nullptr, fileSize, PROT_READ, flags, fd, 0);
+	close(fd);
+	if ( mapped == MAP_FAILED )
+		return nullptr;
+	size = fileSize;
+
+	if ( access == MAP_ACCESS_SEQUENTIAL )
+	{
+		madvise(mapped, size, MADV_SEQUENTIAL);
+	}
+	else if ( access == MAP_ACCESS_WILL_NEED )
+	{
+		madvise(mapped, size, MADV_WILLNEED);
+	}
+	else
+	{
+#if !defined(MAP_POPULATE)
+		madvise(mapped, size, MADV_WILLNEED);
+		const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+		volatile unsigned char touch = 0;
+		for(size_t i=0; i<size; i+=pageSize)
+			touch ^= ((const unsigned char*)mapped)[i];
+#endif
+	}
+
+	return mapped;
+}
+
+inline void UnmapFile(void* mapped, size_t size)
+{
+	if ( mapped )
+		munmap(mapped, size);
+}
+
+#endif
+
+}
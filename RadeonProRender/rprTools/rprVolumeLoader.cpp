@@ -0,0 +1,536 @@
+/*****************************************************************************\
+*
+*  Module Name    rprVolumeLoader.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#include "rprVolumeLoader.h"
+#include "rprToolsCommon.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+using rprtools::SecondsSince;
+using rprtools::ParallelFor;
+using rprtools::ReadFile;
+#if !defined(_WIN32)
+using rprtools::MapFile;
+using rprtools::UnmapFile;
+#endif
+
+
+// one file: its bytes, mapped in memory or read into a buffer, and the indices of its voxels.
+struct RPRVolumeLoader::Frame
+{
+	~Frame()
+	{
+#if !defined(_WIN32)
+		UnmapFile(m_mapped, m_size);
+#endif
+	}
+
+	const unsigned char* Data() const { return m_mapped ? (const unsigned char*)m_mapped : m_buffer.data(); }
+
+	std::string m_fileName;
+	rpr_status m_status = RPR_SUCCESS;
+	size_t m_size = 0;
+	void* m_mapped = nullptr;
+	std::vector<unsigned char> m_buffer;
+
+	unsigned m_sizeX = 0;
+	unsigned m_sizeY = 0;
+	unsigned m_sizeZ = 0;
+	size_t m_activeVoxels = 0;
+	std::vector<GridDesc> m_grids;
+	std::vector<size_t> m_valuesOffsets;
+	std::vector<char> m_indices;
+
+	double m_ioSeconds = 0.0;
+	double m_indexSeconds = 0.0;
+};
+
+
+namespace
+{
+
+const char MAGIC[8] = { 'R', 'P', 'R', 'V', 'O', 'L', '1', 0 };
+const size_t HEADER_BYTES = 64;
+const size_t LEAF_BYTES = 80;
+const size_t GRID_BYTES = 48;
+const size_t GRID_NAME_BYTES = 32;
+
+// leaves validated or expanded by a task
+const size_t LEAF_BATCH = 256;
+
+template<typename T>
+T Load(const unsigned char* data)
+{
+	T value;
+	memcpy(&value, data, sizeof(T));
+	return value;
+}
+
+template<typename T>
+void Append(std::vector<unsigned char>& data, T value)
+{
+	const unsigned char* bytes = (const unsigned char*)&value;
+	data.insert(data.end(), bytes, bytes + sizeof(T));
+}
+
+unsigned CountTrailingZeros(uint64_t value)
+{
+#if defined(_MSC_VER)
+	unsigned long index = 0;
+	_BitScanForward64(&index, value);
+	return (unsigned)index;
+#else
+	return (unsigned)__builtin_ctzll(value);
+#endif
+}
+
+unsigned CountBits(uint64_t value)
+{
+#if defined(_MSC_VER)
+	return (unsigned)__popcnt64(value);
+#else
+	return (unsigned)__builtin_popcountll(value);
+#endif
+}
+
+}
+
+
+const unsigned RPRVolumeLoader::LEAF_SIZE;
+const unsigned RPRVolumeLoader::LEAF_VOXELS;
+
+rpr_status RPRVolumeLoader::WriteFile(const std::string& fileName, unsigned sizeX, unsigned sizeY, unsigned sizeZ, const std::vector<GridDesc>& grids, const LeafFunction& function)
+{
+	if ( sizeX == 0 || sizeY == 0 || sizeZ == 0 || grids.empty() || !function )
+		return RPR_ERROR_INVALID_PARAMETER;
+	for(const GridDesc& grid : grids)
+	{
+		if ( grid.name.size() >= GRID_NAME_BYTES )
+			return RPR_ERROR_INVALID_PARAMETER;
+	}
+
+	const size_t numGrids = grids.size();
+	std::vector<unsigned char> leaves;
+	std::vector<std::vector<float>> values(numGrids);
+	std::vector<float> leafValues(numGrids * LEAF_VOXELS);
+	std::vector<float*> leafPointers(numGrids);
+	for(size_t g=0; g<numGrids; g++)
+		leafPointers[g] = &leafValues[g * LEAF_VOXELS];
+
+	uint64_t numLeaves = 0;
+	uint64_t activeVoxels = 0;
+	for(unsigned z0=0; z0<sizeZ; z0+=LEAF_SIZE)
+	{
+		for(unsigned y0=0; y0<sizeY; y0+=LEAF_SIZE)
+		{
+			for(unsigned x0=0; x0<sizeX; x0+=LEAF_SIZE)
+			{
+				for(size_t g=0; g<numGrids; g++)
+					std::fill(leafPointers[g], leafPointers[g] + LEAF_VOXELS, grids[g].background);
+				function(x0, y0, z0, leafPointers.data());
+
+				const unsigned countX = std::min(LEAF_SIZE, sizeX - x0);
+				const unsigned countY = std::min(LEAF_SIZE, sizeY - y0);
+				const unsigned countZ = std::min(LEAF_SIZE, sizeZ - z0);
+
+				uint64_t mask[LEAF_SIZE] = {};
+				uint32_t activeCount = 0;
+				for(unsigned z=0; z<countZ; z++)
+				{
+					for(unsigned y=0; y<countY; y++)
+					{
+						for(unsigned x=0; x<countX; x++)
+						{
+							const unsigned voxel = x + LEAF_SIZE * (y + LEAF_SIZE * z);
+							bool active = false;
+							for(size_t g=0; g<numGrids && !active; g++)
+								active = leafPointers[g][voxel] != grids[g].background;
+							if ( !active )
+								continue;
+
+							mask[z] |= uint64_t(1) << (x + LEAF_SIZE * y);
+							activeCount++;
+							for(size_t g=0; g<numGrids; g++)
+								values[g].push_back(leafPointers[g][voxel]);
+						}
+					}
+				}
+
+				if ( activeCount == 0 )
+					continue;
+
+				Append<uint32_t>(leaves, x0);
+				Append<uint32_t>(leaves, y0);
+				Append<uint32_t>(leaves, z0);
+				Append<uint32_t>(leaves, activeCount);
+				for(unsigned z=0; z<LEAF_SIZE; z++)
+					Append<uint64_t>(leaves, mask[z]);
+				numLeaves++;
+				activeVoxels += activeCount;
+			}
+		}
+	}
+
+	// header, grid descriptions, leaves, values of each grid
+	const uint64_t gridsOffset = HEADER_BYTES;
+	const uint64_t leavesOffset = gridsOffset + numGrids * GRID_BYTES;
+	const uint64_t valuesOffset = leavesOffset + leaves.size();
+
+	std::vector<unsigned char> header;
+	header.insert(header.end(), MAGIC, MAGIC + sizeof(MAGIC));
+	Append<uint32_t>(header, sizeX);
+	Append<uint32_t>(header, sizeY);
+	Append<uint32_t>(header, sizeZ);
+	Append<uint32_t>(header, (uint32_t)numGrids);
+	Append<uint64_t>(header, numLeaves);
+	Append<uint64_t>(header, activeVoxels);
+	Append<uint64_t>(header, leavesOffset);
+	Append<uint64_t>(header, gridsOffset);
+	Append<uint64_t>(header, 0);
+
+	for(size_t g=0; g<numGrids; g++)
+	{
+		char name[GRID_NAME_BYTES] = {};
+		memcpy(name, grids[g].name.c_str(), grids[g].name.size());
+		header.insert(header.end(), name, name + GRID_NAME_BYTES);
+		Append<uint64_t>(header, valuesOffset + g * activeVoxels * sizeof(float));
+		Append<float>(header, grids[g].background);
+		Append<uint32_t>(header, 0);
+	}
+
+	std::ofstream file(fileName, std::ios::binary);
+	if ( !file )
+		return RPR_ERROR_IO_ERROR;
+	file.write((const char*)header.data(), header.size());
+	file.write((const char*)leaves.data(), leaves.size());
+	for(size_t g=0; g<numGrids; g++)
+		file.write((const char*)values[g].data(), values[g].size() * sizeof(float));
+	file.close();
+
+	return file ? RPR_SUCCESS : RPR_ERROR_IO_ERROR;
+}
+
+RPRVolumeLoader::RPRVolumeLoader(const std::vector<std::string>& files, const Settings& settings)
+	: m_files(files)
+	, m_settings(settings)
+{
+	if ( m_settings.framesAhead == 0 )
+		m_settings.framesAhead = 1;
+
+	m_prefetchThread = std::thread(&RPRVolumeLoader::PrefetchThread, this);
+}
+
+RPRVolumeLoader::RPRVolumeLoader(const std::vector<std::string>& files)
+	: RPRVolumeLoader(files, Settings())
+{
+}
+
+RPRVolumeLoader::~RPRVolumeLoader()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_condition.notify_all();
+	if ( m_prefetchThread.joinable() )
+		m_prefetchThread.join();
+}
+
+bool RPRVolumeLoader::HasNext() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_nextToLoad < m_files.size();
+}
+
+std::string RPRVolumeLoader::NextFileName() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_nextToLoad < m_files.size() ? m_files[m_nextToLoad] : std::string();
+}
+
+RPRVolumeLoader::Stats RPRVolumeLoader::GetStats() const
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_stats;
+}
+
+rpr_status RPRVolumeLoader::PrepareFrame(Frame& frame) const
+{
+	size_t indexBytes = 0;
+	if ( m_settings.topology == RPR_GRID_INDICES_TOPOLOGY_I_U64 )
+		indexBytes = sizeof(uint64_t);
+	else if ( m_settings.topology == RPR_GRID_INDICES_TOPOLOGY_XYZ_U32 )
+		indexBytes = 3 * sizeof(uint32_t);
+	else
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	////// map or read the file //////
+
+	auto start = std::chrono::steady_clock::now();
+#if !defined(_WIN32)
+	// the leaves are read in parallel, the values once by rprContextCreateGrid: both benefit from read-ahead
+	if ( m_settings.useMmap )
+		frame.m_mapped = MapFile(frame.m_fileName, frame.m_size, rprtools::MAP_ACCESS_WILL_NEED);
+	if ( !frame.m_mapped )
+#endif
+	{
+		if ( !ReadFile(frame.m_fileName, frame.m_buffer) )
+		{
+			frame.m_size = 0;
+			return RPR_ERROR_IO_ERROR;
+		}
+		frame.m_size = frame.m_buffer.size();
+	}
+
+	const unsigned char* data = frame.Data();
+	const size_t size = frame.m_size;
+	if ( size < HEADER_BYTES || memcmp(data, MAGIC, sizeof(MAGIC)) != 0 )
+		return RPR_ERROR_IO_ERROR;
+
+	frame.m_sizeX = Load<uint32_t>(data + 8);
+	frame.m_sizeY = Load<uint32_t>(data + 12);
+	frame.m_sizeZ = Load<uint32_t>(data + 16);
+	const uint32_t numGrids = Load<uint32_t>(data + 20);
+	const uint64_t numLeaves = Load<uint64_t>(data + 24);
+	const uint64_t activeVoxels = Load<uint64_t>(data + 32);
+	const uint64_t leavesOffset = Load<uint64_t>(data + 40);
+	const uint64_t gridsOffset = Load<uint64_t>(data + 48);
+
+	// the tables must be inside the file; written as divisions, so that the sizes can't overflow
+	if ( frame.m_sizeX == 0 || frame.m_sizeY == 0 || frame.m_sizeZ == 0 || numGrids == 0 )
+		return RPR_ERROR_IO_ERROR;
+	if ( leavesOffset > size || numLeaves > (size - leavesOffset) / LEAF_BYTES )
+		return RPR_ERROR_IO_ERROR;
+	if ( gridsOffset > size || numGrids > (size - gridsOffset) / GRID_BYTES )
+		return RPR_ERROR_IO_ERROR;
+	if ( activeVoxels > numLeaves * LEAF_VOXELS )
+		return RPR_ERROR_IO_ERROR;
+
+	frame.m_activeVoxels = (size_t)activeVoxels;
+	frame.m_grids.resize(numGrids);
+	frame.m_valuesOffsets.resize(numGrids);
+	for(uint32_t g=0; g<numGrids; g++)
+	{
+		const unsigned char* grid = data + gridsOffset + g * GRID_BYTES;
+		const char* name = (const char*)grid;
+		const uint64_t valuesOffset = Load<uint64_t>(grid + GRID_NAME_BYTES);
+		if ( std::find(name, name + GRID_NAME_BYTES, 0) == name + GRID_NAME_BYTES )
+			return RPR_ERROR_IO_ERROR;
+		if ( valuesOffset % sizeof(float) != 0 || valuesOffset > size || activeVoxels > (size - valuesOffset) / sizeof(float) )
+			return RPR_ERROR_IO_ERROR;
+
+		frame.m_grids[g].name = name;
+		frame.m_grids[g].background = Load<float>(grid + GRID_NAME_BYTES + 8);
+		frame.m_valuesOffsets[g] = (size_t)valuesOffset;
+	}
+	frame.m_ioSeconds = SecondsSince(start);
+
+	////// expand the leaves into indices //////
+
+	start = std::chrono::steady_clock::now();
+	const unsigned char* leaves = data + leavesOffset;
+	const size_t numBatches = (size_t)((numLeaves + LEAF_BATCH - 1) / LEAF_BATCH);
+	const unsigned hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+	const unsigned numThreads = m_settings.numThreads ? m_settings.numThreads : hardwareThreads;
+	const unsigned sizeX = frame.m_sizeX;
+	const unsigned sizeY = frame.m_sizeY;
+	const unsigned sizeZ = frame.m_sizeZ;
+
+	// first pass: validate the leaves and count the voxels of each batch
+	std::vector<size_t> batchOffsets(numBatches + 1, 0);
+	std::atomic<bool> valid(true);
+	ParallelFor(numBatches, numThreads, [&](size_t batch)
+	{
+		const size_t leafEnd = std::min<size_t>((size_t)numLeaves, (batch + 1) * LEAF_BATCH);
+		size_t count = 0;
+		for(size_t l=batch*LEAF_BATCH; l<leafEnd; l++)
+		{
+			const unsigned char* leaf = leaves + l * LEAF_BYTES;
+			const uint32_t x0 = Load<uint32_t>(leaf);
+			const uint32_t y0 = Load<uint32_t>(leaf + 4);
+			const uint32_t z0 = Load<uint32_t>(leaf + 8);
+			const uint32_t activeCount = Load<uint32_t>(leaf + 12);
+			if ( x0 % LEAF_SIZE != 0 || y0 % LEAF_SIZE != 0 || z0 % LEAF_SIZE != 0 || x0 >= sizeX || y0 >= sizeY || z0 >= sizeZ )
+			{
+				valid = false;
+				return;
+			}
+
+			// the voxels outside of the grid must be inactive
+			const unsigned countX = std::min(LEAF_SIZE, sizeX - x0);
+			const unsigned countY = std::min(LEAF_SIZE, sizeY - y0);
+			const unsigned countZ = std::min(LEAF_SIZE, sizeZ - z0);
+			const uint64_t rowMask = countX == LEAF_SIZE ? 0xFF : (uint64_t(1) << countX) - 1;
+			uint64_t wordMask = 0;
+			for(unsigned y=0; y<countY; y++)
+				wordMask |= rowMask << (LEAF_SIZE * y);
+
+			unsigned bits = 0;
+			for(unsigned z=0; z<LEAF_SIZE; z++)
+			{
+				const uint64_t word = Load<uint64_t>(leaf + 16 + z * 8);
+				if ( ( z < countZ ? word & ~wordMask : word ) != 0 )
+				{
+					valid = false;
+					return;
+				}
+				bits += CountBits(word);
+			}
+			if ( bits != activeCount )
+			{
+				valid = false;
+				return;
+			}
+			count += bits;
+		}
+		batchOffsets[batch + 1] = count;
+	});
+	for(size_t b=0; b<numBatches; b++)
+		batchOffsets[b + 1] += batchOffsets[b];
+	if ( !valid || batchOffsets[numBatches] != activeVoxels )
+		return RPR_ERROR_IO_ERROR;
+
+	// second pass: write the indices of each batch at its offset
+	frame.m_indices.resize((size_t)activeVoxels * indexBytes);
+	const uint64_t strideY = sizeX;
+	const uint64_t strideZ = (uint64_t)sizeX * sizeY;
+	// I_U64: x fastest, then y, then z ( see Settings::topology )
+	const bool linear = m_settings.topology == RPR_GRID_INDICES_TOPOLOGY_I_U64;
+	char* indices = frame.m_indices.data();
+	ParallelFor(numBatches, numThreads, [&](size_t batch)
+	{
+		const size_t leafEnd = std::min<size_t>((size_t)numLeaves, (batch + 1) * LEAF_BATCH);
+		char* index = indices + batchOffsets[batch] * indexBytes;
+		for(size_t l=batch*LEAF_BATCH; l<leafEnd; l++)
+		{
+			const unsigned char* leaf = leaves + l * LEAF_BYTES;
+			const uint32_t x0 = Load<uint32_t>(leaf);
+			const uint32_t y0 = Load<uint32_t>(leaf + 4);
+			const uint32_t z0 = Load<uint32_t>(leaf + 8);
+			for(unsigned z=0; z<LEAF_SIZE; z++)
+			{
+				for(uint64_t word=Load<uint64_t>(leaf + 16 + z * 8); word; word&=word-1)
+				{
+					const unsigned bit = CountTrailingZeros(word);
+					const uint32_t x = x0 + bit % LEAF_SIZE;
+					const uint32_t y = y0 + bit / LEAF_SIZE;
+					if ( linear )
+					{
+						const uint64_t linearIndex = x + y * strideY + (z0 + z) * strideZ;
+						memcpy(index, &linearIndex, sizeof(linearIndex));
+					}
+					else
+					{
+						const uint32_t xyz[3] = { x, y, z0 + z };
+						memcpy(index, xyz, sizeof(xyz));
+					}
+					index += indexBytes;
+				}
+			}
+		}
+	});
+	frame.m_indexSeconds = SecondsSince(start);
+
+	return RPR_SUCCESS;
+}
+
+void RPRVolumeLoader::PrefetchThread()
+{
+	for(size_t i=0; i<m_files.size(); i++)
+	{
+		// wait for a slot
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [&]() { return m_stop || m_ready.size() < m_settings.framesAhead; });
+			if ( m_stop )
+				return;
+		}
+
+		std::unique_ptr<Frame> frame(new Frame());
+		frame->m_fileName = m_files[i];
+		frame->m_status = PrepareFrame(*frame);
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stats.bytesRead += frame->m_size;
+			m_stats.ioSeconds += frame->m_ioSeconds;
+			m_stats.indexSeconds += frame->m_indexSeconds;
+			m_ready.push_back(std::move(frame));
+		}
+		m_condition.notify_all();
+	}
+}
+
+rpr_status RPRVolumeLoader::LoadNext(rpr_context context, std::vector<rpr_grid>& grids, std::vector<GridDesc>* descs)
+{
+	grids.clear();
+	if ( descs )
+		descs->clear();
+
+	std::unique_ptr<Frame> frame;
+	{
+		const auto start = std::chrono::steady_clock::now();
+		std::unique_lock<std::mutex> lock(m_mutex);
+		if ( m_nextToLoad >= m_files.size() )
+			return RPR_ERROR_INVALID_PARAMETER;
+		m_condition.wait(lock, [&]() { return !m_ready.empty(); });
+		frame = std::move(m_ready.front());
+		m_ready.pop_front();
+		m_nextToLoad++;
+		m_stats.waitSeconds += SecondsSince(start);
+	}
+	// the prefetch thread can start the next frame
+	m_condition.notify_all();
+
+	rpr_status status = frame->m_status;
+	const auto start = std::chrono::steady_clock::now();
+	for(size_t g=0; g<frame->m_grids.size() && status == RPR_SUCCESS; g++)
+	{
+		rpr_grid grid = nullptr;
+		status = rprContextCreateGrid(context, &grid,
+			frame->m_sizeX, frame->m_sizeY, frame->m_sizeZ,
+			frame->m_indices.data(), frame->m_activeVoxels, m_settings.topology,
+			frame->Data() + frame->m_valuesOffsets[g], frame->m_activeVoxels * sizeof(float), 0);
+		if ( status == RPR_SUCCESS )
+			grids.push_back(grid);
+	}
+	const double createSeconds = SecondsSince(start);
+
+	if ( status != RPR_SUCCESS )
+	{
+		for(rpr_grid grid : grids)
+			rprObjectDelete(grid);
+		grids.clear();
+	}
+	else if ( descs )
+		*descs = frame->m_grids;
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stats.createSeconds += createSeconds;
+		if ( status == RPR_SUCCESS )
+		{
+			m_stats.framesLoaded++;
+			m_stats.activeVoxels += frame->m_activeVoxels;
+		}
+	}
+
+	return status;
+}
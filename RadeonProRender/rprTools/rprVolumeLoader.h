@@ -0,0 +1,159 @@
+/*****************************************************************************\
+*
+*  Module Name    rprVolumeLoader.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Radeon ProRender Interface header
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <RadeonProRender.h>
+
+// Loads a sequence of sparse volume files into rpr_grid, while the next frames are prepared by a prefetch thread.
+//
+// The files use the flat layout below, close to the leaves of NanoVDB: the leaves of 8x8x8 voxels share one topology
+// for all the grids of the file ( density, temperature... ), and the values of each grid are stored leaf after leaf.
+// The prefetch thread memory-maps the file ( or reads it ), validates it, and expands the leaves into the indices of
+// rprContextCreateGrid with several threads. LoadNext then creates the grids with the values taken directly from the mapped
+// file: the volume is never decoded into a second copy in memory.
+//
+// File format, little endian, offsets in bytes from the start of the file:
+//   header, 64 bytes:
+//     char     magic[8]        "RPRVOL1" and a zero
+//     uint32   sizeX, sizeY, sizeZ  size of the grids in voxels
+//     uint32   numGrids
+//     uint64   numLeaves
+//     uint64   activeVoxels
+//     uint64   leavesOffset    numLeaves leaves
+//     uint64   gridsOffset     numGrids grid descriptions
+//     uint64   reserved        0
+//   leaf, 80 bytes:
+//     uint32   x, y, z         origin of the leaf, multiple of 8
+//     uint32   activeCount     number of bits set in mask
+//     uint64   mask[8]         active voxels: one word per z, bit x + 8 * y
+//   grid description, 48 bytes:
+//     char     name[32]        zero terminated
+//     uint64   valuesOffset    activeVoxels floats, multiple of 4: the values of the active voxels, leaf after leaf, in the order of the mask bits
+//     float    background      value of the inactive voxels
+//     uint32   reserved        0
+//
+// Usage:
+//   RPRVolumeLoader loader(files);
+//   while ( loader.HasNext() )
+//   {
+//       std::vector<rpr_grid> grids;
+//       loader.LoadNext(context, grids); // one rpr_grid per grid of the file
+//       ... rprMaterialNodeSetInputGridDataByKey, render, rprObjectDelete the grids ...
+//   }
+//
+// LoadNext must be called from one thread at a time.
+class RPRVolumeLoader
+{
+public:
+
+	static const unsigned LEAF_SIZE = 8;
+	static const unsigned LEAF_VOXELS = LEAF_SIZE * LEAF_SIZE * LEAF_SIZE;
+
+	struct Settings
+	{
+		/// Topology of the indices given to rprContextCreateGrid: RPR_GRID_INDICES_TOPOLOGY_XYZ_U32 ( 12 bytes per voxel ) or RPR_GRID_INDICES_TOPOLOGY_I_U64 ( 8 bytes per voxel ).
+		/// The default saves no memory: the indices take as much as with a per-voxel loop, only the values are not copied.
+		/// I_U64 assumes index = x + y * sizeX + z * sizeX * sizeY, an order the API does not document and that has not been
+		/// checked with the renderer: check it before using it.
+		rpr_grid_indices_topology topology = RPR_GRID_INDICES_TOPOLOGY_XYZ_U32;
+
+		/// Frames prepared ahead of the next LoadNext.
+		size_t framesAhead = 1;
+
+		/// Threads expanding the leaves of a frame. 0: one per hardware thread.
+		unsigned numThreads = 0;
+
+		/// Memory-map the files ( Linux/macOS ). If false, or on Windows, the files are read into memory.
+		bool useMmap = true;
+	};
+
+	struct GridDesc
+	{
+		std::string name;
+		float background = 0.0f;
+	};
+
+	struct Stats
+	{
+		size_t framesLoaded = 0;
+		size_t bytesRead = 0;
+		size_t activeVoxels = 0;
+
+		/// time of the prefetch thread to map/read and validate the files, and to expand the leaves
+		double ioSeconds = 0.0;
+		double indexSeconds = 0.0;
+
+		/// time spent by LoadNext waiting for the prefetch thread. Close to 0 when the loading is fully overlapped.
+		double waitSeconds = 0.0;
+
+		/// time spent inside rprContextCreateGrid
+		double createSeconds = 0.0;
+	};
+
+	/// Fill the values of the grids for the leaf at voxel ( x0, y0, z0 ), x fastest: values[grid][x + 8 * ( y + 8 * z )].
+	/// values is filled with the backgrounds before the call. A voxel is active if one of the grids is not its background.
+	typedef std::function<void(unsigned x0, unsigned y0, unsigned z0, float* const* values)> LeafFunction;
+
+	/// Write a file of the format above. Returns RPR_ERROR_IO_ERROR if the file can't be written.
+	static rpr_status WriteFile(const std::string& fileName, unsigned sizeX, unsigned sizeY, unsigned sizeZ, const std::vector<GridDesc>& grids, const LeafFunction& function);
+
+	/// The prefetch thread starts preparing the first frames immediately.
+	RPRVolumeLoader(const std::vector<std::string>& files, const Settings& settings);
+	explicit RPRVolumeLoader(const std::vector<std::string>& files);
+
+	/// Stops the prefetch thread and releases the frames not loaded.
+	~RPRVolumeLoader();
+
+	RPRVolumeLoader(const RPRVolumeLoader&) = delete;
+	RPRVolumeLoader& operator=(const RPRVolumeLoader&) = delete;
+
+	bool HasNext() const;
+
+	/// Name of the file loaded by the next call of LoadNext. Empty if HasNext() is false.
+	std::string NextFileName() const;
+
+	/// Create the grids of the next file, in the order of the file. descs receives their names and backgrounds, if not null.
+	/// Waits if the prefetch thread hasn't finished this file.
+	/// Returns RPR_ERROR_IO_ERROR if the file can't be read or is not valid, RPR_ERROR_INVALID_PARAMETER if there is no file left.
+	/// In both cases, the sequence moves to the next file.
+	rpr_status LoadNext(rpr_context context, std::vector<rpr_grid>& grids, std::vector<GridDesc>* descs = nullptr);
+
+	Stats GetStats() const;
+
+private:
+
+	struct Frame;
+
+	void PrefetchThread();
+	rpr_status PrepareFrame(Frame& frame) const;
+
+	std::vector<std::string> m_files;
+	Settings m_settings;
+
+	mutable std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::deque<std::unique_ptr<Frame>> m_ready; // frames prepared, in the order of m_files
+	size_t m_nextToLoad = 0;
+	bool m_stop = false;
+	Stats m_stats;
+
+	std::thread m_prefetchThread;
+};
@@ -0,0 +1,159 @@
+#
+# Generates the wrappers of the RPR interposer from RadeonProRender_v2.h :
+#   rprInterposer_generated.h   : number of functions
+#   rprInterposer_generated.cpp : one wrapper per function of the RPR C API
+#
+# usage:   python generate_interposer.py
+#
+# Each wrapper forwards the call to the next library exporting the function ( the real core library when the interposer is loaded with LD_PRELOAD )
+# and records its duration. The functions listed in BYTES also record the number of bytes they transfer.
+# If the call log is enabled ( RPR_INTERPOSER_CALL_LOG ), the wrapper also writes the call and its arguments ( see rprInterposer.h for the format ).
+#
+
+
+import os
+import re
+
+
+scriptDir = os.path.dirname(os.path.abspath(__file__))
+headerPath = os.path.join(scriptDir, '../RadeonProRender/inc/RadeonProRender_v2.h')
+outputHeaderPath = os.path.join(scriptDir, 'rprInterposer_generated.h')
+outputPath = os.path.join(scriptDir, 'rprInterposer_generated.cpp')
+
+
+reFunction = re.compile(r'^(?:\s|\*/)*extern RPR_API_ENTRY\s+(\w+)\s+(rpr\w+)\s*\((.*)\)\s*;\s*$')
+reHandle = re.compile(r'^typedef struct \w+ \{.*\} \* (rpr_\w+);')
+
+
+# number of bytes transferred by a call, as an expression of the parameters.
+BYTES = {
+	'rprContextCreateImage': 'RprInterposer_ImageBytes(format, image_desc)',
+	'rprContextCreateBuffer': 'buffer_desc ? (uint64_t)buffer_desc->nb_element * buffer_desc->element_channel_size * 4 : 0',
+	'rprContextCreateImageFromFileMemory': 'dataSizeByte',
+	'rprContextCreateMesh': '(uint64_t)num_vertices * vertex_stride + (uint64_t)num_normals * normal_stride + (uint64_t)num_texcoords * texcoord_stride',
+	'rprContextCreateMeshEx': '(uint64_t)num_vertices * vertex_stride + (uint64_t)num_normals * normal_stride',
+	'rprContextCreateMeshEx2': '(uint64_t)num_vertices * vertex_stride + (uint64_t)num_normals * normal_stride',
+	'rprContextCreateCurve': '(uint64_t)num_controlPoints * controlPointsStride + (uint64_t)num_indices * sizeof(rpr_uint)',
+	'rprContextCreateGrid': 'gridDataSizeByte',
+	'rprFrameBufferGetInfo': 'data ? size : 0',
+	'rprImageGetInfo': 'data ? size : 0',
+}
+
+
+# structures passed by value, logged as their fields separated by '/'
+STRUCTS = {
+	'rpr_image_format const': ( '%u/%u', [ 'num_components', 'type' ] ),
+	'rpr_framebuffer_format const': ( '%u/%u', [ 'num_components', 'type' ] ),
+}
+
+FLOATS = ( 'rpr_float', 'float', 'rpr_double', 'double' )
+
+# handle pointers that are arrays, not an output handle
+NOT_OUTPUT = ( 'framebufferList', )
+
+
+def ParameterName(param):
+	m = re.match(r'^.*?(\w+)$', param.strip())
+	return m.group(1) if m else ''
+
+
+def ParameterType(param):
+	m = re.match(r'^(.*?)\w+$', param.strip())
+	return m.group(1).strip() if m else ''
+
+
+# printf format and arguments of a parameter in the call log.
+# pointers are logged as addresses. An output handle is logged as the handle written by the call.
+def LogFormat(param, handles):
+	name = ParameterName(param)
+	type = ParameterType(param)
+	if type in STRUCTS:
+		format, fields = STRUCTS[type]
+		return ( format, [ '(unsigned)%s.%s' % (name, f) for f in fields ] )
+	if '*' in type:
+		base = type.replace('*', '').strip()
+		if base in handles and type.count('*') == 1 and name not in NOT_OUTPUT:
+			return ( '%p', [ '%s ? (const void*)*%s : nullptr' % (name, name) ] )
+		return ( '%p', [ '(const void*)%s' % name ] )
+	if type in handles:
+		return ( '%p', [ '(const void*)%s' % name ] )
+	if type in FLOATS:
+		return ( '%.9g', [ '(double)%s' % name ] )
+	return ( '%lld', [ '(long long)%s' % name ] )
+
+
+def main():
+	functions = []
+	handles = set()
+	with open(headerPath) as f:
+		for line in f:
+			m = reFunction.match(line)
+			if m:
+				functions.append( (m.group(1), m.group(2), m.group(3).strip()) )
+			m = reHandle.match(line)
+			if m:
+				handles.add(m.group(1))
+
+	out = []
+	out.append('#pragma once')
+	out.append('')
+	out.append('')
+	out.append('//')
+	out.append('//')
+	out.append('// FILE GENERATED BY generate_interposer.py - DO NOT MODIFY IT DIRECTLY.')
+	out.append('//')
+	out.append('//')
+	out.append('')
+	out.append('')
+	out.append('#define RPR_INTERPOSER_FUNCTION_COUNT %d' % len(functions))
+	with open(outputHeaderPath, 'w', newline='\n') as f:
+		f.write('\n'.join(out) + '\n')
+
+	out = []
+	out.append('#include "rprInterposer.h"')
+	out.append('')
+	out.append('')
+	out.append('//')
+	out.append('//')
+	out.append('// FILE GENERATED BY generate_interposer.py - DO NOT MODIFY IT DIRECTLY.')
+	out.append('//')
+	out.append('//')
+	out.append('')
+	out.append('')
+	out.append('const char* const g_rprInterposerFunctionNames[RPR_INTERPOSER_FUNCTION_COUNT] =')
+	out.append('{')
+	for retType, name, params in functions:
+		out.append('\t"%s",' % name)
+	out.append('};')
+	out.append('')
+
+	for id, (retType, name, params) in enumerate(functions):
+		args = []
+		logFormats = []
+		logArgs = []
+		if params not in ( '', 'void' ):
+			args = [ ParameterName(p) for p in params.split(',') ]
+			for p in params.split(','):
+				format, values = LogFormat(p, handles)
+				logFormats.append(format)
+				logArgs += values
+		out.append('RPR_INTERPOSER_EXPORT %s %s(%s)' % (retType, name, params))
+		out.append('{')
+		out.append('\tstatic const auto s_next = (decltype(&%s))RprInterposer_Resolve("%s");' % (name, name))
+		out.append('\tconst uint64_t start = RprInterposer_Now();')
+		out.append('\tconst %s ret = s_next(%s);' % (retType, ', '.join(args)))
+		out.append('\tconst uint64_t bytes = %s;' % BYTES.get(name, '0'))
+		out.append('\tRprInterposer_Record(%d, start, bytes);' % id)
+		out.append('\tif ( g_rprInterposerCallLogEnabled )')
+		out.append('\t\tRprInterposer_LogCall(%d, (long long)ret, bytes, "%s"%s);' % (id, '\\t'.join(logFormats), ''.join( ', ' + a for a in logArgs )))
+		out.append('\treturn ret;')
+		out.append('}')
+
+	with open(outputPath, 'w', newline='\n') as f:
+		f.write('\n'.join(out) + '\n')
+
+	print('%d functions generated in %s' % (len(functions), outputPath))
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,458 @@
+/*****************************************************************************\
+*
+*  Module Name    rprInterposer.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Latency histograms of the RPR API calls, loaded with LD_PRELOAD
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+#include "rprInterposer.h"
+
+#include <dlfcn.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdarg>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr int kSubBucketBits = 4;
+constexpr uint64_t kSubBucketCount = 1ull << kSubBucketBits;
+constexpr int kBucketCount = (64 - kSubBucketBits + 1) * (int)kSubBucketCount;
+
+// values < 16 have their own bucket, then 16 buckets per power of 2.
+int BucketIndex(uint64_t ticks)
+{
+	if ( ticks < kSubBucketCount )
+		return (int)ticks;
+	const int exponent = 63 - __builtin_clzll(ticks);
+	const int shift = exponent - kSubBucketBits;
+	return (shift + 1) * (int)kSubBucketCount + (int)((ticks >> shift) & (kSubBucketCount - 1));
+}
+
+uint64_t BucketLowerBound(int index)
+{
+	if ( index < (int)kSubBucketCount )
+		return (uint64_t)index;
+	const int shift = index / (int)kSubBucketCount - 1;
+	return (kSubBucketCount + (uint64_t)(index % (int)kSubBucketCount)) << shift;
+}
+
+uint64_t BucketWidth(int index)
+{
+	if ( index < (int)kSubBucketCount )
+		return 1;
+	return 1ull << (index / (int)kSubBucketCount - 1);
+}
+
+// counters are written by their thread only: a relaxed load+store is enough, no atomic read-modify-write.
+// the atomic type is only needed so that the dump can read them while they are written.
+inline void Add(std::atomic<uint64_t>& counter, uint64_t value)
+{
+	counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+struct FunctionHistogram
+{
+	FunctionHistogram()
+	{
+		for(auto& bucket : buckets)
+			bucket.store(0, std::memory_order_relaxed);
+	}
+
+	std::atomic<uint64_t> calls{0};
+	std::atomic<uint64_t> sumTicks{0};
+	std::atomic<uint64_t> maxTicks{0};
+	std::atomic<uint64_t> bytes{0};
+	std::atomic<uint64_t> buckets[kBucketCount];
+};
+
+// histograms of one thread. A histogram is allocated at the first call of its function by this thread.
+struct ThreadHistograms
+{
+	ThreadHistograms()
+	{
+		for(auto& function : functions)
+			function.store(nullptr, std::memory_order_relaxed);
+	}
+
+	std::atomic<FunctionHistogram*> functions[RPR_INTERPOSER_FUNCTION_COUNT];
+};
+
+// statistics of one function, merged from all the threads.
+struct FunctionStats
+{
+	uint64_t calls = 0;
+	uint64_t sumTicks = 0;
+	uint64_t maxTicks = 0;
+	uint64_t bytes = 0;
+	std::vector<uint64_t> buckets;
+
+	// value in ticks at this quantile ( middle of the bucket )
+	double Quantile(double q) const
+	{
+		const uint64_t rank = (uint64_t)(q * (double)calls);
+		uint64_t cumulated = 0;
+		for(int i=0; i<kBucketCount; i++)
+		{
+			cumulated += buckets[i];
+			if ( cumulated > rank )
+				return (double)BucketLowerBound(i) + ( BucketWidth(i) - 1 ) * 0.5;
+		}
+		return (double)maxTicks;
+	}
+};
+
+// list of the histograms of all the threads. The histograms of the finished threads are kept.
+// Never destroyed: the RPR calls done during the exit of the process must still be recorded.
+class Registry
+{
+public:
+	ThreadHistograms* RegisterThread()
+	{
+		ThreadHistograms* thread = new ThreadHistograms();
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_threads.push_back(thread);
+		return thread;
+	}
+
+	std::vector<FunctionStats> Merge()
+	{
+		std::vector<ThreadHistograms*> threads;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			threads = m_threads;
+		}
+
+		std::vector<FunctionStats> stats(RPR_INTERPOSER_FUNCTION_COUNT);
+		for(int f=0; f<RPR_INTERPOSER_FUNCTION_COUNT; f++)
+		{
+			FunctionStats& s = stats[f];
+			s.buckets.resize(kBucketCount, 0);
+			for(ThreadHistograms* thread : threads)
+			{
+				const FunctionHistogram* h = thread->functions[f].load(std::memory_order_acquire);
+				if ( !h )
+					continue;
+				s.calls += h->calls.load(std::memory_order_relaxed);
+				s.sumTicks += h->sumTicks.load(std::memory_order_relaxed);
+				s.bytes += h->bytes.load(std::memory_order_relaxed);
+				const uint64_t maxTicks = h->maxTicks.load(std::memory_order_relaxed);
+				if ( maxTicks > s.maxTicks )
+					s.maxTicks = maxTicks;
+				for(int i=0; i<kBucketCount; i++)
+					s.buckets[i] += h->buckets[i].load(std::memory_order_relaxed);
+			}
+		}
+		return stats;
+	}
+
+private:
+	std::mutex m_mutex;
+	std::vector<ThreadHistograms*> m_threads;
+};
+
+Registry& GetRegistry()
+{
+	static Registry* s_registry = new Registry();
+	return *s_registry;
+}
+
+// initial-exec: no __tls_get_addr call, valid because the interposer is loaded at the start of the process with LD_PRELOAD.
+thread_local ThreadHistograms* t_histograms __attribute__((tls_model("initial-exec"))) = nullptr;
+
+// conversion ticks -> nanoseconds, measured between the load of the interposer and the dump.
+class TickClock
+{
+public:
+	TickClock()
+		: m_ticks0(RprInterposer_Now())
+		, m_time0(std::chrono::steady_clock::now())
+	{
+	}
+
+	double NsPerTick() const
+	{
+#if defined(__x86_64__) || defined(_M_X64)
+		// a too short interval would give an imprecise ratio.
+		while ( std::chrono::steady_clock::now() - m_time0 < std::chrono::milliseconds(10) )
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		const double elapsedNs = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_time0).count();
+		const double elapsedTicks = (double)(RprInterposer_Now() - m_ticks0);
+		return elapsedTicks > 0.0 ? elapsedNs / elapsedTicks : 1.0;
+#else
+		return 1.0;
+#endif
+	}
+
+	double ElapsedSeconds() const
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_time0).count();
+	}
+
+private:
+	uint64_t m_ticks0;
+	std::chrono::steady_clock::time_point m_time0;
+};
+
+void WriteJson(FILE* file, const std::vector<FunctionStats>& stats, double nsPerTick, double elapsedSeconds)
+{
+	fprintf(file, "{\n\t\"pid\": %d,\n\t\"elapsed_s\": %.3f,\n\t\"functions\": {", (int)getpid(), elapsedSeconds);
+	bool first = true;
+	for(int f=0; f<RPR_INTERPOSER_FUNCTION_COUNT; f++)
+	{
+		const FunctionStats& s = stats[f];
+		if ( s.calls == 0 )
+			continue;
+		fprintf(file, "%s\n\t\t\"%s\": { \"calls\": %llu, \"bytes\": %llu, \"total_ns\": %.0f, \"mean_ns\": %.1f, \"p50_ns\": %.1f, \"p90_ns\": %.1f, \"p99_ns\": %.1f, \"p999_ns\": %.1f, \"max_ns\": %.1f }",
+			first ? "" : ",",
+			g_rprInterposerFunctionNames[f],
+			(unsigned long long)s.calls,
+			(unsigned long long)s.bytes,
+			s.sumTicks * nsPerTick,
+			s.sumTicks * nsPerTick / s.calls,
+			s.Quantile(0.5) * nsPerTick,
+			s.Quantile(0.9) * nsPerTick,
+			s.Quantile(0.99) * nsPerTick,
+			s.Quantile(0.999) * nsPerTick,
+			s.maxTicks * nsPerTick);
+		first = false;
+	}
+	fprintf(file, "\n\t}\n}\n");
+}
+
+void WritePrometheus(FILE* file, const std::vector<FunctionStats>& stats, double nsPerTick)
+{
+	static const double quantiles[] = { 0.5, 0.9, 0.99, 0.999 };
+
+	fprintf(file, "# HELP rpr_call_duration_seconds Duration of the RPR API calls.\n");
+	fprintf(file, "# TYPE rpr_call_duration_seconds summary\n");
+	for(int f=0; f<RPR_INTERPOSER_FUNCTION_COUNT; f++)
+	{
+		const FunctionStats& s = stats[f];
+		if ( s.calls == 0 )
+			continue;
+		for(double q : quantiles)
+			fprintf(file, "rpr_call_duration_seconds{function=\"%s\",quantile=\"%g\"} %.9g\n", g_rprInterposerFunctionNames[f], q, s.Quantile(q) * nsPerTick * 1.0e-9);
+		fprintf(file, "rpr_call_duration_seconds_sum{function=\"%s\"} %.9g\n", g_rprInterposerFunctionNames[f], s.sumTicks * nsPerTick * 1.0e-9);
+		fprintf(file, "rpr_call_duration_seconds_count{function=\"%s\"} %llu\n", g_rprInterposerFunctionNames[f], (unsigned long long)s.calls);
+	}
+
+	fprintf(file, "# HELP rpr_call_bytes_total Bytes transferred by the RPR API calls.\n");
+	fprintf(file, "# TYPE rpr_call_bytes_total counter\n");
+	for(int f=0; f<RPR_INTERPOSER_FUNCTION_COUNT; f++)
+	{
+		if ( stats[f].bytes != 0 )
+			fprintf(file, "rpr_call_bytes_total{function=\"%s\"} %llu\n", g_rprInterposerFunctionNames[f], (unsigned long long)stats[f].bytes);
+	}
+}
+
+// write the output file at exit, and periodically if RPR_INTERPOSER_PERIOD_MS is set.
+class Output
+{
+public:
+	Output()
+	{
+		const char* path = std::getenv("RPR_INTERPOSER_OUTPUT");
+		m_path = path && path[0] ? path : "rpr_interposer.json";
+
+		const char* format = std::getenv("RPR_INTERPOSER_FORMAT");
+		if ( format && format[0] )
+			m_prometheus = std::strcmp(format, "prometheus") == 0;
+		else
+			m_prometheus = m_path.size() >= 5 && m_path.compare(m_path.size() - 5, 5, ".prom") == 0;
+
+		const char* period = std::getenv("RPR_INTERPOSER_PERIOD_MS");
+		const int periodMs = period ? std::atoi(period) : 0;
+		if ( periodMs > 0 )
+		{
+			m_thread = std::thread([this, periodMs]()
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				while ( !m_stop )
+				{
+					m_condition.wait_for(lock, std::chrono::milliseconds(periodMs));
+					if ( !m_stop )
+						Write();
+				}
+			});
+		}
+	}
+
+	~Output()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stop = true;
+		}
+		m_condition.notify_all();
+		if ( m_thread.joinable() )
+			m_thread.join();
+		Write();
+	}
+
+	// the file is written entirely in a temporary file, then renamed: a reader never sees a partial file.
+	void Write()
+	{
+		std::lock_guard<std::mutex> lock(m_writeMutex);
+		const std::vector<FunctionStats> stats = GetRegistry().Merge();
+		const double nsPerTick = m_clock.NsPerTick();
+
+		const std::string tmpPath = m_path + ".tmp";
+		FILE* file = fopen(tmpPath.c_str(), "w");
+		if ( !file )
+		{
+			fprintf(stderr, "RPR interposer: can't write %s\n", tmpPath.c_str());
+			return;
+		}
+		if ( m_prometheus )
+			WritePrometheus(file, stats, nsPerTick);
+		else
+			WriteJson(file, stats, nsPerTick, m_clock.ElapsedSeconds());
+		fclose(file);
+		std::rename(tmpPath.c_str(), m_path.c_str());
+	}
+
+private:
+	TickClock m_clock;
+	std::string m_path;
+	bool m_prometheus = false;
+
+	std::thread m_thread;
+	std::mutex m_mutex;
+	std::mutex m_writeMutex;
+	std::condition_variable m_condition;
+	bool m_stop = false;
+};
+
+Output g_output;
+
+// the call log. The file is closed at exit, the calls done after are not written.
+class CallLog
+{
+public:
+	CallLog()
+	{
+		const char* path = std::getenv("RPR_INTERPOSER_CALL_LOG");
+		if ( !path || !path[0] )
+			return;
+		m_file = fopen(path, "w");
+		if ( !m_file )
+		{
+			fprintf(stderr, "RPR interposer: can't write %s\n", path);
+			return;
+		}
+		fprintf(m_file, "# rpr interposer call log 1\n");
+		g_rprInterposerCallLogEnabled = true;
+	}
+
+	~CallLog()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		g_rprInterposerCallLogEnabled = false;
+		if ( m_file )
+			fclose(m_file);
+		m_file = nullptr;
+	}
+
+	void Write(int functionId, long long ret, uint64_t bytes, const char* format, va_list args)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if ( !m_file )
+			return;
+		fprintf(m_file, "%s\t%lld\t%llu\t", g_rprInterposerFunctionNames[functionId], ret, (unsigned long long)bytes);
+		vfprintf(m_file, format, args);
+		fputc('\n', m_file);
+	}
+
+private:
+	std::mutex m_mutex;
+	FILE* m_file = nullptr;
+};
+
+CallLog g_callLog;
+
+size_t GetComponentSize(rpr_component_type type)
+{
+	switch (type)
+	{
+		case RPR_COMPONENT_TYPE_UINT8: return 1;
+		case RPR_COMPONENT_TYPE_FLOAT16: return 2;
+		case RPR_COMPONENT_TYPE_FLOAT32: return 4;
+		case RPR_COMPONENT_TYPE_UINT32: return 4;
+		default: return 0;
+	}
+}
+
+}
+
+std::atomic<bool> g_rprInterposerCallLogEnabled{false};
+
+void* RprInterposer_Resolve(const char* functionName)
+{
+	void* function = dlsym(RTLD_NEXT, functionName);
+	if ( !function )
+	{
+		fprintf(stderr, "RPR interposer: %s not found in the next libraries. Is libRadeonProRender64.so loaded ?\n", functionName);
+		std::abort();
+	}
+	return function;
+}
+
+void RprInterposer_Record(int functionId, uint64_t startTicks, uint64_t bytes)
+{
+	const uint64_t now = RprInterposer_Now();
+	const uint64_t ticks = now > startTicks ? now - startTicks : 0;
+
+	ThreadHistograms* thread = t_histograms;
+	if ( !thread )
+		thread = t_histograms = GetRegistry().RegisterThread();
+
+	FunctionHistogram* histogram = thread->functions[functionId].load(std::memory_order_relaxed);
+	if ( !histogram )
+	{
+		histogram = new FunctionHistogram();
+		thread->functions[functionId].store(histogram, std::memory_order_release);
+	}
+
+	Add(histogram->calls, 1);
+	Add(histogram->sumTicks, ticks);
+	Add(histogram->bytes, bytes);
+	Add(histogram->buckets[BucketIndex(ticks)], 1);
+	if ( ticks > histogram->maxTicks.load(std::memory_order_relaxed) )
+		histogram->maxTicks.store(ticks, std::memory_order_relaxed);
+}
+
+void RprInterposer_LogCall(int functionId, long long ret, uint64_t bytes, const char* format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	g_callLog.Write(functionId, ret, bytes, format, args);
+	va_end(args);
+}
+
+RPR_INTERPOSER_EXPORT void RprInterposer_Dump()
+{
+	g_output.Write();
+}
+
+uint64_t RprInterposer_ImageBytes(rpr_image_format const& format, rpr_image_desc const* desc)
+{
+	if ( !desc )
+		return 0;
+	const uint64_t depth = desc->image_depth ? desc->image_depth : 1;
+	return (uint64_t)desc->image_width * desc->image_height * depth * format.num_components * GetComponentSize(format.type);
+}
@@ -0,0 +1,79 @@
+/*****************************************************************************\
+*
+*  Module Name    rprInterposer.h
+*  Project        AMD Radeon ProRender
+*
+*  Description    Latency histograms of the RPR API calls, loaded with LD_PRELOAD
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+#pragma once
+
+// The interposer exports every rpr* function of RadeonProRender_v2.h ( wrappers generated by generate_interposer.py ).
+// Loaded with LD_PRELOAD, it's found before libRadeonProRender64.so: each wrapper calls the next definition of the function
+// ( found with dlsym(RTLD_NEXT) ) and records the duration and the bytes of the call.
+//
+// Recording is lock-free: each thread owns its histograms, and the dump only reads them.
+// Histograms are log-linear ( 16 sub-buckets per power of 2, ~6% precision ) and count ticks: rdtsc on x86-64, nanoseconds elsewhere.
+// Ticks are converted to nanoseconds at dump time.
+//
+// Environment variables:
+//   RPR_INTERPOSER_OUTPUT    : output file. Default: rpr_interposer.json
+//   RPR_INTERPOSER_FORMAT    : json or prometheus. Default: prometheus if the output ends with .prom, json otherwise.
+//   RPR_INTERPOSER_PERIOD_MS : if >0, the output is rewritten with this period. It's always written at exit.
+//   RPR_INTERPOSER_CALL_LOG  : if set, every call is also written in this file ( the call log ).
+//
+// Call log: the first line is "# rpr interposer call log 1", then one line per call, in the order the calls return,
+// with the fields separated by tabs:
+//   function  return value  bytes  arguments...
+// The arguments are in the order of the declaration: integers and enums in decimal, floats with %.9g,
+// handles and other pointers as addresses ( the content of the arrays and strings isn't written ),
+// rpr_image_format/rpr_framebuffer_format as num_components/type, and an output handle ( rpr_shape* out_mesh... ) as the handle written by the call.
+// The lines are written under a mutex: the log slows down the multithreaded applications, it's meant for debugging and analysis
+// ( tracePlayer/traceAnalyzer.py ), not for production.
+
+#define RPR_API_USE_HEADER_V2
+#include "RadeonProRender.h"
+
+#include "rprInterposer_generated.h"
+
+#include <atomic>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+#define RPR_INTERPOSER_EXPORT extern "C" __attribute__((visibility("default")))
+
+// names of the functions, indexed by the id used by RprInterposer_Record
+extern const char* const g_rprInterposerFunctionNames[RPR_INTERPOSER_FUNCTION_COUNT];
+
+// next definition of a function: the one of the core library. Aborts if not found.
+void* RprInterposer_Resolve(const char* functionName);
+
+// store one call of the function id, started at startTicks.
+void RprInterposer_Record(int functionId, uint64_t startTicks, uint64_t bytes);
+
+// true if RPR_INTERPOSER_CALL_LOG is set
+extern std::atomic<bool> g_rprInterposerCallLogEnabled;
+
+// write one line of the call log. format gives the arguments of the function, separated by tabs.
+void RprInterposer_LogCall(int functionId, long long ret, uint64_t bytes, const char* format, ...) __attribute__((format(printf, 4, 5)));
+
+// write the statistics now, in the output file.
+RPR_INTERPOSER_EXPORT void RprInterposer_Dump();
+
+uint64_t RprInterposer_ImageBytes(rpr_image_format const& format, rpr_image_desc const* desc);
+
+inline uint64_t RprInterposer_Now()
+{
+#if defined(__x86_64__) || defined(_M_X64)
+	return __rdtsc();
+#else
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
@@ -0,0 +1,127 @@
+/*****************************************************************************\
+*
+*  Module Name    rprInterposerBench.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Overhead and correctness test of the RPR interposer
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+// Run with the interposer preloaded:
+//   LD_PRELOAD=./libRprInterposer.so RPR_INTERPOSER_OUTPUT=bench.json ./RprInterposerBench [max overhead in ns]
+//
+// The same RPR function is called directly in the core library ( with dlsym on its handle ) and through the interposer.
+// The difference is the overhead of the interposer, 2 clock reads per call included.
+// Returns 1 if this overhead is above the max ( default 50 ns, RPR_INTERPOSER_MAX_OVERHEAD_NS in CMake ),
+// or if the number of calls written by the interposer is wrong.
+// The cost of the clock reads is printed for information: it depends on the machine ( rdtsc can be trapped on virtual machines ).
+// Each duration is the fastest of several rounds, to ignore the rounds slowed down by the other processes of the machine.
+
+#include "rprInterposer.h"
+
+#include <dlfcn.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+const int kCallsPerThread = 2000000;
+const int kThreadCount = 4;
+const int kRounds = 5;
+
+double MeasureNsPerCall(decltype(&rprShapeSetVisibility) function, rpr_shape shape)
+{
+	const auto start = std::chrono::steady_clock::now();
+	for(int i=0; i<kCallsPerThread; i++)
+		function(shape, (rpr_bool)(i & 1));
+	const auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(end - start).count() / kCallsPerThread;
+}
+
+// on virtual machines rdtsc can be trapped and dominate the overhead: printed to explain a failure, not removed from the overhead.
+double MeasureClockNs()
+{
+	uint64_t sum = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for(int i=0; i<kCallsPerThread; i++)
+		sum += RprInterposer_Now();
+	const auto end = std::chrono::steady_clock::now();
+	return sum == 0 ? 0.0 : std::chrono::duration<double, std::nano>(end - start).count() / kCallsPerThread;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	const double maxOverheadNs = argc > 1 ? std::atof(argv[1]) : 50.0;
+
+	typedef void (*DumpFunction)();
+	DumpFunction dump = (DumpFunction)dlsym(RTLD_DEFAULT, "RprInterposer_Dump");
+	if ( !dump )
+	{
+		printf("the interposer is not loaded: run with LD_PRELOAD=libRprInterposer.so\n");
+		return 1;
+	}
+
+	void* coreLibrary = dlopen("libRadeonProRender64.so", RTLD_NOW | RTLD_NOLOAD);
+	if ( !coreLibrary )
+	{
+		printf("libRadeonProRender64.so not loaded\n");
+		return 1;
+	}
+	auto direct = (decltype(&rprShapeSetVisibility))dlsym(coreLibrary, "rprShapeSetVisibility");
+	auto interposed = &rprShapeSetVisibility;
+	if ( !direct || (void*)direct == (void*)interposed )
+	{
+		printf("can't find the function of the core library\n");
+		return 1;
+	}
+
+	// the interposer function pointer is resolved on the first call
+	rpr_shape shape = nullptr;
+	interposed(shape, RPR_TRUE);
+
+	// the rounds alternate the measures, so that a slow period of the machine doesn't affect only one of them.
+	double directNs = 1.0e9;
+	double interposedNs = 1.0e9;
+	double clockNs = 1.0e9;
+	for(int round=0; round<kRounds; round++)
+	{
+		directNs = std::min(directNs, MeasureNsPerCall(direct, shape));
+		interposedNs = std::min(interposedNs, MeasureNsPerCall(interposed, shape));
+		clockNs = std::min(clockNs, MeasureClockNs());
+	}
+	const double overheadNs = interposedNs - directNs;
+	printf("direct call: %.1f ns   interposed call: %.1f ns   overhead: %.1f ns ( max %.1f )\n", directNs, interposedNs, overheadNs, maxOverheadNs);
+	printf("of which the 2 clock reads of each call: %.1f ns\n", 2.0 * clockNs);
+
+	// calls from several threads, then check the total written by the interposer
+	std::vector<std::thread> threads;
+	for(int t=0; t<kThreadCount; t++)
+		threads.emplace_back([interposed, shape]() { MeasureNsPerCall(interposed, shape); });
+	for(std::thread& thread : threads)
+		thread.join();
+
+	dump();
+	const char* outputPath = std::getenv("RPR_INTERPOSER_OUTPUT");
+	std::ifstream output(outputPath ? outputPath : "rpr_interposer.json");
+	std::stringstream content;
+	content << output.rdbuf();
+	const long long expectedCalls = 1 + (long long)kCallsPerThread * (kRounds + kThreadCount);
+	const std::string expected = "\"rprShapeSetVisibility\": { \"calls\": " + std::to_string(expectedCalls) + ",";
+	const bool countOk = content.str().find(expected) != std::string::npos;
+	printf("calls recorded by the interposer: %s\n", countOk ? "OK" : "WRONG");
+
+	return ( countOk && overheadNs <= maxOverheadNs ) ? 0 : 1;
+}
@@ -0,0 +1,92 @@
+/*****************************************************************************\
+*
+*  Module Name    rprInterposerCallLogTest.cpp
+*  Project        AMD Radeon ProRender
+*
+*  Description    Known sequence of RPR calls, written in the call log of the RPR interposer
+*
+*  Copyright(C) 2017-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+// Run with the interposer preloaded and the call log enabled:
+//   LD_PRELOAD=./libRprInterposer.so RPR_INTERPOSER_CALL_LOG=calls.log ./RprInterposerCallLogTest
+//
+// The log is checked by tracePlayer/test/test_traceAnalyzer.py, which knows the expected report of this sequence:
+// 192 bytes ( mesh: 128, image: 64 ) and 3 redundant setters.
+// tracePlayer/test/rpr_calls_sample.log is the log of this program with the stub core library.
+
+#define RPR_API_USE_HEADER_V2
+#include "RadeonProRender.h"
+
+#include <cstdio>
+
+#define CHECK(x) if ( (x) != RPR_SUCCESS ) { printf("%s failed\n", #x); return 1; }
+
+int main()
+{
+	rpr_int pluginIds[] = { 0 };
+	rpr_context context = nullptr;
+	CHECK( rprCreateContext(RPR_API_VERSION, pluginIds, 1, RPR_CREATION_FLAGS_ENABLE_GPU0, nullptr, nullptr, &context) );
+
+	rpr_scene scene = nullptr;
+	CHECK( rprContextCreateScene(context, &scene) );
+	CHECK( rprContextSetScene(context, scene) );
+
+	rpr_material_system matsys = nullptr;
+	CHECK( rprContextCreateMaterialSystem(context, 0, &matsys) );
+
+	// the 2nd and 3rd calls are redundant. The other key and the other value are not.
+	rpr_material_node material = nullptr;
+	CHECK( rprMaterialSystemCreateNode(matsys, RPR_MATERIAL_NODE_UBERV2, &material) );
+	CHECK( rprMaterialNodeSetInputFByKey(material, RPR_MATERIAL_INPUT_UBER_DIFFUSE_COLOR, 1.0f, 0.0f, 0.0f, 1.0f) );
+	CHECK( rprMaterialNodeSetInputFByKey(material, RPR_MATERIAL_INPUT_UBER_DIFFUSE_COLOR, 1.0f, 0.0f, 0.0f, 1.0f) );
+	CHECK( rprMaterialNodeSetInputFByKey(material, RPR_MATERIAL_INPUT_UBER_DIFFUSE_COLOR, 1.0f, 0.0f, 0.0f, 1.0f) );
+	CHECK( rprMaterialNodeSetInputFByKey(material, RPR_MATERIAL_INPUT_UBER_DIFFUSE_WEIGHT, 1.0f, 1.0f, 1.0f, 1.0f) );
+	CHECK( rprMaterialNodeSetInputFByKey(material, RPR_MATERIAL_INPUT_UBER_DIFFUSE_COLOR, 0.0f, 1.0f, 0.0f, 1.0f) );
+
+	// quad: 128 bytes of vertices, normals and uvs
+	const rpr_float vertices[] = { -1.0f, 0.0f, -1.0f,   1.0f, 0.0f, -1.0f,   1.0f, 0.0f, 1.0f,   -1.0f, 0.0f, 1.0f };
+	const rpr_float normals[] = { 0.0f, 1.0f, 0.0f,   0.0f, 1.0f, 0.0f,   0.0f, 1.0f, 0.0f,   0.0f, 1.0f, 0.0f };
+	const rpr_float uvs[] = { 0.0f, 0.0f,   1.0f, 0.0f,   1.0f, 1.0f,   0.0f, 1.0f };
+	const rpr_int indices[] = { 0, 1, 2, 3 };
+	const rpr_int numFaceVertices[] = { 4 };
+	rpr_shape mesh = nullptr;
+	CHECK( rprContextCreateMesh(context,
+		vertices, 4, 3 * sizeof(rpr_float),
+		normals, 4, 3 * sizeof(rpr_float),
+		uvs, 4, 2 * sizeof(rpr_float),
+		indices, sizeof(rpr_int),
+		indices, sizeof(rpr_int),
+		indices, sizeof(rpr_int),
+		numFaceVertices, 1, &mesh) );
+	CHECK( rprSceneAttachShape(scene, mesh) );
+
+	// the 2nd call is redundant
+	CHECK( rprShapeSetMaterial(mesh, material) );
+	CHECK( rprShapeSetMaterial(mesh, material) );
+
+	// 2x2 RGBA float: 64 bytes
+	const rpr_float pixels[16] = {};
+	rpr_image_format format = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	rpr_image_desc desc = {};
+	desc.image_width = 2;
+	desc.image_height = 2;
+	rpr_image image = nullptr;
+	CHECK( rprContextCreateImage(context, format, &desc, pixels, &image) );
+
+	// the new node can get the address of the deleted one: its first value is not redundant.
+	CHECK( rprObjectDelete(material) );
+	CHECK( rprMaterialSystemCreateNode(matsys, RPR_MATERIAL_NODE_UBERV2, &material) );
+	CHECK( rprMaterialNodeSetInputFByKey(material, RPR_MATERIAL_INPUT_UBER_DIFFUSE_COLOR, 0.0f, 1.0f, 0.0f, 1.0f) );
+
+	CHECK( rprSceneDetachShape(scene, mesh) );
+	CHECK( rprObjectDelete(image) );
+	CHECK( rprObjectDelete(mesh) );
+	CHECK( rprObjectDelete(material) );
+	CHECK( rprObjectDelete(matsys) );
+	CHECK( rprContextSetScene(context, nullptr) );
+	CHECK( rprObjectDelete(scene) );
+	CHECK( rprObjectDelete(context) );
+	return 0;
+}
@@ -0,0 +1,2834 @@
+#include "rprInterposer.h"
+
+
+//
+//
+// FILE GENERATED BY generate_interposer.py - DO NOT MODIFY IT DIRECTLY.
+//
+//
+
+
+const char* const g_rprInterposerFunctionNames[RPR_INTERPOSER_FUNCTION_COUNT] =
+{
+	"rprRegisterPlugin",
+	"rprCreateContext",
+	"rprContextSetActivePlugin",
+	"rprContextGetInfo",
+	"rprContextGetParameterInfo",
+	"rprContextGetAOV",
+	"rprContextSetAOV",
+	"rprContextAttachRenderLayer",
+	"rprContextDetachRenderLayer",
+	"rprFrameBufferSetLPE",
+	"rprContextSetAOVindexLookup",
+	"rprContextSetCuttingPlane",
+	"rprContextSetAOVindicesLookup",
+	"rprContextSetUserTexture",
+	"rprContextGetUserTexture",
+	"rprContextSetScene",
+	"rprContextGetScene",
+	"rprContextSetParameterByKey1u",
+	"rprContextSetParameterByKeyPtr",
+	"rprContextSetParameterByKey1f",
+	"rprContextSetParameterByKey3f",
+	"rprContextSetParameterByKey4f",
+	"rprContextSetParameterByKeyString",
+	"rprContextSetInternalParameter4f",
+	"rprContextSetInternalParameter1u",
+	"rprContextSetInternalParameterBuffer",
+	"rprContextGetInternalParameter4f",
+	"rprContextGetInternalParameter1u",
+	"rprContextGetInternalParameterBuffer",
+	"rprContextRender",
+	"rprContextAbortRender",
+	"rprContextRenderTile",
+	"rprContextClearMemory",
+	"rprContextCreateImage",
+	"rprContextCreateBuffer",
+	"rprContextCreateImageFromFile",
+	"rprContextCreateImageFromFileMemory",
+	"rprContextCreateScene",
+	"rprContextCreateInstance",
+	"rprContextCreateMesh",
+	"rprContextCreateMeshEx",
+	"rprContextCreateMeshEx2",
+	"rprContextCreateCamera",
+	"rprContextCreateFrameBuffer",
+	"rprContextGetFunctionPtr",
+	"rprCameraGetInfo",
+	"rprCameraSetFocalLength",
+	"rprCameraSetMotionTransformCount",
+	"rprCameraSetMotionTransform",
+	"rprCameraSetFocusDistance",
+	"rprCameraSetTransform",
+	"rprCameraSetSensorSize",
+	"rprCameraLookAt",
+	"rprCameraSetFStop",
+	"rprCameraSetApertureBlades",
+	"rprCameraSetExposure",
+	"rprCameraSetMode",
+	"rprCameraSetOrthoWidth",
+	"rprCameraSetFocalTilt",
+	"rprCameraSetIPD",
+	"rprCameraSetLensShift",
+	"rprCameraSetTiltCorrection",
+	"rprCameraSetOrthoHeight",
+	"rprCameraSetNearPlane",
+	"rprCameraSetPostScale",
+	"rprCameraSetFarPlane",
+	"rprCameraSetUVDistortion",
+	"rprImageGetInfo",
+	"rprImageSetWrap",
+	"rprImageSetInternalCompression",
+	"rprImageSetOcioColorspace",
+	"rprImageSetUDIM",
+	"rprImageSetFilter",
+	"rprImageSetGamma",
+	"rprImageSetMipmapEnabled",
+	"rprShapeSetTransform",
+	"rprShapeSetVertexValue",
+	"rprShapeSetPrimvar",
+	"rprShapeSetSubdivisionFactor",
+	"rprShapeSetSubdivisionAutoRatioCap",
+	"rprShapeSetSubdivisionCreaseWeight",
+	"rprShapeAttachRenderLayer",
+	"rprShapeDetachRenderLayer",
+	"rprLightAttachRenderLayer",
+	"rprLightDetachRenderLayer",
+	"rprShapeSetSubdivisionBoundaryInterop",
+	"rprShapeAutoAdaptSubdivisionFactor",
+	"rprShapeSetDisplacementScale",
+	"rprShapeSetObjectGroupID",
+	"rprShapeSetObjectID",
+	"rprShapeSetLightGroupID",
+	"rprShapeSetLayerMask",
+	"rprShapeSetDisplacementMaterial",
+	"rprShapeSetMaterial",
+	"rprShapeSetMaterialFaces",
+	"rprShapeSetVolumeMaterial",
+	"rprShapeSetMotionTransformCount",
+	"rprShapeSetMotionTransform",
+	"rprShapeSetVisibilityFlag",
+	"rprCurveSetVisibilityFlag",
+	"rprShapeSetVisibility",
+	"rprLightSetVisibilityFlag",
+	"rprCurveSetVisibility",
+	"rprShapeSetVisibilityInSpecular",
+	"rprShapeSetShadowCatcher",
+	"rprShapeSetShadowColor",
+	"rprShapeSetReflectionCatcher",
+	"rprShapeSetContourIgnore",
+	"rprShapeSetEnvironmentLight",
+	"rprShapeMarkStatic",
+	"rprLightSetTransform",
+	"rprLightSetGroupId",
+	"rprShapeGetInfo",
+	"rprMeshGetInfo",
+	"rprCurveGetInfo",
+	"rprHeteroVolumeGetInfo",
+	"rprGridGetInfo",
+	"rprBufferGetInfo",
+	"rprInstanceGetBaseShape",
+	"rprContextCreatePointLight",
+	"rprPointLightSetRadiantPower3f",
+	"rprContextCreateSpotLight",
+	"rprContextCreateSphereLight",
+	"rprContextCreateDiskLight",
+	"rprSpotLightSetRadiantPower3f",
+	"rprSpotLightSetImage",
+	"rprSphereLightSetRadiantPower3f",
+	"rprSphereLightSetRadius",
+	"rprDiskLightSetRadiantPower3f",
+	"rprDiskLightSetRadius",
+	"rprDiskLightSetAngle",
+	"rprDiskLightSetInnerAngle",
+	"rprSpotLightSetConeShape",
+	"rprContextCreateDirectionalLight",
+	"rprDirectionalLightSetRadiantPower3f",
+	"rprDirectionalLightSetShadowSoftnessAngle",
+	"rprContextCreateEnvironmentLight",
+	"rprEnvironmentLightSetImage",
+	"rprEnvironmentLightSetIntensityScale",
+	"rprEnvironmentLightAttachPortal",
+	"rprEnvironmentLightDetachPortal",
+	"rprEnvironmentLightSetEnvironmentLightOverride",
+	"rprEnvironmentLightGetEnvironmentLightOverride",
+	"rprContextCreateSkyLight",
+	"rprSkyLightSetTurbidity",
+	"rprSkyLightSetAlbedo",
+	"rprSkyLightSetScale",
+	"rprSkyLightSetDirection",
+	"rprSkyLightAttachPortal",
+	"rprSkyLightDetachPortal",
+	"rprContextCreateIESLight",
+	"rprIESLightSetRadiantPower3f",
+	"rprIESLightSetImageFromFile",
+	"rprIESLightSetImageFromIESdata",
+	"rprLightGetInfo",
+	"rprSceneClear",
+	"rprSceneAttachShape",
+	"rprSceneDetachShape",
+	"rprSceneAttachHeteroVolume",
+	"rprSceneDetachHeteroVolume",
+	"rprSceneAttachCurve",
+	"rprSceneDetachCurve",
+	"rprCurveSetMaterial",
+	"rprCurveSetTransform",
+	"rprContextCreateCurve",
+	"rprSceneAttachLight",
+	"rprSceneDetachLight",
+	"rprSceneSetEnvironmentLight",
+	"rprSceneGetEnvironmentLight",
+	"rprSceneGetInfo",
+	"rprSceneSetBackgroundImage",
+	"rprSceneGetBackgroundImage",
+	"rprSceneSetCameraRight",
+	"rprSceneGetCameraRight",
+	"rprSceneSetCamera",
+	"rprSceneGetCamera",
+	"rprFrameBufferGetInfo",
+	"rprFrameBufferClear",
+	"rprFrameBufferFillWithColor",
+	"rprFrameBufferSaveToFile",
+	"rprFrameBufferSaveToFileEx",
+	"rprContextResolveFrameBuffer",
+	"rprMaterialSystemGetInfo",
+	"rprContextCreateMaterialSystem",
+	"rprMaterialSystemGetSize",
+	"rprMaterialSystemCreateNode",
+	"rprMaterialNodeSetID",
+	"rprMaterialNodeSetInputNByKey",
+	"rprMaterialNodeSetInputFByKey",
+	"rprMaterialNodeSetInputDataByKey",
+	"rprMaterialNodeSetInputUByKey",
+	"rprMaterialNodeSetInputImageDataByKey",
+	"rprMaterialNodeSetInputLightDataByKey",
+	"rprMaterialNodeSetInputBufferDataByKey",
+	"rprMaterialNodeSetInputGridDataByKey",
+	"rprMaterialNodeGetInfo",
+	"rprMaterialNodeGetInputInfo",
+	"rprContextCreateComposite",
+	"rprContextCreateLUTFromFile",
+	"rprContextCreateLUTFromData",
+	"rprCompositeSetInputFb",
+	"rprCompositeSetInputC",
+	"rprCompositeSetInputLUT",
+	"rprCompositeSetInput4f",
+	"rprCompositeSetInput1u",
+	"rprCompositeSetInputOp",
+	"rprCompositeCompute",
+	"rprCompositeGetInfo",
+	"rprObjectDelete",
+	"rprObjectSetName",
+	"rprObjectSetCustomPointer",
+	"rprObjectGetCustomPointer",
+	"rprContextCreatePostEffect",
+	"rprContextAttachPostEffect",
+	"rprContextDetachPostEffect",
+	"rprPostEffectSetParameter1u",
+	"rprPostEffectSetParameter1f",
+	"rprPostEffectSetParameter3f",
+	"rprPostEffectSetParameter4f",
+	"rprContextGetAttachedPostEffectCount",
+	"rprContextGetAttachedPostEffect",
+	"rprPostEffectGetInfo",
+	"rprContextCreateGrid",
+	"rprContextCreateHeteroVolume",
+	"rprShapeSetHeteroVolume",
+	"rprHeteroVolumeSetTransform",
+	"rprHeteroVolumeSetEmissionGrid",
+	"rprHeteroVolumeSetDensityGrid",
+	"rprHeteroVolumeSetAlbedoGrid",
+	"rprHeteroVolumeSetEmissionLookup",
+	"rprHeteroVolumeSetDensityLookup",
+	"rprHeteroVolumeSetAlbedoLookup",
+	"rprHeteroVolumeSetAlbedoScale",
+	"rprHeteroVolumeSetEmissionScale",
+	"rprHeteroVolumeSetDensityScale",
+};
+
+RPR_INTERPOSER_EXPORT rpr_int rprRegisterPlugin(rpr_char const * path)
+{
+	static const auto s_next = (decltype(&rprRegisterPlugin))RprInterposer_Resolve("rprRegisterPlugin");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_int ret = s_next(path);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(0, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(0, (long long)ret, bytes, "%p", (const void*)path);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCreateContext(rpr_uint api_version, rpr_int const * pluginIDs, size_t pluginCount, rpr_creation_flags creation_flags, rpr_context_properties const * props, rpr_char const * cache_path, rpr_context * out_context)
+{
+	static const auto s_next = (decltype(&rprCreateContext))RprInterposer_Resolve("rprCreateContext");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(api_version, pluginIDs, pluginCount, creation_flags, props, cache_path, out_context);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(1, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(1, (long long)ret, bytes, "%lld\t%p\t%lld\t%lld\t%p\t%p\t%p", (long long)api_version, (const void*)pluginIDs, (long long)pluginCount, (long long)creation_flags, (const void*)props, (const void*)cache_path, out_context ? (const void*)*out_context : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetActivePlugin(rpr_context context, rpr_int pluginID)
+{
+	static const auto s_next = (decltype(&rprContextSetActivePlugin))RprInterposer_Resolve("rprContextSetActivePlugin");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, pluginID);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(2, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(2, (long long)ret, bytes, "%p\t%lld", (const void*)context, (long long)pluginID);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextGetInfo(rpr_context context, rpr_context_info context_info, size_t size, void * data, size_t * size_ret)
+{
+	static const auto s_next = (decltype(&rprContextGetInfo))RprInterposer_Resolve("rprContextGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, context_info, size, data, size_ret);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(3, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(3, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)context, (long long)context_info, (long long)size, (const void*)data, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextGetParameterInfo(rpr_context context, int param_idx, rpr_parameter_info parameter_info, size_t size, void * data, size_t * size_ret)
+{
+	static const auto s_next = (decltype(&rprContextGetParameterInfo))RprInterposer_Resolve("rprContextGetParameterInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, param_idx, parameter_info, size, data, size_ret);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(4, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(4, (long long)ret, bytes, "%p\t%lld\t%lld\t%lld\t%p\t%p", (const void*)context, (long long)param_idx, (long long)parameter_info, (long long)size, (const void*)data, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextGetAOV(rpr_context context, rpr_aov aov, rpr_framebuffer * out_fb)
+{
+	static const auto s_next = (decltype(&rprContextGetAOV))RprInterposer_Resolve("rprContextGetAOV");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, aov, out_fb);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(5, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(5, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)context, (long long)aov, out_fb ? (const void*)*out_fb : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetAOV(rpr_context context, rpr_aov aov, rpr_framebuffer frame_buffer)
+{
+	static const auto s_next = (decltype(&rprContextSetAOV))RprInterposer_Resolve("rprContextSetAOV");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, aov, frame_buffer);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(6, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(6, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)context, (long long)aov, (const void*)frame_buffer);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextAttachRenderLayer(rpr_context context, rpr_char const * renderLayerString)
+{
+	static const auto s_next = (decltype(&rprContextAttachRenderLayer))RprInterposer_Resolve("rprContextAttachRenderLayer");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, renderLayerString);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(7, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(7, (long long)ret, bytes, "%p\t%p", (const void*)context, (const void*)renderLayerString);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextDetachRenderLayer(rpr_context context, rpr_char const * renderLayerString)
+{
+	static const auto s_next = (decltype(&rprContextDetachRenderLayer))RprInterposer_Resolve("rprContextDetachRenderLayer");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, renderLayerString);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(8, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(8, (long long)ret, bytes, "%p\t%p", (const void*)context, (const void*)renderLayerString);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprFrameBufferSetLPE(rpr_framebuffer frame_buffer, rpr_char const * lpe)
+{
+	static const auto s_next = (decltype(&rprFrameBufferSetLPE))RprInterposer_Resolve("rprFrameBufferSetLPE");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(frame_buffer, lpe);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(9, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(9, (long long)ret, bytes, "%p\t%p", (const void*)frame_buffer, (const void*)lpe);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetAOVindexLookup(rpr_context context, rpr_int key, rpr_float colorR, rpr_float colorG, rpr_float colorB, rpr_float colorA)
+{
+	static const auto s_next = (decltype(&rprContextSetAOVindexLookup))RprInterposer_Resolve("rprContextSetAOVindexLookup");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, key, colorR, colorG, colorB, colorA);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(10, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(10, (long long)ret, bytes, "%p\t%lld\t%.9g\t%.9g\t%.9g\t%.9g", (const void*)context, (long long)key, (double)colorR, (double)colorG, (double)colorB, (double)colorA);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetCuttingPlane(rpr_context context, rpr_int index, rpr_float a, rpr_float b, rpr_float c, rpr_float d)
+{
+	static const auto s_next = (decltype(&rprContextSetCuttingPlane))RprInterposer_Resolve("rprContextSetCuttingPlane");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, index, a, b, c, d);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(11, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(11, (long long)ret, bytes, "%p\t%lld\t%.9g\t%.9g\t%.9g\t%.9g", (const void*)context, (long long)index, (double)a, (double)b, (double)c, (double)d);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetAOVindicesLookup(rpr_context context, rpr_int keyOffset, rpr_int keyCount, rpr_float const * colorRGBA)
+{
+	static const auto s_next = (decltype(&rprContextSetAOVindicesLookup))RprInterposer_Resolve("rprContextSetAOVindicesLookup");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, keyOffset, keyCount, colorRGBA);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(12, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(12, (long long)ret, bytes, "%p\t%lld\t%lld\t%p", (const void*)context, (long long)keyOffset, (long long)keyCount, (const void*)colorRGBA);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetUserTexture(rpr_context context, rpr_int index, rpr_char const * gpuCode, void * cpuCode)
+{
+	static const auto s_next = (decltype(&rprContextSetUserTexture))RprInterposer_Resolve("rprContextSetUserTexture");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, index, gpuCode, cpuCode);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(13, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(13, (long long)ret, bytes, "%p\t%lld\t%p\t%p", (const void*)context, (long long)index, (const void*)gpuCode, (const void*)cpuCode);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextGetUserTexture(rpr_context context, rpr_int index, size_t bufferSizeByte, void * buffer, size_t * size_ret)
+{
+	static const auto s_next = (decltype(&rprContextGetUserTexture))RprInterposer_Resolve("rprContextGetUserTexture");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, index, bufferSizeByte, buffer, size_ret);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(14, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(14, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)context, (long long)index, (long long)bufferSizeByte, (const void*)buffer, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetScene(rpr_context context, rpr_scene scene)
+{
+	static const auto s_next = (decltype(&rprContextSetScene))RprInterposer_Resolve("rprContextSetScene");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, scene);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(15, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(15, (long long)ret, bytes, "%p\t%p", (const void*)context, (const void*)scene);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextGetScene(rpr_context arg0, rpr_scene * out_scene)
+{
+	static const auto s_next = (decltype(&rprContextGetScene))RprInterposer_Resolve("rprContextGetScene");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(arg0, out_scene);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(16, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(16, (long long)ret, bytes, "%p\t%p", (const void*)arg0, out_scene ? (const void*)*out_scene : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetParameterByKey1u(rpr_context context, rpr_context_info in_input, rpr_uint x)
+{
+	static const auto s_next = (decltype(&rprContextSetParameterByKey1u))RprInterposer_Resolve("rprContextSetParameterByKey1u");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, in_input, x);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(17, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(17, (long long)ret, bytes, "%p\t%lld\t%lld", (const void*)context, (long long)in_input, (long long)x);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetParameterByKeyPtr(rpr_context context, rpr_context_info in_input, void * x)
+{
+	static const auto s_next = (decltype(&rprContextSetParameterByKeyPtr))RprInterposer_Resolve("rprContextSetParameterByKeyPtr");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, in_input, x);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(18, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(18, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)context, (long long)in_input, (const void*)x);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetParameterByKey1f(rpr_context context, rpr_context_info in_input, rpr_float x)
+{
+	static const auto s_next = (decltype(&rprContextSetParameterByKey1f))RprInterposer_Resolve("rprContextSetParameterByKey1f");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, in_input, x);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(19, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(19, (long long)ret, bytes, "%p\t%lld\t%.9g", (const void*)context, (long long)in_input, (double)x);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetParameterByKey3f(rpr_context context, rpr_context_info in_input, rpr_float x, rpr_float y, rpr_float z)
+{
+	static const auto s_next = (decltype(&rprContextSetParameterByKey3f))RprInterposer_Resolve("rprContextSetParameterByKey3f");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, in_input, x, y, z);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(20, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(20, (long long)ret, bytes, "%p\t%lld\t%.9g\t%.9g\t%.9g", (const void*)context, (long long)in_input, (double)x, (double)y, (double)z);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetParameterByKey4f(rpr_context context, rpr_context_info in_input, rpr_float x, rpr_float y, rpr_float z, rpr_float w)
+{
+	static const auto s_next = (decltype(&rprContextSetParameterByKey4f))RprInterposer_Resolve("rprContextSetParameterByKey4f");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, in_input, x, y, z, w);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(21, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(21, (long long)ret, bytes, "%p\t%lld\t%.9g\t%.9g\t%.9g\t%.9g", (const void*)context, (long long)in_input, (double)x, (double)y, (double)z, (double)w);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetParameterByKeyString(rpr_context context, rpr_context_info in_input, rpr_char const * value)
+{
+	static const auto s_next = (decltype(&rprContextSetParameterByKeyString))RprInterposer_Resolve("rprContextSetParameterByKeyString");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, in_input, value);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(22, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(22, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)context, (long long)in_input, (const void*)value);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetInternalParameter4f(rpr_context context, rpr_uint pluginIndex, rpr_char const * paramName, rpr_float x, rpr_float y, rpr_float z, rpr_float w)
+{
+	static const auto s_next = (decltype(&rprContextSetInternalParameter4f))RprInterposer_Resolve("rprContextSetInternalParameter4f");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, pluginIndex, paramName, x, y, z, w);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(23, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(23, (long long)ret, bytes, "%p\t%lld\t%p\t%.9g\t%.9g\t%.9g\t%.9g", (const void*)context, (long long)pluginIndex, (const void*)paramName, (double)x, (double)y, (double)z, (double)w);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetInternalParameter1u(rpr_context context, rpr_uint pluginIndex, rpr_char const * paramName, rpr_uint x)
+{
+	static const auto s_next = (decltype(&rprContextSetInternalParameter1u))RprInterposer_Resolve("rprContextSetInternalParameter1u");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, pluginIndex, paramName, x);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(24, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(24, (long long)ret, bytes, "%p\t%lld\t%p\t%lld", (const void*)context, (long long)pluginIndex, (const void*)paramName, (long long)x);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextSetInternalParameterBuffer(rpr_context context, rpr_uint pluginIndex, rpr_char const * paramName, void const * buffer, size_t bufferSizeByte)
+{
+	static const auto s_next = (decltype(&rprContextSetInternalParameterBuffer))RprInterposer_Resolve("rprContextSetInternalParameterBuffer");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, pluginIndex, paramName, buffer, bufferSizeByte);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(25, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(25, (long long)ret, bytes, "%p\t%lld\t%p\t%p\t%lld", (const void*)context, (long long)pluginIndex, (const void*)paramName, (const void*)buffer, (long long)bufferSizeByte);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextGetInternalParameter4f(rpr_context context, rpr_uint pluginIndex, rpr_char const * paramName, rpr_float * x, rpr_float * y, rpr_float * z, rpr_float * w)
+{
+	static const auto s_next = (decltype(&rprContextGetInternalParameter4f))RprInterposer_Resolve("rprContextGetInternalParameter4f");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, pluginIndex, paramName, x, y, z, w);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(26, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(26, (long long)ret, bytes, "%p\t%lld\t%p\t%p\t%p\t%p\t%p", (const void*)context, (long long)pluginIndex, (const void*)paramName, (const void*)x, (const void*)y, (const void*)z, (const void*)w);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextGetInternalParameter1u(rpr_context context, rpr_uint pluginIndex, rpr_char const * paramName, rpr_uint * x)
+{
+	static const auto s_next = (decltype(&rprContextGetInternalParameter1u))RprInterposer_Resolve("rprContextGetInternalParameter1u");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, pluginIndex, paramName, x);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(27, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(27, (long long)ret, bytes, "%p\t%lld\t%p\t%p", (const void*)context, (long long)pluginIndex, (const void*)paramName, (const void*)x);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextGetInternalParameterBuffer(rpr_context context, rpr_uint pluginIndex, rpr_char const * paramName, size_t bufferSizeByte, void * buffer, size_t * size_ret)
+{
+	static const auto s_next = (decltype(&rprContextGetInternalParameterBuffer))RprInterposer_Resolve("rprContextGetInternalParameterBuffer");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, pluginIndex, paramName, bufferSizeByte, buffer, size_ret);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(28, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(28, (long long)ret, bytes, "%p\t%lld\t%p\t%lld\t%p\t%p", (const void*)context, (long long)pluginIndex, (const void*)paramName, (long long)bufferSizeByte, (const void*)buffer, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextRender(rpr_context context)
+{
+	static const auto s_next = (decltype(&rprContextRender))RprInterposer_Resolve("rprContextRender");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(29, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(29, (long long)ret, bytes, "%p", (const void*)context);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextAbortRender(rpr_context context)
+{
+	static const auto s_next = (decltype(&rprContextAbortRender))RprInterposer_Resolve("rprContextAbortRender");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(30, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(30, (long long)ret, bytes, "%p", (const void*)context);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextRenderTile(rpr_context context, rpr_uint xmin, rpr_uint xmax, rpr_uint ymin, rpr_uint ymax)
+{
+	static const auto s_next = (decltype(&rprContextRenderTile))RprInterposer_Resolve("rprContextRenderTile");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, xmin, xmax, ymin, ymax);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(31, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(31, (long long)ret, bytes, "%p\t%lld\t%lld\t%lld\t%lld", (const void*)context, (long long)xmin, (long long)xmax, (long long)ymin, (long long)ymax);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextClearMemory(rpr_context context)
+{
+	static const auto s_next = (decltype(&rprContextClearMemory))RprInterposer_Resolve("rprContextClearMemory");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(32, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(32, (long long)ret, bytes, "%p", (const void*)context);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateImage(rpr_context context, rpr_image_format const format, rpr_image_desc const * image_desc, void const * data, rpr_image * out_image)
+{
+	static const auto s_next = (decltype(&rprContextCreateImage))RprInterposer_Resolve("rprContextCreateImage");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, format, image_desc, data, out_image);
+	const uint64_t bytes = RprInterposer_ImageBytes(format, image_desc);
+	RprInterposer_Record(33, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(33, (long long)ret, bytes, "%p\t%u/%u\t%p\t%p\t%p", (const void*)context, (unsigned)format.num_components, (unsigned)format.type, (const void*)image_desc, (const void*)data, out_image ? (const void*)*out_image : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateBuffer(rpr_context context, rpr_buffer_desc const * buffer_desc, void const * data, rpr_buffer * out_buffer)
+{
+	static const auto s_next = (decltype(&rprContextCreateBuffer))RprInterposer_Resolve("rprContextCreateBuffer");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, buffer_desc, data, out_buffer);
+	const uint64_t bytes = buffer_desc ? (uint64_t)buffer_desc->nb_element * buffer_desc->element_channel_size * 4 : 0;
+	RprInterposer_Record(34, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(34, (long long)ret, bytes, "%p\t%p\t%p\t%p", (const void*)context, (const void*)buffer_desc, (const void*)data, out_buffer ? (const void*)*out_buffer : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateImageFromFile(rpr_context context, rpr_char const * path, rpr_image * out_image)
+{
+	static const auto s_next = (decltype(&rprContextCreateImageFromFile))RprInterposer_Resolve("rprContextCreateImageFromFile");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, path, out_image);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(35, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(35, (long long)ret, bytes, "%p\t%p\t%p", (const void*)context, (const void*)path, out_image ? (const void*)*out_image : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateImageFromFileMemory(rpr_context context, rpr_char const * extension, void const * data, size_t dataSizeByte, rpr_image * out_image)
+{
+	static const auto s_next = (decltype(&rprContextCreateImageFromFileMemory))RprInterposer_Resolve("rprContextCreateImageFromFileMemory");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, extension, data, dataSizeByte, out_image);
+	const uint64_t bytes = dataSizeByte;
+	RprInterposer_Record(36, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(36, (long long)ret, bytes, "%p\t%p\t%p\t%lld\t%p", (const void*)context, (const void*)extension, (const void*)data, (long long)dataSizeByte, out_image ? (const void*)*out_image : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateScene(rpr_context context, rpr_scene * out_scene)
+{
+	static const auto s_next = (decltype(&rprContextCreateScene))RprInterposer_Resolve("rprContextCreateScene");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, out_scene);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(37, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(37, (long long)ret, bytes, "%p\t%p", (const void*)context, out_scene ? (const void*)*out_scene : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateInstance(rpr_context context, rpr_shape shape, rpr_shape * out_instance)
+{
+	static const auto s_next = (decltype(&rprContextCreateInstance))RprInterposer_Resolve("rprContextCreateInstance");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, shape, out_instance);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(38, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(38, (long long)ret, bytes, "%p\t%p\t%p", (const void*)context, (const void*)shape, out_instance ? (const void*)*out_instance : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateMesh(rpr_context context, rpr_float const * vertices, size_t num_vertices, rpr_int vertex_stride, rpr_float const * normals, size_t num_normals, rpr_int normal_stride, rpr_float const * texcoords, size_t num_texcoords, rpr_int texcoord_stride, rpr_int const * vertex_indices, rpr_int vidx_stride, rpr_int const * normal_indices, rpr_int nidx_stride, rpr_int const * texcoord_indices, rpr_int tidx_stride, rpr_int const * num_face_vertices, size_t num_faces, rpr_shape * out_mesh)
+{
+	static const auto s_next = (decltype(&rprContextCreateMesh))RprInterposer_Resolve("rprContextCreateMesh");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, vertices, num_vertices, vertex_stride, normals, num_normals, normal_stride, texcoords, num_texcoords, texcoord_stride, vertex_indices, vidx_stride, normal_indices, nidx_stride, texcoord_indices, tidx_stride, num_face_vertices, num_faces, out_mesh);
+	const uint64_t bytes = (uint64_t)num_vertices * vertex_stride + (uint64_t)num_normals * normal_stride + (uint64_t)num_texcoords * texcoord_stride;
+	RprInterposer_Record(39, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(39, (long long)ret, bytes, "%p\t%p\t%lld\t%lld\t%p\t%lld\t%lld\t%p\t%lld\t%lld\t%p\t%lld\t%p\t%lld\t%p\t%lld\t%p\t%lld\t%p", (const void*)context, (const void*)vertices, (long long)num_vertices, (long long)vertex_stride, (const void*)normals, (long long)num_normals, (long long)normal_stride, (const void*)texcoords, (long long)num_texcoords, (long long)texcoord_stride, (const void*)vertex_indices, (long long)vidx_stride, (const void*)normal_indices, (long long)nidx_stride, (const void*)texcoord_indices, (long long)tidx_stride, (const void*)num_face_vertices, (long long)num_faces, out_mesh ? (const void*)*out_mesh : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateMeshEx(rpr_context context, rpr_float const * vertices, size_t num_vertices, rpr_int vertex_stride, rpr_float const * normals, size_t num_normals, rpr_int normal_stride, rpr_int const * perVertexFlag, size_t num_perVertexFlags, rpr_int perVertexFlag_stride, rpr_int numberOfTexCoordLayers, rpr_float const ** texcoords, size_t const * num_texcoords, rpr_int const * texcoord_stride, rpr_int const * vertex_indices, rpr_int vidx_stride, rpr_int const * normal_indices, rpr_int nidx_stride, rpr_int const ** texcoord_indices, rpr_int const * tidx_stride, rpr_int const * num_face_vertices, size_t num_faces, rpr_shape * out_mesh)
+{
+	static const auto s_next = (decltype(&rprContextCreateMeshEx))RprInterposer_Resolve("rprContextCreateMeshEx");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, vertices, num_vertices, vertex_stride, normals, num_normals, normal_stride, perVertexFlag, num_perVertexFlags, perVertexFlag_stride, numberOfTexCoordLayers, texcoords, num_texcoords, texcoord_stride, vertex_indices, vidx_stride, normal_indices, nidx_stride, texcoord_indices, tidx_stride, num_face_vertices, num_faces, out_mesh);
+	const uint64_t bytes = (uint64_t)num_vertices * vertex_stride + (uint64_t)num_normals * normal_stride;
+	RprInterposer_Record(40, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(40, (long long)ret, bytes, "%p\t%p\t%lld\t%lld\t%p\t%lld\t%lld\t%p\t%lld\t%lld\t%lld\t%p\t%p\t%p\t%p\t%lld\t%p\t%lld\t%p\t%p\t%p\t%lld\t%p", (const void*)context, (const void*)vertices, (long long)num_vertices, (long long)vertex_stride, (const void*)normals, (long long)num_normals, (long long)normal_stride, (const void*)perVertexFlag, (long long)num_perVertexFlags, (long long)perVertexFlag_stride, (long long)numberOfTexCoordLayers, (const void*)texcoords, (const void*)num_texcoords, (const void*)texcoord_stride, (const void*)vertex_indices, (long long)vidx_stride, (const void*)normal_indices, (long long)nidx_stride, (const void*)texcoord_indices, (const void*)tidx_stride, (const void*)num_face_vertices, (long long)num_faces, out_mesh ? (const void*)*out_mesh : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateMeshEx2(rpr_context context, rpr_float const * vertices, size_t num_vertices, rpr_int vertex_stride, rpr_float const * normals, size_t num_normals, rpr_int normal_stride, rpr_int const * perVertexFlag, size_t num_perVertexFlags, rpr_int perVertexFlag_stride, rpr_int numberOfTexCoordLayers, rpr_float const ** texcoords, size_t const * num_texcoords, rpr_int const * texcoord_stride, rpr_int const * vertex_indices, rpr_int vidx_stride, rpr_int const * normal_indices, rpr_int nidx_stride, rpr_int const ** texcoord_indices, rpr_int const * tidx_stride, rpr_int const * num_face_vertices, size_t num_faces, rpr_mesh_info const * mesh_properties, rpr_shape * out_mesh)
+{
+	static const auto s_next = (decltype(&rprContextCreateMeshEx2))RprInterposer_Resolve("rprContextCreateMeshEx2");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, vertices, num_vertices, vertex_stride, normals, num_normals, normal_stride, perVertexFlag, num_perVertexFlags, perVertexFlag_stride, numberOfTexCoordLayers, texcoords, num_texcoords, texcoord_stride, vertex_indices, vidx_stride, normal_indices, nidx_stride, texcoord_indices, tidx_stride, num_face_vertices, num_faces, mesh_properties, out_mesh);
+	const uint64_t bytes = (uint64_t)num_vertices * vertex_stride + (uint64_t)num_normals * normal_stride;
+	RprInterposer_Record(41, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(41, (long long)ret, bytes, "%p\t%p\t%lld\t%lld\t%p\t%lld\t%lld\t%p\t%lld\t%lld\t%lld\t%p\t%p\t%p\t%p\t%lld\t%p\t%lld\t%p\t%p\t%p\t%lld\t%p\t%p", (const void*)context, (const void*)vertices, (long long)num_vertices, (long long)vertex_stride, (const void*)normals, (long long)num_normals, (long long)normal_stride, (const void*)perVertexFlag, (long long)num_perVertexFlags, (long long)perVertexFlag_stride, (long long)numberOfTexCoordLayers, (const void*)texcoords, (const void*)num_texcoords, (const void*)texcoord_stride, (const void*)vertex_indices, (long long)vidx_stride, (const void*)normal_indices, (long long)nidx_stride, (const void*)texcoord_indices, (const void*)tidx_stride, (const void*)num_face_vertices, (long long)num_faces, (const void*)mesh_properties, out_mesh ? (const void*)*out_mesh : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateCamera(rpr_context context, rpr_camera * out_camera)
+{
+	static const auto s_next = (decltype(&rprContextCreateCamera))RprInterposer_Resolve("rprContextCreateCamera");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, out_camera);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(42, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(42, (long long)ret, bytes, "%p\t%p", (const void*)context, out_camera ? (const void*)*out_camera : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateFrameBuffer(rpr_context context, rpr_framebuffer_format const format, rpr_framebuffer_desc const * fb_desc, rpr_framebuffer * out_fb)
+{
+	static const auto s_next = (decltype(&rprContextCreateFrameBuffer))RprInterposer_Resolve("rprContextCreateFrameBuffer");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, format, fb_desc, out_fb);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(43, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(43, (long long)ret, bytes, "%p\t%u/%u\t%p\t%p", (const void*)context, (unsigned)format.num_components, (unsigned)format.type, (const void*)fb_desc, out_fb ? (const void*)*out_fb : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextGetFunctionPtr(rpr_context context, rpr_char const * function_name, void ** out_function_ptr)
+{
+	static const auto s_next = (decltype(&rprContextGetFunctionPtr))RprInterposer_Resolve("rprContextGetFunctionPtr");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, function_name, out_function_ptr);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(44, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(44, (long long)ret, bytes, "%p\t%p\t%p", (const void*)context, (const void*)function_name, (const void*)out_function_ptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraGetInfo(rpr_camera camera, rpr_camera_info camera_info, size_t size, void * data, size_t * size_ret)
+{
+	static const auto s_next = (decltype(&rprCameraGetInfo))RprInterposer_Resolve("rprCameraGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, camera_info, size, data, size_ret);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(45, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(45, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)camera, (long long)camera_info, (long long)size, (const void*)data, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetFocalLength(rpr_camera camera, rpr_float flength)
+{
+	static const auto s_next = (decltype(&rprCameraSetFocalLength))RprInterposer_Resolve("rprCameraSetFocalLength");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, flength);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(46, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(46, (long long)ret, bytes, "%p\t%.9g", (const void*)camera, (double)flength);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetMotionTransformCount(rpr_camera camera, rpr_uint transformCount)
+{
+	static const auto s_next = (decltype(&rprCameraSetMotionTransformCount))RprInterposer_Resolve("rprCameraSetMotionTransformCount");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, transformCount);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(47, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(47, (long long)ret, bytes, "%p\t%lld", (const void*)camera, (long long)transformCount);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetMotionTransform(rpr_camera camera, rpr_bool transpose, rpr_float const * transform, rpr_uint timeIndex)
+{
+	static const auto s_next = (decltype(&rprCameraSetMotionTransform))RprInterposer_Resolve("rprCameraSetMotionTransform");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, transpose, transform, timeIndex);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(48, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(48, (long long)ret, bytes, "%p\t%lld\t%p\t%lld", (const void*)camera, (long long)transpose, (const void*)transform, (long long)timeIndex);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetFocusDistance(rpr_camera camera, rpr_float fdist)
+{
+	static const auto s_next = (decltype(&rprCameraSetFocusDistance))RprInterposer_Resolve("rprCameraSetFocusDistance");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, fdist);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(49, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(49, (long long)ret, bytes, "%p\t%.9g", (const void*)camera, (double)fdist);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetTransform(rpr_camera camera, rpr_bool transpose, rpr_float const * transform)
+{
+	static const auto s_next = (decltype(&rprCameraSetTransform))RprInterposer_Resolve("rprCameraSetTransform");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, transpose, transform);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(50, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(50, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)camera, (long long)transpose, (const void*)transform);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetSensorSize(rpr_camera camera, rpr_float width, rpr_float height)
+{
+	static const auto s_next = (decltype(&rprCameraSetSensorSize))RprInterposer_Resolve("rprCameraSetSensorSize");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, width, height);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(51, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(51, (long long)ret, bytes, "%p\t%.9g\t%.9g", (const void*)camera, (double)width, (double)height);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraLookAt(rpr_camera camera, rpr_float posx, rpr_float posy, rpr_float posz, rpr_float atx, rpr_float aty, rpr_float atz, rpr_float upx, rpr_float upy, rpr_float upz)
+{
+	static const auto s_next = (decltype(&rprCameraLookAt))RprInterposer_Resolve("rprCameraLookAt");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, posx, posy, posz, atx, aty, atz, upx, upy, upz);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(52, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(52, (long long)ret, bytes, "%p\t%.9g\t%.9g\t%.9g\t%.9g\t%.9g\t%.9g\t%.9g\t%.9g\t%.9g", (const void*)camera, (double)posx, (double)posy, (double)posz, (double)atx, (double)aty, (double)atz, (double)upx, (double)upy, (double)upz);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetFStop(rpr_camera camera, rpr_float fstop)
+{
+	static const auto s_next = (decltype(&rprCameraSetFStop))RprInterposer_Resolve("rprCameraSetFStop");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, fstop);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(53, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(53, (long long)ret, bytes, "%p\t%.9g", (const void*)camera, (double)fstop);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetApertureBlades(rpr_camera camera, rpr_uint num_blades)
+{
+	static const auto s_next = (decltype(&rprCameraSetApertureBlades))RprInterposer_Resolve("rprCameraSetApertureBlades");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, num_blades);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(54, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(54, (long long)ret, bytes, "%p\t%lld", (const void*)camera, (long long)num_blades);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetExposure(rpr_camera camera, rpr_float exposure)
+{
+	static const auto s_next = (decltype(&rprCameraSetExposure))RprInterposer_Resolve("rprCameraSetExposure");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, exposure);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(55, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(55, (long long)ret, bytes, "%p\t%.9g", (const void*)camera, (double)exposure);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetMode(rpr_camera camera, rpr_camera_mode mode)
+{
+	static const auto s_next = (decltype(&rprCameraSetMode))RprInterposer_Resolve("rprCameraSetMode");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, mode);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(56, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(56, (long long)ret, bytes, "%p\t%lld", (const void*)camera, (long long)mode);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetOrthoWidth(rpr_camera camera, rpr_float width)
+{
+	static const auto s_next = (decltype(&rprCameraSetOrthoWidth))RprInterposer_Resolve("rprCameraSetOrthoWidth");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, width);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(57, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(57, (long long)ret, bytes, "%p\t%.9g", (const void*)camera, (double)width);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetFocalTilt(rpr_camera camera, rpr_float tilt)
+{
+	static const auto s_next = (decltype(&rprCameraSetFocalTilt))RprInterposer_Resolve("rprCameraSetFocalTilt");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, tilt);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(58, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(58, (long long)ret, bytes, "%p\t%.9g", (const void*)camera, (double)tilt);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetIPD(rpr_camera camera, rpr_float ipd)
+{
+	static const auto s_next = (decltype(&rprCameraSetIPD))RprInterposer_Resolve("rprCameraSetIPD");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, ipd);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(59, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(59, (long long)ret, bytes, "%p\t%.9g", (const void*)camera, (double)ipd);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetLensShift(rpr_camera camera, rpr_float shiftx, rpr_float shifty)
+{
+	static const auto s_next = (decltype(&rprCameraSetLensShift))RprInterposer_Resolve("rprCameraSetLensShift");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, shiftx, shifty);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(60, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(60, (long long)ret, bytes, "%p\t%.9g\t%.9g", (const void*)camera, (double)shiftx, (double)shifty);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetTiltCorrection(rpr_camera camera, rpr_float tiltX, rpr_float tiltY)
+{
+	static const auto s_next = (decltype(&rprCameraSetTiltCorrection))RprInterposer_Resolve("rprCameraSetTiltCorrection");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, tiltX, tiltY);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(61, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(61, (long long)ret, bytes, "%p\t%.9g\t%.9g", (const void*)camera, (double)tiltX, (double)tiltY);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetOrthoHeight(rpr_camera camera, rpr_float height)
+{
+	static const auto s_next = (decltype(&rprCameraSetOrthoHeight))RprInterposer_Resolve("rprCameraSetOrthoHeight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, height);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(62, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(62, (long long)ret, bytes, "%p\t%.9g", (const void*)camera, (double)height);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetNearPlane(rpr_camera camera, rpr_float near)
+{
+	static const auto s_next = (decltype(&rprCameraSetNearPlane))RprInterposer_Resolve("rprCameraSetNearPlane");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, near);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(63, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(63, (long long)ret, bytes, "%p\t%.9g", (const void*)camera, (double)near);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetPostScale(rpr_camera camera, rpr_float scale)
+{
+	static const auto s_next = (decltype(&rprCameraSetPostScale))RprInterposer_Resolve("rprCameraSetPostScale");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, scale);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(64, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(64, (long long)ret, bytes, "%p\t%.9g", (const void*)camera, (double)scale);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetFarPlane(rpr_camera camera, rpr_float far)
+{
+	static const auto s_next = (decltype(&rprCameraSetFarPlane))RprInterposer_Resolve("rprCameraSetFarPlane");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, far);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(65, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(65, (long long)ret, bytes, "%p\t%.9g", (const void*)camera, (double)far);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCameraSetUVDistortion(rpr_camera camera, rpr_image distortionMap)
+{
+	static const auto s_next = (decltype(&rprCameraSetUVDistortion))RprInterposer_Resolve("rprCameraSetUVDistortion");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(camera, distortionMap);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(66, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(66, (long long)ret, bytes, "%p\t%p", (const void*)camera, (const void*)distortionMap);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprImageGetInfo(rpr_image image, rpr_image_info image_info, size_t size, void * data, size_t * size_ret)
+{
+	static const auto s_next = (decltype(&rprImageGetInfo))RprInterposer_Resolve("rprImageGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(image, image_info, size, data, size_ret);
+	const uint64_t bytes = data ? size : 0;
+	RprInterposer_Record(67, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(67, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)image, (long long)image_info, (long long)size, (const void*)data, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprImageSetWrap(rpr_image image, rpr_image_wrap_type type)
+{
+	static const auto s_next = (decltype(&rprImageSetWrap))RprInterposer_Resolve("rprImageSetWrap");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(image, type);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(68, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(68, (long long)ret, bytes, "%p\t%lld", (const void*)image, (long long)type);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprImageSetInternalCompression(rpr_image image, rpr_uint compressionEnabled)
+{
+	static const auto s_next = (decltype(&rprImageSetInternalCompression))RprInterposer_Resolve("rprImageSetInternalCompression");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(image, compressionEnabled);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(69, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(69, (long long)ret, bytes, "%p\t%lld", (const void*)image, (long long)compressionEnabled);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprImageSetOcioColorspace(rpr_image image, rpr_char const * ocioColorspace)
+{
+	static const auto s_next = (decltype(&rprImageSetOcioColorspace))RprInterposer_Resolve("rprImageSetOcioColorspace");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(image, ocioColorspace);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(70, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(70, (long long)ret, bytes, "%p\t%p", (const void*)image, (const void*)ocioColorspace);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprImageSetUDIM(rpr_image imageUdimRoot, rpr_uint tileIndex, rpr_image imageTile)
+{
+	static const auto s_next = (decltype(&rprImageSetUDIM))RprInterposer_Resolve("rprImageSetUDIM");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(imageUdimRoot, tileIndex, imageTile);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(71, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(71, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)imageUdimRoot, (long long)tileIndex, (const void*)imageTile);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprImageSetFilter(rpr_image image, rpr_image_filter_type type)
+{
+	static const auto s_next = (decltype(&rprImageSetFilter))RprInterposer_Resolve("rprImageSetFilter");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(image, type);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(72, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(72, (long long)ret, bytes, "%p\t%lld", (const void*)image, (long long)type);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprImageSetGamma(rpr_image image, rpr_float type)
+{
+	static const auto s_next = (decltype(&rprImageSetGamma))RprInterposer_Resolve("rprImageSetGamma");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(image, type);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(73, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(73, (long long)ret, bytes, "%p\t%.9g", (const void*)image, (double)type);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprImageSetMipmapEnabled(rpr_image image, rpr_bool enabled)
+{
+	static const auto s_next = (decltype(&rprImageSetMipmapEnabled))RprInterposer_Resolve("rprImageSetMipmapEnabled");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(image, enabled);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(74, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(74, (long long)ret, bytes, "%p\t%lld", (const void*)image, (long long)enabled);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetTransform(rpr_shape shape, rpr_bool transpose, rpr_float const * transform)
+{
+	static const auto s_next = (decltype(&rprShapeSetTransform))RprInterposer_Resolve("rprShapeSetTransform");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, transpose, transform);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(75, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(75, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)shape, (long long)transpose, (const void*)transform);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetVertexValue(rpr_shape in_shape, rpr_int setIndex, rpr_int const * indices, rpr_float const * values, rpr_int indicesCount)
+{
+	static const auto s_next = (decltype(&rprShapeSetVertexValue))RprInterposer_Resolve("rprShapeSetVertexValue");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_shape, setIndex, indices, values, indicesCount);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(76, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(76, (long long)ret, bytes, "%p\t%lld\t%p\t%p\t%lld", (const void*)in_shape, (long long)setIndex, (const void*)indices, (const void*)values, (long long)indicesCount);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetPrimvar(rpr_shape in_shape, rpr_uint key, rpr_float const * data, rpr_uint floatCount, rpr_uint componentCount, rpr_primvar_interpolation_type  interop)
+{
+	static const auto s_next = (decltype(&rprShapeSetPrimvar))RprInterposer_Resolve("rprShapeSetPrimvar");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_shape, key, data, floatCount, componentCount, interop);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(77, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(77, (long long)ret, bytes, "%p\t%lld\t%p\t%lld\t%lld\t%lld", (const void*)in_shape, (long long)key, (const void*)data, (long long)floatCount, (long long)componentCount, (long long)interop);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetSubdivisionFactor(rpr_shape shape, rpr_uint factor)
+{
+	static const auto s_next = (decltype(&rprShapeSetSubdivisionFactor))RprInterposer_Resolve("rprShapeSetSubdivisionFactor");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, factor);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(78, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(78, (long long)ret, bytes, "%p\t%lld", (const void*)shape, (long long)factor);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetSubdivisionAutoRatioCap(rpr_shape shape, rpr_float autoRatioCap)
+{
+	static const auto s_next = (decltype(&rprShapeSetSubdivisionAutoRatioCap))RprInterposer_Resolve("rprShapeSetSubdivisionAutoRatioCap");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, autoRatioCap);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(79, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(79, (long long)ret, bytes, "%p\t%.9g", (const void*)shape, (double)autoRatioCap);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetSubdivisionCreaseWeight(rpr_shape shape, rpr_float factor)
+{
+	static const auto s_next = (decltype(&rprShapeSetSubdivisionCreaseWeight))RprInterposer_Resolve("rprShapeSetSubdivisionCreaseWeight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, factor);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(80, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(80, (long long)ret, bytes, "%p\t%.9g", (const void*)shape, (double)factor);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeAttachRenderLayer(rpr_shape shape, rpr_char const * renderLayerString)
+{
+	static const auto s_next = (decltype(&rprShapeAttachRenderLayer))RprInterposer_Resolve("rprShapeAttachRenderLayer");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, renderLayerString);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(81, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(81, (long long)ret, bytes, "%p\t%p", (const void*)shape, (const void*)renderLayerString);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeDetachRenderLayer(rpr_shape shape, rpr_char const * renderLayerString)
+{
+	static const auto s_next = (decltype(&rprShapeDetachRenderLayer))RprInterposer_Resolve("rprShapeDetachRenderLayer");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, renderLayerString);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(82, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(82, (long long)ret, bytes, "%p\t%p", (const void*)shape, (const void*)renderLayerString);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprLightAttachRenderLayer(rpr_light light, rpr_char const * renderLayerString)
+{
+	static const auto s_next = (decltype(&rprLightAttachRenderLayer))RprInterposer_Resolve("rprLightAttachRenderLayer");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, renderLayerString);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(83, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(83, (long long)ret, bytes, "%p\t%p", (const void*)light, (const void*)renderLayerString);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprLightDetachRenderLayer(rpr_light light, rpr_char const * renderLayerString)
+{
+	static const auto s_next = (decltype(&rprLightDetachRenderLayer))RprInterposer_Resolve("rprLightDetachRenderLayer");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, renderLayerString);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(84, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(84, (long long)ret, bytes, "%p\t%p", (const void*)light, (const void*)renderLayerString);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetSubdivisionBoundaryInterop(rpr_shape shape, rpr_subdiv_boundary_interfop_type type)
+{
+	static const auto s_next = (decltype(&rprShapeSetSubdivisionBoundaryInterop))RprInterposer_Resolve("rprShapeSetSubdivisionBoundaryInterop");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, type);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(85, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(85, (long long)ret, bytes, "%p\t%lld", (const void*)shape, (long long)type);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeAutoAdaptSubdivisionFactor(rpr_shape shape, rpr_framebuffer framebuffer, rpr_camera camera, rpr_int factor)
+{
+	static const auto s_next = (decltype(&rprShapeAutoAdaptSubdivisionFactor))RprInterposer_Resolve("rprShapeAutoAdaptSubdivisionFactor");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, framebuffer, camera, factor);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(86, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(86, (long long)ret, bytes, "%p\t%p\t%p\t%lld", (const void*)shape, (const void*)framebuffer, (const void*)camera, (long long)factor);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetDisplacementScale(rpr_shape shape, rpr_float minscale, rpr_float maxscale)
+{
+	static const auto s_next = (decltype(&rprShapeSetDisplacementScale))RprInterposer_Resolve("rprShapeSetDisplacementScale");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, minscale, maxscale);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(87, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(87, (long long)ret, bytes, "%p\t%.9g\t%.9g", (const void*)shape, (double)minscale, (double)maxscale);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetObjectGroupID(rpr_shape shape, rpr_uint objectGroupID)
+{
+	static const auto s_next = (decltype(&rprShapeSetObjectGroupID))RprInterposer_Resolve("rprShapeSetObjectGroupID");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, objectGroupID);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(88, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(88, (long long)ret, bytes, "%p\t%lld", (const void*)shape, (long long)objectGroupID);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetObjectID(rpr_shape shape, rpr_uint objectID)
+{
+	static const auto s_next = (decltype(&rprShapeSetObjectID))RprInterposer_Resolve("rprShapeSetObjectID");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, objectID);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(89, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(89, (long long)ret, bytes, "%p\t%lld", (const void*)shape, (long long)objectID);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetLightGroupID(rpr_shape shape, rpr_uint lightGroupID)
+{
+	static const auto s_next = (decltype(&rprShapeSetLightGroupID))RprInterposer_Resolve("rprShapeSetLightGroupID");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, lightGroupID);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(90, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(90, (long long)ret, bytes, "%p\t%lld", (const void*)shape, (long long)lightGroupID);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetLayerMask(rpr_shape shape, rpr_uint layerMask)
+{
+	static const auto s_next = (decltype(&rprShapeSetLayerMask))RprInterposer_Resolve("rprShapeSetLayerMask");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, layerMask);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(91, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(91, (long long)ret, bytes, "%p\t%lld", (const void*)shape, (long long)layerMask);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetDisplacementMaterial(rpr_shape shape, rpr_material_node materialNode)
+{
+	static const auto s_next = (decltype(&rprShapeSetDisplacementMaterial))RprInterposer_Resolve("rprShapeSetDisplacementMaterial");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, materialNode);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(92, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(92, (long long)ret, bytes, "%p\t%p", (const void*)shape, (const void*)materialNode);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetMaterial(rpr_shape shape, rpr_material_node node)
+{
+	static const auto s_next = (decltype(&rprShapeSetMaterial))RprInterposer_Resolve("rprShapeSetMaterial");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, node);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(93, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(93, (long long)ret, bytes, "%p\t%p", (const void*)shape, (const void*)node);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetMaterialFaces(rpr_shape shape, rpr_material_node node, rpr_int const * face_indices, size_t num_faces)
+{
+	static const auto s_next = (decltype(&rprShapeSetMaterialFaces))RprInterposer_Resolve("rprShapeSetMaterialFaces");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, node, face_indices, num_faces);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(94, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(94, (long long)ret, bytes, "%p\t%p\t%p\t%lld", (const void*)shape, (const void*)node, (const void*)face_indices, (long long)num_faces);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetVolumeMaterial(rpr_shape shape, rpr_material_node node)
+{
+	static const auto s_next = (decltype(&rprShapeSetVolumeMaterial))RprInterposer_Resolve("rprShapeSetVolumeMaterial");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, node);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(95, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(95, (long long)ret, bytes, "%p\t%p", (const void*)shape, (const void*)node);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetMotionTransformCount(rpr_shape shape, rpr_uint transformCount)
+{
+	static const auto s_next = (decltype(&rprShapeSetMotionTransformCount))RprInterposer_Resolve("rprShapeSetMotionTransformCount");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, transformCount);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(96, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(96, (long long)ret, bytes, "%p\t%lld", (const void*)shape, (long long)transformCount);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetMotionTransform(rpr_shape shape, rpr_bool transpose, rpr_float const * transform, rpr_uint timeIndex)
+{
+	static const auto s_next = (decltype(&rprShapeSetMotionTransform))RprInterposer_Resolve("rprShapeSetMotionTransform");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, transpose, transform, timeIndex);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(97, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(97, (long long)ret, bytes, "%p\t%lld\t%p\t%lld", (const void*)shape, (long long)transpose, (const void*)transform, (long long)timeIndex);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetVisibilityFlag(rpr_shape shape, rpr_shape_info visibilityFlag, rpr_bool visible)
+{
+	static const auto s_next = (decltype(&rprShapeSetVisibilityFlag))RprInterposer_Resolve("rprShapeSetVisibilityFlag");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, visibilityFlag, visible);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(98, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(98, (long long)ret, bytes, "%p\t%lld\t%lld", (const void*)shape, (long long)visibilityFlag, (long long)visible);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCurveSetVisibilityFlag(rpr_curve curve, rpr_curve_parameter visibilityFlag, rpr_bool visible)
+{
+	static const auto s_next = (decltype(&rprCurveSetVisibilityFlag))RprInterposer_Resolve("rprCurveSetVisibilityFlag");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(curve, visibilityFlag, visible);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(99, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(99, (long long)ret, bytes, "%p\t%lld\t%lld", (const void*)curve, (long long)visibilityFlag, (long long)visible);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetVisibility(rpr_shape shape, rpr_bool visible)
+{
+	static const auto s_next = (decltype(&rprShapeSetVisibility))RprInterposer_Resolve("rprShapeSetVisibility");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, visible);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(100, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(100, (long long)ret, bytes, "%p\t%lld", (const void*)shape, (long long)visible);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprLightSetVisibilityFlag(rpr_light light, rpr_light_info visibilityFlag, rpr_bool visible)
+{
+	static const auto s_next = (decltype(&rprLightSetVisibilityFlag))RprInterposer_Resolve("rprLightSetVisibilityFlag");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, visibilityFlag, visible);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(101, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(101, (long long)ret, bytes, "%p\t%lld\t%lld", (const void*)light, (long long)visibilityFlag, (long long)visible);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCurveSetVisibility(rpr_curve curve, rpr_bool visible)
+{
+	static const auto s_next = (decltype(&rprCurveSetVisibility))RprInterposer_Resolve("rprCurveSetVisibility");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(curve, visible);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(102, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(102, (long long)ret, bytes, "%p\t%lld", (const void*)curve, (long long)visible);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetVisibilityInSpecular(rpr_shape shape, rpr_bool visible)
+{
+	static const auto s_next = (decltype(&rprShapeSetVisibilityInSpecular))RprInterposer_Resolve("rprShapeSetVisibilityInSpecular");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, visible);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(103, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(103, (long long)ret, bytes, "%p\t%lld", (const void*)shape, (long long)visible);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetShadowCatcher(rpr_shape shape, rpr_bool shadowCatcher)
+{
+	static const auto s_next = (decltype(&rprShapeSetShadowCatcher))RprInterposer_Resolve("rprShapeSetShadowCatcher");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, shadowCatcher);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(104, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(104, (long long)ret, bytes, "%p\t%lld", (const void*)shape, (long long)shadowCatcher);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetShadowColor(rpr_shape shape, rpr_float r, rpr_float g, rpr_float b)
+{
+	static const auto s_next = (decltype(&rprShapeSetShadowColor))RprInterposer_Resolve("rprShapeSetShadowColor");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, r, g, b);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(105, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(105, (long long)ret, bytes, "%p\t%.9g\t%.9g\t%.9g", (const void*)shape, (double)r, (double)g, (double)b);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetReflectionCatcher(rpr_shape shape, rpr_bool reflectionCatcher)
+{
+	static const auto s_next = (decltype(&rprShapeSetReflectionCatcher))RprInterposer_Resolve("rprShapeSetReflectionCatcher");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, reflectionCatcher);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(106, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(106, (long long)ret, bytes, "%p\t%lld", (const void*)shape, (long long)reflectionCatcher);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetContourIgnore(rpr_shape shape, rpr_bool ignoreInContour)
+{
+	static const auto s_next = (decltype(&rprShapeSetContourIgnore))RprInterposer_Resolve("rprShapeSetContourIgnore");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, ignoreInContour);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(107, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(107, (long long)ret, bytes, "%p\t%lld", (const void*)shape, (long long)ignoreInContour);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetEnvironmentLight(rpr_shape shape, rpr_bool envLight)
+{
+	static const auto s_next = (decltype(&rprShapeSetEnvironmentLight))RprInterposer_Resolve("rprShapeSetEnvironmentLight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, envLight);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(108, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(108, (long long)ret, bytes, "%p\t%lld", (const void*)shape, (long long)envLight);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeMarkStatic(rpr_shape in_shape, rpr_bool in_is_static)
+{
+	static const auto s_next = (decltype(&rprShapeMarkStatic))RprInterposer_Resolve("rprShapeMarkStatic");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_shape, in_is_static);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(109, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(109, (long long)ret, bytes, "%p\t%lld", (const void*)in_shape, (long long)in_is_static);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprLightSetTransform(rpr_light light, rpr_bool transpose, rpr_float const * transform)
+{
+	static const auto s_next = (decltype(&rprLightSetTransform))RprInterposer_Resolve("rprLightSetTransform");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, transpose, transform);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(110, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(110, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)light, (long long)transpose, (const void*)transform);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprLightSetGroupId(rpr_light light, rpr_uint groupId)
+{
+	static const auto s_next = (decltype(&rprLightSetGroupId))RprInterposer_Resolve("rprLightSetGroupId");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, groupId);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(111, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(111, (long long)ret, bytes, "%p\t%lld", (const void*)light, (long long)groupId);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeGetInfo(rpr_shape arg0, rpr_shape_info arg1, size_t arg2, void * arg3, size_t * arg4)
+{
+	static const auto s_next = (decltype(&rprShapeGetInfo))RprInterposer_Resolve("rprShapeGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(arg0, arg1, arg2, arg3, arg4);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(112, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(112, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)arg0, (long long)arg1, (long long)arg2, (const void*)arg3, (const void*)arg4);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprMeshGetInfo(rpr_shape mesh, rpr_mesh_info mesh_info, size_t size, void * data, size_t * size_ret)
+{
+	static const auto s_next = (decltype(&rprMeshGetInfo))RprInterposer_Resolve("rprMeshGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(mesh, mesh_info, size, data, size_ret);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(113, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(113, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)mesh, (long long)mesh_info, (long long)size, (const void*)data, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCurveGetInfo(rpr_curve curve, rpr_curve_parameter curve_info, size_t size, void * data, size_t * size_ret)
+{
+	static const auto s_next = (decltype(&rprCurveGetInfo))RprInterposer_Resolve("rprCurveGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(curve, curve_info, size, data, size_ret);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(114, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(114, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)curve, (long long)curve_info, (long long)size, (const void*)data, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprHeteroVolumeGetInfo(rpr_hetero_volume heteroVol, rpr_hetero_volume_parameter heteroVol_info, size_t size, void * data, size_t * size_ret)
+{
+	static const auto s_next = (decltype(&rprHeteroVolumeGetInfo))RprInterposer_Resolve("rprHeteroVolumeGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(heteroVol, heteroVol_info, size, data, size_ret);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(115, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(115, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)heteroVol, (long long)heteroVol_info, (long long)size, (const void*)data, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprGridGetInfo(rpr_grid grid, rpr_grid_parameter grid_info, size_t size, void * data, size_t * size_ret)
+{
+	static const auto s_next = (decltype(&rprGridGetInfo))RprInterposer_Resolve("rprGridGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(grid, grid_info, size, data, size_ret);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(116, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(116, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)grid, (long long)grid_info, (long long)size, (const void*)data, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprBufferGetInfo(rpr_buffer buffer, rpr_buffer_info buffer_info, size_t size, void * data, size_t * size_ret)
+{
+	static const auto s_next = (decltype(&rprBufferGetInfo))RprInterposer_Resolve("rprBufferGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(buffer, buffer_info, size, data, size_ret);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(117, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(117, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)buffer, (long long)buffer_info, (long long)size, (const void*)data, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprInstanceGetBaseShape(rpr_shape shape, rpr_shape * out_shape)
+{
+	static const auto s_next = (decltype(&rprInstanceGetBaseShape))RprInterposer_Resolve("rprInstanceGetBaseShape");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, out_shape);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(118, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(118, (long long)ret, bytes, "%p\t%p", (const void*)shape, out_shape ? (const void*)*out_shape : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreatePointLight(rpr_context context, rpr_light * out_light)
+{
+	static const auto s_next = (decltype(&rprContextCreatePointLight))RprInterposer_Resolve("rprContextCreatePointLight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, out_light);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(119, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(119, (long long)ret, bytes, "%p\t%p", (const void*)context, out_light ? (const void*)*out_light : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprPointLightSetRadiantPower3f(rpr_light light, rpr_float r, rpr_float g, rpr_float b)
+{
+	static const auto s_next = (decltype(&rprPointLightSetRadiantPower3f))RprInterposer_Resolve("rprPointLightSetRadiantPower3f");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, r, g, b);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(120, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(120, (long long)ret, bytes, "%p\t%.9g\t%.9g\t%.9g", (const void*)light, (double)r, (double)g, (double)b);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateSpotLight(rpr_context context, rpr_light * light)
+{
+	static const auto s_next = (decltype(&rprContextCreateSpotLight))RprInterposer_Resolve("rprContextCreateSpotLight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, light);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(121, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(121, (long long)ret, bytes, "%p\t%p", (const void*)context, light ? (const void*)*light : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateSphereLight(rpr_context context, rpr_light * light)
+{
+	static const auto s_next = (decltype(&rprContextCreateSphereLight))RprInterposer_Resolve("rprContextCreateSphereLight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, light);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(122, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(122, (long long)ret, bytes, "%p\t%p", (const void*)context, light ? (const void*)*light : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateDiskLight(rpr_context context, rpr_light * light)
+{
+	static const auto s_next = (decltype(&rprContextCreateDiskLight))RprInterposer_Resolve("rprContextCreateDiskLight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, light);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(123, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(123, (long long)ret, bytes, "%p\t%p", (const void*)context, light ? (const void*)*light : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSpotLightSetRadiantPower3f(rpr_light light, rpr_float r, rpr_float g, rpr_float b)
+{
+	static const auto s_next = (decltype(&rprSpotLightSetRadiantPower3f))RprInterposer_Resolve("rprSpotLightSetRadiantPower3f");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, r, g, b);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(124, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(124, (long long)ret, bytes, "%p\t%.9g\t%.9g\t%.9g", (const void*)light, (double)r, (double)g, (double)b);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSpotLightSetImage(rpr_light light, rpr_image img)
+{
+	static const auto s_next = (decltype(&rprSpotLightSetImage))RprInterposer_Resolve("rprSpotLightSetImage");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, img);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(125, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(125, (long long)ret, bytes, "%p\t%p", (const void*)light, (const void*)img);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSphereLightSetRadiantPower3f(rpr_light light, rpr_float r, rpr_float g, rpr_float b)
+{
+	static const auto s_next = (decltype(&rprSphereLightSetRadiantPower3f))RprInterposer_Resolve("rprSphereLightSetRadiantPower3f");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, r, g, b);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(126, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(126, (long long)ret, bytes, "%p\t%.9g\t%.9g\t%.9g", (const void*)light, (double)r, (double)g, (double)b);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSphereLightSetRadius(rpr_light light, rpr_float radius)
+{
+	static const auto s_next = (decltype(&rprSphereLightSetRadius))RprInterposer_Resolve("rprSphereLightSetRadius");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, radius);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(127, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(127, (long long)ret, bytes, "%p\t%.9g", (const void*)light, (double)radius);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprDiskLightSetRadiantPower3f(rpr_light light, rpr_float r, rpr_float g, rpr_float b)
+{
+	static const auto s_next = (decltype(&rprDiskLightSetRadiantPower3f))RprInterposer_Resolve("rprDiskLightSetRadiantPower3f");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, r, g, b);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(128, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(128, (long long)ret, bytes, "%p\t%.9g\t%.9g\t%.9g", (const void*)light, (double)r, (double)g, (double)b);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprDiskLightSetRadius(rpr_light light, rpr_float radius)
+{
+	static const auto s_next = (decltype(&rprDiskLightSetRadius))RprInterposer_Resolve("rprDiskLightSetRadius");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, radius);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(129, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(129, (long long)ret, bytes, "%p\t%.9g", (const void*)light, (double)radius);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprDiskLightSetAngle(rpr_light light, rpr_float angle)
+{
+	static const auto s_next = (decltype(&rprDiskLightSetAngle))RprInterposer_Resolve("rprDiskLightSetAngle");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, angle);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(130, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(130, (long long)ret, bytes, "%p\t%.9g", (const void*)light, (double)angle);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprDiskLightSetInnerAngle(rpr_light light, rpr_float innerAngle)
+{
+	static const auto s_next = (decltype(&rprDiskLightSetInnerAngle))RprInterposer_Resolve("rprDiskLightSetInnerAngle");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, innerAngle);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(131, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(131, (long long)ret, bytes, "%p\t%.9g", (const void*)light, (double)innerAngle);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSpotLightSetConeShape(rpr_light light, rpr_float iangle, rpr_float oangle)
+{
+	static const auto s_next = (decltype(&rprSpotLightSetConeShape))RprInterposer_Resolve("rprSpotLightSetConeShape");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, iangle, oangle);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(132, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(132, (long long)ret, bytes, "%p\t%.9g\t%.9g", (const void*)light, (double)iangle, (double)oangle);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateDirectionalLight(rpr_context context, rpr_light * out_light)
+{
+	static const auto s_next = (decltype(&rprContextCreateDirectionalLight))RprInterposer_Resolve("rprContextCreateDirectionalLight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, out_light);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(133, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(133, (long long)ret, bytes, "%p\t%p", (const void*)context, out_light ? (const void*)*out_light : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprDirectionalLightSetRadiantPower3f(rpr_light light, rpr_float r, rpr_float g, rpr_float b)
+{
+	static const auto s_next = (decltype(&rprDirectionalLightSetRadiantPower3f))RprInterposer_Resolve("rprDirectionalLightSetRadiantPower3f");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, r, g, b);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(134, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(134, (long long)ret, bytes, "%p\t%.9g\t%.9g\t%.9g", (const void*)light, (double)r, (double)g, (double)b);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprDirectionalLightSetShadowSoftnessAngle(rpr_light light, rpr_float softnessAngle)
+{
+	static const auto s_next = (decltype(&rprDirectionalLightSetShadowSoftnessAngle))RprInterposer_Resolve("rprDirectionalLightSetShadowSoftnessAngle");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, softnessAngle);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(135, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(135, (long long)ret, bytes, "%p\t%.9g", (const void*)light, (double)softnessAngle);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateEnvironmentLight(rpr_context context, rpr_light * out_light)
+{
+	static const auto s_next = (decltype(&rprContextCreateEnvironmentLight))RprInterposer_Resolve("rprContextCreateEnvironmentLight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, out_light);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(136, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(136, (long long)ret, bytes, "%p\t%p", (const void*)context, out_light ? (const void*)*out_light : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprEnvironmentLightSetImage(rpr_light env_light, rpr_image image)
+{
+	static const auto s_next = (decltype(&rprEnvironmentLightSetImage))RprInterposer_Resolve("rprEnvironmentLightSetImage");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(env_light, image);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(137, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(137, (long long)ret, bytes, "%p\t%p", (const void*)env_light, (const void*)image);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprEnvironmentLightSetIntensityScale(rpr_light env_light, rpr_float intensity_scale)
+{
+	static const auto s_next = (decltype(&rprEnvironmentLightSetIntensityScale))RprInterposer_Resolve("rprEnvironmentLightSetIntensityScale");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(env_light, intensity_scale);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(138, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(138, (long long)ret, bytes, "%p\t%.9g", (const void*)env_light, (double)intensity_scale);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprEnvironmentLightAttachPortal(rpr_scene scene, rpr_light env_light, rpr_shape portal)
+{
+	static const auto s_next = (decltype(&rprEnvironmentLightAttachPortal))RprInterposer_Resolve("rprEnvironmentLightAttachPortal");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, env_light, portal);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(139, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(139, (long long)ret, bytes, "%p\t%p\t%p", (const void*)scene, (const void*)env_light, (const void*)portal);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprEnvironmentLightDetachPortal(rpr_scene scene, rpr_light env_light, rpr_shape portal)
+{
+	static const auto s_next = (decltype(&rprEnvironmentLightDetachPortal))RprInterposer_Resolve("rprEnvironmentLightDetachPortal");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, env_light, portal);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(140, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(140, (long long)ret, bytes, "%p\t%p\t%p", (const void*)scene, (const void*)env_light, (const void*)portal);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprEnvironmentLightSetEnvironmentLightOverride(rpr_light in_ibl, rpr_environment_override overrideType, rpr_light in_iblOverride)
+{
+	static const auto s_next = (decltype(&rprEnvironmentLightSetEnvironmentLightOverride))RprInterposer_Resolve("rprEnvironmentLightSetEnvironmentLightOverride");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_ibl, overrideType, in_iblOverride);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(141, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(141, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)in_ibl, (long long)overrideType, (const void*)in_iblOverride);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprEnvironmentLightGetEnvironmentLightOverride(rpr_light in_ibl, rpr_environment_override overrideType, rpr_light* out_iblOverride)
+{
+	static const auto s_next = (decltype(&rprEnvironmentLightGetEnvironmentLightOverride))RprInterposer_Resolve("rprEnvironmentLightGetEnvironmentLightOverride");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_ibl, overrideType, out_iblOverride);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(142, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(142, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)in_ibl, (long long)overrideType, out_iblOverride ? (const void*)*out_iblOverride : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateSkyLight(rpr_context context, rpr_light * out_light)
+{
+	static const auto s_next = (decltype(&rprContextCreateSkyLight))RprInterposer_Resolve("rprContextCreateSkyLight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, out_light);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(143, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(143, (long long)ret, bytes, "%p\t%p", (const void*)context, out_light ? (const void*)*out_light : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSkyLightSetTurbidity(rpr_light skylight, rpr_float turbidity)
+{
+	static const auto s_next = (decltype(&rprSkyLightSetTurbidity))RprInterposer_Resolve("rprSkyLightSetTurbidity");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(skylight, turbidity);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(144, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(144, (long long)ret, bytes, "%p\t%.9g", (const void*)skylight, (double)turbidity);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSkyLightSetAlbedo(rpr_light skylight, rpr_float albedo)
+{
+	static const auto s_next = (decltype(&rprSkyLightSetAlbedo))RprInterposer_Resolve("rprSkyLightSetAlbedo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(skylight, albedo);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(145, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(145, (long long)ret, bytes, "%p\t%.9g", (const void*)skylight, (double)albedo);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSkyLightSetScale(rpr_light skylight, rpr_float scale)
+{
+	static const auto s_next = (decltype(&rprSkyLightSetScale))RprInterposer_Resolve("rprSkyLightSetScale");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(skylight, scale);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(146, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(146, (long long)ret, bytes, "%p\t%.9g", (const void*)skylight, (double)scale);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSkyLightSetDirection(rpr_light skylight, rpr_float x, rpr_float y, rpr_float z)
+{
+	static const auto s_next = (decltype(&rprSkyLightSetDirection))RprInterposer_Resolve("rprSkyLightSetDirection");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(skylight, x, y, z);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(147, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(147, (long long)ret, bytes, "%p\t%.9g\t%.9g\t%.9g", (const void*)skylight, (double)x, (double)y, (double)z);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSkyLightAttachPortal(rpr_scene scene, rpr_light skylight, rpr_shape portal)
+{
+	static const auto s_next = (decltype(&rprSkyLightAttachPortal))RprInterposer_Resolve("rprSkyLightAttachPortal");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, skylight, portal);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(148, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(148, (long long)ret, bytes, "%p\t%p\t%p", (const void*)scene, (const void*)skylight, (const void*)portal);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSkyLightDetachPortal(rpr_scene scene, rpr_light skylight, rpr_shape portal)
+{
+	static const auto s_next = (decltype(&rprSkyLightDetachPortal))RprInterposer_Resolve("rprSkyLightDetachPortal");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, skylight, portal);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(149, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(149, (long long)ret, bytes, "%p\t%p\t%p", (const void*)scene, (const void*)skylight, (const void*)portal);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateIESLight(rpr_context context, rpr_light * light)
+{
+	static const auto s_next = (decltype(&rprContextCreateIESLight))RprInterposer_Resolve("rprContextCreateIESLight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, light);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(150, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(150, (long long)ret, bytes, "%p\t%p", (const void*)context, light ? (const void*)*light : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprIESLightSetRadiantPower3f(rpr_light light, rpr_float r, rpr_float g, rpr_float b)
+{
+	static const auto s_next = (decltype(&rprIESLightSetRadiantPower3f))RprInterposer_Resolve("rprIESLightSetRadiantPower3f");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, r, g, b);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(151, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(151, (long long)ret, bytes, "%p\t%.9g\t%.9g\t%.9g", (const void*)light, (double)r, (double)g, (double)b);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprIESLightSetImageFromFile(rpr_light env_light, rpr_char const * imagePath, rpr_int nx, rpr_int ny)
+{
+	static const auto s_next = (decltype(&rprIESLightSetImageFromFile))RprInterposer_Resolve("rprIESLightSetImageFromFile");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(env_light, imagePath, nx, ny);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(152, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(152, (long long)ret, bytes, "%p\t%p\t%lld\t%lld", (const void*)env_light, (const void*)imagePath, (long long)nx, (long long)ny);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprIESLightSetImageFromIESdata(rpr_light env_light, rpr_char const * iesData, rpr_int nx, rpr_int ny)
+{
+	static const auto s_next = (decltype(&rprIESLightSetImageFromIESdata))RprInterposer_Resolve("rprIESLightSetImageFromIESdata");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(env_light, iesData, nx, ny);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(153, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(153, (long long)ret, bytes, "%p\t%p\t%lld\t%lld", (const void*)env_light, (const void*)iesData, (long long)nx, (long long)ny);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprLightGetInfo(rpr_light light, rpr_light_info info, size_t size, void * data, size_t * size_ret)
+{
+	static const auto s_next = (decltype(&rprLightGetInfo))RprInterposer_Resolve("rprLightGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(light, info, size, data, size_ret);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(154, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(154, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)light, (long long)info, (long long)size, (const void*)data, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneClear(rpr_scene scene)
+{
+	static const auto s_next = (decltype(&rprSceneClear))RprInterposer_Resolve("rprSceneClear");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(155, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(155, (long long)ret, bytes, "%p", (const void*)scene);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneAttachShape(rpr_scene scene, rpr_shape shape)
+{
+	static const auto s_next = (decltype(&rprSceneAttachShape))RprInterposer_Resolve("rprSceneAttachShape");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, shape);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(156, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(156, (long long)ret, bytes, "%p\t%p", (const void*)scene, (const void*)shape);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneDetachShape(rpr_scene scene, rpr_shape shape)
+{
+	static const auto s_next = (decltype(&rprSceneDetachShape))RprInterposer_Resolve("rprSceneDetachShape");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, shape);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(157, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(157, (long long)ret, bytes, "%p\t%p", (const void*)scene, (const void*)shape);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneAttachHeteroVolume(rpr_scene scene, rpr_hetero_volume heteroVolume)
+{
+	static const auto s_next = (decltype(&rprSceneAttachHeteroVolume))RprInterposer_Resolve("rprSceneAttachHeteroVolume");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, heteroVolume);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(158, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(158, (long long)ret, bytes, "%p\t%p", (const void*)scene, (const void*)heteroVolume);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneDetachHeteroVolume(rpr_scene scene, rpr_hetero_volume heteroVolume)
+{
+	static const auto s_next = (decltype(&rprSceneDetachHeteroVolume))RprInterposer_Resolve("rprSceneDetachHeteroVolume");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, heteroVolume);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(159, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(159, (long long)ret, bytes, "%p\t%p", (const void*)scene, (const void*)heteroVolume);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneAttachCurve(rpr_scene scene, rpr_curve curve)
+{
+	static const auto s_next = (decltype(&rprSceneAttachCurve))RprInterposer_Resolve("rprSceneAttachCurve");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, curve);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(160, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(160, (long long)ret, bytes, "%p\t%p", (const void*)scene, (const void*)curve);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneDetachCurve(rpr_scene scene, rpr_curve curve)
+{
+	static const auto s_next = (decltype(&rprSceneDetachCurve))RprInterposer_Resolve("rprSceneDetachCurve");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, curve);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(161, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(161, (long long)ret, bytes, "%p\t%p", (const void*)scene, (const void*)curve);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCurveSetMaterial(rpr_curve curve, rpr_material_node material)
+{
+	static const auto s_next = (decltype(&rprCurveSetMaterial))RprInterposer_Resolve("rprCurveSetMaterial");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(curve, material);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(162, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(162, (long long)ret, bytes, "%p\t%p", (const void*)curve, (const void*)material);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCurveSetTransform(rpr_curve curve, rpr_bool transpose, rpr_float const * transform)
+{
+	static const auto s_next = (decltype(&rprCurveSetTransform))RprInterposer_Resolve("rprCurveSetTransform");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(curve, transpose, transform);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(163, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(163, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)curve, (long long)transpose, (const void*)transform);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateCurve(rpr_context context, rpr_curve * out_curve, size_t num_controlPoints, rpr_float const * controlPointsData, rpr_int controlPointsStride, size_t num_indices, rpr_uint curveCount, rpr_uint const * indicesData, rpr_float const * radius, rpr_float const * textureUV, rpr_int const * segmentPerCurve, rpr_uint creationFlag_tapered)
+{
+	static const auto s_next = (decltype(&rprContextCreateCurve))RprInterposer_Resolve("rprContextCreateCurve");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, out_curve, num_controlPoints, controlPointsData, controlPointsStride, num_indices, curveCount, indicesData, radius, textureUV, segmentPerCurve, creationFlag_tapered);
+	const uint64_t bytes = (uint64_t)num_controlPoints * controlPointsStride + (uint64_t)num_indices * sizeof(rpr_uint);
+	RprInterposer_Record(164, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(164, (long long)ret, bytes, "%p\t%p\t%lld\t%p\t%lld\t%lld\t%lld\t%p\t%p\t%p\t%p\t%lld", (const void*)context, out_curve ? (const void*)*out_curve : nullptr, (long long)num_controlPoints, (const void*)controlPointsData, (long long)controlPointsStride, (long long)num_indices, (long long)curveCount, (const void*)indicesData, (const void*)radius, (const void*)textureUV, (const void*)segmentPerCurve, (long long)creationFlag_tapered);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneAttachLight(rpr_scene scene, rpr_light light)
+{
+	static const auto s_next = (decltype(&rprSceneAttachLight))RprInterposer_Resolve("rprSceneAttachLight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, light);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(165, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(165, (long long)ret, bytes, "%p\t%p", (const void*)scene, (const void*)light);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneDetachLight(rpr_scene scene, rpr_light light)
+{
+	static const auto s_next = (decltype(&rprSceneDetachLight))RprInterposer_Resolve("rprSceneDetachLight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, light);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(166, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(166, (long long)ret, bytes, "%p\t%p", (const void*)scene, (const void*)light);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneSetEnvironmentLight(rpr_scene in_scene, rpr_light in_light)
+{
+	static const auto s_next = (decltype(&rprSceneSetEnvironmentLight))RprInterposer_Resolve("rprSceneSetEnvironmentLight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_scene, in_light);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(167, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(167, (long long)ret, bytes, "%p\t%p", (const void*)in_scene, (const void*)in_light);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneGetEnvironmentLight(rpr_scene in_scene, rpr_light* out_light)
+{
+	static const auto s_next = (decltype(&rprSceneGetEnvironmentLight))RprInterposer_Resolve("rprSceneGetEnvironmentLight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_scene, out_light);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(168, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(168, (long long)ret, bytes, "%p\t%p", (const void*)in_scene, out_light ? (const void*)*out_light : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneGetInfo(rpr_scene scene, rpr_scene_info info, size_t size, void * data, size_t * size_ret)
+{
+	static const auto s_next = (decltype(&rprSceneGetInfo))RprInterposer_Resolve("rprSceneGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, info, size, data, size_ret);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(169, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(169, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)scene, (long long)info, (long long)size, (const void*)data, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneSetBackgroundImage(rpr_scene scene, rpr_image image)
+{
+	static const auto s_next = (decltype(&rprSceneSetBackgroundImage))RprInterposer_Resolve("rprSceneSetBackgroundImage");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, image);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(170, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(170, (long long)ret, bytes, "%p\t%p", (const void*)scene, (const void*)image);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneGetBackgroundImage(rpr_scene scene, rpr_image * out_image)
+{
+	static const auto s_next = (decltype(&rprSceneGetBackgroundImage))RprInterposer_Resolve("rprSceneGetBackgroundImage");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, out_image);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(171, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(171, (long long)ret, bytes, "%p\t%p", (const void*)scene, out_image ? (const void*)*out_image : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneSetCameraRight(rpr_scene scene, rpr_camera camera)
+{
+	static const auto s_next = (decltype(&rprSceneSetCameraRight))RprInterposer_Resolve("rprSceneSetCameraRight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, camera);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(172, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(172, (long long)ret, bytes, "%p\t%p", (const void*)scene, (const void*)camera);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneGetCameraRight(rpr_scene scene, rpr_camera * out_camera)
+{
+	static const auto s_next = (decltype(&rprSceneGetCameraRight))RprInterposer_Resolve("rprSceneGetCameraRight");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, out_camera);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(173, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(173, (long long)ret, bytes, "%p\t%p", (const void*)scene, out_camera ? (const void*)*out_camera : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneSetCamera(rpr_scene scene, rpr_camera camera)
+{
+	static const auto s_next = (decltype(&rprSceneSetCamera))RprInterposer_Resolve("rprSceneSetCamera");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, camera);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(174, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(174, (long long)ret, bytes, "%p\t%p", (const void*)scene, (const void*)camera);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprSceneGetCamera(rpr_scene scene, rpr_camera * out_camera)
+{
+	static const auto s_next = (decltype(&rprSceneGetCamera))RprInterposer_Resolve("rprSceneGetCamera");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(scene, out_camera);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(175, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(175, (long long)ret, bytes, "%p\t%p", (const void*)scene, out_camera ? (const void*)*out_camera : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprFrameBufferGetInfo(rpr_framebuffer framebuffer, rpr_framebuffer_info info, size_t size, void * data, size_t * size_ret)
+{
+	static const auto s_next = (decltype(&rprFrameBufferGetInfo))RprInterposer_Resolve("rprFrameBufferGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(framebuffer, info, size, data, size_ret);
+	const uint64_t bytes = data ? size : 0;
+	RprInterposer_Record(176, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(176, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)framebuffer, (long long)info, (long long)size, (const void*)data, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprFrameBufferClear(rpr_framebuffer frame_buffer)
+{
+	static const auto s_next = (decltype(&rprFrameBufferClear))RprInterposer_Resolve("rprFrameBufferClear");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(frame_buffer);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(177, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(177, (long long)ret, bytes, "%p", (const void*)frame_buffer);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprFrameBufferFillWithColor(rpr_framebuffer frame_buffer, rpr_float r, rpr_float g, rpr_float b, rpr_float a)
+{
+	static const auto s_next = (decltype(&rprFrameBufferFillWithColor))RprInterposer_Resolve("rprFrameBufferFillWithColor");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(frame_buffer, r, g, b, a);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(178, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(178, (long long)ret, bytes, "%p\t%.9g\t%.9g\t%.9g\t%.9g", (const void*)frame_buffer, (double)r, (double)g, (double)b, (double)a);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprFrameBufferSaveToFile(rpr_framebuffer frame_buffer, rpr_char const * file_path)
+{
+	static const auto s_next = (decltype(&rprFrameBufferSaveToFile))RprInterposer_Resolve("rprFrameBufferSaveToFile");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(frame_buffer, file_path);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(179, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(179, (long long)ret, bytes, "%p\t%p", (const void*)frame_buffer, (const void*)file_path);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprFrameBufferSaveToFileEx(rpr_framebuffer * framebufferList, rpr_uint framebufferCount, rpr_char const * filePath, void const * extraOptions)
+{
+	static const auto s_next = (decltype(&rprFrameBufferSaveToFileEx))RprInterposer_Resolve("rprFrameBufferSaveToFileEx");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(framebufferList, framebufferCount, filePath, extraOptions);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(180, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(180, (long long)ret, bytes, "%p\t%lld\t%p\t%p", (const void*)framebufferList, (long long)framebufferCount, (const void*)filePath, (const void*)extraOptions);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextResolveFrameBuffer(rpr_context context, rpr_framebuffer src_frame_buffer, rpr_framebuffer dst_frame_buffer, rpr_bool noDisplayGamma)
+{
+	static const auto s_next = (decltype(&rprContextResolveFrameBuffer))RprInterposer_Resolve("rprContextResolveFrameBuffer");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, src_frame_buffer, dst_frame_buffer, noDisplayGamma);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(181, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(181, (long long)ret, bytes, "%p\t%p\t%p\t%lld", (const void*)context, (const void*)src_frame_buffer, (const void*)dst_frame_buffer, (long long)noDisplayGamma);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprMaterialSystemGetInfo(rpr_material_system in_material_system, rpr_material_system_info type, size_t in_size, void * in_data, size_t * out_size)
+{
+	static const auto s_next = (decltype(&rprMaterialSystemGetInfo))RprInterposer_Resolve("rprMaterialSystemGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_material_system, type, in_size, in_data, out_size);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(182, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(182, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)in_material_system, (long long)type, (long long)in_size, (const void*)in_data, (const void*)out_size);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateMaterialSystem(rpr_context in_context, rpr_material_system_type type, rpr_material_system * out_matsys)
+{
+	static const auto s_next = (decltype(&rprContextCreateMaterialSystem))RprInterposer_Resolve("rprContextCreateMaterialSystem");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_context, type, out_matsys);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(183, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(183, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)in_context, (long long)type, out_matsys ? (const void*)*out_matsys : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprMaterialSystemGetSize(rpr_context in_context, rpr_uint * out_size)
+{
+	static const auto s_next = (decltype(&rprMaterialSystemGetSize))RprInterposer_Resolve("rprMaterialSystemGetSize");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_context, out_size);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(184, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(184, (long long)ret, bytes, "%p\t%p", (const void*)in_context, (const void*)out_size);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprMaterialSystemCreateNode(rpr_material_system in_matsys, rpr_material_node_type in_type, rpr_material_node * out_node)
+{
+	static const auto s_next = (decltype(&rprMaterialSystemCreateNode))RprInterposer_Resolve("rprMaterialSystemCreateNode");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_matsys, in_type, out_node);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(185, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(185, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)in_matsys, (long long)in_type, out_node ? (const void*)*out_node : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprMaterialNodeSetID(rpr_material_node in_node, rpr_uint id)
+{
+	static const auto s_next = (decltype(&rprMaterialNodeSetID))RprInterposer_Resolve("rprMaterialNodeSetID");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_node, id);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(186, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(186, (long long)ret, bytes, "%p\t%lld", (const void*)in_node, (long long)id);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprMaterialNodeSetInputNByKey(rpr_material_node in_node, rpr_material_node_input in_input, rpr_material_node in_input_node)
+{
+	static const auto s_next = (decltype(&rprMaterialNodeSetInputNByKey))RprInterposer_Resolve("rprMaterialNodeSetInputNByKey");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_node, in_input, in_input_node);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(187, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(187, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)in_node, (long long)in_input, (const void*)in_input_node);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprMaterialNodeSetInputFByKey(rpr_material_node in_node, rpr_material_node_input in_input, rpr_float in_value_x, rpr_float in_value_y, rpr_float in_value_z, rpr_float in_value_w)
+{
+	static const auto s_next = (decltype(&rprMaterialNodeSetInputFByKey))RprInterposer_Resolve("rprMaterialNodeSetInputFByKey");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_node, in_input, in_value_x, in_value_y, in_value_z, in_value_w);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(188, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(188, (long long)ret, bytes, "%p\t%lld\t%.9g\t%.9g\t%.9g\t%.9g", (const void*)in_node, (long long)in_input, (double)in_value_x, (double)in_value_y, (double)in_value_z, (double)in_value_w);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprMaterialNodeSetInputDataByKey(rpr_material_node in_node, rpr_material_node_input in_input, void const * data, size_t dataSizeByte)
+{
+	static const auto s_next = (decltype(&rprMaterialNodeSetInputDataByKey))RprInterposer_Resolve("rprMaterialNodeSetInputDataByKey");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_node, in_input, data, dataSizeByte);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(189, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(189, (long long)ret, bytes, "%p\t%lld\t%p\t%lld", (const void*)in_node, (long long)in_input, (const void*)data, (long long)dataSizeByte);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprMaterialNodeSetInputUByKey(rpr_material_node in_node, rpr_material_node_input in_input, rpr_uint in_value)
+{
+	static const auto s_next = (decltype(&rprMaterialNodeSetInputUByKey))RprInterposer_Resolve("rprMaterialNodeSetInputUByKey");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_node, in_input, in_value);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(190, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(190, (long long)ret, bytes, "%p\t%lld\t%lld", (const void*)in_node, (long long)in_input, (long long)in_value);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprMaterialNodeSetInputImageDataByKey(rpr_material_node in_node, rpr_material_node_input in_input, rpr_image image)
+{
+	static const auto s_next = (decltype(&rprMaterialNodeSetInputImageDataByKey))RprInterposer_Resolve("rprMaterialNodeSetInputImageDataByKey");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_node, in_input, image);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(191, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(191, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)in_node, (long long)in_input, (const void*)image);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprMaterialNodeSetInputLightDataByKey(rpr_material_node in_node, rpr_material_node_input in_input, rpr_light light)
+{
+	static const auto s_next = (decltype(&rprMaterialNodeSetInputLightDataByKey))RprInterposer_Resolve("rprMaterialNodeSetInputLightDataByKey");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_node, in_input, light);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(192, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(192, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)in_node, (long long)in_input, (const void*)light);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprMaterialNodeSetInputBufferDataByKey(rpr_material_node in_node, rpr_material_node_input in_input, rpr_buffer buffer)
+{
+	static const auto s_next = (decltype(&rprMaterialNodeSetInputBufferDataByKey))RprInterposer_Resolve("rprMaterialNodeSetInputBufferDataByKey");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_node, in_input, buffer);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(193, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(193, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)in_node, (long long)in_input, (const void*)buffer);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprMaterialNodeSetInputGridDataByKey(rpr_material_node in_node, rpr_material_node_input in_input, rpr_grid grid)
+{
+	static const auto s_next = (decltype(&rprMaterialNodeSetInputGridDataByKey))RprInterposer_Resolve("rprMaterialNodeSetInputGridDataByKey");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_node, in_input, grid);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(194, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(194, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)in_node, (long long)in_input, (const void*)grid);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprMaterialNodeGetInfo(rpr_material_node in_node, rpr_material_node_info in_info, size_t in_size, void * in_data, size_t * out_size)
+{
+	static const auto s_next = (decltype(&rprMaterialNodeGetInfo))RprInterposer_Resolve("rprMaterialNodeGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_node, in_info, in_size, in_data, out_size);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(195, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(195, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)in_node, (long long)in_info, (long long)in_size, (const void*)in_data, (const void*)out_size);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprMaterialNodeGetInputInfo(rpr_material_node in_node, rpr_int in_input_idx, rpr_material_node_input_info in_info, size_t in_size, void * in_data, size_t * out_size)
+{
+	static const auto s_next = (decltype(&rprMaterialNodeGetInputInfo))RprInterposer_Resolve("rprMaterialNodeGetInputInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(in_node, in_input_idx, in_info, in_size, in_data, out_size);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(196, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(196, (long long)ret, bytes, "%p\t%lld\t%lld\t%lld\t%p\t%p", (const void*)in_node, (long long)in_input_idx, (long long)in_info, (long long)in_size, (const void*)in_data, (const void*)out_size);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateComposite(rpr_context context, rpr_composite_type in_type, rpr_composite * out_composite)
+{
+	static const auto s_next = (decltype(&rprContextCreateComposite))RprInterposer_Resolve("rprContextCreateComposite");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, in_type, out_composite);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(197, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(197, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)context, (long long)in_type, out_composite ? (const void*)*out_composite : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateLUTFromFile(rpr_context context, const rpr_char * fileLutPath, rpr_lut * out_lut)
+{
+	static const auto s_next = (decltype(&rprContextCreateLUTFromFile))RprInterposer_Resolve("rprContextCreateLUTFromFile");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, fileLutPath, out_lut);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(198, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(198, (long long)ret, bytes, "%p\t%p\t%p", (const void*)context, (const void*)fileLutPath, out_lut ? (const void*)*out_lut : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateLUTFromData(rpr_context context, const rpr_char * lutData, rpr_lut * out_lut)
+{
+	static const auto s_next = (decltype(&rprContextCreateLUTFromData))RprInterposer_Resolve("rprContextCreateLUTFromData");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, lutData, out_lut);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(199, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(199, (long long)ret, bytes, "%p\t%p\t%p", (const void*)context, (const void*)lutData, out_lut ? (const void*)*out_lut : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCompositeSetInputFb(rpr_composite composite, const rpr_char * inputName, rpr_framebuffer input)
+{
+	static const auto s_next = (decltype(&rprCompositeSetInputFb))RprInterposer_Resolve("rprCompositeSetInputFb");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(composite, inputName, input);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(200, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(200, (long long)ret, bytes, "%p\t%p\t%p", (const void*)composite, (const void*)inputName, (const void*)input);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCompositeSetInputC(rpr_composite composite, const rpr_char * inputName, rpr_composite input)
+{
+	static const auto s_next = (decltype(&rprCompositeSetInputC))RprInterposer_Resolve("rprCompositeSetInputC");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(composite, inputName, input);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(201, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(201, (long long)ret, bytes, "%p\t%p\t%p", (const void*)composite, (const void*)inputName, (const void*)input);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCompositeSetInputLUT(rpr_composite composite, const rpr_char * inputName, rpr_lut input)
+{
+	static const auto s_next = (decltype(&rprCompositeSetInputLUT))RprInterposer_Resolve("rprCompositeSetInputLUT");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(composite, inputName, input);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(202, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(202, (long long)ret, bytes, "%p\t%p\t%p", (const void*)composite, (const void*)inputName, (const void*)input);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCompositeSetInput4f(rpr_composite composite, const rpr_char * inputName, float x, float y, float z, float w)
+{
+	static const auto s_next = (decltype(&rprCompositeSetInput4f))RprInterposer_Resolve("rprCompositeSetInput4f");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(composite, inputName, x, y, z, w);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(203, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(203, (long long)ret, bytes, "%p\t%p\t%.9g\t%.9g\t%.9g\t%.9g", (const void*)composite, (const void*)inputName, (double)x, (double)y, (double)z, (double)w);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCompositeSetInput1u(rpr_composite composite, const rpr_char * inputName, rpr_uint value)
+{
+	static const auto s_next = (decltype(&rprCompositeSetInput1u))RprInterposer_Resolve("rprCompositeSetInput1u");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(composite, inputName, value);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(204, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(204, (long long)ret, bytes, "%p\t%p\t%lld", (const void*)composite, (const void*)inputName, (long long)value);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCompositeSetInputOp(rpr_composite composite, const rpr_char * inputName, rpr_material_node_arithmetic_operation op)
+{
+	static const auto s_next = (decltype(&rprCompositeSetInputOp))RprInterposer_Resolve("rprCompositeSetInputOp");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(composite, inputName, op);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(205, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(205, (long long)ret, bytes, "%p\t%p\t%lld", (const void*)composite, (const void*)inputName, (long long)op);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCompositeCompute(rpr_composite composite, rpr_framebuffer fb)
+{
+	static const auto s_next = (decltype(&rprCompositeCompute))RprInterposer_Resolve("rprCompositeCompute");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(composite, fb);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(206, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(206, (long long)ret, bytes, "%p\t%p", (const void*)composite, (const void*)fb);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprCompositeGetInfo(rpr_composite composite, rpr_composite_info composite_info, size_t size, void *  data, size_t * size_ret)
+{
+	static const auto s_next = (decltype(&rprCompositeGetInfo))RprInterposer_Resolve("rprCompositeGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(composite, composite_info, size, data, size_ret);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(207, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(207, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)composite, (long long)composite_info, (long long)size, (const void*)data, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprObjectDelete(void * obj)
+{
+	static const auto s_next = (decltype(&rprObjectDelete))RprInterposer_Resolve("rprObjectDelete");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(obj);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(208, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(208, (long long)ret, bytes, "%p", (const void*)obj);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprObjectSetName(void * node, rpr_char const * name)
+{
+	static const auto s_next = (decltype(&rprObjectSetName))RprInterposer_Resolve("rprObjectSetName");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(node, name);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(209, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(209, (long long)ret, bytes, "%p\t%p", (const void*)node, (const void*)name);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprObjectSetCustomPointer(void * node, void const * customPtr)
+{
+	static const auto s_next = (decltype(&rprObjectSetCustomPointer))RprInterposer_Resolve("rprObjectSetCustomPointer");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(node, customPtr);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(210, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(210, (long long)ret, bytes, "%p\t%p", (const void*)node, (const void*)customPtr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprObjectGetCustomPointer(void * node, void const ** customPtr_out)
+{
+	static const auto s_next = (decltype(&rprObjectGetCustomPointer))RprInterposer_Resolve("rprObjectGetCustomPointer");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(node, customPtr_out);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(211, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(211, (long long)ret, bytes, "%p\t%p", (const void*)node, (const void*)customPtr_out);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreatePostEffect(rpr_context context, rpr_post_effect_type type, rpr_post_effect * out_effect)
+{
+	static const auto s_next = (decltype(&rprContextCreatePostEffect))RprInterposer_Resolve("rprContextCreatePostEffect");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, type, out_effect);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(212, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(212, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)context, (long long)type, out_effect ? (const void*)*out_effect : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextAttachPostEffect(rpr_context context, rpr_post_effect effect)
+{
+	static const auto s_next = (decltype(&rprContextAttachPostEffect))RprInterposer_Resolve("rprContextAttachPostEffect");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, effect);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(213, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(213, (long long)ret, bytes, "%p\t%p", (const void*)context, (const void*)effect);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextDetachPostEffect(rpr_context context, rpr_post_effect effect)
+{
+	static const auto s_next = (decltype(&rprContextDetachPostEffect))RprInterposer_Resolve("rprContextDetachPostEffect");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, effect);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(214, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(214, (long long)ret, bytes, "%p\t%p", (const void*)context, (const void*)effect);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprPostEffectSetParameter1u(rpr_post_effect effect, rpr_char const * name, rpr_uint x)
+{
+	static const auto s_next = (decltype(&rprPostEffectSetParameter1u))RprInterposer_Resolve("rprPostEffectSetParameter1u");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(effect, name, x);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(215, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(215, (long long)ret, bytes, "%p\t%p\t%lld", (const void*)effect, (const void*)name, (long long)x);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprPostEffectSetParameter1f(rpr_post_effect effect, rpr_char const * name, rpr_float x)
+{
+	static const auto s_next = (decltype(&rprPostEffectSetParameter1f))RprInterposer_Resolve("rprPostEffectSetParameter1f");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(effect, name, x);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(216, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(216, (long long)ret, bytes, "%p\t%p\t%.9g", (const void*)effect, (const void*)name, (double)x);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprPostEffectSetParameter3f(rpr_post_effect effect, rpr_char const * name, rpr_float x, rpr_float y, rpr_float z)
+{
+	static const auto s_next = (decltype(&rprPostEffectSetParameter3f))RprInterposer_Resolve("rprPostEffectSetParameter3f");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(effect, name, x, y, z);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(217, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(217, (long long)ret, bytes, "%p\t%p\t%.9g\t%.9g\t%.9g", (const void*)effect, (const void*)name, (double)x, (double)y, (double)z);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprPostEffectSetParameter4f(rpr_post_effect effect, rpr_char const * name, rpr_float x, rpr_float y, rpr_float z, rpr_float w)
+{
+	static const auto s_next = (decltype(&rprPostEffectSetParameter4f))RprInterposer_Resolve("rprPostEffectSetParameter4f");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(effect, name, x, y, z, w);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(218, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(218, (long long)ret, bytes, "%p\t%p\t%.9g\t%.9g\t%.9g\t%.9g", (const void*)effect, (const void*)name, (double)x, (double)y, (double)z, (double)w);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextGetAttachedPostEffectCount(rpr_context context, rpr_uint *  nb)
+{
+	static const auto s_next = (decltype(&rprContextGetAttachedPostEffectCount))RprInterposer_Resolve("rprContextGetAttachedPostEffectCount");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, nb);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(219, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(219, (long long)ret, bytes, "%p\t%p", (const void*)context, (const void*)nb);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextGetAttachedPostEffect(rpr_context context, rpr_uint i, rpr_post_effect * out_effect)
+{
+	static const auto s_next = (decltype(&rprContextGetAttachedPostEffect))RprInterposer_Resolve("rprContextGetAttachedPostEffect");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, i, out_effect);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(220, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(220, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)context, (long long)i, out_effect ? (const void*)*out_effect : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprPostEffectGetInfo(rpr_post_effect effect, rpr_post_effect_info info, size_t size,  void *  data, size_t *  size_ret)
+{
+	static const auto s_next = (decltype(&rprPostEffectGetInfo))RprInterposer_Resolve("rprPostEffectGetInfo");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(effect, info, size, data, size_ret);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(221, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(221, (long long)ret, bytes, "%p\t%lld\t%lld\t%p\t%p", (const void*)effect, (long long)info, (long long)size, (const void*)data, (const void*)size_ret);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateGrid(rpr_context context, rpr_grid * out_grid, size_t gridSizeX, size_t gridSizeY, size_t gridSizeZ, void const * indicesList, size_t numberOfIndices, rpr_grid_indices_topology indicesListTopology, void const * gridData, size_t gridDataSizeByte, rpr_uint gridDataTopology___unused)
+{
+	static const auto s_next = (decltype(&rprContextCreateGrid))RprInterposer_Resolve("rprContextCreateGrid");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, out_grid, gridSizeX, gridSizeY, gridSizeZ, indicesList, numberOfIndices, indicesListTopology, gridData, gridDataSizeByte, gridDataTopology___unused);
+	const uint64_t bytes = gridDataSizeByte;
+	RprInterposer_Record(222, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(222, (long long)ret, bytes, "%p\t%p\t%lld\t%lld\t%lld\t%p\t%lld\t%lld\t%p\t%lld\t%lld", (const void*)context, out_grid ? (const void*)*out_grid : nullptr, (long long)gridSizeX, (long long)gridSizeY, (long long)gridSizeZ, (const void*)indicesList, (long long)numberOfIndices, (long long)indicesListTopology, (const void*)gridData, (long long)gridDataSizeByte, (long long)gridDataTopology___unused);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprContextCreateHeteroVolume(rpr_context context, rpr_hetero_volume * out_heteroVolume)
+{
+	static const auto s_next = (decltype(&rprContextCreateHeteroVolume))RprInterposer_Resolve("rprContextCreateHeteroVolume");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(context, out_heteroVolume);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(223, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(223, (long long)ret, bytes, "%p\t%p", (const void*)context, out_heteroVolume ? (const void*)*out_heteroVolume : nullptr);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprShapeSetHeteroVolume(rpr_shape shape, rpr_hetero_volume heteroVolume)
+{
+	static const auto s_next = (decltype(&rprShapeSetHeteroVolume))RprInterposer_Resolve("rprShapeSetHeteroVolume");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(shape, heteroVolume);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(224, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(224, (long long)ret, bytes, "%p\t%p", (const void*)shape, (const void*)heteroVolume);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprHeteroVolumeSetTransform(rpr_hetero_volume heteroVolume, rpr_bool transpose, rpr_float const * transform)
+{
+	static const auto s_next = (decltype(&rprHeteroVolumeSetTransform))RprInterposer_Resolve("rprHeteroVolumeSetTransform");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(heteroVolume, transpose, transform);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(225, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(225, (long long)ret, bytes, "%p\t%lld\t%p", (const void*)heteroVolume, (long long)transpose, (const void*)transform);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprHeteroVolumeSetEmissionGrid(rpr_hetero_volume heteroVolume, rpr_grid grid)
+{
+	static const auto s_next = (decltype(&rprHeteroVolumeSetEmissionGrid))RprInterposer_Resolve("rprHeteroVolumeSetEmissionGrid");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(heteroVolume, grid);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(226, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(226, (long long)ret, bytes, "%p\t%p", (const void*)heteroVolume, (const void*)grid);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprHeteroVolumeSetDensityGrid(rpr_hetero_volume heteroVolume, rpr_grid grid)
+{
+	static const auto s_next = (decltype(&rprHeteroVolumeSetDensityGrid))RprInterposer_Resolve("rprHeteroVolumeSetDensityGrid");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(heteroVolume, grid);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(227, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(227, (long long)ret, bytes, "%p\t%p", (const void*)heteroVolume, (const void*)grid);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprHeteroVolumeSetAlbedoGrid(rpr_hetero_volume heteroVolume, rpr_grid grid)
+{
+	static const auto s_next = (decltype(&rprHeteroVolumeSetAlbedoGrid))RprInterposer_Resolve("rprHeteroVolumeSetAlbedoGrid");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(heteroVolume, grid);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(228, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(228, (long long)ret, bytes, "%p\t%p", (const void*)heteroVolume, (const void*)grid);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprHeteroVolumeSetEmissionLookup(rpr_hetero_volume heteroVolume, rpr_float const * ptr, rpr_uint n)
+{
+	static const auto s_next = (decltype(&rprHeteroVolumeSetEmissionLookup))RprInterposer_Resolve("rprHeteroVolumeSetEmissionLookup");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(heteroVolume, ptr, n);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(229, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(229, (long long)ret, bytes, "%p\t%p\t%lld", (const void*)heteroVolume, (const void*)ptr, (long long)n);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprHeteroVolumeSetDensityLookup(rpr_hetero_volume heteroVolume, rpr_float const * ptr, rpr_uint n)
+{
+	static const auto s_next = (decltype(&rprHeteroVolumeSetDensityLookup))RprInterposer_Resolve("rprHeteroVolumeSetDensityLookup");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(heteroVolume, ptr, n);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(230, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(230, (long long)ret, bytes, "%p\t%p\t%lld", (const void*)heteroVolume, (const void*)ptr, (long long)n);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprHeteroVolumeSetAlbedoLookup(rpr_hetero_volume heteroVolume, rpr_float const * ptr, rpr_uint n)
+{
+	static const auto s_next = (decltype(&rprHeteroVolumeSetAlbedoLookup))RprInterposer_Resolve("rprHeteroVolumeSetAlbedoLookup");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(heteroVolume, ptr, n);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(231, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(231, (long long)ret, bytes, "%p\t%p\t%lld", (const void*)heteroVolume, (const void*)ptr, (long long)n);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprHeteroVolumeSetAlbedoScale(rpr_hetero_volume heteroVolume, rpr_float scale)
+{
+	static const auto s_next = (decltype(&rprHeteroVolumeSetAlbedoScale))RprInterposer_Resolve("rprHeteroVolumeSetAlbedoScale");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(heteroVolume, scale);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(232, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(232, (long long)ret, bytes, "%p\t%.9g", (const void*)heteroVolume, (double)scale);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprHeteroVolumeSetEmissionScale(rpr_hetero_volume heteroVolume, rpr_float scale)
+{
+	static const auto s_next = (decltype(&rprHeteroVolumeSetEmissionScale))RprInterposer_Resolve("rprHeteroVolumeSetEmissionScale");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(heteroVolume, scale);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(233, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(233, (long long)ret, bytes, "%p\t%.9g", (const void*)heteroVolume, (double)scale);
+	return ret;
+}
+RPR_INTERPOSER_EXPORT rpr_status rprHeteroVolumeSetDensityScale(rpr_hetero_volume heteroVolume, rpr_float scale)
+{
+	static const auto s_next = (decltype(&rprHeteroVolumeSetDensityScale))RprInterposer_Resolve("rprHeteroVolumeSetDensityScale");
+	const uint64_t start = RprInterposer_Now();
+	const rpr_status ret = s_next(heteroVolume, scale);
+	const uint64_t bytes = 0;
+	RprInterposer_Record(234, start, bytes);
+	if ( g_rprInterposerCallLogEnabled )
+		RprInterposer_LogCall(234, (long long)ret, bytes, "%p\t%.9g", (const void*)heteroVolume, (double)scale);
+	return ret;
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+
+//
+//
+// FILE GENERATED BY generate_interposer.py - DO NOT MODIFY IT DIRECTLY.
+//
+//
+
+
+#define RPR_INTERPOSER_FUNCTION_COUNT 235
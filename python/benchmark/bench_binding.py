@@ -0,0 +1,219 @@
+#
+#
+# Micro-benchmarks of the overhead added by the RPR Python binding ( python/bind_*.cpp ) on top of the core library.
+#
+# The binding must be built against the stub core library, so that each RPR call costs nothing and only the binding is measured:
+#   > cd python/build
+#   > cmake -Dnanobind_DIR=nanobind/cmake -DRPRPY_STUB_CORE=ON ..
+#   > cmake --build . --config Release
+#
+# usage:
+#   > python bench_binding.py                    print the per-call timings
+#   > python bench_binding.py --check            compare with baseline.json, exit with 1 if a call regressed
+#   > python bench_binding.py --update-baseline  write the current timings inside baseline.json
+#
+# The timings are divided by the time of an empty Python function call with the same number of arguments,
+# so that baseline.json can be compared across machines.
+# baseline.json is written by --update-baseline on the reference machine ( the agent of scripts/python_binding_benchmark.jenkinsfile ),
+# with the description of that machine. --check exits with 2 if it contains no measured ratios: the CI job is then unstable, not failed.
+#
+#
+
+
+import sys
+import os
+import json
+import argparse
+import platform
+import timeit
+
+
+scriptDir = os.path.dirname(os.path.abspath(__file__))
+
+# add the RPR Python library folder in order to import the rpr module.
+if sys.platform == "win32":
+    sys.path.insert(1, os.path.join(scriptDir, '../build/Release'))
+else:
+	sys.path.insert(1, os.path.join(scriptDir, '../build'))
+
+
+import rpr
+import numpy as np
+
+
+def RPRCHECK(retCode):
+    if ( retCode != rpr.Status.SUCCESS ):
+        print(f"RPR ERROR: {retCode}")
+        exit(1)
+
+
+def EmptyCall(*args):
+    pass
+
+
+# create the objects used by the benchmarks.
+class Scene:
+    def __init__(self):
+        self.ctx = rpr.Context()
+        RPRCHECK( rpr.CreateContext(rpr.VERSION_MAJOR_MINOR_REVISION  ,  np.array([0], dtype=np.int32)  , 1  , int(rpr.CreationFlags.ENABLE_GPU0) ,   [ rpr.Int64ToPvoid(0) ] , "" ,  self.ctx ) )
+
+        self.matsys = rpr.MaterialSystem()
+        RPRCHECK( rpr.ContextCreateMaterialSystem(self.ctx, 0, self.matsys) )
+        self.node = rpr.MaterialNode()
+        RPRCHECK( rpr.MaterialSystemCreateNode(self.matsys, rpr.MaterialNodeType.DIFFUSE, self.node) )
+
+        self.camera = rpr.Camera()
+        RPRCHECK( rpr.ContextCreateCamera(self.ctx, self.camera) )
+
+        self.light = rpr.Light()
+        RPRCHECK( rpr.ContextCreatePointLight(self.ctx, self.light) )
+
+        self.vertices = np.array([ -1,0,-1,  -1,0,1,  1,0,1,  1,0,-1 ], dtype=np.float32)
+        self.indices = np.array([ 3,1,0, 2,1,3 ], dtype=np.int32)
+        self.emptyFloats = np.array([], dtype=np.float32)
+        self.emptyInts = np.array([], dtype=np.int32)
+        self.num_face_vertices = np.array([ 3, 3 ], dtype=np.int32)
+        self.shape = rpr.Shape()
+        RPRCHECK( self.CreateMesh(self.shape) )
+
+        self.transform = np.array([ 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1 ], dtype=np.float32)
+
+        fbFormat = rpr.FramebufferFormat()
+        fbFormat.num_components = 4
+        fbFormat.type = rpr.ComponentType.FLOAT32
+        fbDesc = rpr.FrameBufferDesc()
+        fbDesc.fb_width = 64
+        fbDesc.fb_height = 64
+        self.fb = rpr.Framebuffer()
+        RPRCHECK( rpr.ContextCreateFrameBuffer(self.ctx, fbFormat, fbDesc, self.fb) )
+        self.fbArray = np.zeros((64, 64, 4), dtype=np.float32)
+        self.fbMalloc = rpr.PyMalloc(np.zeros(64*64*4*4, dtype=np.uint8))
+
+    def CreateMesh(self, shape):
+        return rpr.ContextCreateMesh(self.ctx,
+            self.vertices, 0, 4, 3*4,
+            self.emptyFloats, 0, 0, 0,
+            self.emptyFloats, 0, 0, 0,
+            self.indices, 4,
+            self.emptyInts, 0,
+            self.emptyInts, 0,
+            self.num_face_vertices, 2,
+            shape )
+
+    def Delete(self):
+        self.fbMalloc.Free()
+        for obj in [ self.fb, self.shape, self.light, self.camera, self.node, self.matsys, self.ctx ]:
+            RPRCHECK( rpr.ObjectDelete(obj) )
+
+
+# returns the list of benchmarks:  name -> ( binding call , equivalent empty Python call )
+def GetBenchmarks(s):
+    tmpLight = rpr.Light()
+    tmpShape = rpr.Shape()
+
+    def CreateDeleteLight():
+        rpr.ContextCreatePointLight(s.ctx, tmpLight)
+        rpr.ObjectDelete(tmpLight)
+    def CreateDeleteLightEmpty():
+        EmptyCall(s.ctx, tmpLight)
+        EmptyCall(tmpLight)
+
+    def CreateDeleteMesh():
+        s.CreateMesh(tmpShape)
+        rpr.ObjectDelete(tmpShape)
+    def CreateDeleteMeshEmpty():
+        EmptyCall(s.ctx, s.vertices, 0, 4, 12, None, 0, 0, 0, None, 0, 0, 0, s.indices, 4, None, 0, None, 0, s.num_face_vertices, 2, tmpShape)
+        EmptyCall(tmpShape)
+
+    return {
+        # setters
+        'MaterialNodeSetInputFByKey': ( lambda: rpr.MaterialNodeSetInputFByKey(s.node, rpr.MaterialInput.COLOR, 0.1, 0.2, 0.3, 1.0) ,
+                                        lambda: EmptyCall(s.node, rpr.MaterialInput.COLOR, 0.1, 0.2, 0.3, 1.0) ),
+        'CameraLookAt':               ( lambda: rpr.CameraLookAt(s.camera, 0, 5, 20, 0, 1, 0, 0, 1, 0) ,
+                                        lambda: EmptyCall(s.camera, 0, 5, 20, 0, 1, 0, 0, 1, 0) ),
+        'ObjectSetName':              ( lambda: rpr.ObjectSetName(s.node.h, "node") ,
+                                        lambda: EmptyCall(s.node.h, "node") ),
+        # creators
+        'ContextCreatePointLight+ObjectDelete': ( CreateDeleteLight , CreateDeleteLightEmpty ),
+        'ContextCreateMesh+ObjectDelete':       ( CreateDeleteMesh , CreateDeleteMeshEmpty ),
+        # transforms
+        'ShapeSetTransform':          ( lambda: rpr.ShapeSetTransform(s.shape, False, s.transform) ,
+                                        lambda: EmptyCall(s.shape, False, s.transform) ),
+        'LightSetTransform':          ( lambda: rpr.LightSetTransform(s.light, False, s.transform) ,
+                                        lambda: EmptyCall(s.light, False, s.transform) ),
+        # framebuffer reads ( 64x64 float4 )
+        'FrameBufferGetInfo':         ( lambda: rpr.FrameBufferGetInfo(s.fb, int(rpr.FrameBuffer.DATA), 64*64*4*4, s.fbMalloc.GetMem(0), None) ,
+                                        lambda: EmptyCall(s.fb, 0, 64*64*4*4, EmptyCall(0), None) ),
+        'FrameBufferReadInto':        ( lambda: rpr.FrameBufferReadInto(s.fb, s.fbArray) ,
+                                        lambda: EmptyCall(s.fb, s.fbArray) ),
+        'FrameBufferRead':            ( lambda: rpr.FrameBufferRead(s.fb) ,
+                                        lambda: EmptyCall(s.fb) ),
+    }
+
+
+# best time of one call in nanoseconds
+def Measure(func, number, repeat):
+    return min( timeit.Timer(func).repeat(repeat=repeat, number=number) ) / number * 1.0e9
+
+
+def main():
+    parser = argparse.ArgumentParser(description='RPR Python binding overhead benchmarks')
+    parser.add_argument('--baseline', default=os.path.join(scriptDir, 'baseline.json'))
+    parser.add_argument('--check', action='store_true', help='exit with 1 if a benchmark is slower than the baseline')
+    parser.add_argument('--update-baseline', action='store_true', help='write the current results inside the baseline file')
+    parser.add_argument('--number', type=int, default=20000, help='calls per measure')
+    parser.add_argument('--repeat', type=int, default=7, help='number of measures, the best one is kept')
+    parser.add_argument('--output', help='write the results in this JSON file')
+    args = parser.parse_args()
+
+    scene = Scene()
+    results = {}
+    print(f"{'benchmark':40} {'binding (ns)':>14} {'python (ns)':>14} {'ratio':>8}")
+    for name, (bindingCall, emptyCall) in GetBenchmarks(scene).items():
+        timeBinding = Measure(bindingCall, args.number, args.repeat)
+        timeEmpty = Measure(emptyCall, args.number, args.repeat)
+        ratio = timeBinding / timeEmpty
+        results[name] = { 'ns': round(timeBinding, 1), 'ratio': round(ratio, 3) }
+        print(f"{name:40} {timeBinding:14.1f} {timeEmpty:14.1f} {ratio:8.2f}")
+    scene.Delete()
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(results, f, indent=4)
+
+    if args.update_baseline:
+        baseline = { 'tolerance': 0.25, 'machine': {}, 'ratios': {} }
+        if os.path.exists(args.baseline):
+            with open(args.baseline) as f:
+                baseline['tolerance'] = json.load(f).get('tolerance', baseline['tolerance'])
+        baseline['machine'] = { 'platform': platform.platform(), 'processor': platform.processor() or platform.machine(),
+                                'python': platform.python_version(), 'numpy': np.__version__,
+                                'number': args.number, 'repeat': args.repeat }
+        baseline['ratios'] = { name: r['ratio'] for name, r in results.items() }
+        with open(args.baseline, 'w') as f:
+            json.dump(baseline, f, indent=4)
+        print(f"baseline written: {args.baseline}")
+
+    if args.check:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        if not baseline.get('ratios'):
+            print(f"ERROR: {args.baseline} has no measured ratios: run bench_binding.py --update-baseline on the reference machine and commit the file")
+            exit(2)
+        tolerance = baseline['tolerance']
+        regressions = 0
+        for name, r in results.items():
+            if name not in baseline['ratios']:
+                print(f"WARNING: {name} has no baseline")
+                continue
+            limit = baseline['ratios'][name] * (1.0 + tolerance)
+            if r['ratio'] > limit:
+                print(f"REGRESSION: {name} ratio {r['ratio']:.2f} > {limit:.2f} ( baseline {baseline['ratios'][name]:.2f} + {tolerance*100:.0f}% )")
+                regressions += 1
+        if regressions != 0:
+            exit(1)
+        print("no regression")
+
+
+if __name__ == '__main__':
+    main()
@@ -1,5 +1,7 @@
 #include "bind_common.h"
 
+#include <stdexcept>
+
 
 
 
@@ -60,3 +62,273 @@ void* PyMalloc::GetMem(int offset)
 }
 
 
+
+namespace
+{
+
+// dtype of the NumPy array matching the component type of a framebuffer. bits=0 if the type is not supported.
+nb::dlpack::dtype FrameBufferDtype(rpr_component_type type)
+{
+	nb::dlpack::dtype dt;
+	dt.code = (uint8_t)nb::dlpack::dtype_code::Float;
+	dt.bits = 0;
+	dt.lanes = 1;
+	switch (type)
+	{
+		case RPR_COMPONENT_TYPE_FLOAT32: dt.code = (uint8_t)nb::dlpack::dtype_code::Float; dt.bits = 32; break;
+		case RPR_COMPONENT_TYPE_FLOAT16: dt.code = (uint8_t)nb::dlpack::dtype_code::Float; dt.bits = 16; break;
+		case RPR_COMPONENT_TYPE_UINT8:   dt.code = (uint8_t)nb::dlpack::dtype_code::UInt;  dt.bits = 8;  break;
+		case RPR_COMPONENT_TYPE_UINT32:  dt.code = (uint8_t)nb::dlpack::dtype_code::UInt;  dt.bits = 32; break;
+		default: break;
+	}
+	return dt;
+}
+
+// get format, dimensions and size in bytes of the framebuffer.
+// checks that the size matches width*height*num_components, so that the data can be written directly into a (H,W,C) array.
+rpr_status FrameBufferQuery(rpr_framebuffer fb, rpr_framebuffer_format& format, rpr_framebuffer_desc& desc, size_t& dataSize)
+{
+	rpr_status status = rprFrameBufferGetInfo(fb, RPR_FRAMEBUFFER_FORMAT, sizeof(format), &format, nullptr);
+	if ( status != RPR_SUCCESS )
+		return status;
+	status = rprFrameBufferGetInfo(fb, RPR_FRAMEBUFFER_DESC, sizeof(desc), &desc, nullptr);
+	if ( status != RPR_SUCCESS )
+		return status;
+	status = rprFrameBufferGetInfo(fb, RPR_FRAMEBUFFER_DATA, 0, nullptr, &dataSize);
+	if ( status != RPR_SUCCESS )
+		return status;
+
+	const nb::dlpack::dtype dt = FrameBufferDtype(format.type);
+	if ( dt.bits == 0 )
+		return RPR_ERROR_UNSUPPORTED;
+	if ( dataSize != (size_t)desc.fb_width * desc.fb_height * format.num_components * (dt.bits / 8) )
+		return RPR_ERROR_INTERNAL_ERROR;
+	return RPR_SUCCESS;
+}
+
+}
+
+rpr_status PyRpr_FrameBufferReadInto(PyRprFramebuffer* fb, nb::ndarray<nb::c_contig, nb::device::cpu> dst)
+{
+	// the ndarray accessors only read the DLPack tensor, so everything can run without the GIL.
+	nb::gil_scoped_release gilRelease;
+
+	rpr_framebuffer_format format;
+	rpr_framebuffer_desc desc;
+	size_t dataSize = 0;
+	rpr_status status = FrameBufferQuery((rpr_framebuffer)fb->h, format, desc, dataSize);
+	if ( status != RPR_SUCCESS )
+	{
+		RprError(status);
+		return status;
+	}
+
+	const nb::dlpack::dtype dt = FrameBufferDtype(format.type);
+	const nb::dlpack::dtype dstDt = dst.dtype();
+	size_t dstCount = 1;
+	for(size_t i=0; i<dst.ndim(); i++)
+		dstCount *= dst.shape(i);
+	if ( dstDt.code != dt.code || dstDt.bits != dt.bits || dstDt.lanes != dt.lanes
+		|| dstCount != (size_t)desc.fb_width * desc.fb_height * format.num_components )
+	{
+		RprError(RPR_ERROR_INVALID_PARAMETER);
+		return RPR_ERROR_INVALID_PARAMETER;
+	}
+
+	status = rprFrameBufferGetInfo((rpr_framebuffer)fb->h, RPR_FRAMEBUFFER_DATA, dataSize, dst.data(), nullptr);
+	if ( status != RPR_SUCCESS )
+		RprError(status);
+	return status;
+}
+
+nb::ndarray<nb::numpy> PyRpr_FrameBufferRead(PyRprFramebuffer* fb)
+{
+	rpr_framebuffer_format format;
+	rpr_framebuffer_desc desc;
+	size_t dataSize = 0;
+	uint8_t* data = nullptr;
+	rpr_status status = RPR_SUCCESS;
+	{
+		nb::gil_scoped_release gilRelease;
+		status = FrameBufferQuery((rpr_framebuffer)fb->h, format, desc, dataSize);
+		if ( status == RPR_SUCCESS )
+		{
+			data = new uint8_t[dataSize > 0 ? dataSize : 1];
+			status = rprFrameBufferGetInfo((rpr_framebuffer)fb->h, RPR_FRAMEBUFFER_DATA, dataSize, data, nullptr);
+		}
+	}
+
+	if ( status != RPR_SUCCESS )
+	{
+		delete[] data;
+		RprError(status);
+		throw std::runtime_error("FrameBufferRead failed with RPR error " + std::to_string(status));
+	}
+
+	// the array owns the memory written by RPR: it's released when the last Python reference goes away.
+	nb::capsule owner(data, [](void* p) noexcept { delete[] (uint8_t*)p; });
+	const size_t shape[3] = { desc.fb_height, desc.fb_width, format.num_components };
+	return nb::ndarray<nb::numpy>(data, 3, shape, owner, nullptr, FrameBufferDtype(format.type));
+}
+
+std::vector<PyRprShape> PyRpr_ContextCreateMeshes(PyRprContext* context,
+	nb::ndarray<float_t, nb::c_contig, nb::device::cpu> vertices,
+	nb::ndarray<float_t, nb::c_contig, nb::device::cpu> normals,
+	nb::ndarray<float_t, nb::c_contig, nb::device::cpu> texcoords,
+	nb::ndarray<int64_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> vertex_offsets,
+	nb::ndarray<int32_t, nb::c_contig, nb::device::cpu> indices,
+	nb::ndarray<int32_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> num_face_vertices,
+	nb::ndarray<int64_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> face_offsets )
+{
+	if ( vertex_offsets.shape(0) != face_offsets.shape(0) || vertex_offsets.shape(0) == 0 )
+		throw std::runtime_error("ContextCreateMeshes: vertex_offsets and face_offsets must have count+1 values");
+
+	const size_t meshCount = vertex_offsets.shape(0) - 1;
+	const size_t numVertices = vertices.size() / 3;
+	const bool hasNormals = normals.size() != 0;
+	const bool hasTexcoords = texcoords.size() != 0;
+	if ( vertices.size() % 3 != 0 || ( hasNormals && normals.size() != numVertices*3 ) || ( hasTexcoords && texcoords.size() != numVertices*2 ) )
+		throw std::runtime_error("ContextCreateMeshes: vertices/normals/texcoords sizes don't match");
+
+	const rpr_float* vertices___pycast = (const rpr_float*)vertices.data();
+	const rpr_float* normals___pycast = hasNormals ? (const rpr_float*)normals.data() : nullptr;
+	const rpr_float* texcoords___pycast = hasTexcoords ? (const rpr_float*)texcoords.data() : nullptr;
+	const int64_t* vertex_offsets___pycast = (const int64_t*)vertex_offsets.data();
+	const int32_t* indices___pycast = (const int32_t*)indices.data();
+	const int32_t* num_face_vertices___pycast = (const int32_t*)num_face_vertices.data();
+	const int64_t* face_offsets___pycast = (const int64_t*)face_offsets.data();
+	const size_t numIndices = indices.size();
+	const size_t numFaces = num_face_vertices.shape(0);
+
+	std::vector<PyRprShape> meshes(meshCount);
+	std::string error;
+	{
+		nb::gil_scoped_release gilRelease;
+
+		size_t indexOffset = 0;
+		for(size_t i=0; i<meshCount; i++)
+		{
+			const int64_t vBegin = vertex_offsets___pycast[i];
+			const int64_t vEnd = vertex_offsets___pycast[i+1];
+			const int64_t fBegin = face_offsets___pycast[i];
+			const int64_t fEnd = face_offsets___pycast[i+1];
+			if ( vBegin < 0 || vEnd < vBegin || (size_t)vEnd > numVertices || fBegin < 0 || fEnd < fBegin || (size_t)fEnd > numFaces )
+			{
+				error = "ContextCreateMeshes: invalid offsets for mesh " + std::to_string(i);
+				break;
+			}
+
+			// a face has at least 3 vertices: a negative count would wrap the index offset around
+			size_t meshIndexCount = 0;
+			bool validCounts = true;
+			for(int64_t f=fBegin; f<fEnd && validCounts; f++)
+			{
+				validCounts = num_face_vertices___pycast[f] >= 3;
+				meshIndexCount += validCounts ? (size_t)num_face_vertices___pycast[f] : 0;
+			}
+			if ( !validCounts )
+			{
+				error = "ContextCreateMeshes: num_face_vertices must be at least 3, for mesh " + std::to_string(i);
+				break;
+			}
+			if ( meshIndexCount > numIndices - indexOffset )
+			{
+				error = "ContextCreateMeshes: not enough indices for mesh " + std::to_string(i);
+				break;
+			}
+
+			// the indices are relative to the first vertex of the mesh
+			const int32_t* meshIndices = &indices___pycast[indexOffset];
+			const int64_t meshVertexCount = vEnd - vBegin;
+			bool validIndices = true;
+			for(size_t j=0; j<meshIndexCount && validIndices; j++)
+				validIndices = meshIndices[j] >= 0 && meshIndices[j] < meshVertexCount;
+			if ( !validIndices )
+			{
+				error = "ContextCreateMeshes: index out of the vertices of mesh " + std::to_string(i);
+				break;
+			}
+
+			const rpr_status status = rprContextCreateMesh( (rpr_context)context->h,
+				&vertices___pycast[vBegin*3], (size_t)(vEnd-vBegin), 3*sizeof(rpr_float),
+				hasNormals ? &normals___pycast[vBegin*3] : nullptr, hasNormals ? (size_t)(vEnd-vBegin) : 0, 3*sizeof(rpr_float),
+				hasTexcoords ? &texcoords___pycast[vBegin*2] : nullptr, hasTexcoords ? (size_t)(vEnd-vBegin) : 0, 2*sizeof(rpr_float),
+				meshIndices, sizeof(int32_t),
+				hasNormals ? meshIndices : nullptr, sizeof(int32_t),
+				hasTexcoords ? meshIndices : nullptr, sizeof(int32_t),
+				&num_face_vertices___pycast[fBegin], (size_t)(fEnd-fBegin),
+				(rpr_shape*)&(meshes[i].h) );
+			if ( status != RPR_SUCCESS )
+			{
+				RprError(status);
+				error = "ContextCreateMeshes failed with RPR error " + std::to_string(status) + " for mesh " + std::to_string(i);
+				break;
+			}
+
+			indexOffset += meshIndexCount;
+		}
+
+		if ( !error.empty() )
+		{
+			for(PyRprShape& mesh : meshes)
+			{
+				if ( mesh.h )
+					rprObjectDelete(mesh.h);
+			}
+		}
+	}
+
+	if ( !error.empty() )
+		throw std::runtime_error(error);
+	return meshes;
+}
+
+namespace
+{
+
+// call setter(object handle, pointer to the values of this object) for each object, without the GIL.
+template<typename PyRprObject, typename Setter>
+rpr_status SetForEach(const std::vector<PyRprObject*>& objects, nb::ndarray<float_t, nb::c_contig, nb::device::cpu>& values, size_t valuesPerObject, Setter setter)
+{
+	if ( values.size() != objects.size() * valuesPerObject )
+	{
+		RprError(RPR_ERROR_INVALID_PARAMETER);
+		return RPR_ERROR_INVALID_PARAMETER;
+	}
+
+	const rpr_float* values___pycast = (const rpr_float*)values.data();
+	nb::gil_scoped_release gilRelease;
+	for(size_t i=0; i<objects.size(); i++)
+	{
+		const rpr_status status = objects[i] ? setter(objects[i]->h, &values___pycast[i*valuesPerObject]) : RPR_ERROR_NULLPTR;
+		if ( status != RPR_SUCCESS )
+		{
+			RprError(status);
+			return status;
+		}
+	}
+	return RPR_SUCCESS;
+}
+
+}
+
+rpr_status PyRpr_ShapesSetTransforms(std::vector<PyRprShape*> shapes, rpr_bool transpose, nb::ndarray<float_t, nb::c_contig, nb::device::cpu> transforms)
+{
+	return SetForEach(shapes, transforms, 16, [transpose](void* h, const rpr_float* transform) {
+		return rprShapeSetTransform((rpr_shape)h, transpose, transform);
+	});
+}
+
+rpr_status PyRpr_LightsSetTransforms(std::vector<PyRprLight*> lights, rpr_bool transpose, nb::ndarray<float_t, nb::c_contig, nb::device::cpu> transforms)
+{
+	return SetForEach(lights, transforms, 16, [transpose](void* h, const rpr_float* transform) {
+		return rprLightSetTransform((rpr_light)h, transpose, transform);
+	});
+}
+
+rpr_status PyRpr_MaterialNodesSetInputF(std::vector<PyRprMaterialNode*> nodes, rpr_material_node_input key, nb::ndarray<float_t, nb::c_contig, nb::device::cpu> values)
+{
+	return SetForEach(nodes, values, 4, [key](void* h, const rpr_float* value) {
+		return rprMaterialNodeSetInputFByKey((rpr_material_node)h, key, value[0], value[1], value[2], value[3]);
+	});
+}
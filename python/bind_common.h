@@ -38,6 +38,18 @@ void RprError(int code);
 
 #define PYRPR_CHECK_ERROR(a)   rpr_status ret = a; if ( ret != RPR_SUCCESS ) { RprError(ret); }
 
+// same as PYRPR_CHECK_ERROR, but the GIL is released during the RPR call.
+// used for every call that can block for a long time ( rendering, resolve, file I/O, scene import/export, big uploads ).
+// While such a call runs, other Python threads keep running.
+//
+// Concurrency rules are the ones of the RPR C API, the binding doesn't add any lock:
+//  - calls on objects owned by different rpr_context can run concurrently.
+//  - calls on the same rpr_context ( and on its objects ) must be serialized by the script,
+//    except rprContextAbortRender that is designed to be called from another thread while rprContextRender is running.
+//  - rprs/rprgltf Import/Export can run concurrently only if each thread uses its own rprs.Context ( and its own rpr_context ).
+// All the arguments (ndarray, PyMalloc, handles) must stay alive and unmodified on the Python side until the call returns.
+#define PYRPR_CHECK_ERROR_NOGIL(a)   rpr_status ret = RPR_SUCCESS; { nb::gil_scoped_release gilRelease; ret = a; } if ( ret != RPR_SUCCESS ) { RprError(ret); }
+
 struct PyRprScene { void* h = nullptr; };
 struct PyRprCamera { void* h = nullptr; };
 struct PyRprShape { void* h = nullptr; };
@@ -109,6 +121,58 @@ struct PyMalloc
 
 
 
+// Framebuffer readback directly into NumPy arrays.
+// The pixels are written by rprFrameBufferGetInfo(RPR_FRAMEBUFFER_DATA) straight into the memory of the array: no PyMalloc, no intermediate copy.
+// The GIL is released during the read, with the same concurrency rules as PYRPR_CHECK_ERROR_NOGIL.
+// dtype of the array matches the component type of the framebuffer: FLOAT32->float32, FLOAT16->float16, UINT8->uint8, UINT32->uint32.
+
+// read into an array owned by the caller. The array must be C-contiguous, on CPU, with the matching dtype and exactly width*height*num_components elements ( any shape, (H,W,C) is the natural one ).
+// returns RPR_ERROR_INVALID_PARAMETER if the array doesn't match the framebuffer.
+rpr_status PyRpr_FrameBufferReadInto(PyRprFramebuffer* fb, nb::ndarray<nb::c_contig, nb::device::cpu> dst);
+
+// allocate a new (height, width, num_components) array and read the framebuffer into it.
+// raises RuntimeError if a RPR call fails.
+nb::ndarray<nb::numpy> PyRpr_FrameBufferRead(PyRprFramebuffer* fb);
+
+
+
+// create many meshes in one call: one native loop of rprContextCreateMesh, without the GIL.
+// used to avoid one Python->C++ crossing per mesh when a script creates thousands of small meshes.
+//
+// all the meshes are concatenated in the same arrays:
+//   vertices  : float32 , 3 per vertex
+//   normals   : float32 , 3 per vertex , or empty
+//   texcoords : float32 , 2 per vertex , or empty
+//   vertex_offsets : int64 , count+1 values. vertices of mesh i are [ vertex_offsets[i] , vertex_offsets[i+1] [
+//   indices   : int32 , indices of each mesh are local to the mesh ( 0 = first vertex of the mesh ). The same indices are used for vertices, normals, texcoords.
+//   num_face_vertices : int32 , number of vertices of each face, at least 3.
+//   face_offsets : int64 , count+1 values. faces of mesh i are [ face_offsets[i] , face_offsets[i+1] [
+// The indices of each mesh follow the indices of the previous mesh, so their offsets are deduced from num_face_vertices.
+//
+// returns the list of the created rpr.Shape. Raises RuntimeError if the arrays are not consistent or if a creation fails ( in that case, the meshes already created are deleted ).
+// For meshes with different indices for normals/texcoords, use ContextCreateMesh.
+std::vector<PyRprShape> PyRpr_ContextCreateMeshes(PyRprContext* context,
+	nb::ndarray<float_t, nb::c_contig, nb::device::cpu> vertices,
+	nb::ndarray<float_t, nb::c_contig, nb::device::cpu> normals,
+	nb::ndarray<float_t, nb::c_contig, nb::device::cpu> texcoords,
+	nb::ndarray<int64_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> vertex_offsets,
+	nb::ndarray<int32_t, nb::c_contig, nb::device::cpu> indices,
+	nb::ndarray<int32_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> num_face_vertices,
+	nb::ndarray<int64_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> face_offsets );
+
+
+
+// batch setters: set the same kind of parameter on many objects with one Python call.
+// the loop on the objects runs natively without the GIL ( same concurrency rules as PYRPR_CHECK_ERROR_NOGIL ).
+// The loop stops at the first RPR error and returns it. RPR_ERROR_INVALID_PARAMETER is returned if the array size doesn't match the number of objects.
+//   transforms : float32 , N*16 values , for example a (N,4,4) array.
+//   values     : float32 , N*4 values , for example a (N,4) array.
+rpr_status PyRpr_ShapesSetTransforms(std::vector<PyRprShape*> shapes, rpr_bool transpose, nb::ndarray<float_t, nb::c_contig, nb::device::cpu> transforms);
+rpr_status PyRpr_LightsSetTransforms(std::vector<PyRprLight*> lights, rpr_bool transpose, nb::ndarray<float_t, nb::c_contig, nb::device::cpu> transforms);
+rpr_status PyRpr_MaterialNodesSetInputF(std::vector<PyRprMaterialNode*> nodes, rpr_material_node_input key, nb::ndarray<float_t, nb::c_contig, nb::device::cpu> values);
+
+
+
 #define RPRPY_ADDITIONAL_DEFINES_rpr\
 \
 	m.def("ObjectDelete", []( PyRprScene* obj ) {   PYRPR_CHECK_ERROR( rprObjectDelete(  obj->h   )  );   return ret;   });\
@@ -116,7 +180,7 @@ struct PyMalloc
 	m.def("ObjectDelete", []( PyRprShape* obj ) {   PYRPR_CHECK_ERROR( rprObjectDelete(  obj->h   )  );   return ret;   });\
 	m.def("ObjectDelete", []( PyRprLight* obj ) {   PYRPR_CHECK_ERROR( rprObjectDelete(  obj->h   )  );   return ret;   });\
 	m.def("ObjectDelete", []( PyRprFramebuffer* obj ) {   PYRPR_CHECK_ERROR( rprObjectDelete(  obj->h   )  );   return ret;   });\
-	m.def("ObjectDelete", []( PyRprContext* obj ) {   PYRPR_CHECK_ERROR( rprObjectDelete(  obj->h   )  );   return ret;   });\
+	m.def("ObjectDelete", []( PyRprContext* obj ) {   PYRPR_CHECK_ERROR_NOGIL( rprObjectDelete(  obj->h   )  );   return ret;   });\
 	m.def("ObjectDelete", []( PyRprImage* obj ) {   PYRPR_CHECK_ERROR( rprObjectDelete(  obj->h   )  );   return ret;   });\
 	m.def("ObjectDelete", []( PyRprBuffer* obj ) {   PYRPR_CHECK_ERROR( rprObjectDelete(  obj->h   )  );   return ret;   });\
 	m.def("ObjectDelete", []( PyRprHeteroVolume* obj ) {   PYRPR_CHECK_ERROR( rprObjectDelete(  obj->h   )  );   return ret;   });\
@@ -145,6 +209,12 @@ struct PyMalloc
 	nb::class_<PyRprComposite>(m, "Composite").def(nb::init<>()).def_rw("h", &PyRprComposite::h);\
 	nb::class_<PyRprLut>(m, "Lut").def(nb::init<>()).def_rw("h", &PyRprLut::h);\
 	m.def("Int64ToPvoid", []( int64_t i ){return (void*)i;});\
+	m.def("FrameBufferReadInto", &PyRpr_FrameBufferReadInto);\
+	m.def("FrameBufferRead", &PyRpr_FrameBufferRead);\
+	m.def("ContextCreateMeshes", &PyRpr_ContextCreateMeshes);\
+	m.def("ShapesSetTransforms", &PyRpr_ShapesSetTransforms);\
+	m.def("LightsSetTransforms", &PyRpr_LightsSetTransforms);\
+	m.def("MaterialNodesSetInputF", &PyRpr_MaterialNodesSetInputF);\
 	nb::class_<PyMalloc>(m, "PyMalloc").def(nb::init< nb::ndarray<>  >()).def(nb::init< const std::string&  >()).def("GetMem", &PyMalloc::GetMem).def("Free", &PyMalloc::Free);\
 
 
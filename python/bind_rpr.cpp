@@ -2408,7 +2408,7 @@ NB_MODULE(rpr, m) {
 	{
 		const int32_t* pluginIDs___pycast =    pluginIDs.size() == 0 ? nullptr :     &(((int32_t*)pluginIDs.data())[0]);
 
-		PYRPR_CHECK_ERROR( rprCreateContext(  api_version,  pluginIDs___pycast,  pluginCount,  creation_flags,  &(props[0]),  cache_path.c_str(),  &(out_context->h)   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprCreateContext(  api_version,  pluginIDs___pycast,  pluginCount,  creation_flags,  &(props[0]),  cache_path.c_str(),  &(out_context->h)   )  );
 		return ret;
 	});
 	m.def("ContextSetActivePlugin", []( PyRprContext* context,  rpr_int pluginID )
@@ -2577,7 +2577,7 @@ NB_MODULE(rpr, m) {
 	m.def("ContextRender", []( PyRprContext* context )
 	{
 
-		PYRPR_CHECK_ERROR( rprContextRender(  context->h   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprContextRender(  context->h   )  );
 		return ret;
 	});
 	m.def("ContextAbortRender", []( PyRprContext* context )
@@ -2589,37 +2589,37 @@ NB_MODULE(rpr, m) {
 	m.def("ContextRenderTile", []( PyRprContext* context,  rpr_uint xmin,  rpr_uint xmax,  rpr_uint ymin,  rpr_uint ymax )
 	{
 
-		PYRPR_CHECK_ERROR( rprContextRenderTile(  context->h,  xmin,  xmax,  ymin,  ymax   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprContextRenderTile(  context->h,  xmin,  xmax,  ymin,  ymax   )  );
 		return ret;
 	});
 	m.def("ContextClearMemory", []( PyRprContext* context )
 	{
 
-		PYRPR_CHECK_ERROR( rprContextClearMemory(  context->h   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprContextClearMemory(  context->h   )  );
 		return ret;
 	});
 	m.def("ContextCreateImage", []( PyRprContext* context,  rpr_image_format format,  rpr_image_desc* image_desc,  void* data,  PyRprImage* out_image )
 	{
 
-		PYRPR_CHECK_ERROR( rprContextCreateImage(  context->h,  format,  image_desc,  data,  &(out_image->h)   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprContextCreateImage(  context->h,  format,  image_desc,  data,  &(out_image->h)   )  );
 		return ret;
 	});
 	m.def("ContextCreateBuffer", []( PyRprContext* context,  rpr_buffer_desc* buffer_desc,  void* data,  PyRprBuffer* out_buffer )
 	{
 
-		PYRPR_CHECK_ERROR( rprContextCreateBuffer(  context->h,  buffer_desc,  data,  &(out_buffer->h)   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprContextCreateBuffer(  context->h,  buffer_desc,  data,  &(out_buffer->h)   )  );
 		return ret;
 	});
 	m.def("ContextCreateImageFromFile", []( PyRprContext* context,  std::string path,  PyRprImage* out_image )
 	{
 
-		PYRPR_CHECK_ERROR( rprContextCreateImageFromFile(  context->h,  path.c_str(),  &(out_image->h)   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprContextCreateImageFromFile(  context->h,  path.c_str(),  &(out_image->h)   )  );
 		return ret;
 	});
 	m.def("ContextCreateImageFromFileMemory", []( PyRprContext* context,  std::string extension,  void* data,  size_t dataSizeByte,  PyRprImage* out_image )
 	{
 
-		PYRPR_CHECK_ERROR( rprContextCreateImageFromFileMemory(  context->h,  extension.c_str(),  data,  dataSizeByte,  &(out_image->h)   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprContextCreateImageFromFileMemory(  context->h,  extension.c_str(),  data,  dataSizeByte,  &(out_image->h)   )  );
 		return ret;
 	});
 	m.def("ContextCreateScene", []( PyRprContext* context,  PyRprScene* out_scene )
@@ -2644,7 +2644,7 @@ NB_MODULE(rpr, m) {
 		const int32_t* texcoord_indices___pycast =    texcoord_indices.size() == 0 ? nullptr :     &(((int32_t*)texcoord_indices.data())[0]);
 		const int32_t* num_face_vertices___pycast =    num_face_vertices.size() == 0 ? nullptr :     &(((int32_t*)num_face_vertices.data())[0]);
 
-		PYRPR_CHECK_ERROR( rprContextCreateMesh(  context->h,  vertices___pycast,  num_vertices,  vertex_stride,  normals___pycast,  num_normals,  normal_stride,  texcoords___pycast,  num_texcoords,  texcoord_stride,  vertex_indices___pycast,  vidx_stride,  normal_indices___pycast,  nidx_stride,  texcoord_indices___pycast,  tidx_stride,  num_face_vertices___pycast,  num_faces,  &(out_mesh->h)   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprContextCreateMesh(  context->h,  vertices___pycast,  num_vertices,  vertex_stride,  normals___pycast,  num_normals,  normal_stride,  texcoords___pycast,  num_texcoords,  texcoord_stride,  vertex_indices___pycast,  vidx_stride,  normal_indices___pycast,  nidx_stride,  texcoord_indices___pycast,  tidx_stride,  num_face_vertices___pycast,  num_faces,  &(out_mesh->h)   )  );
 		return ret;
 	});
 	m.def("ContextCreateMeshEx", []( PyRprContext* context,  nb::ndarray<float_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> vertices, int vertices____offset,  size_t num_vertices,  rpr_int vertex_stride,  nb::ndarray<float_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> normals, int normals____offset,  size_t num_normals,  rpr_int normal_stride,  nb::ndarray<int32_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> perVertexFlag,  size_t num_perVertexFlags,  rpr_int perVertexFlag_stride,  rpr_int numberOfTexCoordLayers,  nb::ndarray<float_t, nb::shape<nb::any,nb::any>, nb::c_contig, nb::device::cpu> texcoords, int texcoords____offset,  nb::ndarray<size_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> num_texcoords,  nb::ndarray<int32_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> texcoord_stride,  nb::ndarray<int32_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> vertex_indices,  rpr_int vidx_stride,  nb::ndarray<int32_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> normal_indices,  rpr_int nidx_stride,  nb::ndarray<int32_t, nb::shape<nb::any,nb::any>, nb::c_contig, nb::device::cpu> texcoord_indices,  nb::ndarray<int32_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> tidx_stride,  nb::ndarray<int32_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> num_face_vertices,  size_t num_faces,  PyRprShape* out_mesh )
@@ -2661,7 +2661,7 @@ NB_MODULE(rpr, m) {
 		const int32_t* tidx_stride___pycast =    tidx_stride.size() == 0 ? nullptr :     &(((int32_t*)tidx_stride.data())[0]);
 		const int32_t* num_face_vertices___pycast =    num_face_vertices.size() == 0 ? nullptr :     &(((int32_t*)num_face_vertices.data())[0]);
 
-		PYRPR_CHECK_ERROR( rprContextCreateMeshEx(  context->h,  vertices___pycast,  num_vertices,  vertex_stride,  normals___pycast,  num_normals,  normal_stride,  perVertexFlag___pycast,  num_perVertexFlags,  perVertexFlag_stride,  numberOfTexCoordLayers,  texcoords___pycast,  num_texcoords___pycast,  texcoord_stride___pycast,  vertex_indices___pycast,  vidx_stride,  normal_indices___pycast,  nidx_stride,  texcoord_indices___pycast,  tidx_stride___pycast,  num_face_vertices___pycast,  num_faces,  &(out_mesh->h)   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprContextCreateMeshEx(  context->h,  vertices___pycast,  num_vertices,  vertex_stride,  normals___pycast,  num_normals,  normal_stride,  perVertexFlag___pycast,  num_perVertexFlags,  perVertexFlag_stride,  numberOfTexCoordLayers,  texcoords___pycast,  num_texcoords___pycast,  texcoord_stride___pycast,  vertex_indices___pycast,  vidx_stride,  normal_indices___pycast,  nidx_stride,  texcoord_indices___pycast,  tidx_stride___pycast,  num_face_vertices___pycast,  num_faces,  &(out_mesh->h)   )  );
 		return ret;
 	});
 	m.def("ContextCreateMeshEx2", []( PyRprContext* context,  nb::ndarray<float_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> vertices, int vertices____offset,  size_t num_vertices,  rpr_int vertex_stride,  nb::ndarray<float_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> normals, int normals____offset,  size_t num_normals,  rpr_int normal_stride,  nb::ndarray<int32_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> perVertexFlag,  size_t num_perVertexFlags,  rpr_int perVertexFlag_stride,  rpr_int numberOfTexCoordLayers,  nb::ndarray<float_t, nb::shape<nb::any,nb::any>, nb::c_contig, nb::device::cpu> texcoords, int texcoords____offset,  nb::ndarray<size_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> num_texcoords,  nb::ndarray<int32_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> texcoord_stride,  nb::ndarray<int32_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> vertex_indices,  rpr_int vidx_stride,  nb::ndarray<int32_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> normal_indices,  rpr_int nidx_stride,  nb::ndarray<int32_t, nb::shape<nb::any,nb::any>, nb::c_contig, nb::device::cpu> texcoord_indices,  nb::ndarray<int32_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> tidx_stride,  nb::ndarray<int32_t, nb::shape<nb::any>, nb::c_contig, nb::device::cpu> num_face_vertices,  size_t num_faces,  std::vector<uint32_t> mesh_properties,  PyRprShape* out_mesh )
@@ -2678,7 +2678,7 @@ NB_MODULE(rpr, m) {
 		const int32_t* tidx_stride___pycast =    tidx_stride.size() == 0 ? nullptr :     &(((int32_t*)tidx_stride.data())[0]);
 		const int32_t* num_face_vertices___pycast =    num_face_vertices.size() == 0 ? nullptr :     &(((int32_t*)num_face_vertices.data())[0]);
 
-		PYRPR_CHECK_ERROR( rprContextCreateMeshEx2(  context->h,  vertices___pycast,  num_vertices,  vertex_stride,  normals___pycast,  num_normals,  normal_stride,  perVertexFlag___pycast,  num_perVertexFlags,  perVertexFlag_stride,  numberOfTexCoordLayers,  texcoords___pycast,  num_texcoords___pycast,  texcoord_stride___pycast,  vertex_indices___pycast,  vidx_stride,  normal_indices___pycast,  nidx_stride,  texcoord_indices___pycast,  tidx_stride___pycast,  num_face_vertices___pycast,  num_faces,  &(mesh_properties[0]),  &(out_mesh->h)   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprContextCreateMeshEx2(  context->h,  vertices___pycast,  num_vertices,  vertex_stride,  normals___pycast,  num_normals,  normal_stride,  perVertexFlag___pycast,  num_perVertexFlags,  perVertexFlag_stride,  numberOfTexCoordLayers,  texcoords___pycast,  num_texcoords___pycast,  texcoord_stride___pycast,  vertex_indices___pycast,  vidx_stride,  normal_indices___pycast,  nidx_stride,  texcoord_indices___pycast,  tidx_stride___pycast,  num_face_vertices___pycast,  num_faces,  &(mesh_properties[0]),  &(out_mesh->h)   )  );
 		return ret;
 	});
 	m.def("ContextCreateCamera", []( PyRprContext* context,  PyRprCamera* out_camera )
@@ -3425,7 +3425,7 @@ NB_MODULE(rpr, m) {
 		const rpr_float* textureUV___pycast =    textureUV.size() == 0 ? nullptr :      &(((rpr_float*)textureUV.data())[0]);
 		const int32_t* segmentPerCurve___pycast =    segmentPerCurve.size() == 0 ? nullptr :     &(((int32_t*)segmentPerCurve.data())[0]);
 
-		PYRPR_CHECK_ERROR( rprContextCreateCurve(  context->h,  &(out_curve->h),  num_controlPoints,  controlPointsData___pycast,  controlPointsStride,  num_indices,  curveCount,  indicesData___pycast,  radius___pycast,  textureUV___pycast,  segmentPerCurve___pycast,  creationFlag_tapered   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprContextCreateCurve(  context->h,  &(out_curve->h),  num_controlPoints,  controlPointsData___pycast,  controlPointsStride,  num_indices,  curveCount,  indicesData___pycast,  radius___pycast,  textureUV___pycast,  segmentPerCurve___pycast,  creationFlag_tapered   )  );
 		return ret;
 	});
 	m.def("SceneAttachLight", []( PyRprScene* scene,  PyRprLight* light )
@@ -3497,7 +3497,7 @@ NB_MODULE(rpr, m) {
 	m.def("FrameBufferGetInfo", []( PyRprFramebuffer* framebuffer,  rpr_framebuffer_info info,  size_t size,  void* data,  size_t* size_ret )
 	{
 
-		PYRPR_CHECK_ERROR( rprFrameBufferGetInfo(  framebuffer->h,  info,  size,  data,  size_ret   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprFrameBufferGetInfo(  framebuffer->h,  info,  size,  data,  size_ret   )  );
 		return ret;
 	});
 	m.def("FrameBufferClear", []( PyRprFramebuffer* frame_buffer )
@@ -3515,19 +3515,19 @@ NB_MODULE(rpr, m) {
 	m.def("FrameBufferSaveToFile", []( PyRprFramebuffer* frame_buffer,  std::string file_path )
 	{
 
-		PYRPR_CHECK_ERROR( rprFrameBufferSaveToFile(  frame_buffer->h,  file_path.c_str()   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprFrameBufferSaveToFile(  frame_buffer->h,  file_path.c_str()   )  );
 		return ret;
 	});
 	m.def("FrameBufferSaveToFileEx", []( PyRprFramebuffer* framebufferList,  rpr_uint framebufferCount,  std::string filePath,  void* extraOptions )
 	{
 
-		PYRPR_CHECK_ERROR( rprFrameBufferSaveToFileEx(  &(framebufferList->h),  framebufferCount,  filePath.c_str(),  extraOptions   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprFrameBufferSaveToFileEx(  &(framebufferList->h),  framebufferCount,  filePath.c_str(),  extraOptions   )  );
 		return ret;
 	});
 	m.def("ContextResolveFrameBuffer", []( PyRprContext* context,  PyRprFramebuffer* src_frame_buffer,  PyRprFramebuffer* dst_frame_buffer,  rpr_bool noDisplayGamma )
 	{
 
-		PYRPR_CHECK_ERROR( rprContextResolveFrameBuffer(  context->h,  src_frame_buffer->h,  dst_frame_buffer->h,  noDisplayGamma   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprContextResolveFrameBuffer(  context->h,  src_frame_buffer->h,  dst_frame_buffer->h,  noDisplayGamma   )  );
 		return ret;
 	});
 	m.def("MaterialSystemGetInfo", []( PyRprMaterialSystem* in_material_system,  rpr_material_system_info type,  size_t in_size,  void* in_data,  size_t* out_size )
@@ -3629,7 +3629,7 @@ NB_MODULE(rpr, m) {
 	m.def("ContextCreateLUTFromFile", []( PyRprContext* context,  std::string fileLutPath,  PyRprLut* out_lut )
 	{
 
-		PYRPR_CHECK_ERROR( rprContextCreateLUTFromFile(  context->h,  fileLutPath.c_str(),  &(out_lut->h)   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprContextCreateLUTFromFile(  context->h,  fileLutPath.c_str(),  &(out_lut->h)   )  );
 		return ret;
 	});
 	m.def("ContextCreateLUTFromData", []( PyRprContext* context,  std::string lutData,  PyRprLut* out_lut )
@@ -3677,7 +3677,7 @@ NB_MODULE(rpr, m) {
 	m.def("CompositeCompute", []( PyRprComposite* composite,  PyRprFramebuffer* fb )
 	{
 
-		PYRPR_CHECK_ERROR( rprCompositeCompute(  composite->h,  fb->h   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprCompositeCompute(  composite->h,  fb->h   )  );
 		return ret;
 	});
 	m.def("CompositeGetInfo", []( PyRprComposite* composite,  rpr_composite_info composite_info,  size_t size,  void* data,  size_t* size_ret )
@@ -3761,7 +3761,7 @@ NB_MODULE(rpr, m) {
 	m.def("ContextCreateGrid", []( PyRprContext* context,  PyRprGrid* out_grid,  size_t gridSizeX,  size_t gridSizeY,  size_t gridSizeZ,  void* indicesList,  size_t numberOfIndices,  rpr_grid_indices_topology indicesListTopology,  void* gridData,  size_t gridDataSizeByte,  rpr_uint gridDataTopology___unused )
 	{
 
-		PYRPR_CHECK_ERROR( rprContextCreateGrid(  context->h,  &(out_grid->h),  gridSizeX,  gridSizeY,  gridSizeZ,  indicesList,  numberOfIndices,  indicesListTopology,  gridData,  gridDataSizeByte,  gridDataTopology___unused   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprContextCreateGrid(  context->h,  &(out_grid->h),  gridSizeX,  gridSizeY,  gridSizeZ,  indicesList,  numberOfIndices,  indicesListTopology,  gridData,  gridDataSizeByte,  gridDataTopology___unused   )  );
 		return ret;
 	});
 	m.def("ContextCreateHeteroVolume", []( PyRprContext* context,  PyRprHeteroVolume* out_heteroVolume )
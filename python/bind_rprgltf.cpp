@@ -15,7 +15,7 @@ NB_MODULE(rprgltf, m) {
 	m.def("Export", []( std::string rprsFileName,  PyRprContext* context,  PyRprScene* scene,  rpr_uint exportFlags,  PyRprsContext* rprsCtx )
 	{
 
-		PYRPR_CHECK_ERROR( rprExportToGLTF(
+		PYRPR_CHECK_ERROR_NOGIL( rprExportToGLTF(
 			rprsFileName.c_str(),  
 			context->h,  
 			nullptr,
@@ -28,7 +28,7 @@ NB_MODULE(rprgltf, m) {
 	m.def("Import", []( std::string rprsFileName,  PyRprContext* context,  PyRprMaterialSystem* materialSystem,  PyRprScene* scene,  rpr_uint importFlags,  PyRprsContext* rprsCtx )
 	{
 
-		PYRPR_CHECK_ERROR( rprImportFromGLTF(
+		PYRPR_CHECK_ERROR_NOGIL( rprImportFromGLTF(
 			rprsFileName.c_str(),  
 			context->h,  
 			materialSystem->h,
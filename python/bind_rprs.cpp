@@ -38,31 +38,31 @@ NB_MODULE(rprs, m) {
 
 		const rpr_float* extraCustomParam_float_values___pycast =    extraCustomParam_float_values.size() == 0 ? nullptr :      &(((rpr_float*)extraCustomParam_float_values.data())[0]);
 
-		PYRPR_CHECK_ERROR( rprsExport(  rprsFileName.c_str(),  context->h,  scene->h,  extraCustomParam_int_number,  extraCustomParam_int_names___pycast,  extraCustomParam_int_values___pycast,  extraCustomParam_float_number,  extraCustomParam_float_names___pycast,  extraCustomParam_float_values___pycast,  exportFlags,  rprsCtx->h   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprsExport(  rprsFileName.c_str(),  context->h,  scene->h,  extraCustomParam_int_number,  extraCustomParam_int_names___pycast,  extraCustomParam_int_values___pycast,  extraCustomParam_float_number,  extraCustomParam_float_names___pycast,  extraCustomParam_float_values___pycast,  exportFlags,  rprsCtx->h   )  );
 		return ret;
 	});
 	m.def("Import", []( std::string rprsFileName,  PyRprContext* context,  PyRprMaterialSystem* materialSystem,  PyRprScene* scene,  bool useAlreadyExistingScene,  PyRprsContext* rprsCtx )
 	{
 
-		PYRPR_CHECK_ERROR( rprsImport(  rprsFileName.c_str(),  context->h,  materialSystem->h,  &(scene->h),  useAlreadyExistingScene,  rprsCtx->h   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprsImport(  rprsFileName.c_str(),  context->h,  materialSystem->h,  &(scene->h),  useAlreadyExistingScene,  rprsCtx->h   )  );
 		return ret;
 	});
 	m.def("ImportFromData", []( rpr_uchar* data,  size_t dataSize,  PyRprContext* context,  PyRprMaterialSystem* materialSystem,  PyRprScene* scene,  bool useAlreadyExistingScene,  PyRprsContext* rprsCtx )
 	{
 
-		PYRPR_CHECK_ERROR( rprsImportFromData(  data,  dataSize,  context->h,  materialSystem->h,  &(scene->h),  useAlreadyExistingScene,  rprsCtx->h   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprsImportFromData(  data,  dataSize,  context->h,  materialSystem->h,  &(scene->h),  useAlreadyExistingScene,  rprsCtx->h   )  );
 		return ret;
 	});
 	m.def("BuildOCIOFiles", []( std::string rprsFileName,  PyRprContext* context,  std::string basePath,  PyRprsContext* rprsCtx )
 	{
 
-		PYRPR_CHECK_ERROR( rprsBuildOCIOFiles(  rprsFileName.c_str(),  context->h,  basePath.c_str(),  rprsCtx->h   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprsBuildOCIOFiles(  rprsFileName.c_str(),  context->h,  basePath.c_str(),  rprsCtx->h   )  );
 		return ret;
 	});
 	m.def("ExportCustomList", []( std::string rprsFileName,  int materialNode_number,  PyRprMaterialNode* materialNode_list,  int camera_number,  PyRprCamera* camera_list,  int light_number,  PyRprLight* light_list,  int shape_number,  PyRprShape* shape_list,  int image_number,  PyRprImage* image_list,  PyRprsContext* rprsCtx )
 	{
 
-		PYRPR_CHECK_ERROR( rprsExportCustomList(  rprsFileName.c_str(),  materialNode_number,  &(materialNode_list->h),  camera_number,  &(camera_list->h),  light_number,  &(light_list->h),  shape_number,  &(shape_list->h),  image_number,  &(image_list->h),  rprsCtx->h   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprsExportCustomList(  rprsFileName.c_str(),  materialNode_number,  &(materialNode_list->h),  camera_number,  &(camera_list->h),  light_number,  &(light_list->h),  shape_number,  &(shape_list->h),  image_number,  &(image_list->h),  rprsCtx->h   )  );
 		return ret;
 	});
 	m.def("AddExtraCamera", []( PyRprCamera* extraCam )
@@ -92,13 +92,13 @@ NB_MODULE(rprs, m) {
 	m.def("ExportToXML", []( std::string rprsFilePath,  std::string xmlFileOut )
 	{
 
-		PYRPR_CHECK_ERROR( rprsExportToXML(  rprsFilePath.c_str(),  xmlFileOut.c_str()   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprsExportToXML(  rprsFilePath.c_str(),  xmlFileOut.c_str()   )  );
 		return ret;
 	});
 	m.def("ExportToXMLEx", []( PyRprsContext* rprsCtx,  std::string rprsFilePath,  std::string xmlFileOut )
 	{
 
-		PYRPR_CHECK_ERROR( rprsExportToXMLEx(  rprsCtx->h,  rprsFilePath.c_str(),  xmlFileOut.c_str()   )  );
+		PYRPR_CHECK_ERROR_NOGIL( rprsExportToXMLEx(  rprsCtx->h,  rprsFilePath.c_str(),  xmlFileOut.c_str()   )  );
 		return ret;
 	});
 	m.def("AssignShapeToGroup", []( PyRprShape* shape,  std::string groupName )
@@ -0,0 +1,103 @@
+#
+# Generates rprStub_generated.cpp : a no-op implementation of every function of the RPR C API.
+#
+# usage:   python generate_stub.py
+#
+# Functions already implemented in rprStub.cpp are skipped.
+# Output handles ( parameters named out_* of a rpr handle type ) of the creation functions are filled with a new RprStubObject,
+# so that the Python scripts can chain creations and deletions like with the real library.
+# The other functions don't create anything: their output handles are set to null ( the stub doesn't track the objects ).
+# The unused parameters are unnamed ( name in comment ), so that the stub builds without -Wunused-parameter warnings.
+#
+
+
+import os
+import re
+
+
+scriptDir = os.path.dirname(os.path.abspath(__file__))
+headerPath = os.path.join(scriptDir, '../../RadeonProRender/inc/RadeonProRender_v2.h')
+customPath = os.path.join(scriptDir, 'rprStub.cpp')
+outputPath = os.path.join(scriptDir, 'rprStub_generated.cpp')
+
+
+reFunction = re.compile(r'^(?:\s|\*/)*extern RPR_API_ENTRY\s+(\w+)\s+(rpr\w+)\s*\((.*)\)\s*;\s*$')
+reHandle = re.compile(r'^typedef struct (\w+)_t \{ void\*_; \} \* (\w+);')
+reCustom = re.compile(r'^RPR_STUB_EXPORT\s+\w+\s+(rpr\w+)\s*\(')
+
+
+def ParseParameter(param):
+	# returns (type, name) from a string like "rpr_float const * vertices"
+	param = param.strip()
+	m = re.match(r'^(.*?)(\w+)$', param)
+	if not m:
+		return (param, '')
+	return (m.group(1).strip(), m.group(2))
+
+
+def main():
+	handleTypes = set()
+	functions = []
+	with open(headerPath) as f:
+		for line in f:
+			m = reHandle.match(line)
+			if m:
+				handleTypes.add(m.group(2))
+				continue
+			m = reFunction.match(line)
+			if m:
+				functions.append( (m.group(1), m.group(2), m.group(3)) )
+
+	customFunctions = set()
+	with open(customPath) as f:
+		for line in f:
+			m = reCustom.match(line)
+			if m:
+				customFunctions.add(m.group(1))
+
+	out = []
+	out.append('#include "rprStub.h"')
+	out.append('')
+	out.append('')
+	out.append('//')
+	out.append('//')
+	out.append('// FILE GENERATED BY generate_stub.py - DO NOT MODIFY IT DIRECTLY.')
+	out.append('//')
+	out.append('//')
+	out.append('')
+	out.append('')
+
+	for retType, name, params in functions:
+		if name in customFunctions:
+			continue
+
+		body = []
+		outParams = []
+		for param in params.split(','):
+			paramType, paramName = ParseParameter(param)
+			m = re.match(r'^(\w+)\s*\*$', paramType)
+			if paramName.startswith('out_') and m and m.group(1) in handleTypes:
+				if 'Create' in name:
+					body.append('\tif ( %s ) { *%s = (%s)RprStub_CreateObject(); }' % (paramName, paramName, m.group(1)))
+				else:
+					body.append('\tif ( %s ) { *%s = nullptr; }' % (paramName, paramName))
+				outParams.append(param.strip())
+			elif paramType and paramName and paramType != 'void':
+				outParams.append('%s /*%s*/' % (paramType, paramName))
+			else:
+				outParams.append(param.strip())
+
+		out.append('RPR_STUB_EXPORT %s %s(%s)' % (retType, name, ', '.join(outParams)))
+		out.append('{')
+		out += body
+		out.append('\treturn RPR_SUCCESS;')
+		out.append('}')
+
+	with open(outputPath, 'w', newline='\n') as f:
+		f.write('\n'.join(out) + '\n')
+
+	print('%d functions generated in %s' % (len(functions) - len(customFunctions), outputPath))
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,231 @@
+#include "rprStub.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+
+//
+// Hand written functions of the stub.
+// generate_stub.py doesn't generate the functions defined in this file.
+//
+// Environment variables:
+//   RPR_STUB_LATENCY_MS : duration in milliseconds of rprContextRender, rprContextRenderTile and rprContextResolveFrameBuffer.
+//                         Default is 0. Used to simulate a long rendering.
+//
+
+
+namespace
+{
+
+int GetLatencyMs()
+{
+	static const int s_latencyMs = []()
+	{
+		const char* env = std::getenv("RPR_STUB_LATENCY_MS");
+		return env ? std::atoi(env) : 0;
+	}();
+	return s_latencyMs;
+}
+
+// wait for the simulated latency. return false if the render has been aborted in the meantime.
+bool SimulateWork(RprStubObject* context)
+{
+	const auto endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(GetLatencyMs());
+	while ( std::chrono::steady_clock::now() < endTime )
+	{
+		if ( context && context->abortRender.exchange(false) )
+			return false;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	return true;
+}
+
+size_t GetComponentSize(rpr_component_type type)
+{
+	switch (type)
+	{
+		case RPR_COMPONENT_TYPE_UINT8: return 1;
+		case RPR_COMPONENT_TYPE_FLOAT16: return 2;
+		case RPR_COMPONENT_TYPE_FLOAT32: return 4;
+		case RPR_COMPONENT_TYPE_UINT32: return 4;
+		default: return 0;
+	}
+}
+
+// float32 -> float16 , no denormals, enough for a stub.
+uint16_t FloatToHalf(float f)
+{
+	uint32_t x;
+	std::memcpy(&x, &f, sizeof(x));
+	const uint32_t sign = (x >> 16) & 0x8000;
+	const int32_t exponent = (int32_t)((x >> 23) & 0xff) - 127 + 15;
+	const uint32_t mantissa = x & 0x7fffff;
+	if ( exponent <= 0 )
+		return (uint16_t)sign;
+	if ( exponent >= 31 )
+		return (uint16_t)(sign | 0x7c00);
+	return (uint16_t)(sign | (exponent << 10) | (mantissa >> 13));
+}
+
+}
+
+
+RprStubObject* RprStub_CreateObject()
+{
+	return new RprStubObject();
+}
+
+RPR_STUB_EXPORT rpr_int rprRegisterPlugin(rpr_char const * /*path*/)
+{
+	return 0;
+}
+
+RPR_STUB_EXPORT rpr_status rprObjectDelete(void * obj)
+{
+	delete (RprStubObject*)obj;
+	return RPR_SUCCESS;
+}
+
+RPR_STUB_EXPORT rpr_status rprContextRender(rpr_context context)
+{
+	return SimulateWork((RprStubObject*)context) ? RPR_SUCCESS : RPR_ERROR_ABORTED;
+}
+
+RPR_STUB_EXPORT rpr_status rprContextRenderTile(rpr_context context, rpr_uint /*xmin*/, rpr_uint /*xmax*/, rpr_uint /*ymin*/, rpr_uint /*ymax*/)
+{
+	return SimulateWork((RprStubObject*)context) ? RPR_SUCCESS : RPR_ERROR_ABORTED;
+}
+
+RPR_STUB_EXPORT rpr_status rprContextAbortRender(rpr_context context)
+{
+	if ( !context )
+		return RPR_ERROR_NULLPTR;
+	((RprStubObject*)context)->abortRender = true;
+	return RPR_SUCCESS;
+}
+
+// the framebuffers are owned by the caller: rprContextGetAOV returns the one set, it doesn't create any
+RPR_STUB_EXPORT rpr_status rprContextSetAOV(rpr_context context, rpr_aov aov, rpr_framebuffer frame_buffer)
+{
+	if ( !context )
+		return RPR_ERROR_NULLPTR;
+	std::vector<rpr_framebuffer>& aovs = ((RprStubObject*)context)->aovs;
+	if ( aov >= aovs.size() )
+		aovs.resize(aov + 1, nullptr);
+	aovs[aov] = frame_buffer;
+	return RPR_SUCCESS;
+}
+
+RPR_STUB_EXPORT rpr_status rprContextGetAOV(rpr_context context, rpr_aov aov, rpr_framebuffer * out_fb)
+{
+	if ( !context || !out_fb )
+		return RPR_ERROR_NULLPTR;
+	const std::vector<rpr_framebuffer>& aovs = ((RprStubObject*)context)->aovs;
+	*out_fb = aov < aovs.size() ? aovs[aov] : nullptr;
+	return RPR_SUCCESS;
+}
+
+RPR_STUB_EXPORT rpr_status rprContextCreateFrameBuffer(rpr_context /*context*/, rpr_framebuffer_format const format, rpr_framebuffer_desc const * fb_desc, rpr_framebuffer * out_fb)
+{
+	if ( !fb_desc || !out_fb )
+		return RPR_ERROR_NULLPTR;
+
+	const size_t componentSize = GetComponentSize(format.type);
+	if ( componentSize == 0 || format.num_components == 0 || format.num_components > 4 )
+		return RPR_ERROR_INVALID_PARAMETER;
+
+	RprStubObject* fb = RprStub_CreateObject();
+	fb->fbFormat = format;
+	fb->fbDesc = *fb_desc;
+	fb->fbData.resize( (size_t)fb_desc->fb_width * fb_desc->fb_height * format.num_components * componentSize , 0 );
+	*out_fb = (rpr_framebuffer)fb;
+	return RPR_SUCCESS;
+}
+
+RPR_STUB_EXPORT rpr_status rprFrameBufferGetInfo(rpr_framebuffer framebuffer, rpr_framebuffer_info info, size_t size, void * data, size_t * size_ret)
+{
+	if ( !framebuffer )
+		return RPR_ERROR_NULLPTR;
+	RprStubObject* fb = (RprStubObject*)framebuffer;
+
+	const void* src = nullptr;
+	size_t srcSize = 0;
+	switch (info)
+	{
+		case RPR_FRAMEBUFFER_FORMAT: src = &fb->fbFormat; srcSize = sizeof(fb->fbFormat); break;
+		case RPR_FRAMEBUFFER_DESC: src = &fb->fbDesc; srcSize = sizeof(fb->fbDesc); break;
+		case RPR_FRAMEBUFFER_DATA: src = fb->fbData.data(); srcSize = fb->fbData.size(); break;
+		default: return RPR_ERROR_INVALID_PARAMETER;
+	}
+
+	if ( size_ret )
+		*size_ret = srcSize;
+	if ( data )
+	{
+		if ( size < srcSize )
+			return RPR_ERROR_INVALID_PARAMETER;
+		std::memcpy(data, src, srcSize);
+	}
+	return RPR_SUCCESS;
+}
+
+RPR_STUB_EXPORT rpr_status rprFrameBufferFillWithColor(rpr_framebuffer frame_buffer, rpr_float r, rpr_float g, rpr_float b, rpr_float a)
+{
+	if ( !frame_buffer )
+		return RPR_ERROR_NULLPTR;
+	RprStubObject* fb = (RprStubObject*)frame_buffer;
+
+	const float color[4] = { r, g, b, a };
+	const size_t nbComponents = fb->fbFormat.num_components;
+	const size_t componentSize = GetComponentSize(fb->fbFormat.type);
+	const size_t nbPixels = (size_t)fb->fbDesc.fb_width * fb->fbDesc.fb_height;
+	for(size_t i=0; i<nbPixels; i++)
+	{
+		for(size_t c=0; c<nbComponents; c++)
+		{
+			unsigned char* dst = &fb->fbData[ (i*nbComponents + c) * componentSize ];
+			if ( fb->fbFormat.type == RPR_COMPONENT_TYPE_FLOAT32 )
+			{
+				std::memcpy(dst, &color[c], sizeof(float));
+			}
+			else if ( fb->fbFormat.type == RPR_COMPONENT_TYPE_FLOAT16 )
+			{
+				const uint16_t h = FloatToHalf(color[c]);
+				std::memcpy(dst, &h, sizeof(h));
+			}
+			else if ( fb->fbFormat.type == RPR_COMPONENT_TYPE_UINT8 )
+			{
+				const float v = color[c] < 0.0f ? 0.0f : ( color[c] > 1.0f ? 1.0f : color[c] );
+				*dst = (unsigned char)(v * 255.0f + 0.5f);
+			}
+			else
+			{
+				const uint32_t v = (uint32_t)color[c];
+				std::memcpy(dst, &v, sizeof(v));
+			}
+		}
+	}
+	return RPR_SUCCESS;
+}
+
+RPR_STUB_EXPORT rpr_status rprFrameBufferClear(rpr_framebuffer frame_buffer)
+{
+	return rprFrameBufferFillWithColor(frame_buffer, 0.0f, 0.0f, 0.0f, 0.0f);
+}
+
+RPR_STUB_EXPORT rpr_status rprContextResolveFrameBuffer(rpr_context /*context*/, rpr_framebuffer src_frame_buffer, rpr_framebuffer dst_frame_buffer, rpr_bool /*noDisplayGamma*/)
+{
+	if ( !src_frame_buffer || !dst_frame_buffer )
+		return RPR_ERROR_NULLPTR;
+
+	SimulateWork(nullptr);
+
+	RprStubObject* src = (RprStubObject*)src_frame_buffer;
+	RprStubObject* dst = (RprStubObject*)dst_frame_buffer;
+	if ( src->fbData.size() == dst->fbData.size() )
+		dst->fbData = src->fbData;
+	return RPR_SUCCESS;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+//
+// Stub of the RPR core library ( libRadeonProRender64 ).
+// All the functions of the C API are implemented as no-op returning RPR_SUCCESS.
+// It's used to test the Python binding without GPU and without the real core library.
+//
+// The list of functions is generated by generate_stub.py from RadeonProRender_v2.h
+// The functions needing a behavior ( render latency, framebuffer data ... ) are written by hand in rprStub.cpp
+//
+
+
+#ifndef RPR_API_USE_HEADER_V2
+#define RPR_API_USE_HEADER_V2
+#endif
+#include <RadeonProRender.h>
+
+#include <atomic>
+#include <vector>
+
+
+#if defined(_WIN32)
+#define RPR_STUB_EXPORT extern "C" __declspec(dllexport)
+#else
+#define RPR_STUB_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+
+// every rpr handle created by the stub points to a RprStubObject
+struct RprStubObject
+{
+	// rpr_context only
+	std::atomic<bool> abortRender { false };
+	std::vector<rpr_framebuffer> aovs; // indexed by rpr_aov, set by rprContextSetAOV
+
+	// rpr_framebuffer only
+	rpr_framebuffer_format fbFormat = { 0, RPR_COMPONENT_TYPE_UNKNOWN };
+	rpr_framebuffer_desc fbDesc = { 0, 0 };
+	std::vector<unsigned char> fbData;
+};
+
+RprStubObject* RprStub_CreateObject();
@@ -0,0 +1,934 @@
+#include "rprStub.h"
+
+
+//
+//
+// FILE GENERATED BY generate_stub.py - DO NOT MODIFY IT DIRECTLY.
+//
+//
+
+
+RPR_STUB_EXPORT rpr_status rprCreateContext(rpr_uint /*api_version*/, rpr_int const * /*pluginIDs*/, size_t /*pluginCount*/, rpr_creation_flags /*creation_flags*/, rpr_context_properties const * /*props*/, rpr_char const * /*cache_path*/, rpr_context * out_context)
+{
+	if ( out_context ) { *out_context = (rpr_context)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextSetActivePlugin(rpr_context /*context*/, rpr_int /*pluginID*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextGetInfo(rpr_context /*context*/, rpr_context_info /*context_info*/, size_t /*size*/, void * /*data*/, size_t * /*size_ret*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextGetParameterInfo(rpr_context /*context*/, int /*param_idx*/, rpr_parameter_info /*parameter_info*/, size_t /*size*/, void * /*data*/, size_t * /*size_ret*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextAttachRenderLayer(rpr_context /*context*/, rpr_char const * /*renderLayerString*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextDetachRenderLayer(rpr_context /*context*/, rpr_char const * /*renderLayerString*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprFrameBufferSetLPE(rpr_framebuffer /*frame_buffer*/, rpr_char const * /*lpe*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextSetAOVindexLookup(rpr_context /*context*/, rpr_int /*key*/, rpr_float /*colorR*/, rpr_float /*colorG*/, rpr_float /*colorB*/, rpr_float /*colorA*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextSetCuttingPlane(rpr_context /*context*/, rpr_int /*index*/, rpr_float /*a*/, rpr_float /*b*/, rpr_float /*c*/, rpr_float /*d*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextSetAOVindicesLookup(rpr_context /*context*/, rpr_int /*keyOffset*/, rpr_int /*keyCount*/, rpr_float const * /*colorRGBA*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextSetUserTexture(rpr_context /*context*/, rpr_int /*index*/, rpr_char const * /*gpuCode*/, void * /*cpuCode*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextGetUserTexture(rpr_context /*context*/, rpr_int /*index*/, size_t /*bufferSizeByte*/, void * /*buffer*/, size_t * /*size_ret*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextSetScene(rpr_context /*context*/, rpr_scene /*scene*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextGetScene(rpr_context /*arg0*/, rpr_scene * out_scene)
+{
+	if ( out_scene ) { *out_scene = nullptr; }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextSetParameterByKey1u(rpr_context /*context*/, rpr_context_info /*in_input*/, rpr_uint /*x*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextSetParameterByKeyPtr(rpr_context /*context*/, rpr_context_info /*in_input*/, void * /*x*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextSetParameterByKey1f(rpr_context /*context*/, rpr_context_info /*in_input*/, rpr_float /*x*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextSetParameterByKey3f(rpr_context /*context*/, rpr_context_info /*in_input*/, rpr_float /*x*/, rpr_float /*y*/, rpr_float /*z*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextSetParameterByKey4f(rpr_context /*context*/, rpr_context_info /*in_input*/, rpr_float /*x*/, rpr_float /*y*/, rpr_float /*z*/, rpr_float /*w*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextSetParameterByKeyString(rpr_context /*context*/, rpr_context_info /*in_input*/, rpr_char const * /*value*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextSetInternalParameter4f(rpr_context /*context*/, rpr_uint /*pluginIndex*/, rpr_char const * /*paramName*/, rpr_float /*x*/, rpr_float /*y*/, rpr_float /*z*/, rpr_float /*w*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextSetInternalParameter1u(rpr_context /*context*/, rpr_uint /*pluginIndex*/, rpr_char const * /*paramName*/, rpr_uint /*x*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextSetInternalParameterBuffer(rpr_context /*context*/, rpr_uint /*pluginIndex*/, rpr_char const * /*paramName*/, void const * /*buffer*/, size_t /*bufferSizeByte*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextGetInternalParameter4f(rpr_context /*context*/, rpr_uint /*pluginIndex*/, rpr_char const * /*paramName*/, rpr_float * /*x*/, rpr_float * /*y*/, rpr_float * /*z*/, rpr_float * /*w*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextGetInternalParameter1u(rpr_context /*context*/, rpr_uint /*pluginIndex*/, rpr_char const * /*paramName*/, rpr_uint * /*x*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextGetInternalParameterBuffer(rpr_context /*context*/, rpr_uint /*pluginIndex*/, rpr_char const * /*paramName*/, size_t /*bufferSizeByte*/, void * /*buffer*/, size_t * /*size_ret*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextClearMemory(rpr_context /*context*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateImage(rpr_context /*context*/, rpr_image_format const /*format*/, rpr_image_desc const * /*image_desc*/, void const * /*data*/, rpr_image * out_image)
+{
+	if ( out_image ) { *out_image = (rpr_image)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateBuffer(rpr_context /*context*/, rpr_buffer_desc const * /*buffer_desc*/, void const * /*data*/, rpr_buffer * out_buffer)
+{
+	if ( out_buffer ) { *out_buffer = (rpr_buffer)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateImageFromFile(rpr_context /*context*/, rpr_char const * /*path*/, rpr_image * out_image)
+{
+	if ( out_image ) { *out_image = (rpr_image)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateImageFromFileMemory(rpr_context /*context*/, rpr_char const * /*extension*/, void const * /*data*/, size_t /*dataSizeByte*/, rpr_image * out_image)
+{
+	if ( out_image ) { *out_image = (rpr_image)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateScene(rpr_context /*context*/, rpr_scene * out_scene)
+{
+	if ( out_scene ) { *out_scene = (rpr_scene)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateInstance(rpr_context /*context*/, rpr_shape /*shape*/, rpr_shape * out_instance)
+{
+	if ( out_instance ) { *out_instance = (rpr_shape)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateMesh(rpr_context /*context*/, rpr_float const * /*vertices*/, size_t /*num_vertices*/, rpr_int /*vertex_stride*/, rpr_float const * /*normals*/, size_t /*num_normals*/, rpr_int /*normal_stride*/, rpr_float const * /*texcoords*/, size_t /*num_texcoords*/, rpr_int /*texcoord_stride*/, rpr_int const * /*vertex_indices*/, rpr_int /*vidx_stride*/, rpr_int const * /*normal_indices*/, rpr_int /*nidx_stride*/, rpr_int const * /*texcoord_indices*/, rpr_int /*tidx_stride*/, rpr_int const * /*num_face_vertices*/, size_t /*num_faces*/, rpr_shape * out_mesh)
+{
+	if ( out_mesh ) { *out_mesh = (rpr_shape)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateMeshEx(rpr_context /*context*/, rpr_float const * /*vertices*/, size_t /*num_vertices*/, rpr_int /*vertex_stride*/, rpr_float const * /*normals*/, size_t /*num_normals*/, rpr_int /*normal_stride*/, rpr_int const * /*perVertexFlag*/, size_t /*num_perVertexFlags*/, rpr_int /*perVertexFlag_stride*/, rpr_int /*numberOfTexCoordLayers*/, rpr_float const ** /*texcoords*/, size_t const * /*num_texcoords*/, rpr_int const * /*texcoord_stride*/, rpr_int const * /*vertex_indices*/, rpr_int /*vidx_stride*/, rpr_int const * /*normal_indices*/, rpr_int /*nidx_stride*/, rpr_int const ** /*texcoord_indices*/, rpr_int const * /*tidx_stride*/, rpr_int const * /*num_face_vertices*/, size_t /*num_faces*/, rpr_shape * out_mesh)
+{
+	if ( out_mesh ) { *out_mesh = (rpr_shape)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateMeshEx2(rpr_context /*context*/, rpr_float const * /*vertices*/, size_t /*num_vertices*/, rpr_int /*vertex_stride*/, rpr_float const * /*normals*/, size_t /*num_normals*/, rpr_int /*normal_stride*/, rpr_int const * /*perVertexFlag*/, size_t /*num_perVertexFlags*/, rpr_int /*perVertexFlag_stride*/, rpr_int /*numberOfTexCoordLayers*/, rpr_float const ** /*texcoords*/, size_t const * /*num_texcoords*/, rpr_int const * /*texcoord_stride*/, rpr_int const * /*vertex_indices*/, rpr_int /*vidx_stride*/, rpr_int const * /*normal_indices*/, rpr_int /*nidx_stride*/, rpr_int const ** /*texcoord_indices*/, rpr_int const * /*tidx_stride*/, rpr_int const * /*num_face_vertices*/, size_t /*num_faces*/, rpr_mesh_info const * /*mesh_properties*/, rpr_shape * out_mesh)
+{
+	if ( out_mesh ) { *out_mesh = (rpr_shape)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateCamera(rpr_context /*context*/, rpr_camera * out_camera)
+{
+	if ( out_camera ) { *out_camera = (rpr_camera)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextGetFunctionPtr(rpr_context /*context*/, rpr_char const * /*function_name*/, void ** /*out_function_ptr*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraGetInfo(rpr_camera /*camera*/, rpr_camera_info /*camera_info*/, size_t /*size*/, void * /*data*/, size_t * /*size_ret*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetFocalLength(rpr_camera /*camera*/, rpr_float /*flength*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetMotionTransformCount(rpr_camera /*camera*/, rpr_uint /*transformCount*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetMotionTransform(rpr_camera /*camera*/, rpr_bool /*transpose*/, rpr_float const * /*transform*/, rpr_uint /*timeIndex*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetFocusDistance(rpr_camera /*camera*/, rpr_float /*fdist*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetTransform(rpr_camera /*camera*/, rpr_bool /*transpose*/, rpr_float const * /*transform*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetSensorSize(rpr_camera /*camera*/, rpr_float /*width*/, rpr_float /*height*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraLookAt(rpr_camera /*camera*/, rpr_float /*posx*/, rpr_float /*posy*/, rpr_float /*posz*/, rpr_float /*atx*/, rpr_float /*aty*/, rpr_float /*atz*/, rpr_float /*upx*/, rpr_float /*upy*/, rpr_float /*upz*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetFStop(rpr_camera /*camera*/, rpr_float /*fstop*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetApertureBlades(rpr_camera /*camera*/, rpr_uint /*num_blades*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetExposure(rpr_camera /*camera*/, rpr_float /*exposure*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetMode(rpr_camera /*camera*/, rpr_camera_mode /*mode*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetOrthoWidth(rpr_camera /*camera*/, rpr_float /*width*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetFocalTilt(rpr_camera /*camera*/, rpr_float /*tilt*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetIPD(rpr_camera /*camera*/, rpr_float /*ipd*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetLensShift(rpr_camera /*camera*/, rpr_float /*shiftx*/, rpr_float /*shifty*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetTiltCorrection(rpr_camera /*camera*/, rpr_float /*tiltX*/, rpr_float /*tiltY*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetOrthoHeight(rpr_camera /*camera*/, rpr_float /*height*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetNearPlane(rpr_camera /*camera*/, rpr_float /*near*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetPostScale(rpr_camera /*camera*/, rpr_float /*scale*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetFarPlane(rpr_camera /*camera*/, rpr_float /*far*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCameraSetUVDistortion(rpr_camera /*camera*/, rpr_image /*distortionMap*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprImageGetInfo(rpr_image /*image*/, rpr_image_info /*image_info*/, size_t /*size*/, void * /*data*/, size_t * /*size_ret*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprImageSetWrap(rpr_image /*image*/, rpr_image_wrap_type /*type*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprImageSetInternalCompression(rpr_image /*image*/, rpr_uint /*compressionEnabled*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprImageSetOcioColorspace(rpr_image /*image*/, rpr_char const * /*ocioColorspace*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprImageSetUDIM(rpr_image /*imageUdimRoot*/, rpr_uint /*tileIndex*/, rpr_image /*imageTile*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprImageSetFilter(rpr_image /*image*/, rpr_image_filter_type /*type*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprImageSetGamma(rpr_image /*image*/, rpr_float /*type*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprImageSetMipmapEnabled(rpr_image /*image*/, rpr_bool /*enabled*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetTransform(rpr_shape /*shape*/, rpr_bool /*transpose*/, rpr_float const * /*transform*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetVertexValue(rpr_shape /*in_shape*/, rpr_int /*setIndex*/, rpr_int const * /*indices*/, rpr_float const * /*values*/, rpr_int /*indicesCount*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetPrimvar(rpr_shape /*in_shape*/, rpr_uint /*key*/, rpr_float const * /*data*/, rpr_uint /*floatCount*/, rpr_uint /*componentCount*/, rpr_primvar_interpolation_type /*interop*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetSubdivisionFactor(rpr_shape /*shape*/, rpr_uint /*factor*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetSubdivisionAutoRatioCap(rpr_shape /*shape*/, rpr_float /*autoRatioCap*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetSubdivisionCreaseWeight(rpr_shape /*shape*/, rpr_float /*factor*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeAttachRenderLayer(rpr_shape /*shape*/, rpr_char const * /*renderLayerString*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeDetachRenderLayer(rpr_shape /*shape*/, rpr_char const * /*renderLayerString*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprLightAttachRenderLayer(rpr_light /*light*/, rpr_char const * /*renderLayerString*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprLightDetachRenderLayer(rpr_light /*light*/, rpr_char const * /*renderLayerString*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetSubdivisionBoundaryInterop(rpr_shape /*shape*/, rpr_subdiv_boundary_interfop_type /*type*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeAutoAdaptSubdivisionFactor(rpr_shape /*shape*/, rpr_framebuffer /*framebuffer*/, rpr_camera /*camera*/, rpr_int /*factor*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetDisplacementScale(rpr_shape /*shape*/, rpr_float /*minscale*/, rpr_float /*maxscale*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetObjectGroupID(rpr_shape /*shape*/, rpr_uint /*objectGroupID*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetObjectID(rpr_shape /*shape*/, rpr_uint /*objectID*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetLightGroupID(rpr_shape /*shape*/, rpr_uint /*lightGroupID*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetLayerMask(rpr_shape /*shape*/, rpr_uint /*layerMask*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetDisplacementMaterial(rpr_shape /*shape*/, rpr_material_node /*materialNode*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetMaterial(rpr_shape /*shape*/, rpr_material_node /*node*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetMaterialFaces(rpr_shape /*shape*/, rpr_material_node /*node*/, rpr_int const * /*face_indices*/, size_t /*num_faces*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetVolumeMaterial(rpr_shape /*shape*/, rpr_material_node /*node*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetMotionTransformCount(rpr_shape /*shape*/, rpr_uint /*transformCount*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetMotionTransform(rpr_shape /*shape*/, rpr_bool /*transpose*/, rpr_float const * /*transform*/, rpr_uint /*timeIndex*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetVisibilityFlag(rpr_shape /*shape*/, rpr_shape_info /*visibilityFlag*/, rpr_bool /*visible*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCurveSetVisibilityFlag(rpr_curve /*curve*/, rpr_curve_parameter /*visibilityFlag*/, rpr_bool /*visible*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetVisibility(rpr_shape /*shape*/, rpr_bool /*visible*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprLightSetVisibilityFlag(rpr_light /*light*/, rpr_light_info /*visibilityFlag*/, rpr_bool /*visible*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCurveSetVisibility(rpr_curve /*curve*/, rpr_bool /*visible*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetVisibilityInSpecular(rpr_shape /*shape*/, rpr_bool /*visible*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetShadowCatcher(rpr_shape /*shape*/, rpr_bool /*shadowCatcher*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetShadowColor(rpr_shape /*shape*/, rpr_float /*r*/, rpr_float /*g*/, rpr_float /*b*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetReflectionCatcher(rpr_shape /*shape*/, rpr_bool /*reflectionCatcher*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetContourIgnore(rpr_shape /*shape*/, rpr_bool /*ignoreInContour*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetEnvironmentLight(rpr_shape /*shape*/, rpr_bool /*envLight*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeMarkStatic(rpr_shape /*in_shape*/, rpr_bool /*in_is_static*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprLightSetTransform(rpr_light /*light*/, rpr_bool /*transpose*/, rpr_float const * /*transform*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprLightSetGroupId(rpr_light /*light*/, rpr_uint /*groupId*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeGetInfo(rpr_shape /*arg0*/, rpr_shape_info /*arg1*/, size_t /*arg2*/, void * /*arg3*/, size_t * /*arg4*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprMeshGetInfo(rpr_shape /*mesh*/, rpr_mesh_info /*mesh_info*/, size_t /*size*/, void * /*data*/, size_t * /*size_ret*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCurveGetInfo(rpr_curve /*curve*/, rpr_curve_parameter /*curve_info*/, size_t /*size*/, void * /*data*/, size_t * /*size_ret*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprHeteroVolumeGetInfo(rpr_hetero_volume /*heteroVol*/, rpr_hetero_volume_parameter /*heteroVol_info*/, size_t /*size*/, void * /*data*/, size_t * /*size_ret*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprGridGetInfo(rpr_grid /*grid*/, rpr_grid_parameter /*grid_info*/, size_t /*size*/, void * /*data*/, size_t * /*size_ret*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprBufferGetInfo(rpr_buffer /*buffer*/, rpr_buffer_info /*buffer_info*/, size_t /*size*/, void * /*data*/, size_t * /*size_ret*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprInstanceGetBaseShape(rpr_shape /*shape*/, rpr_shape * out_shape)
+{
+	if ( out_shape ) { *out_shape = nullptr; }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreatePointLight(rpr_context /*context*/, rpr_light * out_light)
+{
+	if ( out_light ) { *out_light = (rpr_light)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprPointLightSetRadiantPower3f(rpr_light /*light*/, rpr_float /*r*/, rpr_float /*g*/, rpr_float /*b*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateSpotLight(rpr_context /*context*/, rpr_light * /*light*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateSphereLight(rpr_context /*context*/, rpr_light * /*light*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateDiskLight(rpr_context /*context*/, rpr_light * /*light*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSpotLightSetRadiantPower3f(rpr_light /*light*/, rpr_float /*r*/, rpr_float /*g*/, rpr_float /*b*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSpotLightSetImage(rpr_light /*light*/, rpr_image /*img*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSphereLightSetRadiantPower3f(rpr_light /*light*/, rpr_float /*r*/, rpr_float /*g*/, rpr_float /*b*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSphereLightSetRadius(rpr_light /*light*/, rpr_float /*radius*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprDiskLightSetRadiantPower3f(rpr_light /*light*/, rpr_float /*r*/, rpr_float /*g*/, rpr_float /*b*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprDiskLightSetRadius(rpr_light /*light*/, rpr_float /*radius*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprDiskLightSetAngle(rpr_light /*light*/, rpr_float /*angle*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprDiskLightSetInnerAngle(rpr_light /*light*/, rpr_float /*innerAngle*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSpotLightSetConeShape(rpr_light /*light*/, rpr_float /*iangle*/, rpr_float /*oangle*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateDirectionalLight(rpr_context /*context*/, rpr_light * out_light)
+{
+	if ( out_light ) { *out_light = (rpr_light)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprDirectionalLightSetRadiantPower3f(rpr_light /*light*/, rpr_float /*r*/, rpr_float /*g*/, rpr_float /*b*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprDirectionalLightSetShadowSoftnessAngle(rpr_light /*light*/, rpr_float /*softnessAngle*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateEnvironmentLight(rpr_context /*context*/, rpr_light * out_light)
+{
+	if ( out_light ) { *out_light = (rpr_light)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprEnvironmentLightSetImage(rpr_light /*env_light*/, rpr_image /*image*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprEnvironmentLightSetIntensityScale(rpr_light /*env_light*/, rpr_float /*intensity_scale*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprEnvironmentLightAttachPortal(rpr_scene /*scene*/, rpr_light /*env_light*/, rpr_shape /*portal*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprEnvironmentLightDetachPortal(rpr_scene /*scene*/, rpr_light /*env_light*/, rpr_shape /*portal*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprEnvironmentLightSetEnvironmentLightOverride(rpr_light /*in_ibl*/, rpr_environment_override /*overrideType*/, rpr_light /*in_iblOverride*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprEnvironmentLightGetEnvironmentLightOverride(rpr_light /*in_ibl*/, rpr_environment_override /*overrideType*/, rpr_light* out_iblOverride)
+{
+	if ( out_iblOverride ) { *out_iblOverride = nullptr; }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateSkyLight(rpr_context /*context*/, rpr_light * out_light)
+{
+	if ( out_light ) { *out_light = (rpr_light)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSkyLightSetTurbidity(rpr_light /*skylight*/, rpr_float /*turbidity*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSkyLightSetAlbedo(rpr_light /*skylight*/, rpr_float /*albedo*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSkyLightSetScale(rpr_light /*skylight*/, rpr_float /*scale*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSkyLightSetDirection(rpr_light /*skylight*/, rpr_float /*x*/, rpr_float /*y*/, rpr_float /*z*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSkyLightAttachPortal(rpr_scene /*scene*/, rpr_light /*skylight*/, rpr_shape /*portal*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSkyLightDetachPortal(rpr_scene /*scene*/, rpr_light /*skylight*/, rpr_shape /*portal*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateIESLight(rpr_context /*context*/, rpr_light * /*light*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprIESLightSetRadiantPower3f(rpr_light /*light*/, rpr_float /*r*/, rpr_float /*g*/, rpr_float /*b*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprIESLightSetImageFromFile(rpr_light /*env_light*/, rpr_char const * /*imagePath*/, rpr_int /*nx*/, rpr_int /*ny*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprIESLightSetImageFromIESdata(rpr_light /*env_light*/, rpr_char const * /*iesData*/, rpr_int /*nx*/, rpr_int /*ny*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprLightGetInfo(rpr_light /*light*/, rpr_light_info /*info*/, size_t /*size*/, void * /*data*/, size_t * /*size_ret*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneClear(rpr_scene /*scene*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneAttachShape(rpr_scene /*scene*/, rpr_shape /*shape*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneDetachShape(rpr_scene /*scene*/, rpr_shape /*shape*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneAttachHeteroVolume(rpr_scene /*scene*/, rpr_hetero_volume /*heteroVolume*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneDetachHeteroVolume(rpr_scene /*scene*/, rpr_hetero_volume /*heteroVolume*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneAttachCurve(rpr_scene /*scene*/, rpr_curve /*curve*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneDetachCurve(rpr_scene /*scene*/, rpr_curve /*curve*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCurveSetMaterial(rpr_curve /*curve*/, rpr_material_node /*material*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCurveSetTransform(rpr_curve /*curve*/, rpr_bool /*transpose*/, rpr_float const * /*transform*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateCurve(rpr_context /*context*/, rpr_curve * out_curve, size_t /*num_controlPoints*/, rpr_float const * /*controlPointsData*/, rpr_int /*controlPointsStride*/, size_t /*num_indices*/, rpr_uint /*curveCount*/, rpr_uint const * /*indicesData*/, rpr_float const * /*radius*/, rpr_float const * /*textureUV*/, rpr_int const * /*segmentPerCurve*/, rpr_uint /*creationFlag_tapered*/)
+{
+	if ( out_curve ) { *out_curve = (rpr_curve)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneAttachLight(rpr_scene /*scene*/, rpr_light /*light*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneDetachLight(rpr_scene /*scene*/, rpr_light /*light*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneSetEnvironmentLight(rpr_scene /*in_scene*/, rpr_light /*in_light*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneGetEnvironmentLight(rpr_scene /*in_scene*/, rpr_light* out_light)
+{
+	if ( out_light ) { *out_light = nullptr; }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneGetInfo(rpr_scene /*scene*/, rpr_scene_info /*info*/, size_t /*size*/, void * /*data*/, size_t * /*size_ret*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneSetBackgroundImage(rpr_scene /*scene*/, rpr_image /*image*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneGetBackgroundImage(rpr_scene /*scene*/, rpr_image * out_image)
+{
+	if ( out_image ) { *out_image = nullptr; }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneSetCameraRight(rpr_scene /*scene*/, rpr_camera /*camera*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneGetCameraRight(rpr_scene /*scene*/, rpr_camera * out_camera)
+{
+	if ( out_camera ) { *out_camera = nullptr; }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneSetCamera(rpr_scene /*scene*/, rpr_camera /*camera*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprSceneGetCamera(rpr_scene /*scene*/, rpr_camera * out_camera)
+{
+	if ( out_camera ) { *out_camera = nullptr; }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprFrameBufferSaveToFile(rpr_framebuffer /*frame_buffer*/, rpr_char const * /*file_path*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprFrameBufferSaveToFileEx(rpr_framebuffer * /*framebufferList*/, rpr_uint /*framebufferCount*/, rpr_char const * /*filePath*/, void const * /*extraOptions*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprMaterialSystemGetInfo(rpr_material_system /*in_material_system*/, rpr_material_system_info /*type*/, size_t /*in_size*/, void * /*in_data*/, size_t * /*out_size*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateMaterialSystem(rpr_context /*in_context*/, rpr_material_system_type /*type*/, rpr_material_system * out_matsys)
+{
+	if ( out_matsys ) { *out_matsys = (rpr_material_system)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprMaterialSystemGetSize(rpr_context /*in_context*/, rpr_uint * /*out_size*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprMaterialSystemCreateNode(rpr_material_system /*in_matsys*/, rpr_material_node_type /*in_type*/, rpr_material_node * out_node)
+{
+	if ( out_node ) { *out_node = (rpr_material_node)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprMaterialNodeSetID(rpr_material_node /*in_node*/, rpr_uint /*id*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprMaterialNodeSetInputNByKey(rpr_material_node /*in_node*/, rpr_material_node_input /*in_input*/, rpr_material_node /*in_input_node*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprMaterialNodeSetInputFByKey(rpr_material_node /*in_node*/, rpr_material_node_input /*in_input*/, rpr_float /*in_value_x*/, rpr_float /*in_value_y*/, rpr_float /*in_value_z*/, rpr_float /*in_value_w*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprMaterialNodeSetInputDataByKey(rpr_material_node /*in_node*/, rpr_material_node_input /*in_input*/, void const * /*data*/, size_t /*dataSizeByte*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprMaterialNodeSetInputUByKey(rpr_material_node /*in_node*/, rpr_material_node_input /*in_input*/, rpr_uint /*in_value*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprMaterialNodeSetInputImageDataByKey(rpr_material_node /*in_node*/, rpr_material_node_input /*in_input*/, rpr_image /*image*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprMaterialNodeSetInputLightDataByKey(rpr_material_node /*in_node*/, rpr_material_node_input /*in_input*/, rpr_light /*light*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprMaterialNodeSetInputBufferDataByKey(rpr_material_node /*in_node*/, rpr_material_node_input /*in_input*/, rpr_buffer /*buffer*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprMaterialNodeSetInputGridDataByKey(rpr_material_node /*in_node*/, rpr_material_node_input /*in_input*/, rpr_grid /*grid*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprMaterialNodeGetInfo(rpr_material_node /*in_node*/, rpr_material_node_info /*in_info*/, size_t /*in_size*/, void * /*in_data*/, size_t * /*out_size*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprMaterialNodeGetInputInfo(rpr_material_node /*in_node*/, rpr_int /*in_input_idx*/, rpr_material_node_input_info /*in_info*/, size_t /*in_size*/, void * /*in_data*/, size_t * /*out_size*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateComposite(rpr_context /*context*/, rpr_composite_type /*in_type*/, rpr_composite * out_composite)
+{
+	if ( out_composite ) { *out_composite = (rpr_composite)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateLUTFromFile(rpr_context /*context*/, const rpr_char * /*fileLutPath*/, rpr_lut * out_lut)
+{
+	if ( out_lut ) { *out_lut = (rpr_lut)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateLUTFromData(rpr_context /*context*/, const rpr_char * /*lutData*/, rpr_lut * out_lut)
+{
+	if ( out_lut ) { *out_lut = (rpr_lut)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCompositeSetInputFb(rpr_composite /*composite*/, const rpr_char * /*inputName*/, rpr_framebuffer /*input*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCompositeSetInputC(rpr_composite /*composite*/, const rpr_char * /*inputName*/, rpr_composite /*input*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCompositeSetInputLUT(rpr_composite /*composite*/, const rpr_char * /*inputName*/, rpr_lut /*input*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCompositeSetInput4f(rpr_composite /*composite*/, const rpr_char * /*inputName*/, float /*x*/, float /*y*/, float /*z*/, float /*w*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCompositeSetInput1u(rpr_composite /*composite*/, const rpr_char * /*inputName*/, rpr_uint /*value*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCompositeSetInputOp(rpr_composite /*composite*/, const rpr_char * /*inputName*/, rpr_material_node_arithmetic_operation /*op*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCompositeCompute(rpr_composite /*composite*/, rpr_framebuffer /*fb*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprCompositeGetInfo(rpr_composite /*composite*/, rpr_composite_info /*composite_info*/, size_t /*size*/, void * /*data*/, size_t * /*size_ret*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprObjectSetName(void * /*node*/, rpr_char const * /*name*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprObjectSetCustomPointer(void * /*node*/, void const * /*customPtr*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprObjectGetCustomPointer(void * /*node*/, void const ** /*customPtr_out*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreatePostEffect(rpr_context /*context*/, rpr_post_effect_type /*type*/, rpr_post_effect * out_effect)
+{
+	if ( out_effect ) { *out_effect = (rpr_post_effect)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextAttachPostEffect(rpr_context /*context*/, rpr_post_effect /*effect*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextDetachPostEffect(rpr_context /*context*/, rpr_post_effect /*effect*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprPostEffectSetParameter1u(rpr_post_effect /*effect*/, rpr_char const * /*name*/, rpr_uint /*x*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprPostEffectSetParameter1f(rpr_post_effect /*effect*/, rpr_char const * /*name*/, rpr_float /*x*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprPostEffectSetParameter3f(rpr_post_effect /*effect*/, rpr_char const * /*name*/, rpr_float /*x*/, rpr_float /*y*/, rpr_float /*z*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprPostEffectSetParameter4f(rpr_post_effect /*effect*/, rpr_char const * /*name*/, rpr_float /*x*/, rpr_float /*y*/, rpr_float /*z*/, rpr_float /*w*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextGetAttachedPostEffectCount(rpr_context /*context*/, rpr_uint * /*nb*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextGetAttachedPostEffect(rpr_context /*context*/, rpr_uint /*i*/, rpr_post_effect * out_effect)
+{
+	if ( out_effect ) { *out_effect = nullptr; }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprPostEffectGetInfo(rpr_post_effect /*effect*/, rpr_post_effect_info /*info*/, size_t /*size*/, void * /*data*/, size_t * /*size_ret*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateGrid(rpr_context /*context*/, rpr_grid * out_grid, size_t /*gridSizeX*/, size_t /*gridSizeY*/, size_t /*gridSizeZ*/, void const * /*indicesList*/, size_t /*numberOfIndices*/, rpr_grid_indices_topology /*indicesListTopology*/, void const * /*gridData*/, size_t /*gridDataSizeByte*/, rpr_uint /*gridDataTopology___unused*/)
+{
+	if ( out_grid ) { *out_grid = (rpr_grid)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprContextCreateHeteroVolume(rpr_context /*context*/, rpr_hetero_volume * out_heteroVolume)
+{
+	if ( out_heteroVolume ) { *out_heteroVolume = (rpr_hetero_volume)RprStub_CreateObject(); }
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprShapeSetHeteroVolume(rpr_shape /*shape*/, rpr_hetero_volume /*heteroVolume*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprHeteroVolumeSetTransform(rpr_hetero_volume /*heteroVolume*/, rpr_bool /*transpose*/, rpr_float const * /*transform*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprHeteroVolumeSetEmissionGrid(rpr_hetero_volume /*heteroVolume*/, rpr_grid /*grid*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprHeteroVolumeSetDensityGrid(rpr_hetero_volume /*heteroVolume*/, rpr_grid /*grid*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprHeteroVolumeSetAlbedoGrid(rpr_hetero_volume /*heteroVolume*/, rpr_grid /*grid*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprHeteroVolumeSetEmissionLookup(rpr_hetero_volume /*heteroVolume*/, rpr_float const * /*ptr*/, rpr_uint /*n*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprHeteroVolumeSetDensityLookup(rpr_hetero_volume /*heteroVolume*/, rpr_float const * /*ptr*/, rpr_uint /*n*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprHeteroVolumeSetAlbedoLookup(rpr_hetero_volume /*heteroVolume*/, rpr_float const * /*ptr*/, rpr_uint /*n*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprHeteroVolumeSetAlbedoScale(rpr_hetero_volume /*heteroVolume*/, rpr_float /*scale*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprHeteroVolumeSetEmissionScale(rpr_hetero_volume /*heteroVolume*/, rpr_float /*scale*/)
+{
+	return RPR_SUCCESS;
+}
+RPR_STUB_EXPORT rpr_status rprHeteroVolumeSetDensityScale(rpr_hetero_volume /*heteroVolume*/, rpr_float /*scale*/)
+{
+	return RPR_SUCCESS;
+}
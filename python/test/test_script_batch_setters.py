@@ -0,0 +1,112 @@
+#
+#
+# BENCHMARK of the batch setters ( rpr.ShapesSetTransforms, rpr.LightsSetTransforms, rpr.MaterialNodesSetInputF )
+# against one ShapeSetTransform / LightSetTransform / MaterialNodeSetInputFByKey call per object.
+#
+# Can run with the real core library or with the stub core library:
+#   > cmake -Dnanobind_DIR=nanobind/cmake -DRPRPY_STUB_CORE=ON ..
+#
+#
+
+
+import sys
+import time
+
+
+# add the RPR Python library folder in order to import the rpr module.
+if sys.platform == "win32":
+    sys.path.insert(1, '../../python/build/Release')
+else:
+	sys.path.insert(1, '../../python/build')
+
+
+import rpr
+import numpy as np
+
+
+def RPRCHECK(retCode):
+    if ( retCode != rpr.Status.SUCCESS ):
+        print(f"RPR ERROR: {retCode}")
+        exit(1)
+
+
+print("-- script starts --");
+
+ctx = rpr.Context()
+RPRCHECK( rpr.CreateContext(rpr.VERSION_MAJOR_MINOR_REVISION  ,  np.array([0], dtype=np.int32)  , 1  , int(rpr.CreationFlags.ENABLE_GPU0) ,   [ rpr.Int64ToPvoid(0) ] , "" ,  ctx ) )
+matsys = rpr.MaterialSystem()
+RPRCHECK( rpr.ContextCreateMaterialSystem(ctx, 0, matsys) )
+
+
+NB_OBJECTS = 100000
+
+# meshes created in one call, see test_script_meshes.py
+plane_vertices = np.array([ [-1,0,-1], [-1,0,1], [1,0,1], [1,0,-1] ], dtype=np.float32)
+shapes = rpr.ContextCreateMeshes(ctx,
+    np.tile(plane_vertices, (NB_OBJECTS, 1)), np.array([], dtype=np.float32), np.array([], dtype=np.float32),
+    np.arange(NB_OBJECTS+1, dtype=np.int64) * 4,
+    np.tile(np.array([ 3,1,0, 2,1,3 ], dtype=np.int32), NB_OBJECTS),
+    np.tile(np.array([ 3, 3 ], dtype=np.int32), NB_OBJECTS),
+    np.arange(NB_OBJECTS+1, dtype=np.int64) * 2 )
+
+lights = []
+nodes = []
+for i in range(NB_OBJECTS):
+    light = rpr.Light()
+    RPRCHECK( rpr.ContextCreatePointLight(ctx, light) )
+    lights.append(light)
+    node = rpr.MaterialNode()
+    RPRCHECK( rpr.MaterialSystemCreateNode(matsys, rpr.MaterialNodeType.DIFFUSE, node) )
+    nodes.append(node)
+
+
+# one frame of an animation cache: a translation per object, and a color per material
+transforms = np.tile(np.eye(4, dtype=np.float32), (NB_OBJECTS, 1, 1))
+transforms[:, 0:3, 3] = np.random.rand(NB_OBJECTS, 3).astype(np.float32)
+colors = np.random.rand(NB_OBJECTS, 4).astype(np.float32)
+
+
+def Loop(setter, objects, values):
+    for i in range(len(objects)):
+        RPRCHECK( setter(objects[i], values[i]) )
+
+tests = [
+    ( "transforms of shapes" , lambda: Loop(lambda o, v: rpr.ShapeSetTransform(o, True, v.reshape(-1)), shapes, transforms) , lambda: rpr.ShapesSetTransforms(shapes, True, transforms) ),
+    ( "transforms of lights" , lambda: Loop(lambda o, v: rpr.LightSetTransform(o, True, v.reshape(-1)), lights, transforms) , lambda: rpr.LightsSetTransforms(lights, True, transforms) ),
+    ( "colors of materials"  , lambda: Loop(lambda o, v: rpr.MaterialNodeSetInputFByKey(o, rpr.MaterialInput.COLOR, v[0], v[1], v[2], v[3]), nodes, colors) , lambda: rpr.MaterialNodesSetInputF(nodes, rpr.MaterialInput.COLOR, colors) ),
+]
+
+errors = 0
+for (name, loopCall, batchCall) in tests:
+    timeStart = time.time()
+    loopCall()
+    timeLoop = time.time() - timeStart
+
+    timeStart = time.time()
+    status = batchCall()
+    timeBatch = time.time() - timeStart
+    if ( status != rpr.Status.SUCCESS ):
+        print(f"FAIL: batch setter of {name} returns {status}")
+        errors += 1
+
+    print(f"{NB_OBJECTS} {name:22} - per object: {timeLoop*1000.0:8.1f} ms   batch: {timeBatch*1000.0:8.1f} ms   speedup: x{timeLoop/max(timeBatch,1e-9):.1f}")
+
+
+# the number of values must match the number of objects
+if ( rpr.ShapesSetTransforms(shapes, True, transforms[:-1]) != rpr.Status.ERROR_INVALID_PARAMETER ):
+    print("FAIL: ShapesSetTransforms accepts a wrong number of transforms")
+    errors += 1
+
+
+# DELETE RPR OBJECTS
+for obj in shapes + lights + nodes:
+    RPRCHECK( rpr.ObjectDelete( obj ) )
+RPRCHECK( rpr.ObjectDelete( matsys ) )
+RPRCHECK( rpr.ObjectDelete( ctx ) )
+
+
+if errors != 0:
+    print(f"-- script ends with {errors} error(s) --");
+    exit(1)
+
+print("-- script ends --");
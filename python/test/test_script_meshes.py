@@ -0,0 +1,150 @@
+#
+#
+# BENCHMARK of rpr.ContextCreateMeshes ( batched creation ) against the per-mesh rpr.ContextCreateMesh loop used in test_script_rpr.py
+#
+# Can run with the real core library or with the stub core library:
+#   > cmake -Dnanobind_DIR=nanobind/cmake -DRPRPY_STUB_CORE=ON ..
+# With the stub, the measured time is only the cost of the binding.
+#
+#
+
+
+import sys
+import time
+
+
+# add the RPR Python library folder in order to import the rpr module.
+if sys.platform == "win32":
+    sys.path.insert(1, '../../python/build/Release')
+else:
+	sys.path.insert(1, '../../python/build')
+
+
+import rpr
+import numpy as np
+
+
+def RPRCHECK(retCode):
+    if ( retCode != rpr.Status.SUCCESS ):
+        print(f"RPR ERROR: {retCode}")
+        exit(1)
+
+
+print("-- script starts --");
+
+ctx = rpr.Context()
+RPRCHECK( rpr.CreateContext(rpr.VERSION_MAJOR_MINOR_REVISION  ,  np.array([0], dtype=np.int32)  , 1  , int(rpr.CreationFlags.ENABLE_GPU0) ,   [ rpr.Int64ToPvoid(0) ] , "" ,  ctx ) )
+
+
+NB_MESHES = 20000
+
+# one small plane ( 4 vertices, 2 triangles ), duplicated NB_MESHES times with a different position.
+plane_vertices = np.array([ [-1,0,-1], [-1,0,1], [1,0,1], [1,0,-1] ], dtype=np.float32)
+plane_normals = np.array([ [0,1,0], [0,1,0], [0,1,0], [0,1,0] ], dtype=np.float32)
+plane_texcoords = np.array([ [0,0], [0,1], [1,1], [1,0] ], dtype=np.float32)
+plane_indices = np.array([ 3,1,0, 2,1,3 ], dtype=np.int32)
+plane_num_face_vertices = np.array([ 3, 3 ], dtype=np.int32)
+
+meshPositions = np.arange(NB_MESHES, dtype=np.float32)[:, None, None] * np.array([0, 0, 3], dtype=np.float32)
+vertices = np.ascontiguousarray( (plane_vertices[None, :, :] + meshPositions).reshape(-1, 3) )
+normals = np.tile(plane_normals, (NB_MESHES, 1))
+texcoords = np.tile(plane_texcoords, (NB_MESHES, 1))
+indices = np.tile(plane_indices, NB_MESHES)
+num_face_vertices = np.tile(plane_num_face_vertices, NB_MESHES)
+vertex_offsets = np.arange(NB_MESHES+1, dtype=np.int64) * len(plane_vertices)
+face_offsets = np.arange(NB_MESHES+1, dtype=np.int64) * len(plane_num_face_vertices)
+
+
+# per-mesh loop
+timeStart = time.time()
+loopMeshes = []
+for i in range(NB_MESHES):
+    mesh = rpr.Shape()
+    meshVertices = vertices[ vertex_offsets[i] : vertex_offsets[i+1] ].reshape(-1)
+    RPRCHECK( rpr.ContextCreateMesh(ctx,
+        meshVertices, 0, 4, 3*4,
+        plane_normals.reshape(-1), 0, 4, 3*4,
+        plane_texcoords.reshape(-1), 0, 4, 2*4,
+        plane_indices, 4,
+        plane_indices, 4,
+        plane_indices, 4,
+        plane_num_face_vertices,
+        2,
+        mesh ) )
+    loopMeshes.append(mesh)
+timeLoop = time.time() - timeStart
+
+
+# batched
+timeStart = time.time()
+batchMeshes = rpr.ContextCreateMeshes(ctx, vertices, normals, texcoords, vertex_offsets, indices, num_face_vertices, face_offsets)
+timeBatch = time.time() - timeStart
+
+
+print(f"{NB_MESHES} meshes - ContextCreateMesh loop: {timeLoop*1000.0:.1f} ms   ContextCreateMeshes: {timeBatch*1000.0:.1f} ms   speedup: x{timeLoop/max(timeBatch,1e-9):.1f}")
+
+errors = 0
+if ( len(batchMeshes) != NB_MESHES ):
+    print(f"FAIL: ContextCreateMeshes returns {len(batchMeshes)} meshes")
+    errors += 1
+
+# contents of a few meshes, read back from the core. The stub core doesn't return the arrays: the buffers stay zero.
+def ReadMeshArray(mesh, info, count, dtype):
+    buffer = np.zeros(count, dtype=dtype)
+    bufferMalloc = rpr.PyMalloc(buffer)
+    RPRCHECK( rpr.MeshGetInfo(mesh, int(info), buffer.nbytes, bufferMalloc.GetMem(0), None) )
+    copy = buffer.copy()
+    bufferMalloc.Free()
+    return copy
+
+for i in [0, 1, NB_MESHES-1]:
+    meshVertices = ReadMeshArray(batchMeshes[i], rpr.Mesh.VERTEX_ARRAY, len(plane_vertices)*3, np.float32)
+    if not meshVertices.any():
+        print("mesh contents not checked: the core doesn't return the mesh arrays")
+        break
+    if not np.array_equal(meshVertices, vertices[ vertex_offsets[i] : vertex_offsets[i+1] ].reshape(-1)):
+        print(f"FAIL: vertices of mesh {i} differ")
+        errors += 1
+    if not np.array_equal(ReadMeshArray(batchMeshes[i], rpr.Mesh.VERTEX_INDEX_ARRAY, len(plane_indices), np.int32), plane_indices):
+        print(f"FAIL: indices of mesh {i} differ")
+        errors += 1
+    if not np.array_equal(ReadMeshArray(batchMeshes[i], rpr.Mesh.NUM_FACE_VERTICES_ARRAY, len(plane_num_face_vertices), np.int32), plane_num_face_vertices):
+        print(f"FAIL: faces of mesh {i} differ")
+        errors += 1
+
+# inconsistent offsets, face counts and indices must be rejected
+try:
+    rpr.ContextCreateMeshes(ctx, vertices, normals, texcoords, vertex_offsets, indices, num_face_vertices, face_offsets[:-1])
+    print("FAIL: ContextCreateMeshes accepts inconsistent offsets")
+    errors += 1
+except RuntimeError:
+    pass
+
+for badValue, badArray, name in [ (-3, "faces", "a negative face vertex count"), (0, "faces", "a face without vertices"), (4, "indices", "an index out of the mesh"), (-1, "indices", "a negative index") ]:
+    badFaces = num_face_vertices.copy()
+    badIndices = indices.copy()
+    if badArray == "faces":
+        badFaces[5] = badValue
+    else:
+        badIndices[7] = badValue
+    try:
+        badMeshes = rpr.ContextCreateMeshes(ctx, vertices, normals, texcoords, vertex_offsets, badIndices, badFaces, face_offsets)
+        print(f"FAIL: ContextCreateMeshes accepts {name}")
+        errors += 1
+        for mesh in badMeshes:
+            RPRCHECK( rpr.ObjectDelete( mesh ) )
+    except RuntimeError:
+        pass
+
+
+# DELETE RPR OBJECTS
+for mesh in loopMeshes + batchMeshes:
+    RPRCHECK( rpr.ObjectDelete( mesh ) )
+RPRCHECK( rpr.ObjectDelete( ctx ) )
+
+
+if errors != 0:
+    print(f"-- script ends with {errors} error(s) --");
+    exit(1)
+
+print("-- script ends --");
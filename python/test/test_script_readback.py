@@ -0,0 +1,109 @@
+#
+#
+# TEST of the framebuffer readback into NumPy arrays: rpr.FrameBufferRead and rpr.FrameBufferReadInto
+#
+# Can run with the real core library or with the stub core library:
+#   > cmake -Dnanobind_DIR=nanobind/cmake -DRPRPY_STUB_CORE=ON ..
+#
+#
+
+
+import sys
+import time
+
+
+# add the RPR Python library folder in order to import the rpr module.
+if sys.platform == "win32":
+    sys.path.insert(1, '../../python/build/Release')
+else:
+	sys.path.insert(1, '../../python/build')
+
+
+import rpr
+import numpy as np
+
+
+def RPRCHECK(retCode):
+    if ( retCode != rpr.Status.SUCCESS ):
+        print(f"RPR ERROR: {retCode}")
+        exit(1)
+
+
+print("-- script starts --");
+
+errors = 0
+
+ctx = rpr.Context()
+RPRCHECK( rpr.CreateContext(rpr.VERSION_MAJOR_MINOR_REVISION  ,  np.array([0], dtype=np.int32)  , 1  , int(rpr.CreationFlags.ENABLE_GPU0) ,   [ rpr.Int64ToPvoid(0) ] , "" ,  ctx ) )
+
+WIDTH = 320
+HEIGHT = 240
+COLOR = [0.25, 0.5, 0.75, 1.0]
+
+
+for (componentType, dtype) in [ (rpr.ComponentType.FLOAT32, np.float32) , (rpr.ComponentType.FLOAT16, np.float16) ]:
+
+    fbFormat = rpr.FramebufferFormat()
+    fbFormat.num_components = 4
+    fbFormat.type = componentType
+    fbDesc = rpr.FrameBufferDesc()
+    fbDesc.fb_width = WIDTH
+    fbDesc.fb_height = HEIGHT
+    fb = rpr.Framebuffer()
+    RPRCHECK( rpr.ContextCreateFrameBuffer(ctx , fbFormat,  fbDesc , fb ) )
+    RPRCHECK( rpr.FrameBufferFillWithColor(fb, COLOR[0], COLOR[1], COLOR[2], COLOR[3]) )
+
+    # new array allocated by the binding
+    pixels = rpr.FrameBufferRead(fb)
+    if ( pixels.shape != (HEIGHT, WIDTH, 4) or pixels.dtype != dtype or not pixels.flags['C_CONTIGUOUS'] ):
+        print(f"FAIL: FrameBufferRead returns {pixels.shape} {pixels.dtype}")
+        errors += 1
+    elif ( not np.allclose(pixels[HEIGHT//2, WIDTH//2], COLOR) ):
+        print(f"FAIL: FrameBufferRead pixel = {pixels[HEIGHT//2, WIDTH//2]}")
+        errors += 1
+
+    # array owned by the script, reused for each frame
+    dst = np.zeros((HEIGHT, WIDTH, 4), dtype=dtype)
+    RPRCHECK( rpr.FrameBufferReadInto(fb, dst) )
+    if ( not np.array_equal(dst, pixels) ):
+        print("FAIL: FrameBufferReadInto differs from FrameBufferRead")
+        errors += 1
+
+    # wrong dtype or wrong size must be rejected
+    if ( rpr.FrameBufferReadInto(fb, np.zeros((HEIGHT, WIDTH, 4), dtype=np.float64)) != rpr.Status.ERROR_INVALID_PARAMETER ):
+        print("FAIL: FrameBufferReadInto accepts a wrong dtype")
+        errors += 1
+    if ( rpr.FrameBufferReadInto(fb, np.zeros((HEIGHT, WIDTH, 3), dtype=dtype)) != rpr.Status.ERROR_INVALID_PARAMETER ):
+        print("FAIL: FrameBufferReadInto accepts a wrong size")
+        errors += 1
+
+    # compare with the previous way: FrameBufferGetInfo into a PyMalloc buffer, then a copy into numpy
+    NB_READ = 50
+    timeStart = time.time()
+    for i in range(NB_READ):
+        RPRCHECK( rpr.FrameBufferReadInto(fb, dst) )
+    timeReadInto = (time.time() - timeStart) * 1000.0 / NB_READ
+
+    timeStart = time.time()
+    for i in range(NB_READ):
+        size = HEIGHT * WIDTH * 4 * np.dtype(dtype).itemsize
+        buffer = np.zeros(size, dtype=np.uint8)
+        bufferMalloc = rpr.PyMalloc(buffer)
+        RPRCHECK( rpr.FrameBufferGetInfo(fb, int(rpr.FrameBuffer.DATA), size, bufferMalloc.GetMem(0), None) )
+        copy = buffer.view(dtype).reshape((HEIGHT, WIDTH, 4)).copy()
+        bufferMalloc.Free()
+    timeGetInfo = (time.time() - timeStart) * 1000.0 / NB_READ
+
+    print(f"{dtype.__name__}: FrameBufferReadInto {timeReadInto:.3f} ms  /  FrameBufferGetInfo+copy {timeGetInfo:.3f} ms")
+
+    RPRCHECK( rpr.ObjectDelete( fb ) )
+
+
+RPRCHECK( rpr.ObjectDelete( ctx ) )
+
+
+if errors != 0:
+    print(f"-- script ends with {errors} error(s) --");
+    exit(1)
+
+print("-- script ends --");
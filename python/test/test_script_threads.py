@@ -0,0 +1,130 @@
+#
+#
+# TEST of the GIL release inside the RPR Python Binding.
+#
+# This script must run with the binding built against the stub core library:
+#   > cmake -Dnanobind_DIR=nanobind/cmake -DRPRPY_STUB_CORE=ON ..
+# The stub simulates a long rendering with the RPR_STUB_LATENCY_MS environment variable.
+#
+#
+
+
+import sys
+import os
+import threading
+import time
+
+
+# add the RPR Python library folder in order to import the rpr module.
+if sys.platform == "win32":
+    sys.path.insert(1, '../../python/build/Release')
+else:
+	sys.path.insert(1, '../../python/build')
+
+
+# each render/resolve of the stub will take this duration
+LATENCY_MS = 300
+os.environ["RPR_STUB_LATENCY_MS"] = str(LATENCY_MS)
+
+
+import rpr
+import numpy as np
+
+
+def RPRCHECK(retCode):
+    if ( retCode != rpr.Status.SUCCESS ):
+        print(f"RPR ERROR: {retCode}")
+        exit(1)
+
+
+def CreateContext():
+    ctx = rpr.Context()
+    RPRCHECK( rpr.CreateContext(rpr.VERSION_MAJOR_MINOR_REVISION  ,  np.array([0], dtype=np.int32)  , 1  , int(rpr.CreationFlags.ENABLE_GPU0) ,   [ rpr.Int64ToPvoid(0) ] , "" ,  ctx ) )
+    return ctx
+
+
+print("-- script starts --");
+
+errors = 0
+
+
+# TEST 1 : the Python main thread keeps running while another thread is inside rprContextRender.
+ctx1 = CreateContext()
+renderResult = []
+renderThread = threading.Thread(target=lambda: renderResult.append(rpr.ContextRender(ctx1)))
+renderThread.start()
+mainThreadLoops = 0
+while renderThread.is_alive():
+    mainThreadLoops += 1
+    time.sleep(0.001)
+renderThread.join()
+print(f"main thread loops during render: {mainThreadLoops}")
+if ( mainThreadLoops < 10 or renderResult[0] != rpr.Status.SUCCESS ):
+    print("FAIL: the GIL was held during rprContextRender")
+    errors += 1
+
+
+# TEST 2 : two renderings on two different contexts run in parallel.
+ctx2 = CreateContext()
+timeStart = time.time()
+threads = [ threading.Thread(target=rpr.ContextRender, args=(c,)) for c in [ctx1, ctx2] ]
+for t in threads: t.start()
+for t in threads: t.join()
+elapsedMs = (time.time() - timeStart) * 1000.0
+print(f"2 parallel renders: {elapsedMs:.0f} ms  (one render: {LATENCY_MS} ms)")
+if ( elapsedMs > LATENCY_MS * 1.5 ):
+    print("FAIL: the renders were serialized")
+    errors += 1
+
+
+# TEST 3 : rprContextAbortRender called from another thread interrupts rprContextRender.
+renderResult = []
+renderThread = threading.Thread(target=lambda: renderResult.append(rpr.ContextRender(ctx1)))
+renderThread.start()
+time.sleep(LATENCY_MS / 1000.0 / 4.0)
+RPRCHECK( rpr.ContextAbortRender(ctx1) )
+renderThread.join()
+print(f"render after abort returns: {renderResult[0]}")
+if ( renderResult[0] != rpr.Status.ERROR_ABORTED ):
+    print("FAIL: render not aborted")
+    errors += 1
+
+
+# TEST 4 : resolve of different contexts in parallel
+fbFormat = rpr.FramebufferFormat()
+fbFormat.num_components = 4
+fbFormat.type =  rpr.ComponentType.FLOAT32
+fbDesc = rpr.FrameBufferDesc()
+fbDesc.fb_width = 64
+fbDesc.fb_height = 64
+fbs = []
+for c in [ctx1, ctx2]:
+    fbSrc = rpr.Framebuffer()
+    fbDst = rpr.Framebuffer()
+    RPRCHECK( rpr.ContextCreateFrameBuffer(c , fbFormat,  fbDesc , fbSrc ) )
+    RPRCHECK( rpr.ContextCreateFrameBuffer(c , fbFormat,  fbDesc , fbDst ) )
+    fbs.append( (c, fbSrc, fbDst) )
+timeStart = time.time()
+threads = [ threading.Thread(target=rpr.ContextResolveFrameBuffer, args=(c, fbSrc, fbDst, False)) for (c, fbSrc, fbDst) in fbs ]
+for t in threads: t.start()
+for t in threads: t.join()
+elapsedMs = (time.time() - timeStart) * 1000.0
+print(f"2 parallel resolves: {elapsedMs:.0f} ms")
+if ( elapsedMs > LATENCY_MS * 1.5 ):
+    print("FAIL: the resolves were serialized")
+    errors += 1
+
+
+# DELETE RPR OBJECTS
+for (c, fbSrc, fbDst) in fbs:
+    RPRCHECK( rpr.ObjectDelete( fbSrc ) )
+    RPRCHECK( rpr.ObjectDelete( fbDst ) )
+RPRCHECK( rpr.ObjectDelete( ctx2 ) )
+RPRCHECK( rpr.ObjectDelete( ctx1 ) )
+
+
+if errors != 0:
+    print(f"-- script ends with {errors} error(s) --");
+    exit(1)
+
+print("-- script ends --");
@@ -3,6 +3,12 @@ function fileExists(name)
    if f~=nil then io.close(f) return true else return false end
 end
 
+newoption {
+    trigger = "rprlib",
+    value = "PATH",
+    description = "Folder of the RadeonProRender64 library to link, for example the stub built by python/CMakeLists.txt with RPRPY_STUB_CORE"
+}
+
 solution "RprTracePlayer"
     configurations { "Debug", "Release" }           
     language "C++"
@@ -57,6 +63,9 @@ solution "RprTracePlayer"
         targetsuffix "64"
     
     configuration {}
+    if _OPTIONS["rprlib"] then
+        libdirs { _OPTIONS["rprlib"] }
+    end
     if os.is("windows") then
         libdirs {"../RadeonProRender/libWin64" }
     end
@@ -0,0 +1,96 @@
+#
+#
+# TEST of traceAnalyzer.py on the sample trace of the trace_sample folder, and on the call log of interposer/rprInterposerCallLogTest.cpp
+#
+# usage:   python test_traceAnalyzer.py [call log]
+#
+# trace_sample/rprTrace_code_0.cpp gives the offset and size of each argument read from trace_sample/rprTrace_data.bin .
+# Without argument, the call log committed next to this script is used: rpr_calls_sample.log , written by RprInterposerCallLogTest with the stub core library.
+# The ctest of the interposer runs this script on the log it has just written, so that the format of the interposer and the analyzer stay the same.
+#
+#
+
+
+import os
+import sys
+import shutil
+import tempfile
+
+
+scriptDir = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(1, os.path.join(scriptDir, '..'))
+
+import traceAnalyzer
+
+
+failures = 0
+
+def CHECK(name, value, expected):
+	global failures
+	if value != expected:
+		print('WRONG %s: %s, expected %s' % (name, value, expected))
+		failures += 1
+
+
+traceDir = os.path.join(scriptDir, 'trace_sample')
+report = traceAnalyzer.Analyze(traceDir, 40)
+functions = report['functions']
+print('')
+
+CHECK('calls', report['calls'], 15)
+CHECK('data file bytes', report['dataFileBytes'], 276)
+CHECK('payload bytes', report['payloadBytes'], 276)
+# 4 x 12 vertices + 4 x 12 normals + 4 x 8 texcoords + 3 x 4 indices ( from num_face_vertices ) x 4 + 1 face x 4
+CHECK('rprContextCreateMesh payload', functions['rprContextCreateMesh']['payloadBytes'], 48 + 48 + 32 + 3*16 + 4)
+CHECK('rprContextCreateMesh estimated', functions['rprContextCreateMesh']['estimatedCalls'], 0)
+CHECK('rprShapeSetPrimvar payload', functions['rprShapeSetPrimvar']['payloadBytes'], 32)
+# the size of the image data isn't in the arguments: it's the distance to the end of the file
+CHECK('rprContextCreateImage payload', functions['rprContextCreateImage']['payloadBytes'], 64)
+CHECK('rprContextCreateImage estimated', functions['rprContextCreateImage']['estimatedCalls'], 1)
+CHECK('redundant calls', report['redundantCalls'], 2)
+# the node is deleted then created again with the same name: its first setter isn't redundant
+CHECK('rprMaterialNodeSetInputFByKey redundant', functions['rprMaterialNodeSetInputFByKey']['redundantCalls'], 1)
+CHECK('rprShapeSetMaterial redundant', functions['rprShapeSetMaterial']['redundantCalls'], 1)
+
+# a data file smaller than the offsets of the trace is rejected
+tempDir = tempfile.mkdtemp()
+try:
+	shutil.copy(os.path.join(traceDir, 'rprTrace_code_0.cpp'), tempDir)
+	with open(os.path.join(tempDir, 'rprTrace_data.bin'), 'wb') as f:
+		f.write(b'\0' * 100)
+	try:
+		traceAnalyzer.Analyze(tempDir, 40)
+		CHECK('truncated data file rejected', False, True)
+	except ValueError as e:
+		print(e)
+finally:
+	shutil.rmtree(tempDir)
+
+
+logPath = sys.argv[1] if len(sys.argv) > 1 else os.path.join(scriptDir, 'rpr_calls_sample.log')
+report = traceAnalyzer.Analyze(logPath, 40)
+functions = report['functions']
+print('')
+
+CHECK('log: calls', report['calls'], 26)
+CHECK('log: failed calls', report['failedCalls'], 0)
+CHECK('log: payload bytes', report['payloadBytes'], 192)
+CHECK('log: rprContextCreateMesh payload', functions['rprContextCreateMesh']['payloadBytes'], 128)
+CHECK('log: rprContextCreateImage payload', functions['rprContextCreateImage']['payloadBytes'], 64)
+CHECK('log: redundant calls', report['redundantCalls'], 3)
+CHECK('log: rprMaterialNodeSetInputFByKey calls', functions['rprMaterialNodeSetInputFByKey']['calls'], 6)
+CHECK('log: rprMaterialNodeSetInputFByKey redundant', functions['rprMaterialNodeSetInputFByKey']['redundantCalls'], 2)
+CHECK('log: rprShapeSetMaterial redundant', functions['rprShapeSetMaterial']['redundantCalls'], 1)
+CHECK('log: rprObjectDelete calls', functions['rprObjectDelete']['calls'], 7)
+
+# the output handles are written in the log: the mesh created is the one attached, then deleted.
+calls = traceAnalyzer.ParseCallLog(logPath)
+createMesh = [ c for c in calls if c.name == 'rprContextCreateMesh' ][0]
+attach = [ c for c in calls if c.name == 'rprSceneAttachShape' ][0]
+CHECK('log: handle of the created mesh', createMesh.args[-1], attach.args[1])
+CHECK('log: arguments of rprContextCreateMesh', len(createMesh.args), 19)
+
+if failures:
+	print('%d checks failed' % failures)
+	sys.exit(1)
+print('all checks passed')
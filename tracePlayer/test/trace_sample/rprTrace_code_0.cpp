@@ -0,0 +1,25 @@
+// sample trace for test_traceAnalyzer.py : a textured quad, written in the form of the generated trace sources.
+// the arguments read from rprTrace_data.bin are at:
+//   0 vertices ( 4 x 12 bytes )    48 normals ( 4 x 12 )    96 texcoords ( 4 x 8 )
+//   128 / 144 / 160 vertex, normal and texcoord indices ( 4 x 4 )    176 num_face_vertices ( 1 x 4 )
+//   180 primvar ( 8 floats )    212 image pixels ( 4 x 4 RGBA8 : 64 bytes, up to the end of the file )
+#include "rprTrace_variables.h"
+
+void rprtrace_part0()
+{
+status = rprContextCreateScene(context_0x01, &scene_0x02);RPRTRACE_CHECK
+status = rprContextSetScene(context_0x01, scene_0x02);RPRTRACE_CHECK
+status = rprContextCreateMesh(context_0x01,(rpr_float*)&RPRTRACE_DATA[0],4,12,(rpr_float*)&RPRTRACE_DATA[48],4,12,(rpr_float*)&RPRTRACE_DATA[96],4,8,(rpr_int*)&RPRTRACE_DATA[128],4,(rpr_int*)&RPRTRACE_DATA[144],4,(rpr_int*)&RPRTRACE_DATA[160],4,(rpr_int*)&RPRTRACE_DATA[176],1,&shape_0x03);RPRTRACE_CHECK
+status = rprShapeSetPrimvar(shape_0x03,0,(rpr_float*)&RPRTRACE_DATA[180],8,2,RPR_PRIMVAR_INTERPOLATION_VERTEX);RPRTRACE_CHECK
+status = rprSceneAttachShape(scene_0x02, shape_0x03);RPRTRACE_CHECK
+status = rprContextCreateImage(context_0x01,{4,RPR_COMPONENT_TYPE_UINT8},&imageDesc_0x04,&RPRTRACE_DATA[212],&image_0x05);RPRTRACE_CHECK
+status = rprMaterialSystemCreateNode(matsys_0x06,RPR_MATERIAL_NODE_UBERV2,&node_0x07);RPRTRACE_CHECK
+status = rprMaterialNodeSetInputFByKey(node_0x07,RPR_MATERIAL_INPUT_UBER_DIFFUSE_COLOR,0.5f,0.5f,0.5f,1.0f);RPRTRACE_CHECK
+status = rprMaterialNodeSetInputFByKey(node_0x07,RPR_MATERIAL_INPUT_UBER_DIFFUSE_COLOR,0.5f,0.5f,0.5f,1.0f);RPRTRACE_CHECK
+status = rprMaterialNodeSetInputFByKey(node_0x07,RPR_MATERIAL_INPUT_UBER_DIFFUSE_WEIGHT,1.0f,1.0f,1.0f,1.0f);RPRTRACE_CHECK
+status = rprShapeSetMaterial(shape_0x03, node_0x07);RPRTRACE_CHECK
+status = rprShapeSetMaterial(shape_0x03, node_0x07);RPRTRACE_CHECK
+status = rprObjectDelete(node_0x07);RPRTRACE_CHECK
+status = rprMaterialSystemCreateNode(matsys_0x06,RPR_MATERIAL_NODE_UBERV2,&node_0x07);RPRTRACE_CHECK
+status = rprMaterialNodeSetInputFByKey(node_0x07,RPR_MATERIAL_INPUT_UBER_DIFFUSE_COLOR,0.5f,0.5f,0.5f,1.0f);RPRTRACE_CHECK
+}
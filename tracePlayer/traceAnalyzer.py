@@ -0,0 +1,381 @@
+#
+# Analyzer of the traces generated by RPR_CONTEXT_TRACING_ENABLED.
+#
+# usage:   python traceAnalyzer.py [Trace folder | call log] [--json report.json] [--top N]
+#
+# The input is either a trace folder, or the call log written by the RPR interposer ( interposer/rprInterposer.h, RPR_INTERPOSER_CALL_LOG ).
+#
+# The generated trace sources ( *.cpp / *.h of the Trace folder ) are parsed into a stream of RPR calls, in the order of the files then of the lines.
+# The report gives, for each RPR function:
+#  - the number of calls
+#  - the payload bytes: bytes read from rprTrace_data.bin by the calls ( mesh vertices, image pixels, buffers... )
+#  - the redundant calls: a setter called on the same object ( and same parameter key ) with the same arguments as its previous call
+#
+# The arguments read from rprTrace_data.bin are found with --data-pattern, which captures their offset in the file.
+# For the functions of PAYLOAD_SIZES, the size of an argument is computed from the other arguments of the call, as the core reads it:
+# for example num_vertices * vertex_stride. The indices of a mesh are counted from its num_face_vertices, read in rprTrace_data.bin.
+# For the other arguments ( image and buffer data, ... ), the size is the distance to the next offset used by the trace: these calls are counted as 'estimated'.
+# An offset outside of rprTrace_data.bin is an error: the pattern or the data file doesn't match the trace.
+#
+# The call log is written while the trace player ( or any application ) runs with the interposer:
+#   LD_PRELOAD=libRprInterposer.so RPR_INTERPOSER_CALL_LOG=rpr_calls.log ./RprTracePlayer64
+# Its payload is the bytes computed by the interposer for each call, and it adds the failed calls: negative return value.
+#
+
+
+import os
+import re
+import sys
+import json
+import struct
+import argparse
+
+
+scriptDir = os.path.dirname(os.path.abspath(__file__))
+headerPath = os.path.join(scriptDir, '../RadeonProRender/inc/RadeonProRender_v2.h')
+
+reFunction = re.compile(r'^(?:\s|\*/)*extern RPR_API_ENTRY\s+(\w+)\s+(rpr\w+)\s*\((.*)\)\s*;\s*$')
+reComments = re.compile(r'//[^\n]*|/\*.*?\*/', re.DOTALL)
+reCall = re.compile(r'\b(rpr\w+)\s*\(')
+reParameterName = re.compile(r'(\w+)\s*(?:\[\s*\d*\s*\])?\s*$')
+# integer literal, optionally casted:  24  ,  (size_t)24  ,  0x18u
+reInteger = re.compile(r'^(?:\(\s*[\w\s\*]+\)\s*)*(0x[0-9a-fA-F]+|\d+)[uUlL]*$')
+
+LOG_HEADER = '# rpr interposer call log 1'
+
+# offset inside the data file, for example:  &RPRTRACE_DATA[1024]  ,  rprTrace_data + 1024  ,  data_0 + 1024
+DEFAULT_DATA_PATTERN = r'(?:RPRTRACE_DATA|rprTrace_data|\bdata\w*)\s*(?:\[\s*|\+\s*)(\d+)'
+
+# for these setters, the 2nd argument is a key: only the calls with the same object and the same key are compared.
+KEYED_SETTERS = ( 'ByKey', 'Parameter', 'SetInput', 'SetAOV', 'SetTexture', 'SetPrimvar' )
+
+# bytes read by the core from a pointer argument:  function -> { pointer parameter -> ( count , bytes per element ) }
+# the count and the bytes per element are integers or names of parameters of the same call.
+# FACE_VERTICES is the sum of the num_face_vertices array of the call.
+FACE_VERTICES = '#faceVertices'
+PAYLOAD_SIZES = {
+	'rprContextCreateMesh': {
+		'vertices': ( 'num_vertices', 'vertex_stride' ),
+		'normals': ( 'num_normals', 'normal_stride' ),
+		'texcoords': ( 'num_texcoords', 'texcoord_stride' ),
+		'vertex_indices': ( FACE_VERTICES, 'vidx_stride' ),
+		'normal_indices': ( FACE_VERTICES, 'nidx_stride' ),
+		'texcoord_indices': ( FACE_VERTICES, 'tidx_stride' ),
+		'num_face_vertices': ( 'num_faces', 4 ),
+	},
+	'rprShapeSetPrimvar': {
+		'data': ( 'floatCount', 4 ),
+	},
+	'rprContextCreateCurve': {
+		'controlPointsData': ( 'num_controlPoints', 'controlPointsStride' ),
+		'indicesData': ( 'num_indices', 4 ),
+		'segmentPerCurve': ( 'curveCount', 4 ),
+		'textureUV': ( 'curveCount', 8 ),
+	},
+}
+
+
+class Call:
+	def __init__(self, name, args, file, line):
+		self.name = name
+		self.args = args
+		self.file = file
+		self.line = line
+		self.payload = 0
+		self.estimated = False
+		self.redundant = False
+		self.ret = 0
+
+
+# name -> list of parameter names
+def LoadApiFunctions():
+	functions = {}
+	with open(headerPath) as f:
+		for line in f:
+			m = reFunction.match(line)
+			if m:
+				params = []
+				for p in m.group(3).split(','):
+					n = reParameterName.search(p.strip())
+					params.append(n.group(1) if n else '')
+				functions[m.group(2)] = params
+	return functions
+
+
+# split the arguments of a call at the top-level commas. returns (args, index after the closing parenthesis)
+def ParseArguments(text, start):
+	args = []
+	depth = 0
+	current = start
+	i = start
+	while i < len(text):
+		c = text[i]
+		if c in '([{':
+			depth += 1
+		elif c in ')]}':
+			if depth == 0:
+				args.append(text[current:i].strip())
+				return ( [a for a in args if a != ''] , i+1 )
+			depth -= 1
+		elif c == ',' and depth == 0:
+			args.append(text[current:i].strip())
+			current = i+1
+		elif c == '"':
+			i += 1
+			while i < len(text) and text[i] != '"':
+				if text[i] == '\\':
+					i += 1
+				i += 1
+		i += 1
+	return (None, len(text))
+
+
+def NaturalKey(path):
+	return [ int(t) if t.isdigit() else t.lower() for t in re.split(r'(\d+)', path) ]
+
+
+def ParseTrace(traceDir, apiFunctions):
+	sources = []
+	for name in os.listdir(traceDir):
+		if name.endswith('.cpp') or name.endswith('.h'):
+			sources.append(os.path.join(traceDir, name))
+	sources.sort(key=NaturalKey)
+
+	calls = []
+	for path in sources:
+		with open(path, errors='replace') as f:
+			text = reComments.sub(lambda m: '\n' * m.group(0).count('\n'), f.read())
+		pos = 0
+		while True:
+			m = reCall.search(text, pos)
+			if not m:
+				break
+			pos = m.end()
+			name = m.group(1)
+			if name not in apiFunctions:
+				continue
+			# skip the declarations/definitions : the name is preceded by a type
+			lineStart = text.rfind('\n', 0, m.start()) + 1
+			prefix = text[lineStart:m.start()]
+			if re.search(r'\b(rpr_status|rpr_int|extern|RPR_API_ENTRY)\s*$', prefix):
+				continue
+			args, end = ParseArguments(text, m.end())
+			if args is None:
+				break
+			calls.append( Call(name, args, os.path.basename(path), text.count('\n', 0, m.start()) + 1) )
+			pos = end
+	return calls
+
+
+# one call per line:  function <tab> return value <tab> bytes <tab> arguments...
+def ParseCallLog(path):
+	calls = []
+	with open(path) as f:
+		header = f.readline().rstrip('\n')
+		if header != LOG_HEADER:
+			raise ValueError('%s is not a call log of the RPR interposer ( first line: "%s" )' % (path, header))
+		for lineNumber, line in enumerate(f, 2):
+			line = line.rstrip('\n')
+			if line == '' or line.startswith('#'):
+				continue
+			fields = line.split('\t')
+			if len(fields) < 3:
+				raise ValueError('%s:%d: expected function, return value and bytes' % (path, lineNumber))
+			call = Call(fields[0], fields[3:], os.path.basename(path), lineNumber)
+			call.ret = int(fields[1])
+			call.payload = int(fields[2])
+			calls.append(call)
+	return calls
+
+
+def ParseInteger(arg):
+	m = reInteger.match(arg.strip())
+	if not m:
+		return None
+	return int(m.group(1), 0)
+
+
+class DataFile:
+	def __init__(self, path):
+		self.path = path
+		self.size = os.path.getsize(path) if os.path.exists(path) else None
+		self.file = open(path, 'rb') if self.size is not None else None
+
+	def ReadInt32Sum(self, offset, count):
+		if self.file is None or offset + 4*count > self.size:
+			return None
+		self.file.seek(offset)
+		values = struct.unpack('<%di' % count, self.file.read(4*count))
+		return sum(values)
+
+
+# exact size of each data argument of the call, from PAYLOAD_SIZES. returns { argument index -> bytes }
+def ExactPayload(call, params, offsets, data):
+	rules = PAYLOAD_SIZES.get(call.name)
+	if rules is None or len(params) != len(call.args):
+		return {}
+	index = { p: i for i, p in enumerate(params) }
+
+	def Value(term):
+		if isinstance(term, int):
+			return term
+		if term == FACE_VERTICES:
+			countsArg = index['num_face_vertices']
+			if countsArg not in offsets:
+				return None
+			numFaces = ParseInteger(call.args[index['num_faces']])
+			return data.ReadInt32Sum(offsets[countsArg], numFaces) if numFaces is not None else None
+		return ParseInteger(call.args[index[term]])
+
+	sizes = {}
+	for param, ( count, elementSize ) in rules.items():
+		i = index[param]
+		if i not in offsets:
+			continue
+		c = Value(count)
+		e = Value(elementSize)
+		if c is not None and e is not None:
+			sizes[i] = c * e
+	return sizes
+
+
+def ComputePayload(calls, apiFunctions, dataPath, dataPattern):
+	reData = re.compile(dataPattern)
+	data = DataFile(dataPath)
+
+	offsetsPerCall = []
+	allOffsets = set()
+	for call in calls:
+		offsets = {}
+		for i, arg in enumerate(call.args):
+			m = reData.search(arg)
+			if m:
+				offsets[i] = int(m.group(1))
+		offsetsPerCall.append(offsets)
+		allOffsets |= set(offsets.values())
+
+	if data.size is not None:
+		outside = [ o for o in allOffsets if o >= data.size ]
+		if outside:
+			raise ValueError('offset %d is outside of %s ( %d bytes ): check --data-pattern' % (min(outside), dataPath, data.size))
+
+	sortedOffsets = sorted(allOffsets)
+	nextOffset = {}
+	for i, offset in enumerate(sortedOffsets):
+		if i+1 < len(sortedOffsets):
+			nextOffset[offset] = sortedOffsets[i+1]
+		else:
+			nextOffset[offset] = data.size if data.size is not None else offset
+
+	for call, offsets in zip(calls, offsetsPerCall):
+		exact = ExactPayload(call, apiFunctions[call.name], offsets, data)
+		for i, offset in offsets.items():
+			if i in exact:
+				if data.size is not None and offset + exact[i] > data.size:
+					raise ValueError('%s:%d: %s reads %d bytes at offset %d, after the end of %s' % (call.file, call.line, call.name, exact[i], offset, dataPath))
+				call.payload += exact[i]
+			else:
+				call.payload += nextOffset[offset] - offset
+				call.estimated = True
+	return data.size
+
+
+# a setter is redundant if its previous successful call on the same object ( and key ) had the same arguments.
+# rprObjectDelete forgets the previous values: a new object can reuse the name of a deleted one.
+def FindRedundantCalls(calls):
+	lastArgs = {}
+	for call in calls:
+		if call.ret < 0:
+			continue
+		if call.name == 'rprObjectDelete' and len(call.args) == 1:
+			obj = call.args[0]
+			for key in [ k for k in lastArgs if k[1] == obj ]:
+				del lastArgs[key]
+			continue
+		if 'Set' not in call.name or len(call.args) == 0:
+			continue
+		keyed = any( k in call.name for k in KEYED_SETTERS ) and len(call.args) >= 2
+		key = ( call.name, call.args[0], call.args[1] if keyed else None )
+		call.redundant = ( lastArgs.get(key) == call.args )
+		lastArgs[key] = call.args
+
+
+def Report(calls, dataSize, top):
+	stats = {}
+	for call in calls:
+		s = stats.setdefault(call.name, { 'calls': 0, 'payloadBytes': 0, 'estimatedCalls': 0, 'redundantCalls': 0, 'failedCalls': 0 })
+		s['calls'] += 1
+		s['payloadBytes'] += call.payload
+		s['estimatedCalls'] += 1 if call.estimated else 0
+		s['redundantCalls'] += 1 if call.redundant else 0
+		s['failedCalls'] += 1 if call.ret < 0 else 0
+
+	sortedStats = sorted(stats.items(), key=lambda kv: (kv[1]['calls'], kv[1]['payloadBytes']), reverse=True)
+	print('%-45s %10s %16s %10s %10s %10s' % ('function', 'calls', 'payload (bytes)', 'estimated', 'redundant', 'failed'))
+	for name, s in sortedStats[:top]:
+		print('%-45s %10d %16d %10d %10d %10d' % (name, s['calls'], s['payloadBytes'], s['estimatedCalls'], s['redundantCalls'], s['failedCalls']))
+	if len(sortedStats) > top:
+		print('... %d more functions' % (len(sortedStats) - top))
+
+	totalPayload = sum( c.payload for c in calls )
+	totalEstimated = sum( 1 for c in calls if c.estimated )
+	totalRedundant = sum( 1 for c in calls if c.redundant )
+	totalFailed = sum( 1 for c in calls if c.ret < 0 )
+	print('')
+	print('calls: %d   functions: %d   payload: %.2f MB   estimated payloads: %d   redundant calls: %d   failed calls: %d' % (len(calls), len(stats), totalPayload / (1024.0*1024.0), totalEstimated, totalRedundant, totalFailed))
+	if dataSize is not None:
+		print('rprTrace_data.bin: %.2f MB' % (dataSize / (1024.0*1024.0)))
+
+	return {
+		'calls': len(calls),
+		'payloadBytes': totalPayload,
+		'estimatedCalls': totalEstimated,
+		'redundantCalls': totalRedundant,
+		'failedCalls': totalFailed,
+		'dataFileBytes': dataSize,
+		'functions': stats,
+	}
+
+
+# trace: a trace folder or a call log of the interposer
+def Analyze(trace, top, dataPattern=DEFAULT_DATA_PATTERN):
+	if not os.path.isdir(trace):
+		calls = ParseCallLog(trace)
+		FindRedundantCalls(calls)
+		return Report(calls, None, top)
+
+	traceDir = trace
+	apiFunctions = LoadApiFunctions()
+	calls = ParseTrace(traceDir, apiFunctions)
+	dataSize = ComputePayload(calls, apiFunctions, os.path.join(traceDir, 'rprTrace_data.bin'), dataPattern)
+	FindRedundantCalls(calls)
+	return Report(calls, dataSize, top)
+
+
+def main():
+	parser = argparse.ArgumentParser(description='RPR trace analyzer')
+	parser.add_argument('trace', nargs='?', default=os.path.join(scriptDir, 'Trace'), help='folder of the trace files, or call log of the RPR interposer ( RPR_INTERPOSER_CALL_LOG )')
+	parser.add_argument('--json', help='write the report in this JSON file')
+	parser.add_argument('--top', type=int, default=40, help='number of functions printed')
+	parser.add_argument('--data-pattern', default=DEFAULT_DATA_PATTERN, help='regex capturing the offsets inside rprTrace_data.bin')
+	args = parser.parse_args()
+
+	if not os.path.exists(args.trace):
+		print('%s not found' % args.trace)
+		sys.exit(1)
+	try:
+		report = Analyze(args.trace, args.top, args.data_pattern)
+	except ValueError as e:
+		print(e)
+		sys.exit(1)
+	if report['calls'] == 0:
+		print('no RPR call found in %s' % args.trace)
+		sys.exit(1)
+
+	if args.json:
+		with open(args.json, 'w') as f:
+			json.dump(report, f, indent=4)
+
+
+if __name__ == '__main__':
+	main()
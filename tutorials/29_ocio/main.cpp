@@ -387,7 +387,8 @@ int main()
 	//
 	// We want the out colorspace : "Output - sRGB",  so we select display="ACES" and view="sRGB"
 	//
-	OcioDisplay::Display(
+	OcioDisplay ocioDisplay;
+	ocioDisplay.Display(
 		frame_buffer_resolved, 
 		ocio_config,
 		"ACES - ACEScg",  
@@ -1,7 +1,7 @@
 
 #include "ocio_display.h"
 
-#include <memory>
+#include <vector>
 
 #if ( USE_OCIO == 1 )
 #include <OpenColorIO/OpenColorIO.h>
@@ -9,50 +9,22 @@
 namespace OCIO = OCIO_NAMESPACE;
 #endif
 
-#include <Math/float3.h>
-#include <Math/mathutils.h>
-
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include "../3rdParty/stbi/stbi.h"
 
-unsigned char FloatToByte(float f)
-{
-	return (unsigned char)RadeonProRender::clamp( (int)(f*255.0f) , (int)0, (int)255);
-}
-
 
-rpr_status OcioDisplay::Display(
-	rpr_framebuffer framebuffer, 
+rpr_status OcioDisplay::Bake(
 	const std::string& ocioFile, 
 	const std::string& src,
-	
 	const std::string& display, 
 	const std::string& view, 
-
 	float exposure, 
-	float gamma ,
-	const std::string& file_path,
-
+	float gamma,
 	bool useOCIO
 	)
 {
-	rpr_status status = RPR_SUCCESS;
-
-	rpr_framebuffer_desc fbInfoDesc;
-	status = rprFrameBufferGetInfo(framebuffer,RPR_FRAMEBUFFER_DESC,sizeof(fbInfoDesc),&fbInfoDesc,0); 
-	if ( status != RPR_SUCCESS ) 
-		return status;
-
-	const int64_t pxlCount = fbInfoDesc.fb_height * fbInfoDesc.fb_width;
-	const int fltCount = pxlCount * 4;
-	auto frame_buffer_data = std::make_unique<float[]>(fltCount);
-	status = rprFrameBufferGetInfo(framebuffer, RPR_FRAMEBUFFER_DATA, fltCount*4 , frame_buffer_data.get() , NULL ); 
-	if ( status != RPR_SUCCESS ) 
-		return status;
-
-	const int channelCountLDR = 3;
-	auto framebufferLDR = std::make_unique<unsigned char[]>(pxlCount * channelCountLDR);
-
+	// the display transform is baked into a 3D LUT, then applied to the pixels by several threads.
+	RPRDisplayTransform::ColorFunction colorFunction = RPRDisplayTransform::ExposureGamma(exposure, gamma);
 
 	#if ( USE_OCIO == 1 )
 
@@ -112,43 +84,70 @@ rpr_status OcioDisplay::Display(
 		return RPR_ERROR_INTERNAL_ERROR;
 	}
 
+	if ( useOCIO ) // if using OCIO processor
+	{
+		colorFunction = [cpuProcessor](float* rgb, size_t numPixels)
+		{
+			OCIO::PackedImageDesc image(rgb, (long)numPixels, 1, 3);
+			cpuProcessor->apply(image);
+		};
+	}
+
 	#endif
 
-	// run the post process on each pixels
-	for(int64_t i=0; i<pxlCount; i++) // <-- can be multithreaded for perf improve
+	rpr_status status = m_displayTransform.Bake(colorFunction);
+	if ( status != RPR_SUCCESS ) 
+		return status;
+
+	m_ocioFile = ocioFile;
+	m_src = src;
+	m_display = display;
+	m_view = view;
+	m_exposure = exposure;
+	m_gamma = gamma;
+	m_useOCIO = useOCIO;
+	return RPR_SUCCESS;
+}
+
+rpr_status OcioDisplay::Display(
+	rpr_framebuffer framebuffer, 
+	const std::string& ocioFile, 
+	const std::string& src,
+	
+	const std::string& display, 
+	const std::string& view, 
+
+	float exposure, 
+	float gamma ,
+	const std::string& file_path,
+
+	bool useOCIO
+	)
+{
+	rpr_status status = RPR_SUCCESS;
+	if ( !m_displayTransform.IsBaked() || ocioFile != m_ocioFile || src != m_src || display != m_display || view != m_view 
+		|| exposure != m_exposure || gamma != m_gamma || useOCIO != m_useOCIO )
 	{
-		RadeonProRender::float3 rgb = RadeonProRender::float3(
-			frame_buffer_data[i*4+0],
-			frame_buffer_data[i*4+1],
-			frame_buffer_data[i*4+2]);
-
-		
-		#if ( USE_OCIO == 1 )
-		if ( useOCIO ) // if using OCIO processor
-		{
-			cpuProcessor->applyRGB(&(rgb.x));
-		}
-		else
-		#endif
-		{
-			rgb.x = powf(rgb.x * exposure, 1.0f/gamma );
-			rgb.y = powf(rgb.y * exposure, 1.0f/gamma );
-			rgb.z = powf(rgb.z * exposure, 1.0f/gamma );
-		}
-		
-		framebufferLDR[i*3+0] = FloatToByte(rgb[0]);
-		framebufferLDR[i*3+1] = FloatToByte(rgb[1]);
-		framebufferLDR[i*3+2] = FloatToByte(rgb[2]);
+		status = Bake(ocioFile, src, display, view, exposure, gamma, useOCIO);
+		if ( status != RPR_SUCCESS ) 
+			return status;
 	}
 
+	std::vector<unsigned char> framebufferLDR;
+	unsigned int width = 0;
+	unsigned int height = 0;
+	status = m_displayTransform.ApplyToFrameBuffer(framebuffer, framebufferLDR, width, height);
+	if ( status != RPR_SUCCESS ) 
+		return status;
+
 	// export to png file.
 	stbi_write_png(
 		file_path.c_str(), 
-		fbInfoDesc.fb_width,
-		fbInfoDesc.fb_height,
-		channelCountLDR,
-		framebufferLDR.get(),
-		fbInfoDesc.fb_width*channelCountLDR
+		width,
+		height,
+		3,
+		framebufferLDR.data(),
+		width*3
 		);
 
 	return RPR_SUCCESS;
@@ -6,6 +6,7 @@
 #include "ocio_display.h"
 
 #include <RadeonProRender.h>
+#include "../../RadeonProRender/rprTools/rprDisplayTransform.h"
 
 #include <string>
 
@@ -15,7 +16,9 @@ class OcioDisplay
 public:
 
 	// export a resolved HDR framebuffer into a PNG.
-	static rpr_status Display(
+	// the display transform is baked into a 3D LUT on the first call, and baked again only when one of the transform arguments
+	// ( ocioFile, src, display, view, exposure, gamma, useOCIO ) changes: the next frames only apply the LUT.
+	rpr_status Display(
 		rpr_framebuffer framebuffer, 
 
 		const std::string& ocioFile, 
@@ -31,7 +34,20 @@ public:
 		bool useOCIO
 		);
 
+private:
 
+	rpr_status Bake(const std::string& ocioFile, const std::string& src, const std::string& display, const std::string& view, float exposure, float gamma, bool useOCIO);
+
+	RPRDisplayTransform m_displayTransform;
+
+	// arguments of the baked LUT
+	std::string m_ocioFile;
+	std::string m_src;
+	std::string m_display;
+	std::string m_view;
+	float m_exposure = 0.0f;
+	float m_gamma = 0.0f;
+	bool m_useOCIO = false;
 
 };
 
@@ -3,9 +3,10 @@ project "29_ocio"
     location "../build"
     files { "../29_ocio/**.h", "../29_ocio/**.cpp"} 
     files { "../common/common.cpp","../common/common.h"}
+    files { "../../RadeonProRender/rprTools/rprDisplayTransform.cpp","../../RadeonProRender/rprTools/rprDisplayTransform.h"}
 
     -- remove filters for Visual Studio
-    vpaths { [""] = { "../29_ocio/**.h", "../29_ocio/**.cpp","../common/common.cpp","../common/common.h"} }
+    vpaths { [""] = { "../29_ocio/**.h", "../29_ocio/**.cpp","../common/common.cpp","../common/common.h","../../RadeonProRender/rprTools/rprDisplayTransform.cpp","../../RadeonProRender/rprTools/rprDisplayTransform.h"} }
 
 
     includedirs{ "../../RadeonProRender/inc" } 
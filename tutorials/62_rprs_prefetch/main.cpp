@@ -0,0 +1,191 @@
+/*****************************************************************************\
+*
+*  Module Name    62_rprs_prefetch/main.cpp
+*  Project        Radeon ProRender rendering tutorial
+*
+*  Description    Radeon ProRender SDK tutorials: RPRS shots read ahead with RPRRprsPrefetcher
+*
+*  Copyright(C) 2011-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+
+//
+// Shows how to load a sequence of RPRS shots with RPRRprsPrefetcher ( rprTools ):
+// the next files are read by an I/O thread while the current shot renders, then imported with rprsImportFromData.
+// The demo compares it with a sequential rprsImport of each shot.
+//
+// usage:  62_rprs_prefetch64 [file1.rprs file2.rprs ...]
+// Without arguments, the demo exports its own shots first.
+// The files written by the demo are in the OS cache: to measure the cold disk latency, use your own files after flushing the cache.
+//
+
+
+#include "RadeonProRender.h"
+#include "Math/mathutils.h"
+#include "RprLoadStore.h"
+#include "../common/common.h"
+#include "../../RadeonProRender/rprTools/rprRprsPrefetcher.h"
+
+#include <cassert>
+#include <chrono>
+#include <iostream>
+
+RPRGarbageCollector g_gc;
+
+const int NB_SHOTS = 8;
+
+
+// export NB_SHOTS scenes, with a different position of the teapot.
+std::vector<std::string> ExportShots(rpr_context context, rpr_material_system matsys)
+{
+	rpr_scene scene = nullptr;
+	CHECK(rprContextCreateScene(context, &scene));
+	CHECK( CreateAMDFloor(context, scene, matsys, g_gc, 0.7f, 0.7f)  );
+	CHECK( CreateNatureEnvLight(context, scene, g_gc, 0.8f)  );
+
+	rpr_camera camera = nullptr;
+	CHECK(rprContextCreateCamera(context, &camera));
+	CHECK(rprCameraLookAt(camera, 10, 6, 23,   0, 1, 0,   0, 1, 0));
+	CHECK(rprCameraSetFocalLength(camera, 75.f));
+	CHECK(rprSceneSetCamera(scene, camera));
+
+	rpr_shape teapot = ImportOBJ("../../Resources/Meshes/teapot.obj",scene,context);
+	g_gc.GCAdd(teapot);
+
+	rpr_material_node diffuse = nullptr;
+	CHECK(rprMaterialSystemCreateNode(matsys,RPR_MATERIAL_NODE_DIFFUSE,&diffuse));
+	g_gc.GCAdd(diffuse);
+	CHECK(rprMaterialNodeSetInputFByKey(diffuse,RPR_MATERIAL_INPUT_COLOR,0.5f,0.0f,0.0f,1.0f));
+	CHECK(rprShapeSetMaterial(teapot, diffuse));
+
+	std::vector<std::string> files;
+	for(int i=0; i<NB_SHOTS; i++)
+	{
+		RadeonProRender::matrix m = RadeonProRender::translation(RadeonProRender::float3(-4.0f + i, 0, 0)) * RadeonProRender::rotation_x(MY_PI);
+		CHECK(rprShapeSetTransform(teapot, RPR_TRUE, &m.m00));
+
+		const std::string fileName = "62_shot_" + std::to_string(i) + ".rprs";
+		CHECK(rprsExport(fileName.c_str(), context, scene, 0, 0, 0, 0, 0, 0, 0, nullptr));
+		files.push_back(fileName);
+	}
+
+	CHECK(rprObjectDelete(camera));camera=nullptr;
+	CHECK(rprObjectDelete(scene));scene=nullptr;
+	g_gc.GCClean();
+	return files;
+}
+
+
+void RenderShot(rpr_context context, rpr_framebuffer frame_buffer, rpr_framebuffer frame_buffer_resolved, const std::string& outputFile)
+{
+	CHECK(rprFrameBufferClear(frame_buffer));
+	CHECK(rprContextRender(context));
+	CHECK(rprContextResolveFrameBuffer(context,frame_buffer,frame_buffer_resolved,false));
+	CHECK(rprFrameBufferSaveToFile(frame_buffer_resolved, outputFile.c_str()));
+}
+
+
+int main(int argc, char** argv)
+{
+	//	enable Radeon ProRender API trace
+	//	set this before any RPR API calls
+	//	rprContextSetParameterByKey1u(0,RPR_CONTEXT_TRACING_ENABLED,1);
+
+	std::cout << "-- Radeon ProRender SDK Demo --" << std::endl;
+
+	// the RPR context object.
+	rpr_context context = nullptr;
+
+	// Register the RPR DLL
+	rpr_int tahoePluginID = rprRegisterPlugin(RPR_PLUGIN_FILE_NAME); 
+	CHECK_NE(tahoePluginID , -1);
+	rpr_int plugins[] = { tahoePluginID };
+	size_t pluginCount = sizeof(plugins) / sizeof(plugins[0]);
+
+	// Create context using a single GPU 
+	CHECK( rprCreateContext(RPR_API_VERSION, plugins, pluginCount, g_ContextCreationFlags, g_contextProperties, NULL, &context) );
+
+	// Set the active plugin.
+	CHECK(  rprContextSetActivePlugin(context, plugins[0]) );
+
+	std::cout << "RPR Context creation succeeded." << std::endl;
+
+	// create material system
+	rpr_material_system matsys = nullptr;
+	CHECK(rprContextCreateMaterialSystem(context, 0, &matsys));
+
+	// Create framebuffer 
+	rpr_framebuffer_desc desc = { 800,600 };
+	rpr_framebuffer_format fmt = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	rpr_framebuffer frame_buffer = nullptr;
+	rpr_framebuffer frame_buffer_resolved = nullptr;
+	CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer));
+	CHECK( rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer_resolved) );
+	CHECK(rprContextSetAOV(context, RPR_AOV_COLOR, frame_buffer));
+	CHECK(rprContextSetParameterByKey1u(context,RPR_CONTEXT_ITERATIONS,NUM_ITERATIONS));
+
+	std::vector<std::string> files;
+	for(int i=1; i<argc; i++)
+		files.push_back(argv[i]);
+	if ( files.empty() )
+		files = ExportShots(context, matsys);
+
+
+	///////// Sequential rprsImport //////////
+
+	auto start = std::chrono::steady_clock::now();
+	for(size_t i=0; i<files.size(); i++)
+	{
+		rpr_scene scene = nullptr;
+		CHECK(rprContextCreateScene(context, &scene));
+		CHECK(rprContextSetScene(context, scene));
+
+		CHECK(rprsImport(files[i].c_str(), context, matsys, &scene, true, nullptr));
+		RenderShot(context, frame_buffer, frame_buffer_resolved, "62_sequential_" + std::to_string(i) + ".png");
+
+		CHECK(rprsDeleteListImportedObjects(nullptr));
+		CHECK(rprContextSetScene(context, nullptr));
+		CHECK(rprObjectDelete(scene));scene=nullptr;
+	}
+	const double sequentialSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+
+	///////// Prefetched rprsImportFromData //////////
+
+	start = std::chrono::steady_clock::now();
+	RPRRprsPrefetcher::Settings settings;
+	settings.maxFilesAhead = 2;
+	settings.memoryBudgetBytes = size_t(512) << 20;
+	RPRRprsPrefetcher prefetcher(files, settings);
+	for(size_t i=0; prefetcher.HasNext(); i++)
+	{
+		rpr_scene scene = nullptr;
+		CHECK(rprContextCreateScene(context, &scene));
+		CHECK(rprContextSetScene(context, scene));
+
+		CHECK(prefetcher.ImportNext(context, matsys, &scene, true, nullptr));
+		RenderShot(context, frame_buffer, frame_buffer_resolved, "62_prefetch_" + std::to_string(i) + ".png");
+
+		CHECK(rprsDeleteListImportedObjects(nullptr));
+		CHECK(rprContextSetScene(context, nullptr));
+		CHECK(rprObjectDelete(scene));scene=nullptr;
+	}
+	const double prefetchSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	const RPRRprsPrefetcher::Stats stats = prefetcher.GetStats();
+	std::cout << files.size() << " shots" << std::endl;
+	std::cout << "sequential rprsImport : " << sequentialSeconds << " s" << std::endl;
+	std::cout << "prefetch              : " << prefetchSeconds << " s" << std::endl;
+	std::cout << "   I/O thread: " << stats.ioSeconds << " s for " << stats.bytesRead / (1024.0*1024.0) << " MB ( peak held: " << stats.peakBytesHeld / (1024.0*1024.0) << " MB )" << std::endl;
+	std::cout << "   waiting for I/O: " << stats.waitSeconds << " s   rprsImportFromData: " << stats.importSeconds << " s" << std::endl;
+
+
+	// Release the stuff we created
+	CHECK(rprObjectDelete(matsys));matsys=nullptr;
+	CHECK(rprObjectDelete(frame_buffer));frame_buffer=nullptr;
+	CHECK(rprObjectDelete(frame_buffer_resolved));frame_buffer_resolved=nullptr;
+	CheckNoLeak(context);
+	CHECK(rprObjectDelete(context));context=nullptr; // Always delete the RPR Context in last.
+	return 0;
+}
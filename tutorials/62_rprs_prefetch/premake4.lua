@@ -0,0 +1,31 @@
+project "62_rprs_prefetch"
+    kind "ConsoleApp"
+    location "../build"
+    files { "../62_rprs_prefetch/**.h", "../62_rprs_prefetch/**.cpp"} 
+    files { "../common/common.cpp","../common/common.h"}
+    files { "../../RadeonProRender/rprTools/rprRprsPrefetcher.cpp","../../RadeonProRender/rprTools/rprRprsPrefetcher.h"}
+
+    -- remove filters for Visual Studio
+    vpaths { [""] = { 
+		"../62_rprs_prefetch/**.h", "../62_rprs_prefetch/**.cpp",
+		"../common/common.cpp","../common/common.h",
+		"../../RadeonProRender/rprTools/rprRprsPrefetcher.cpp", "../../RadeonProRender/rprTools/rprRprsPrefetcher.h"
+	} }
+
+    includedirs{ "../../RadeonProRender/inc" } 
+    
+    buildoptions "-std=c++14"
+
+    configuration {"x64"}
+    links {"RadeonProRender64", "RprLoadStore64"}
+
+    if os.istarget("linux") then
+		links {"pthread"}
+    end
+
+    configuration {"x64", "Debug"}
+        targetdir "../Bin"
+    configuration {"x64", "Release"}
+        targetdir "../Bin"
+    configuration {}
+    
@@ -0,0 +1,151 @@
+/*****************************************************************************\
+*
+*  Module Name    65_rprs_buffer_store/main.cpp
+*  Project        Radeon ProRender rendering tutorial
+*
+*  Description    Radeon ProRender SDK tutorials: RPRS animation exported through RPRRprsBufferStore
+*
+*  Copyright(C) 2011-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+
+//
+// Shows how to export an animation as RPRS files with RPRRprsBufferStore ( rprTools ).
+// Each frame is exported with RPRLOADSTORE_EXPORTFLAG_EXTERNALFILES, and the external buffers are moved into a content-addressed store:
+// the meshes and images that don't change between frames are stored only once.
+// The last frame is then imported back through the store and rendered.
+//
+
+
+#include "RadeonProRender.h"
+#include "Math/mathutils.h"
+#include "RprLoadStore.h"
+#include "../common/common.h"
+#include "../../RadeonProRender/rprTools/rprRprsBufferStore.h"
+
+#include <cassert>
+#include <iostream>
+
+RPRGarbageCollector g_gc;
+
+const int NB_FRAMES = 8;
+
+
+int main()
+{
+	//	enable Radeon ProRender API trace
+	//	set this before any RPR API calls
+	//	rprContextSetParameterByKey1u(0,RPR_CONTEXT_TRACING_ENABLED,1);
+
+	std::cout << "-- Radeon ProRender SDK Demo --" << std::endl;
+
+	// the RPR context object.
+	rpr_context context = nullptr;
+
+	// Register the RPR DLL
+	rpr_int tahoePluginID = rprRegisterPlugin(RPR_PLUGIN_FILE_NAME);
+	CHECK_NE(tahoePluginID , -1);
+	rpr_int plugins[] = { tahoePluginID };
+	size_t pluginCount = sizeof(plugins) / sizeof(plugins[0]);
+
+	// Create context using a single GPU
+	CHECK( rprCreateContext(RPR_API_VERSION, plugins, pluginCount, g_ContextCreationFlags, g_contextProperties, NULL, &context) );
+
+	// Set the active plugin.
+	CHECK(  rprContextSetActivePlugin(context, plugins[0]) );
+
+	std::cout << "RPR Context creation succeeded." << std::endl;
+
+	// create material system
+	rpr_material_system matsys = nullptr;
+	CHECK(rprContextCreateMaterialSystem(context, 0, &matsys));
+
+	rpr_scene scene = nullptr;
+	CHECK(rprContextCreateScene(context, &scene));
+	CHECK( CreateAMDFloor(context, scene, matsys, g_gc, 0.7f, 0.7f)  );
+	CHECK( CreateNatureEnvLight(context, scene, g_gc, 0.8f)  );
+
+	rpr_camera camera = nullptr;
+	CHECK(rprContextCreateCamera(context, &camera));
+	CHECK(rprCameraLookAt(camera, 10, 6, 23,   0, 1, 0,   0, 1, 0));
+	CHECK(rprCameraSetFocalLength(camera, 75.f));
+	CHECK(rprSceneSetCamera(scene, camera));
+
+	rpr_shape teapot = ImportOBJ("../../Resources/Meshes/teapot.obj",scene,context);
+	g_gc.GCAdd(teapot);
+
+	rpr_material_node diffuse = nullptr;
+	CHECK(rprMaterialSystemCreateNode(matsys,RPR_MATERIAL_NODE_DIFFUSE,&diffuse));
+	g_gc.GCAdd(diffuse);
+	CHECK(rprShapeSetMaterial(teapot, diffuse));
+
+
+	///////// Export the frames //////////
+
+	// only the teapot transform and color change: after the first frame, the store receives almost nothing.
+	RPRRprsBufferStore::Settings settings;
+	settings.storeDirectory = "65_store";
+	RPRRprsBufferStore store(settings);
+
+	size_t bytesTotal = 0;
+	size_t bytesStored = 0;
+	std::string lastFrame;
+	for(int i=0; i<NB_FRAMES; i++)
+	{
+		RadeonProRender::matrix m = RadeonProRender::translation(RadeonProRender::float3(-4.0f + i, 0, 0)) * RadeonProRender::rotation_x(MY_PI);
+		CHECK(rprShapeSetTransform(teapot, RPR_TRUE, &m.m00));
+		CHECK(rprMaterialNodeSetInputFByKey(diffuse,RPR_MATERIAL_INPUT_COLOR,0.5f,0.1f*i,0.0f,1.0f));
+
+		lastFrame = "65_frames/frame_" + std::to_string(i) + ".rprs";
+		RPRRprsBufferStore::ExportStats stats;
+		CHECK(store.Export(lastFrame, context, scene, 0, nullptr, &stats));
+
+		std::cout << lastFrame << " : " << stats.filesTotal << " external files, " << stats.bytesTotal / 1024 << " KB. Added to the store: " << stats.filesStored << " files, " << stats.bytesStored / 1024 << " KB" << std::endl;
+		bytesTotal += stats.bytesTotal;
+		bytesStored += stats.bytesStored;
+	}
+	std::cout << "external buffers of all frames: " << bytesTotal / 1024 << " KB, size of the store: " << bytesStored / 1024 << " KB" << std::endl;
+
+	CHECK(rprObjectDelete(camera));camera=nullptr;
+	CHECK(rprObjectDelete(scene));scene=nullptr;
+	g_gc.GCClean();
+
+
+	///////// Import the last frame from the store //////////
+
+	// Create framebuffer
+	rpr_framebuffer_desc desc = { 800,600 };
+	rpr_framebuffer_format fmt = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	rpr_framebuffer frame_buffer = nullptr;
+	rpr_framebuffer frame_buffer_resolved = nullptr;
+	CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer));
+	CHECK( rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer_resolved) );
+	CHECK(rprContextSetAOV(context, RPR_AOV_COLOR, frame_buffer));
+	CHECK(rprContextSetParameterByKey1u(context,RPR_CONTEXT_ITERATIONS,NUM_ITERATIONS));
+
+	CHECK(rprContextCreateScene(context, &scene));
+	CHECK(rprContextSetScene(context, scene));
+
+	// the external files of the frame are linked from the store into 65_work/, next to the RPRS file given to rprsImport.
+	RPRRprsBufferStore::ResolveStats resolveStats;
+	CHECK(store.Import(lastFrame, "65_work", context, matsys, &scene, true, nullptr, &resolveStats));
+	std::cout << "import of " << lastFrame << " : " << resolveStats.filesResolved << " external files resolved from the store" << std::endl;
+
+	CHECK(rprFrameBufferClear(frame_buffer));
+	CHECK(rprContextRender(context));
+	CHECK(rprContextResolveFrameBuffer(context,frame_buffer,frame_buffer_resolved,false));
+	CHECK(rprFrameBufferSaveToFile(frame_buffer_resolved, "65.png"));
+	std::cout << "Rendering finished." << std::endl;
+
+	// Release the stuff we created
+	CHECK(rprsDeleteListImportedObjects(nullptr));
+	CHECK(rprContextSetScene(context, nullptr));
+	CHECK(rprObjectDelete(scene));scene=nullptr;
+	CHECK(rprObjectDelete(matsys));matsys=nullptr;
+	CHECK(rprObjectDelete(frame_buffer));frame_buffer=nullptr;
+	CHECK(rprObjectDelete(frame_buffer_resolved));frame_buffer_resolved=nullptr;
+	CheckNoLeak(context);
+	CHECK(rprObjectDelete(context));context=nullptr; // Always delete the RPR Context in last.
+	return 0;
+}
@@ -0,0 +1,31 @@
+project "65_rprs_buffer_store"
+    kind "ConsoleApp"
+    location "../build"
+    files { "../65_rprs_buffer_store/**.h", "../65_rprs_buffer_store/**.cpp"} 
+    files { "../common/common.cpp","../common/common.h"}
+    files { "../../RadeonProRender/rprTools/rprRprsBufferStore.cpp","../../RadeonProRender/rprTools/rprRprsBufferStore.h"}
+
+    -- remove filters for Visual Studio
+    vpaths { [""] = { 
+		"../65_rprs_buffer_store/**.h", "../65_rprs_buffer_store/**.cpp",
+		"../common/common.cpp","../common/common.h",
+		"../../RadeonProRender/rprTools/rprRprsBufferStore.cpp", "../../RadeonProRender/rprTools/rprRprsBufferStore.h"
+	} }
+
+    includedirs{ "../../RadeonProRender/inc" } 
+    
+    buildoptions "-std=c++14"
+
+    configuration {"x64"}
+    links {"RadeonProRender64", "RprLoadStore64"}
+
+    if os.istarget("linux") then
+		links {"pthread"}
+    end
+
+    configuration {"x64", "Debug"}
+        targetdir "../Bin"
+    configuration {"x64", "Release"}
+        targetdir "../Bin"
+    configuration {}
+    
@@ -0,0 +1,173 @@
+/*****************************************************************************\
+*
+*  Module Name    66_scene_pool/main.cpp
+*  Project        Radeon ProRender rendering tutorial
+*
+*  Description    Radeon ProRender SDK tutorials: assets shared between render jobs with RPRScenePool
+*
+*  Copyright(C) 2011-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+
+//
+// Shows how to reuse imported assets between render jobs with RPRScenePool ( rprTools ).
+// Each job renders a new scene made of the same asset: the pool imports the RPRS file once, then attaches the same objects to the scene of each job.
+// The demo compares it with one rprsImport / rprsDeleteListImportedObjects per job.
+//
+
+
+#include "RadeonProRender.h"
+#include "Math/mathutils.h"
+#include "RprLoadStore.h"
+#include "../common/common.h"
+#include "../../RadeonProRender/rprTools/rprScenePool.h"
+
+#include <cassert>
+#include <chrono>
+#include <iostream>
+
+RPRGarbageCollector g_gc;
+
+const int NB_JOBS = 8;
+const char ASSET_FILE[] = "66_asset.rprs";
+
+
+// export the asset used by all the jobs.
+void ExportAsset(rpr_context context, rpr_material_system matsys)
+{
+	rpr_scene scene = nullptr;
+	CHECK(rprContextCreateScene(context, &scene));
+	CHECK( CreateAMDFloor(context, scene, matsys, g_gc, 0.7f, 0.7f)  );
+	CHECK( CreateNatureEnvLight(context, scene, g_gc, 0.8f)  );
+
+	rpr_camera camera = nullptr;
+	CHECK(rprContextCreateCamera(context, &camera));
+	CHECK(rprCameraLookAt(camera, 10, 6, 23,   0, 1, 0,   0, 1, 0));
+	CHECK(rprCameraSetFocalLength(camera, 75.f));
+	CHECK(rprSceneSetCamera(scene, camera));
+
+	rpr_shape teapot = ImportOBJ("../../Resources/Meshes/teapot.obj",scene,context);
+	g_gc.GCAdd(teapot);
+	RadeonProRender::matrix m = RadeonProRender::rotation_x(MY_PI);
+	CHECK(rprShapeSetTransform(teapot, RPR_TRUE, &m.m00));
+
+	CHECK(rprsExport(ASSET_FILE, context, scene, 0, 0, 0, 0, 0, 0, 0, nullptr));
+
+	CHECK(rprObjectDelete(camera));camera=nullptr;
+	CHECK(rprObjectDelete(scene));scene=nullptr;
+	g_gc.GCClean();
+}
+
+
+void RenderJob(rpr_context context, rpr_framebuffer frame_buffer, rpr_framebuffer frame_buffer_resolved, const std::string& outputFile)
+{
+	CHECK(rprFrameBufferClear(frame_buffer));
+	CHECK(rprContextRender(context));
+	CHECK(rprContextResolveFrameBuffer(context,frame_buffer,frame_buffer_resolved,false));
+	CHECK(rprFrameBufferSaveToFile(frame_buffer_resolved, outputFile.c_str()));
+}
+
+
+int main()
+{
+	//	enable Radeon ProRender API trace
+	//	set this before any RPR API calls
+	//	rprContextSetParameterByKey1u(0,RPR_CONTEXT_TRACING_ENABLED,1);
+
+	std::cout << "-- Radeon ProRender SDK Demo --" << std::endl;
+
+	// the RPR context object.
+	rpr_context context = nullptr;
+
+	// Register the RPR DLL
+	rpr_int tahoePluginID = rprRegisterPlugin(RPR_PLUGIN_FILE_NAME);
+	CHECK_NE(tahoePluginID , -1);
+	rpr_int plugins[] = { tahoePluginID };
+	size_t pluginCount = sizeof(plugins) / sizeof(plugins[0]);
+
+	// Create context using a single GPU
+	CHECK( rprCreateContext(RPR_API_VERSION, plugins, pluginCount, g_ContextCreationFlags, g_contextProperties, NULL, &context) );
+
+	// Set the active plugin.
+	CHECK(  rprContextSetActivePlugin(context, plugins[0]) );
+
+	std::cout << "RPR Context creation succeeded." << std::endl;
+
+	// create material system
+	rpr_material_system matsys = nullptr;
+	CHECK(rprContextCreateMaterialSystem(context, 0, &matsys));
+
+	// Create framebuffer
+	rpr_framebuffer_desc desc = { 800,600 };
+	rpr_framebuffer_format fmt = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	rpr_framebuffer frame_buffer = nullptr;
+	rpr_framebuffer frame_buffer_resolved = nullptr;
+	CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer));
+	CHECK( rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer_resolved) );
+	CHECK(rprContextSetAOV(context, RPR_AOV_COLOR, frame_buffer));
+	CHECK(rprContextSetParameterByKey1u(context,RPR_CONTEXT_ITERATIONS,NUM_ITERATIONS));
+
+	ExportAsset(context, matsys);
+
+
+	///////// One rprsImport per job //////////
+
+	auto start = std::chrono::steady_clock::now();
+	for(int i=0; i<NB_JOBS; i++)
+	{
+		rpr_scene scene = nullptr;
+		CHECK(rprContextCreateScene(context, &scene));
+		CHECK(rprContextSetScene(context, scene));
+
+		CHECK(rprsImport(ASSET_FILE, context, matsys, &scene, true, nullptr));
+		RenderJob(context, frame_buffer, frame_buffer_resolved, "66_import_" + std::to_string(i) + ".png");
+
+		CHECK(rprsDeleteListImportedObjects(nullptr));
+		CHECK(rprContextSetScene(context, nullptr));
+		CHECK(rprObjectDelete(scene));scene=nullptr;
+	}
+	const double importSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+
+	///////// Scene pool //////////
+
+	start = std::chrono::steady_clock::now();
+	{
+		RPRScenePool::Settings settings;
+		settings.memoryBudgetBytes = size_t(512) << 20;
+		RPRScenePool pool(context, matsys, settings);
+		for(int i=0; i<NB_JOBS; i++)
+		{
+			rpr_scene scene = nullptr;
+			CHECK(rprContextCreateScene(context, &scene));
+			CHECK(rprContextSetScene(context, scene));
+
+			// only the first job imports the file
+			CHECK(pool.Attach(ASSET_FILE, scene));
+			RenderJob(context, frame_buffer, frame_buffer_resolved, "66_pool_" + std::to_string(i) + ".png");
+
+			CHECK(pool.DetachScene(scene));
+			CHECK(rprContextSetScene(context, nullptr));
+			CHECK(rprObjectDelete(scene));scene=nullptr;
+		}
+
+		const RPRScenePool::Stats stats = pool.GetStats();
+		std::cout << "pool: " << stats.hits << " hits, " << stats.misses << " misses, " << stats.evictions << " evictions, "
+			<< stats.residentFiles << " resident files ( " << stats.residentBytes / 1024 << " KB ), " << stats.importSeconds << " s of import" << std::endl;
+	} // the pool deletes the objects it imported
+	const double poolSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::cout << NB_JOBS << " jobs" << std::endl;
+	std::cout << "one rprsImport per job : " << importSeconds << " s" << std::endl;
+	std::cout << "scene pool             : " << poolSeconds << " s" << std::endl;
+
+
+	// Release the stuff we created
+	CHECK(rprObjectDelete(matsys));matsys=nullptr;
+	CHECK(rprObjectDelete(frame_buffer));frame_buffer=nullptr;
+	CHECK(rprObjectDelete(frame_buffer_resolved));frame_buffer_resolved=nullptr;
+	CheckNoLeak(context);
+	CHECK(rprObjectDelete(context));context=nullptr; // Always delete the RPR Context in last.
+	return 0;
+}
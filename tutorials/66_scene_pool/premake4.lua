@@ -0,0 +1,33 @@
+project "66_scene_pool"
+    kind "ConsoleApp"
+    location "../build"
+    files { "../66_scene_pool/**.h", "../66_scene_pool/**.cpp"} 
+    files { "../common/common.cpp","../common/common.h"}
+    files { "../../RadeonProRender/rprTools/rprScenePool.cpp","../../RadeonProRender/rprTools/rprScenePool.h"}
+    files { "../../RadeonProRender/rprTools/rprRprsBufferStore.cpp","../../RadeonProRender/rprTools/rprRprsBufferStore.h"}
+
+    -- remove filters for Visual Studio
+    vpaths { [""] = { 
+		"../66_scene_pool/**.h", "../66_scene_pool/**.cpp",
+		"../common/common.cpp","../common/common.h",
+		"../../RadeonProRender/rprTools/rprScenePool.cpp", "../../RadeonProRender/rprTools/rprScenePool.h",
+		"../../RadeonProRender/rprTools/rprRprsBufferStore.cpp", "../../RadeonProRender/rprTools/rprRprsBufferStore.h"
+	} }
+
+    includedirs{ "../../RadeonProRender/inc" } 
+    
+    buildoptions "-std=c++14"
+
+    configuration {"x64"}
+    links {"RadeonProRender64", "RprLoadStore64", "ProRenderGLTF"}
+
+    if os.istarget("linux") then
+		links {"pthread"}
+    end
+
+    configuration {"x64", "Debug"}
+        targetdir "../Bin"
+    configuration {"x64", "Release"}
+        targetdir "../Bin"
+    configuration {}
+    
@@ -0,0 +1,107 @@
+/*****************************************************************************\
+*
+*  Module Name    67_materialx_loader/main.cpp
+*  Project        Radeon ProRender rendering tutorial
+*
+*  Description    Radeon ProRender SDK tutorials: startup benchmark of RPRMtlxLoader in worker threads
+*
+*  Copyright(C) 2011-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+
+//
+// Benchmark of the startup of RPRMtlxLoader ( rprTools ) in a pool of worker threads.
+// Each worker creates its own loader and prepares a MaterialX document, like the workers of a material farm.
+//
+//  - private stdlib : each worker parses the standard libraries with mx::loadLibraries and imports the whole library in its document.
+//  - shared stdlib  : RPRMtlxLoader::SetupStdlib finds the libraries, the first ImportStdlibDefinitions of the process parses them, and it only imports
+//                     the nodedefs used by the document.
+//
+// usage:  67_materialx_loader64 [material.mtlx] [MaterialX libraries folder]
+// Without library folder, the MATERIALX_SEARCH_PATH environment variable is used.
+// This tutorial is only built when premake is called with --materialx=PATH
+//
+
+
+#include "RadeonProRender.h"
+#include "../../RadeonProRender/rprTools/rprMtlxLoader.h"
+
+#include <MaterialXFormat/Util.h>
+#include <MaterialXFormat/XmlIo.h>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace mx = MaterialX;
+
+
+struct BenchmarkResult
+{
+	double seconds = 0.0;
+	size_t elementsPerDocument = 0;
+};
+
+
+// run the same preparation on threadCount threads, returns the time until the last one is done.
+template<typename F>
+BenchmarkResult RunWorkers(int threadCount, F&& prepareDocument)
+{
+	std::atomic<size_t> elements(0);
+	const auto start = std::chrono::steady_clock::now();
+	std::vector<std::thread> threads;
+	for(int i=0; i<threadCount; i++)
+		threads.emplace_back([&]() { elements += prepareDocument()->getChildren().size(); });
+	for(auto& thread : threads)
+		thread.join();
+
+	BenchmarkResult result;
+	result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	result.elementsPerDocument = elements / threadCount;
+	return result;
+}
+
+
+int main(int argc, char** argv)
+{
+	std::cout << "-- Radeon ProRender SDK Demo --" << std::endl;
+
+	const std::string materialFile = argc > 1 ? argv[1] : "../../Resources/Textures/matx_texture.mtlx";
+	const mx::FileSearchPath librariesSearchPath = argc > 2 ? mx::FileSearchPath(argv[2]) : mx::getEnvironmentPath();
+	const mx::FilePathVec libraryNames = { "stdlib", "pbrlib", "bxdf" };
+
+	for(int threadCount : { 1, 16 })
+	{
+		// what each loader did before the shared stdlib
+		const BenchmarkResult privateStdlib = RunWorkers(threadCount, [&]() {
+			mx::DocumentPtr stdlib = mx::createDocument();
+			mx::loadLibraries(libraryNames, librariesSearchPath, stdlib);
+
+			mx::DocumentPtr document = mx::createDocument();
+			mx::readFromXmlFile(document, materialFile);
+			document->importLibrary(stdlib);
+			return document;
+		});
+
+		// the first loader of the process parses the libraries, the others reuse them.
+		const BenchmarkResult sharedStdlib = RunWorkers(threadCount, [&]() {
+			RPRMtlxLoader loader;
+			loader.SetupStdlib(libraryNames, librariesSearchPath);
+
+			mx::DocumentPtr document = mx::createDocument();
+			mx::readFromXmlFile(document, materialFile);
+			loader.ImportStdlibDefinitions(document);
+			return document;
+		});
+
+		std::cout << threadCount << " loader thread(s):" << std::endl;
+		std::cout << "   private stdlib : " << privateStdlib.seconds * 1000.0 << " ms, " << privateStdlib.elementsPerDocument << " elements per document" << std::endl;
+		std::cout << "   shared stdlib  : " << sharedStdlib.seconds * 1000.0 << " ms, " << sharedStdlib.elementsPerDocument << " elements per document" << std::endl;
+	}
+	std::cout << "( the shared stdlib stays loaded after the first run: the 16 threads run only measures its reuse )" << std::endl;
+
+	return 0;
+}
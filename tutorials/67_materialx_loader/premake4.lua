@@ -0,0 +1,31 @@
+project "67_materialx_loader"
+    kind "ConsoleApp"
+    location "../build"
+    files { "../67_materialx_loader/**.h", "../67_materialx_loader/**.cpp"} 
+    files { "../../RadeonProRender/rprTools/rprMtlxLoader.cpp","../../RadeonProRender/rprTools/rprMtlxLoader.h"}
+
+    -- remove filters for Visual Studio
+    vpaths { [""] = { 
+		"../67_materialx_loader/**.h", "../67_materialx_loader/**.cpp",
+		"../../RadeonProRender/rprTools/rprMtlxLoader.cpp", "../../RadeonProRender/rprTools/rprMtlxLoader.h"
+	} }
+
+    -- rprMtlxLoader needs the MaterialX SDK: given with  --materialx=PATH
+    includedirs{ "../../RadeonProRender/inc", _OPTIONS["materialx"] .. "/include" } 
+    libdirs{ _OPTIONS["materialx"] .. "/lib" }
+    
+    buildoptions "-std=c++14"
+
+    configuration {"x64"}
+    links {"RadeonProRender64", "MaterialXFormat", "MaterialXCore"}
+
+    if os.istarget("linux") then
+		links {"pthread"}
+    end
+
+    configuration {"x64", "Debug"}
+        targetdir "../Bin"
+    configuration {"x64", "Release"}
+        targetdir "../Bin"
+    configuration {}
+    
@@ -0,0 +1,163 @@
+/*****************************************************************************\
+*
+*  Module Name    68_mtlx_textures/main.cpp
+*  Project        Radeon ProRender rendering tutorial
+*
+*  Description    Radeon ProRender SDK tutorials: MaterialX batch loading and background textures
+*
+*  Copyright(C) 2011-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+
+//
+// Shows how to load a set of MaterialX materials with RPRMtlxLoader::LoadBatch, and their textures with RPRMtlxTextureLoader ( rprTools ).
+// The documents are parsed by worker threads, then the texture files are read in the background while the scene renders
+// ( the images are decoded by the core when Update creates them ):
+// each material is shown with its default values first, and with its textures once they are bound.
+//
+// usage:  68_mtlx_textures64 [MaterialX libraries folder]
+// Without library folder, the MATERIALX_SEARCH_PATH environment variable is used.
+// This tutorial is only built when premake is called with --materialx=PATH
+//
+
+
+#include "RadeonProRender.h"
+#include "Math/mathutils.h"
+#include "../common/common.h"
+#include "../../RadeonProRender/rprTools/rprMtlxLoader.h"
+#include "../../RadeonProRender/rprTools/rprMtlxTextureLoader.h"
+
+#include <MaterialXFormat/Util.h>
+
+#include <cassert>
+#include <iostream>
+
+RPRGarbageCollector g_gc;
+
+
+int main(int argc, char** argv)
+{
+	//	enable Radeon ProRender API trace
+	//	set this before any RPR API calls
+	//	rprContextSetParameterByKey1u(0,RPR_CONTEXT_TRACING_ENABLED,1);
+
+	std::cout << "-- Radeon ProRender SDK Demo --" << std::endl;
+
+	const MaterialX::FileSearchPath librariesSearchPath = argc > 1 ? MaterialX::FileSearchPath(argv[1]) : MaterialX::getEnvironmentPath();
+
+	// the RPR context object.
+	rpr_context context = nullptr;
+
+	// Register the RPR DLL
+	rpr_int tahoePluginID = rprRegisterPlugin(RPR_PLUGIN_FILE_NAME);
+	CHECK_NE(tahoePluginID , -1);
+	rpr_int plugins[] = { tahoePluginID };
+	size_t pluginCount = sizeof(plugins) / sizeof(plugins[0]);
+
+	// Create context using a single GPU
+	CHECK( rprCreateContext(RPR_API_VERSION, plugins, pluginCount, g_ContextCreationFlags, g_contextProperties, NULL, &context) );
+
+	// Set the active plugin.
+	CHECK(  rprContextSetActivePlugin(context, plugins[0]) );
+
+	std::cout << "RPR Context creation succeeded." << std::endl;
+
+	// create material system
+	rpr_material_system matsys = nullptr;
+	CHECK(rprContextCreateMaterialSystem(context, 0, &matsys));
+
+	rpr_scene scene = nullptr;
+	CHECK(rprContextCreateScene(context, &scene));
+	CHECK(rprContextSetScene(context, scene));
+	CHECK( CreateNatureEnvLight(context, scene, g_gc, 0.8f)  );
+
+	rpr_camera camera = nullptr;
+	CHECK(rprContextCreateCamera(context, &camera));
+	CHECK(rprCameraLookAt(camera, 0, 5, 20,   0, 1, 0,   0, 1, 0));
+	CHECK(rprCameraSetFocalLength(camera, 75.f));
+	CHECK(rprSceneSetCamera(scene, camera));
+
+	// Create framebuffer
+	rpr_framebuffer_desc desc = { 800,600 };
+	rpr_framebuffer_format fmt = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	rpr_framebuffer frame_buffer = nullptr;
+	rpr_framebuffer frame_buffer_resolved = nullptr;
+	CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer));
+	CHECK( rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer_resolved) );
+	CHECK(rprContextSetAOV(context, RPR_AOV_COLOR, frame_buffer));
+	CHECK(rprContextSetParameterByKey1u(context,RPR_CONTEXT_ITERATIONS,NUM_ITERATIONS));
+
+
+	///////// Materials //////////
+
+	const std::vector<std::string> materialFiles = {
+		"../../Resources/Textures/matx_texture.mtlx",
+		"../../Resources/Textures/matx_standard_surface_metal_texture.mtlx",
+		"../../Resources/Textures/matx_standard_surface_gold.mtlx",
+	};
+
+	RPRMtlxLoader mtlxLoader;
+	mtlxLoader.SetupStdlib({ "stdlib", "pbrlib", "bxdf" }, librariesSearchPath);
+	std::vector<RPRMtlxLoader::Result> materials = mtlxLoader.LoadBatch(materialFiles, MaterialX::FileSearchPath(), matsys);
+
+	{
+		// the files are read by the workers of the texture loader, the images are created and bound by Update.
+		RPRMtlxTextureLoader textureLoader(context);
+		for(size_t i=0; i<materials.size(); i++)
+		{
+			const RPRMtlxLoader::Result& material = materials[i];
+			const size_t surfaceIndex = material.rootNodeIndices[RPRMtlxLoader::kOutputSurface];
+			if ( !material.nodes || surfaceIndex == RPRMtlxLoader::Result::kInvalidRootNodeIndex )
+			{
+				std::cout << "failed to load " << materialFiles[i] << std::endl;
+				continue;
+			}
+			textureLoader.Add(material);
+
+			rpr_shape teapot = ImportOBJ("../../Resources/Meshes/teapot.obj",scene,context);
+			g_gc.GCAdd(teapot);
+			RadeonProRender::matrix m = RadeonProRender::translation(RadeonProRender::float3(-6.0f + 6.0f * i, 0, 0)) * RadeonProRender::rotation_x(MY_PI);
+			CHECK(rprShapeSetTransform(teapot, RPR_TRUE, &m.m00));
+			CHECK(rprShapeSetMaterial(teapot, material.nodes[surfaceIndex]));
+		}
+
+
+		///////// Render while the textures load //////////
+
+		int frame = 0;
+		do
+		{
+			// at most one new image per frame: its decode is the cost of Update
+			textureLoader.Update(1);
+
+			const RPRMtlxTextureLoader::Progress progress = textureLoader.GetProgress();
+			std::cout << "frame " << frame << ": " << progress.texturesLoaded + progress.texturesFailed << "/" << progress.texturesTotal << " textures, "
+				<< progress.nodesBound << " nodes bound, " << progress.nodesDefaulted << " with their default value" << std::endl;
+
+			CHECK(rprFrameBufferClear(frame_buffer));
+			CHECK(rprContextRender(context));
+			frame++;
+		}
+		while ( !textureLoader.IsDone() );
+
+		CHECK(rprContextResolveFrameBuffer(context,frame_buffer,frame_buffer_resolved,false));
+		CHECK(rprFrameBufferSaveToFile(frame_buffer_resolved, "68.png"));
+		std::cout << "Rendering finished." << std::endl;
+
+
+		// Release the stuff we created
+		g_gc.GCClean();
+		for(auto& material : materials)
+			RPRMtlxLoader::Release(&material);
+	} // the texture loader deletes its images
+	CHECK(rprContextSetScene(context, nullptr));
+	CHECK(rprObjectDelete(scene));scene=nullptr;
+	CHECK(rprObjectDelete(camera));camera=nullptr;
+	CHECK(rprObjectDelete(matsys));matsys=nullptr;
+	CHECK(rprObjectDelete(frame_buffer));frame_buffer=nullptr;
+	CHECK(rprObjectDelete(frame_buffer_resolved));frame_buffer_resolved=nullptr;
+	CheckNoLeak(context);
+	CHECK(rprObjectDelete(context));context=nullptr; // Always delete the RPR Context in last.
+	return 0;
+}
@@ -0,0 +1,35 @@
+project "68_mtlx_textures"
+    kind "ConsoleApp"
+    location "../build"
+    files { "../68_mtlx_textures/**.h", "../68_mtlx_textures/**.cpp"} 
+    files { "../../RadeonProRender/rprTools/rprMtlxLoader.cpp","../../RadeonProRender/rprTools/rprMtlxLoader.h"}
+    files { "../../RadeonProRender/rprTools/rprMtlxTextureLoader.cpp","../../RadeonProRender/rprTools/rprMtlxTextureLoader.h"}
+    files { "../common/common.cpp","../common/common.h"}
+
+    -- remove filters for Visual Studio
+    vpaths { [""] = { 
+		"../68_mtlx_textures/**.h", "../68_mtlx_textures/**.cpp",
+		"../common/common.cpp","../common/common.h",
+		"../../RadeonProRender/rprTools/rprMtlxLoader.cpp", "../../RadeonProRender/rprTools/rprMtlxLoader.h",
+		"../../RadeonProRender/rprTools/rprMtlxTextureLoader.cpp", "../../RadeonProRender/rprTools/rprMtlxTextureLoader.h"
+	} }
+
+    -- rprMtlxLoader needs the MaterialX SDK: given with  --materialx=PATH
+    includedirs{ "../../RadeonProRender/inc", _OPTIONS["materialx"] .. "/include" } 
+    libdirs{ _OPTIONS["materialx"] .. "/lib" }
+    
+    buildoptions "-std=c++14"
+
+    configuration {"x64"}
+    links {"RadeonProRender64", "MaterialXFormat", "MaterialXCore"}
+
+    if os.istarget("linux") then
+		links {"pthread"}
+    end
+
+    configuration {"x64", "Debug"}
+        targetdir "../Bin"
+    configuration {"x64", "Release"}
+        targetdir "../Bin"
+    configuration {}
+    
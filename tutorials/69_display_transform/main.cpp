@@ -0,0 +1,279 @@
+/*****************************************************************************\
+*
+*  Module Name    69_display_transform/main.cpp
+*  Project        Radeon ProRender rendering tutorial
+*
+*  Description    Radeon ProRender SDK tutorials: benchmark of the RPRDisplayTransform 3D LUT
+*
+*  Copyright(C) 2011-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+
+//
+// Benchmark of RPRDisplayTransform ( rprTools ): accuracy and speed of the baked 3D LUT against the direct transform of each pixel.
+// A scene is rendered once, then its HDR framebuffer is converted to 8-bit by:
+//
+//  - direct : the transform called on each pixel, like the loop of 29_ocio before RPRDisplayTransform
+//  - LUT    : RPRDisplayTransform::Apply, for several LUT sizes and interpolations, on 1 thread and on all the threads
+//
+// The error is the difference with the direct transform, in 8-bit levels, measured without dithering.
+// The values missing from a render are checked apart: 0, the negatives and NaN must give the transform of 0 ( black ),
+// the values below the shaper range must be close to the transform.
+// Set USE_OCIO to 1 to add the ACES display transform of OpenColorIO ( applyRGB for the direct transform ), as in 29_ocio.
+//
+
+
+// set it to 1 if OpenColorIO library is linked to this project.
+#define USE_OCIO 0
+
+#include "RadeonProRender.h"
+#include "Math/mathutils.h"
+#include "../common/common.h"
+#include "../../RadeonProRender/rprTools/rprDisplayTransform.h"
+
+#if ( USE_OCIO == 1 )
+#include <OpenColorIO/OpenColorIO.h>
+namespace OCIO = OCIO_NAMESPACE;
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+RPRGarbageCollector g_gc;
+
+
+struct Look
+{
+	std::string name;
+	RPRDisplayTransform::ColorFunction function;
+};
+
+// milliseconds taken by f
+template<typename F>
+double Measure(F&& f)
+{
+	const auto start = std::chrono::steady_clock::now();
+	f();
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+int main()
+{
+	//	enable Radeon ProRender API trace
+	//	set this before any RPR API calls
+	//	rprContextSetParameterByKey1u(0,RPR_CONTEXT_TRACING_ENABLED,1);
+
+	std::cout << "-- Radeon ProRender SDK Demo --" << std::endl;
+
+	// the RPR context object.
+	rpr_context context = nullptr;
+
+	// Register the RPR DLL
+	rpr_int tahoePluginID = rprRegisterPlugin(RPR_PLUGIN_FILE_NAME);
+	CHECK_NE(tahoePluginID , -1);
+	rpr_int plugins[] = { tahoePluginID };
+	size_t pluginCount = sizeof(plugins) / sizeof(plugins[0]);
+
+	// Create context using a single GPU
+	CHECK( rprCreateContext(RPR_API_VERSION, plugins, pluginCount, g_ContextCreationFlags, g_contextProperties, NULL, &context) );
+
+	// Set the active plugin.
+	CHECK(  rprContextSetActivePlugin(context, plugins[0]) );
+
+	std::cout << "RPR Context creation succeeded." << std::endl;
+
+	rpr_material_system matsys = nullptr;
+	CHECK(rprContextCreateMaterialSystem(context, 0, &matsys));
+
+	rpr_scene scene = nullptr;
+	CHECK(rprContextCreateScene(context, &scene));
+	CHECK(rprContextSetScene(context, scene));
+
+	// a bright light, to have values far above 1 in the framebuffer
+	CHECK( CreateNatureEnvLight(context, scene, g_gc, 3.0f)  );
+
+	rpr_camera camera = nullptr;
+	CHECK(rprContextCreateCamera(context, &camera));
+	CHECK(rprCameraLookAt(camera, 0, 5, 20,   0, 1, 0,   0, 1, 0));
+	CHECK(rprCameraSetFocalLength(camera, 75.f));
+	CHECK(rprSceneSetCamera(scene, camera));
+
+	rpr_shape teapot = ImportOBJ("../../Resources/Meshes/teapot.obj",scene,context);
+	g_gc.GCAdd(teapot);
+	RadeonProRender::matrix m = RadeonProRender::rotation_x(MY_PI);
+	CHECK(rprShapeSetTransform(teapot, RPR_TRUE, &m.m00));
+
+	CHECK( CreateAMDFloor(context, scene, matsys, g_gc, 1.0f, 1.0f)  );
+
+	// Create framebuffer. The display transform needs the linear values: the rendering gamma stays at 1.0
+	rpr_framebuffer_desc desc = { 1920,1080 };
+	rpr_framebuffer_format fmt = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	rpr_framebuffer frame_buffer = nullptr;
+	rpr_framebuffer frame_buffer_resolved = nullptr;
+	CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer));
+	CHECK( rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer_resolved) );
+	CHECK(rprContextSetAOV(context, RPR_AOV_COLOR, frame_buffer));
+	CHECK( rprContextSetParameterByKey1f(context, RPR_CONTEXT_DISPLAY_GAMMA , 1.0f ) );
+	CHECK(rprContextSetParameterByKey1u(context,RPR_CONTEXT_ITERATIONS,NUM_ITERATIONS));
+	CHECK(rprContextRender(context));
+	CHECK(rprContextResolveFrameBuffer(context,frame_buffer,frame_buffer_resolved,false));
+
+	size_t size = 0;
+	CHECK( rprFrameBufferGetInfo(frame_buffer_resolved, RPR_FRAMEBUFFER_DATA, 0, nullptr, &size) );
+	std::vector<float> hdr(size / sizeof(float));
+	CHECK( rprFrameBufferGetInfo(frame_buffer_resolved, RPR_FRAMEBUFFER_DATA, size, hdr.data(), nullptr) );
+	const unsigned int width = desc.fb_width;
+	const unsigned int height = desc.fb_height;
+	const size_t pixelCount = (size_t)width * height;
+
+
+	///////// Looks //////////
+
+	std::vector<Look> looks;
+	looks.push_back({ "exposure 1.0, gamma 2.2", RPRDisplayTransform::ExposureGamma(1.0f, 2.2f) });
+
+	// a filmic S-curve ( fit of the ACES RRT+ODT ), then the sRGB gamma
+	looks.push_back({ "filmic", [](float* rgb, size_t numPixels)
+	{
+		for(size_t i=0; i<numPixels*3; i++)
+		{
+			const float x = std::max(rgb[i], 0.0f) * 0.6f;
+			const float y = (x * (2.51f * x + 0.03f)) / (x * (2.43f * x + 0.59f) + 0.14f);
+			rgb[i] = std::pow(RadeonProRender::clamp(y, 0.0f, 1.0f), 1.0f / 2.2f);
+		}
+	} });
+
+	#if ( USE_OCIO == 1 )
+	OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+	try
+	{
+		OCIO::ConstConfigRcPtr config = OCIO::Config::CreateFromFile("../../Resources/aces_1.0.3/config.ocio");
+		OCIO::DisplayViewTransformRcPtr transform = OCIO::DisplayViewTransform::Create();
+		transform->setSrc("ACES - ACEScg");
+		transform->setDisplay("ACES");
+		transform->setView("sRGB");
+		cpuProcessor = config->getProcessor(transform)->getDefaultCPUProcessor();
+	}
+	catch( std::exception& e )
+	{
+		std::cout<<"Error during OCIO config: "<< e.what() << std::endl;
+	}
+	if ( cpuProcessor )
+	{
+		// one applyRGB per pixel, as the direct transform of 29_ocio did
+		looks.push_back({ "OCIO ACES sRGB", [cpuProcessor](float* rgb, size_t numPixels)
+		{
+			for(size_t i=0; i<numPixels; i++)
+				cpuProcessor->applyRGB(rgb + i*3);
+		} });
+	}
+	#endif
+
+
+	///////// Benchmark //////////
+
+	// gray pixels of the special values, and their reference input: NaN and the negatives are 0
+	const float nan = std::numeric_limits<float>::quiet_NaN();
+	const float infinity = std::numeric_limits<float>::infinity();
+	const std::vector<float> specialValues = { 0.0f, -0.0f, -1e-3f, -1.0f, -infinity, nan, -nan, 1e-7f, 1e-5f };
+	const unsigned int specialCount = (unsigned int)specialValues.size();
+	std::vector<float> specialPixels;
+	std::vector<float> specialInputs;
+	for(float value : specialValues)
+	{
+		specialPixels.insert(specialPixels.end(), 3, value);
+		specialInputs.insert(specialInputs.end(), 3, value > 0.0f ? value : 0.0f);
+	}
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << width << "x" << height << " pixels" << std::endl;
+
+	for(const Look& look : looks)
+	{
+		// reference: the function on each pixel
+		std::vector<float> reference(pixelCount * 3);
+		const double directMs = Measure([&]()
+		{
+			for(size_t i=0; i<pixelCount; i++)
+			{
+				float* rgb = &reference[i*3];
+				rgb[0] = hdr[i*4+0];
+				rgb[1] = hdr[i*4+1];
+				rgb[2] = hdr[i*4+2];
+				look.function(rgb, 1);
+			}
+		});
+		std::cout << std::endl << look.name << ": direct " << directMs << " ms" << std::endl;
+
+		std::vector<float> specialReference = specialInputs;
+		look.function(specialReference.data(), specialCount);
+
+		for(unsigned int lutSize : { 17u, 33u, 65u })
+		{
+			for(RPRDisplayTransform::Interpolation interpolation : { RPRDisplayTransform::INTERPOLATION_TRILINEAR, RPRDisplayTransform::INTERPOLATION_TETRAHEDRAL })
+			{
+				RPRDisplayTransform::Settings settings;
+				settings.lutSize = lutSize;
+				settings.interpolation = interpolation;
+				settings.dither = false;
+
+				settings.numThreads = 1;
+				RPRDisplayTransform singleThread(settings);
+				settings.numThreads = 0;
+				RPRDisplayTransform allThreads(settings);
+
+				const double bakeMs = Measure([&]() { CHECK( allThreads.Bake(look.function) ); });
+				CHECK( singleThread.Bake(look.function) );
+
+				std::vector<float> converted(pixelCount * 3);
+				std::vector<unsigned char> ldr(pixelCount * 3);
+				const double singleThreadMs = Measure([&]() { CHECK( singleThread.Apply(hdr.data(), 4, width, height, ldr.data()) ); });
+				const double allThreadsMs = Measure([&]() { CHECK( allThreads.Apply(hdr.data(), 4, width, height, ldr.data()) ); });
+				CHECK( allThreads.ApplyFloat(hdr.data(), 4, width, height, converted.data()) );
+
+				// error on the displayed range, in 8-bit levels
+				double maxError = 0.0;
+				double sumError = 0.0;
+				for(size_t i=0; i<converted.size(); i++)
+				{
+					const double error = std::fabs( RadeonProRender::clamp(converted[i], 0.0f, 1.0f) - RadeonProRender::clamp(reference[i], 0.0f, 1.0f) ) * 255.0;
+					maxError = std::max(maxError, error);
+					sumError += error;
+				}
+
+				// special values, on the 8-bit output
+				std::vector<unsigned char> specialLdr(specialPixels.size());
+				CHECK( allThreads.Apply(specialPixels.data(), 3, specialCount, 1, specialLdr.data()) );
+				double specialMaxError = 0.0;
+				for(size_t i=0; i<specialLdr.size(); i++)
+				{
+					const double error = std::fabs( specialLdr[i] - RadeonProRender::clamp(specialReference[i], 0.0f, 1.0f) * 255.0 );
+					specialMaxError = std::max(specialMaxError, error);
+				}
+
+				std::cout << "   LUT " << std::setw(2) << lutSize << (interpolation == RPRDisplayTransform::INTERPOLATION_TETRAHEDRAL ? " tetrahedral" : " trilinear  ")
+					<< " : bake " << bakeMs << " ms, 1 thread " << singleThreadMs << " ms, all threads " << allThreadsMs << " ms"
+					<< ", error max " << maxError << " mean " << sumError / converted.size()
+					<< ", 0 / negative / NaN error max " << specialMaxError << std::endl;
+			}
+		}
+	}
+
+	// Release the stuff we created
+	CHECK(rprObjectDelete(camera));camera=nullptr;
+	CHECK(rprObjectDelete(frame_buffer));frame_buffer=nullptr;
+	CHECK(rprObjectDelete(frame_buffer_resolved));frame_buffer_resolved=nullptr;
+	g_gc.GCClean();
+	CHECK(rprObjectDelete(scene));scene=nullptr;
+	CHECK(rprObjectDelete(matsys));matsys=nullptr;
+	CheckNoLeak(context);
+	CHECK(rprObjectDelete(context));context=nullptr; // Always delete the RPR Context in last.
+	return 0;
+}
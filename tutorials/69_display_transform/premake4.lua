@@ -0,0 +1,31 @@
+project "69_display_transform"
+    kind "ConsoleApp"
+    location "../build"
+    files { "../69_display_transform/**.h", "../69_display_transform/**.cpp"} 
+    files { "../common/common.cpp","../common/common.h"}
+    files { "../../RadeonProRender/rprTools/rprDisplayTransform.cpp","../../RadeonProRender/rprTools/rprDisplayTransform.h"}
+
+    -- remove filters for Visual Studio
+    vpaths { [""] = { 
+		"../69_display_transform/**.h", "../69_display_transform/**.cpp",
+		"../common/common.cpp","../common/common.h",
+		"../../RadeonProRender/rprTools/rprDisplayTransform.cpp", "../../RadeonProRender/rprTools/rprDisplayTransform.h"
+	} }
+
+    includedirs{ "../../RadeonProRender/inc" } 
+    
+    buildoptions "-std=c++14"
+
+    configuration {"x64"}
+    links {"RadeonProRender64"}
+
+    if os.istarget("linux") then
+		links {"pthread"}
+    end
+
+    configuration {"x64", "Debug"}
+        targetdir "../Bin"
+    configuration {"x64", "Release"}
+        targetdir "../Bin"
+    configuration {}
+    
@@ -0,0 +1,168 @@
+/*****************************************************************************\
+*
+*  Module Name    70_async_output/main.cpp
+*  Project        Radeon ProRender rendering tutorial
+*
+*  Description    Radeon ProRender SDK tutorials: frames written by worker threads with RPROutputWriter
+*
+*  Copyright(C) 2011-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+
+//
+// Shows how to write the frames of a turntable with RPROutputWriter ( rprTools ), while the next frames render.
+// The same turntable is rendered twice:
+//
+//  - synchronous : rprFrameBufferSaveToFile after each frame, the render loop waits for the PNG encoding
+//  - background  : RPROutputWriter::Write copies the framebuffer and returns, the files are encoded by worker threads
+//
+// and the time per frame of both loops is compared.
+//
+
+
+#include "RadeonProRender.h"
+#include "Math/mathutils.h"
+#include "../common/common.h"
+#include "../../RadeonProRender/rprTools/rprOutputWriter.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+RPRGarbageCollector g_gc;
+
+const int FRAME_COUNT = 24;
+const unsigned int FRAME_ITERATIONS = 32;
+
+
+// render the turntable, calling saveFrame after each frame. Returns the seconds taken until the last file is written.
+template<typename F>
+double RenderTurntable(rpr_context context, rpr_camera camera, rpr_framebuffer frame_buffer, rpr_framebuffer frame_buffer_resolved, F&& saveFrame)
+{
+	const auto start = std::chrono::steady_clock::now();
+	for(int frame=0; frame<FRAME_COUNT; frame++)
+	{
+		const float angle = 2.0f * MY_PI * frame / FRAME_COUNT;
+		CHECK(rprCameraLookAt(camera, 20.0f * std::sin(angle), 5, 20.0f * std::cos(angle),   0, 1, 0,   0, 1, 0));
+
+		CHECK(rprFrameBufferClear(frame_buffer));
+		CHECK(rprContextRender(context));
+		CHECK(rprContextResolveFrameBuffer(context,frame_buffer,frame_buffer_resolved,false));
+		saveFrame(frame);
+	}
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+int main()
+{
+	//	enable Radeon ProRender API trace
+	//	set this before any RPR API calls
+	//	rprContextSetParameterByKey1u(0,RPR_CONTEXT_TRACING_ENABLED,1);
+
+	std::cout << "-- Radeon ProRender SDK Demo --" << std::endl;
+
+	// the RPR context object.
+	rpr_context context = nullptr;
+
+	// Register the RPR DLL
+	rpr_int tahoePluginID = rprRegisterPlugin(RPR_PLUGIN_FILE_NAME);
+	CHECK_NE(tahoePluginID , -1);
+	rpr_int plugins[] = { tahoePluginID };
+	size_t pluginCount = sizeof(plugins) / sizeof(plugins[0]);
+
+	// Create context using a single GPU
+	CHECK( rprCreateContext(RPR_API_VERSION, plugins, pluginCount, g_ContextCreationFlags, g_contextProperties, NULL, &context) );
+
+	// Set the active plugin.
+	CHECK(  rprContextSetActivePlugin(context, plugins[0]) );
+
+	std::cout << "RPR Context creation succeeded." << std::endl;
+
+	rpr_material_system matsys = nullptr;
+	CHECK(rprContextCreateMaterialSystem(context, 0, &matsys));
+
+	rpr_scene scene = nullptr;
+	CHECK(rprContextCreateScene(context, &scene));
+	CHECK(rprContextSetScene(context, scene));
+	CHECK( CreateNatureEnvLight(context, scene, g_gc, 0.8f)  );
+
+	rpr_camera camera = nullptr;
+	CHECK(rprContextCreateCamera(context, &camera));
+	CHECK(rprCameraSetFocalLength(camera, 75.f));
+	CHECK(rprSceneSetCamera(scene, camera));
+
+	rpr_shape teapot = ImportOBJ("../../Resources/Meshes/teapot.obj",scene,context);
+	g_gc.GCAdd(teapot);
+	RadeonProRender::matrix m = RadeonProRender::rotation_x(MY_PI);
+	CHECK(rprShapeSetTransform(teapot, RPR_TRUE, &m.m00));
+
+	CHECK( CreateAMDFloor(context, scene, matsys, g_gc, 1.0f, 1.0f)  );
+
+	// 4K frames: the PNG encoding takes a large part of the frame time
+	rpr_framebuffer_desc desc = { 3840,2160 };
+	rpr_framebuffer_format fmt = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	rpr_framebuffer frame_buffer = nullptr;
+	rpr_framebuffer frame_buffer_resolved = nullptr;
+	CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer));
+	CHECK( rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer_resolved) );
+	CHECK(rprContextSetAOV(context, RPR_AOV_COLOR, frame_buffer));
+	CHECK(rprContextSetParameterByKey1u(context,RPR_CONTEXT_ITERATIONS,FRAME_ITERATIONS));
+
+
+	///////// Synchronous writes //////////
+
+	const double synchronousSeconds = RenderTurntable(context, camera, frame_buffer, frame_buffer_resolved, [&](int frame)
+	{
+		CHECK(rprFrameBufferSaveToFile(frame_buffer_resolved, ("70_sync_" + std::to_string(frame) + ".png").c_str()));
+	});
+
+
+	///////// Background writes //////////
+
+	RPROutputWriter::Settings settings;
+	settings.numThreads = 4;
+	settings.maxPendingImages = 8; // 8 copies of the 4K framebuffer at most: 265 MB
+	RPROutputWriter writer(settings);
+
+	std::atomic<int> failedFrames(0);
+	const double backgroundSeconds = RenderTurntable(context, camera, frame_buffer, frame_buffer_resolved, [&](int frame)
+	{
+		// the framebuffer is copied, the next frame can render immediately. The callback is called by a worker.
+		CHECK(writer.Write(frame_buffer_resolved, "70_async_" + std::to_string(frame) + ".png", [&](const std::string& filePath, rpr_status status)
+		{
+			if ( status != RPR_SUCCESS )
+			{
+				std::cout << "failed to write " << filePath << std::endl;
+				failedFrames++;
+			}
+		}));
+	});
+	const auto flushStart = std::chrono::steady_clock::now();
+	writer.Flush();
+	const double flushSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - flushStart).count();
+
+	const RPROutputWriter::Stats stats = writer.GetStats();
+	std::cout << FRAME_COUNT << " frames of " << desc.fb_width << "x" << desc.fb_height << ":" << std::endl;
+	std::cout << "   synchronous : " << synchronousSeconds * 1000.0 / FRAME_COUNT << " ms per frame" << std::endl;
+	std::cout << "   background  : " << (backgroundSeconds + flushSeconds) * 1000.0 / FRAME_COUNT << " ms per frame ( "
+		<< flushSeconds * 1000.0 << " ms waiting for the last files )" << std::endl;
+	std::cout << "   " << stats.imagesWritten << " files written, " << stats.imagesFailed << " failed, " << stats.buffersAllocated << " buffers, "
+		<< stats.copySeconds * 1000.0 / FRAME_COUNT << " ms per copy, " << stats.waitSeconds * 1000.0 << " ms blocked by the queue, "
+		<< stats.encodeSeconds * 1000.0 / FRAME_COUNT << " ms per encoding" << std::endl;
+
+
+	// Release the stuff we created
+	CHECK(rprObjectDelete(camera));camera=nullptr;
+	CHECK(rprObjectDelete(frame_buffer));frame_buffer=nullptr;
+	CHECK(rprObjectDelete(frame_buffer_resolved));frame_buffer_resolved=nullptr;
+	g_gc.GCClean();
+	CHECK(rprObjectDelete(scene));scene=nullptr;
+	CHECK(rprObjectDelete(matsys));matsys=nullptr;
+	CheckNoLeak(context);
+	CHECK(rprObjectDelete(context));context=nullptr; // Always delete the RPR Context in last.
+	return failedFrames == 0 ? 0 : 1;
+}
@@ -0,0 +1,31 @@
+project "70_async_output"
+    kind "ConsoleApp"
+    location "../build"
+    files { "../70_async_output/**.h", "../70_async_output/**.cpp"} 
+    files { "../common/common.cpp","../common/common.h"}
+    files { "../../RadeonProRender/rprTools/rprOutputWriter.cpp","../../RadeonProRender/rprTools/rprOutputWriter.h"}
+
+    -- remove filters for Visual Studio
+    vpaths { [""] = { 
+		"../70_async_output/**.h", "../70_async_output/**.cpp",
+		"../common/common.cpp","../common/common.h",
+		"../../RadeonProRender/rprTools/rprOutputWriter.cpp", "../../RadeonProRender/rprTools/rprOutputWriter.h"
+	} }
+
+    includedirs{ "../../RadeonProRender/inc" } 
+    
+    buildoptions "-std=c++14"
+
+    configuration {"x64"}
+    links {"RadeonProRender64"}
+
+    if os.istarget("linux") then
+		links {"pthread"}
+    end
+
+    configuration {"x64", "Debug"}
+        targetdir "../Bin"
+    configuration {"x64", "Release"}
+        targetdir "../Bin"
+    configuration {}
+    
@@ -0,0 +1,213 @@
+/*****************************************************************************\
+*
+*  Module Name    71_png_writer/main.cpp
+*  Project        Radeon ProRender rendering tutorial
+*
+*  Description    Radeon ProRender SDK tutorials: benchmark of RPRPngWriter against stbi_write_png
+*
+*  Copyright(C) 2011-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+
+//
+// Benchmark of RPRPngWriter ( rprTools ) against stbi_write_png, on the outputs of a tutorial render:
+// the color, shading normal and diffuse albedo AOVs of the teapot scene, in 1920x1080.
+//
+// Each image is encoded in memory ( the disk is not measured ) by:
+//  - stbi_write_png_to_mem, 8-bit
+//  - RPRPngWriter, 8-bit, with each compression preset
+//  - RPRPngWriter, 16-bit, COMPRESSION_FAST
+// and the throughput ( MB of raw scanlines per second ) and the file size are printed.
+// The 8-bit files of each preset are also written, to compare them with the stbi ones in an image viewer.
+//
+
+
+#include "RadeonProRender.h"
+#include "Math/mathutils.h"
+#include "../common/common.h"
+#include "../../RadeonProRender/rprTools/rprPngWriter.h"
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "../../3rdParty/stbi/stbi.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+RPRGarbageCollector g_gc;
+
+// each encoding is repeated, the fastest one is kept
+const int ENCODE_REPEAT = 3;
+
+
+// seconds of the fastest of ENCODE_REPEAT calls of encode
+template<typename F>
+double Measure(F&& encode)
+{
+	double best = 1e30;
+	for(int i=0; i<ENCODE_REPEAT; i++)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		encode();
+		best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+	}
+	return best;
+}
+
+void PrintResult(const std::string& name, size_t rawBytes, double seconds, size_t fileBytes)
+{
+	std::cout << "   " << std::left << std::setw(22) << name << std::right
+		<< std::setw(8) << std::fixed << std::setprecision(1) << rawBytes / seconds / 1e6 << " MB/s "
+		<< std::setw(10) << fileBytes << " bytes ( " << std::setprecision(1) << 100.0 * fileBytes / rawBytes << "% )" << std::endl;
+}
+
+
+int main()
+{
+	//	enable Radeon ProRender API trace
+	//	set this before any RPR API calls
+	//	rprContextSetParameterByKey1u(0,RPR_CONTEXT_TRACING_ENABLED,1);
+
+	std::cout << "-- Radeon ProRender SDK Demo --" << std::endl;
+
+	// the RPR context object.
+	rpr_context context = nullptr;
+
+	// Register the RPR DLL
+	rpr_int tahoePluginID = rprRegisterPlugin(RPR_PLUGIN_FILE_NAME);
+	CHECK_NE(tahoePluginID , -1);
+	rpr_int plugins[] = { tahoePluginID };
+	size_t pluginCount = sizeof(plugins) / sizeof(plugins[0]);
+
+	// Create context using a single GPU
+	CHECK( rprCreateContext(RPR_API_VERSION, plugins, pluginCount, g_ContextCreationFlags, g_contextProperties, NULL, &context) );
+
+	// Set the active plugin.
+	CHECK(  rprContextSetActivePlugin(context, plugins[0]) );
+
+	std::cout << "RPR Context creation succeeded." << std::endl;
+
+	rpr_material_system matsys = nullptr;
+	CHECK(rprContextCreateMaterialSystem(context, 0, &matsys));
+
+	rpr_scene scene = nullptr;
+	CHECK(rprContextCreateScene(context, &scene));
+	CHECK(rprContextSetScene(context, scene));
+	CHECK( CreateNatureEnvLight(context, scene, g_gc, 0.8f)  );
+
+	rpr_camera camera = nullptr;
+	CHECK(rprContextCreateCamera(context, &camera));
+	CHECK(rprCameraLookAt(camera, 10, 10, 10, 0, 1, 0, 0, 1, 0));
+	CHECK(rprCameraSetFocalLength(camera, 35.f));
+	CHECK(rprSceneSetCamera(scene, camera));
+
+	rpr_shape teapot = ImportOBJ("../../Resources/Meshes/teapot.obj",scene,context);
+	g_gc.GCAdd(teapot);
+	RadeonProRender::matrix m = RadeonProRender::rotation_x(MY_PI);
+	CHECK(rprShapeSetTransform(teapot, RPR_TRUE, &m.m00));
+
+	CHECK( CreateAMDFloor(context, scene, matsys, g_gc, 1.0f, 1.0f)  );
+
+	rpr_framebuffer_desc desc = { 1920,1080 };
+	rpr_framebuffer_format fmt = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+
+	struct Output
+	{
+		const char* name;
+		rpr_aov aov;
+		rpr_framebuffer frame_buffer;
+		rpr_framebuffer frame_buffer_resolved;
+	};
+	Output outputs[] = {
+		{ "color", RPR_AOV_COLOR, nullptr, nullptr },
+		{ "shading_normal", RPR_AOV_SHADING_NORMAL, nullptr, nullptr },
+		{ "diffuse_albedo", RPR_AOV_DIFFUSE_ALBEDO, nullptr, nullptr },
+	};
+	for(Output& output : outputs)
+	{
+		CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &output.frame_buffer));
+		CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &output.frame_buffer_resolved));
+		CHECK(rprContextSetAOV(context, output.aov, output.frame_buffer));
+	}
+
+	CHECK(rprContextSetParameterByKey1u(context,RPR_CONTEXT_ITERATIONS,100));
+	CHECK(rprContextRender(context));
+
+	const RPRPngWriter::Compression compressions[] = { RPRPngWriter::COMPRESSION_STORE, RPRPngWriter::COMPRESSION_RLE, RPRPngWriter::COMPRESSION_FAST, RPRPngWriter::COMPRESSION_DEFAULT };
+	const char* compressionNames[] = { "STORE", "RLE", "FAST", "DEFAULT" };
+
+	for(Output& output : outputs)
+	{
+		// only the color is tone mapped by the resolve
+		CHECK(rprContextResolveFrameBuffer(context, output.frame_buffer, output.frame_buffer_resolved, output.aov != RPR_AOV_COLOR));
+
+		size_t size = 0;
+		CHECK(rprFrameBufferGetInfo(output.frame_buffer_resolved, RPR_FRAMEBUFFER_DATA, 0, nullptr, &size));
+		std::vector<float> pixels(size / sizeof(float));
+		CHECK(rprFrameBufferGetInfo(output.frame_buffer_resolved, RPR_FRAMEBUFFER_DATA, size, pixels.data(), nullptr));
+
+		// the 8-bit RGB pixels given to stbi: same conversion as RPRPngWriter
+		const size_t numPixels = (size_t)desc.fb_width * desc.fb_height;
+		std::vector<unsigned char> rgb(numPixels * 3);
+		for(size_t i=0; i<numPixels; i++)
+		{
+			for(int c=0; c<3; c++)
+			{
+				const float value = pixels[i * 4 + c];
+				rgb[i * 3 + c] = !(value > 0.0f) ? 0 : value >= 1.0f ? 255 : (unsigned char)(value * 255.0f);
+			}
+		}
+
+		std::cout << output.name << " ( " << desc.fb_width << "x" << desc.fb_height << " RGB ):" << std::endl;
+
+		int stbiBytes = 0;
+		const double stbiSeconds = Measure([&]()
+		{
+			unsigned char* png = stbi_write_png_to_mem(rgb.data(), desc.fb_width * 3, desc.fb_width, desc.fb_height, 3, &stbiBytes);
+			free(png);
+		});
+		PrintResult("stbi_write_png", rgb.size(), stbiSeconds, stbiBytes);
+		stbi_write_png((std::string("71_") + output.name + "_stbi.png").c_str(), desc.fb_width, desc.fb_height, 3, rgb.data(), desc.fb_width * 3);
+
+		for(int i=0; i<4; i++)
+		{
+			RPRPngWriter::Settings settings;
+			settings.compression = compressions[i];
+			settings.alpha = false;
+			RPRPngWriter writer(settings);
+
+			std::vector<unsigned char> png;
+			const double seconds = Measure([&]() { CHECK(writer.Encode(pixels.data(), desc.fb_width, desc.fb_height, 4, png)); });
+			PrintResult(std::string("RPRPngWriter ") + compressionNames[i], rgb.size(), seconds, png.size());
+			CHECK(writer.Write(std::string("71_") + output.name + "_" + compressionNames[i] + ".png", pixels.data(), desc.fb_width, desc.fb_height, 4));
+		}
+
+		RPRPngWriter::Settings settings16;
+		settings16.bitDepth = 16;
+		settings16.alpha = false;
+		RPRPngWriter writer16(settings16);
+		std::vector<unsigned char> png16;
+		const double seconds16 = Measure([&]() { CHECK(writer16.Encode(pixels.data(), desc.fb_width, desc.fb_height, 4, png16)); });
+		PrintResult("RPRPngWriter FAST 16", rgb.size() * 2, seconds16, png16.size());
+	}
+
+
+	// Release the stuff we created
+	CHECK(rprObjectDelete(camera));camera=nullptr;
+	for(Output& output : outputs)
+	{
+		CHECK(rprObjectDelete(output.frame_buffer));output.frame_buffer=nullptr;
+		CHECK(rprObjectDelete(output.frame_buffer_resolved));output.frame_buffer_resolved=nullptr;
+	}
+	g_gc.GCClean();
+	CHECK(rprObjectDelete(scene));scene=nullptr;
+	CHECK(rprObjectDelete(matsys));matsys=nullptr;
+	CheckNoLeak(context);
+	CHECK(rprObjectDelete(context));context=nullptr; // Always delete the RPR Context in last.
+	return 0;
+}
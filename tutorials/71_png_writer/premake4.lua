@@ -0,0 +1,31 @@
+project "71_png_writer"
+    kind "ConsoleApp"
+    location "../build"
+    files { "../71_png_writer/**.h", "../71_png_writer/**.cpp", "../../3rdParty/stbi/**.h"} 
+    files { "../common/common.cpp","../common/common.h"}
+    files { "../../RadeonProRender/rprTools/rprPngWriter.cpp","../../RadeonProRender/rprTools/rprPngWriter.h"}
+
+    -- remove filters for Visual Studio
+    vpaths { [""] = { 
+		"../71_png_writer/**.h", "../71_png_writer/**.cpp",
+		"../common/common.cpp","../common/common.h",
+		"../../RadeonProRender/rprTools/rprPngWriter.cpp", "../../RadeonProRender/rprTools/rprPngWriter.h"
+	} }
+
+    includedirs{ "../../RadeonProRender/inc" } 
+    
+    buildoptions "-std=c++14"
+
+    configuration {"x64"}
+    links {"RadeonProRender64"}
+
+    if os.istarget("linux") then
+		links {"pthread"}
+    end
+
+    configuration {"x64", "Debug"}
+        targetdir "../Bin"
+    configuration {"x64", "Release"}
+        targetdir "../Bin"
+    configuration {}
+    
@@ -0,0 +1,173 @@
+/*****************************************************************************\
+*
+*  Module Name    72_convergence/main.cpp
+*  Project        Radeon ProRender rendering tutorial
+*
+*  Description    Radeon ProRender SDK tutorials: frames rendered until converged with RPRConvergenceController
+*
+*  Copyright(C) 2011-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+
+//
+// Shows how to render each frame until it is converged with RPRConvergenceController ( rprTools ), instead of a fixed number of iterations.
+//
+// The camera moves from a view of the teapot ( converges quickly ) to a close-up of the floor under it ( noisy indirect lighting ).
+// The same frames are rendered twice:
+//
+//  - fixed      : RPR_CONTEXT_ITERATIONS = FIXED_ITERATIONS for all the frames
+//  - controlled : the samples are rendered in batches until the error estimated from RPR_AOV_VARIANCE is below the target,
+//                 or the time budget of the frame is used
+//
+// The sample budget used by each controlled frame is printed.
+//
+
+
+#include "RadeonProRender.h"
+#include "Math/mathutils.h"
+#include "../common/common.h"
+#include "../../RadeonProRender/rprTools/rprConvergenceController.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+RPRGarbageCollector g_gc;
+
+const int FRAME_COUNT = 8;
+const unsigned int FIXED_ITERATIONS = 200;
+
+
+void SetCamera(rpr_camera camera, int frame)
+{
+	// from ( 10, 10, 10 ) looking at the teapot to ( 2, 1.5, 2 ) looking at the floor
+	const float t = (float)frame / (FRAME_COUNT - 1);
+	const float eye = 10.0f - 8.0f * t;
+	CHECK(rprCameraLookAt(camera, eye, 10.0f - 8.5f * t, eye,   0, 1.0f - t, 0,   0, 1, 0));
+}
+
+
+int main()
+{
+	//	enable Radeon ProRender API trace
+	//	set this before any RPR API calls
+	//	rprContextSetParameterByKey1u(0,RPR_CONTEXT_TRACING_ENABLED,1);
+
+	std::cout << "-- Radeon ProRender SDK Demo --" << std::endl;
+
+	// the RPR context object.
+	rpr_context context = nullptr;
+
+	// Register the RPR DLL
+	rpr_int tahoePluginID = rprRegisterPlugin(RPR_PLUGIN_FILE_NAME);
+	CHECK_NE(tahoePluginID , -1);
+	rpr_int plugins[] = { tahoePluginID };
+	size_t pluginCount = sizeof(plugins) / sizeof(plugins[0]);
+
+	// Create context using a single GPU
+	CHECK( rprCreateContext(RPR_API_VERSION, plugins, pluginCount, g_ContextCreationFlags, g_contextProperties, NULL, &context) );
+
+	// Set the active plugin.
+	CHECK(  rprContextSetActivePlugin(context, plugins[0]) );
+
+	std::cout << "RPR Context creation succeeded." << std::endl;
+
+	rpr_material_system matsys = nullptr;
+	CHECK(rprContextCreateMaterialSystem(context, 0, &matsys));
+
+	rpr_scene scene = nullptr;
+	CHECK(rprContextCreateScene(context, &scene));
+	CHECK(rprContextSetScene(context, scene));
+	CHECK( CreateNatureEnvLight(context, scene, g_gc, 0.8f)  );
+
+	rpr_camera camera = nullptr;
+	CHECK(rprContextCreateCamera(context, &camera));
+	CHECK(rprCameraSetFocalLength(camera, 35.f));
+	CHECK(rprSceneSetCamera(scene, camera));
+
+	rpr_shape teapot = ImportOBJ("../../Resources/Meshes/teapot.obj",scene,context);
+	g_gc.GCAdd(teapot);
+	RadeonProRender::matrix m = RadeonProRender::rotation_x(MY_PI);
+	CHECK(rprShapeSetTransform(teapot, RPR_TRUE, &m.m00));
+
+	CHECK( CreateAMDFloor(context, scene, matsys, g_gc, 1.0f, 1.0f)  );
+
+	rpr_framebuffer_desc desc = { 800,600 };
+	rpr_framebuffer_format fmt = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	rpr_framebuffer frame_buffer = nullptr;
+	rpr_framebuffer frame_buffer_variance = nullptr;
+	rpr_framebuffer frame_buffer_resolved = nullptr;
+	CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer));
+	CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer_variance));
+	CHECK( rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer_resolved) );
+	CHECK(rprContextSetAOV(context, RPR_AOV_COLOR, frame_buffer));
+	CHECK(rprContextSetAOV(context, RPR_AOV_VARIANCE, frame_buffer_variance));
+
+
+	///////// Fixed iterations //////////
+
+	CHECK(rprContextSetParameterByKey1u(context,RPR_CONTEXT_ITERATIONS,FIXED_ITERATIONS));
+	const auto fixedStart = std::chrono::steady_clock::now();
+	for(int frame=0; frame<FRAME_COUNT; frame++)
+	{
+		SetCamera(camera, frame);
+		CHECK(rprFrameBufferClear(frame_buffer));
+		CHECK(rprContextRender(context));
+		CHECK(rprContextResolveFrameBuffer(context,frame_buffer,frame_buffer_resolved,false));
+		CHECK(rprFrameBufferSaveToFile(frame_buffer_resolved, ("72_fixed_" + std::to_string(frame) + ".png").c_str()));
+	}
+	const double fixedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - fixedStart).count();
+
+
+	///////// Controlled iterations //////////
+
+	// in a block: the controller deletes its framebuffers before the context
+	{
+		RPRConvergenceController::Settings settings;
+		settings.targetError = 0.02f;
+		settings.minSamples = 16;
+		settings.maxSamples = 2048;
+		settings.timeBudgetSeconds = 10.0;
+		RPRConvergenceController controller(context, frame_buffer, frame_buffer_variance, settings);
+
+		const char* stopReasons[] = { "converged", "time budget", "max samples" };
+		const auto controlledStart = std::chrono::steady_clock::now();
+		for(int frame=0; frame<FRAME_COUNT; frame++)
+		{
+			SetCamera(camera, frame);
+
+			RPRConvergenceController::FrameReport report;
+			CHECK(controller.RenderFrame(&report));
+			CHECK(rprContextResolveFrameBuffer(context,frame_buffer,frame_buffer_resolved,false));
+			CHECK(rprFrameBufferSaveToFile(frame_buffer_resolved, ("72_controlled_" + std::to_string(frame) + ".png").c_str()));
+
+			std::cout << "frame " << frame << ": " << std::setw(5) << report.samples << " spp in " << report.batches << " batches, error "
+				<< std::fixed << std::setprecision(4) << report.error << " ( max tile " << report.maxTileError << " ), "
+				<< report.unconvergedTiles << "/" << report.numTiles << " tiles above the target, " << stopReasons[report.stopReason] << ", "
+				<< std::setprecision(1) << report.renderSeconds * 1000.0 << " ms rendering + " << report.estimateSeconds * 1000.0 << " ms estimating" << std::endl;
+		}
+		const double controlledSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - controlledStart).count();
+
+		const RPRConvergenceController::Stats stats = controller.GetStats();
+		std::cout << FRAME_COUNT << " frames of " << desc.fb_width << "x" << desc.fb_height << ":" << std::endl;
+		std::cout << "   fixed      : " << FIXED_ITERATIONS * FRAME_COUNT << " samples, " << fixedSeconds << " s" << std::endl;
+		std::cout << "   controlled : " << stats.samples << " samples, " << controlledSeconds << " s, "
+			<< stats.framesConverged << " frames converged, " << stats.framesTimeBudget << " stopped by the time budget, "
+			<< stats.framesMaxSamples << " by the max samples" << std::endl;
+	}
+
+
+	// Release the stuff we created
+	CHECK(rprObjectDelete(camera));camera=nullptr;
+	CHECK(rprObjectDelete(frame_buffer));frame_buffer=nullptr;
+	CHECK(rprObjectDelete(frame_buffer_variance));frame_buffer_variance=nullptr;
+	CHECK(rprObjectDelete(frame_buffer_resolved));frame_buffer_resolved=nullptr;
+	g_gc.GCClean();
+	CHECK(rprObjectDelete(scene));scene=nullptr;
+	CHECK(rprObjectDelete(matsys));matsys=nullptr;
+	CheckNoLeak(context);
+	CHECK(rprObjectDelete(context));context=nullptr; // Always delete the RPR Context in last.
+	return 0;
+}
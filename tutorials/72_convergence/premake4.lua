@@ -0,0 +1,31 @@
+project "72_convergence"
+    kind "ConsoleApp"
+    location "../build"
+    files { "../72_convergence/**.h", "../72_convergence/**.cpp"} 
+    files { "../common/common.cpp","../common/common.h"}
+    files { "../../RadeonProRender/rprTools/rprConvergenceController.cpp","../../RadeonProRender/rprTools/rprConvergenceController.h"}
+
+    -- remove filters for Visual Studio
+    vpaths { [""] = { 
+		"../72_convergence/**.h", "../72_convergence/**.cpp",
+		"../common/common.cpp","../common/common.h",
+		"../../RadeonProRender/rprTools/rprConvergenceController.cpp", "../../RadeonProRender/rprTools/rprConvergenceController.h"
+	} }
+
+    includedirs{ "../../RadeonProRender/inc" } 
+    
+    buildoptions "-std=c++14"
+
+    configuration {"x64"}
+    links {"RadeonProRender64"}
+
+    if os.istarget("linux") then
+		links {"pthread"}
+    end
+
+    configuration {"x64", "Debug"}
+        targetdir "../Bin"
+    configuration {"x64", "Release"}
+        targetdir "../Bin"
+    configuration {}
+    
@@ -0,0 +1,142 @@
+/*****************************************************************************\
+*
+*  Module Name    73_telemetry/main.cpp
+*  Project        Radeon ProRender rendering tutorial
+*
+*  Description    Radeon ProRender SDK tutorials: render metrics exported with RPRTelemetry
+*
+*  Copyright(C) 2011-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+
+//
+// Shows how to export the metrics of the renders of a farm node with RPRTelemetry ( rprTools ).
+//
+// A turntable is rendered: for each frame, the camera update is timed as the commit phase, then the frame is rendered,
+// resolved and read back through the wrappers of RPRTelemetry. The metrics of each frame ( iterations per second, time to
+// first pixel, seconds of each phase, memory, number of objects ) are appended to 73_telemetry.jsonl, and served in the
+// Prometheus text format on http://127.0.0.1:9464/metrics while the tutorial runs.
+//
+
+
+#include "RadeonProRender.h"
+#include "Math/mathutils.h"
+#include "../common/common.h"
+#include "../../RadeonProRender/rprTools/rprTelemetry.h"
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+RPRGarbageCollector g_gc;
+
+const int FRAME_COUNT = 24;
+const unsigned int FRAME_ITERATIONS = 64;
+
+
+int main()
+{
+	//	enable Radeon ProRender API trace
+	//	set this before any RPR API calls
+	//	rprContextSetParameterByKey1u(0,RPR_CONTEXT_TRACING_ENABLED,1);
+
+	std::cout << "-- Radeon ProRender SDK Demo --" << std::endl;
+
+	// the RPR context object.
+	rpr_context context = nullptr;
+
+	// Register the RPR DLL
+	rpr_int tahoePluginID = rprRegisterPlugin(RPR_PLUGIN_FILE_NAME);
+	CHECK_NE(tahoePluginID , -1);
+	rpr_int plugins[] = { tahoePluginID };
+	size_t pluginCount = sizeof(plugins) / sizeof(plugins[0]);
+
+	// Create context using a single GPU
+	CHECK( rprCreateContext(RPR_API_VERSION, plugins, pluginCount, g_ContextCreationFlags, g_contextProperties, NULL, &context) );
+
+	// Set the active plugin.
+	CHECK(  rprContextSetActivePlugin(context, plugins[0]) );
+
+	std::cout << "RPR Context creation succeeded." << std::endl;
+
+	rpr_material_system matsys = nullptr;
+	CHECK(rprContextCreateMaterialSystem(context, 0, &matsys));
+
+	rpr_scene scene = nullptr;
+	CHECK(rprContextCreateScene(context, &scene));
+	CHECK(rprContextSetScene(context, scene));
+	CHECK( CreateNatureEnvLight(context, scene, g_gc, 0.8f)  );
+
+	rpr_camera camera = nullptr;
+	CHECK(rprContextCreateCamera(context, &camera));
+	CHECK(rprCameraSetFocalLength(camera, 75.f));
+	CHECK(rprSceneSetCamera(scene, camera));
+
+	rpr_shape teapot = ImportOBJ("../../Resources/Meshes/teapot.obj",scene,context);
+	g_gc.GCAdd(teapot);
+	RadeonProRender::matrix m = RadeonProRender::rotation_x(MY_PI);
+	CHECK(rprShapeSetTransform(teapot, RPR_TRUE, &m.m00));
+
+	CHECK( CreateAMDFloor(context, scene, matsys, g_gc, 1.0f, 1.0f)  );
+
+	rpr_framebuffer_desc desc = { 1280,720 };
+	rpr_framebuffer_format fmt = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	rpr_framebuffer frame_buffer = nullptr;
+	rpr_framebuffer frame_buffer_resolved = nullptr;
+	CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer));
+	CHECK( rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer_resolved) );
+	CHECK(rprContextSetAOV(context, RPR_AOV_COLOR, frame_buffer));
+	CHECK(rprContextSetParameterByKey1u(context,RPR_CONTEXT_ITERATIONS,FRAME_ITERATIONS));
+
+	// in a block: the telemetry removes its callback before the context is deleted
+	{
+		RPRTelemetry::Settings settings;
+		settings.nodeName = "tutorial";
+		settings.jsonPath = "73_telemetry.jsonl";
+		settings.prometheusPort = 9464;
+		RPRTelemetry telemetry(context, settings);
+		CHECK(telemetry.Install());
+		std::cout << "metrics served on http://127.0.0.1:" << settings.prometheusPort << "/metrics" << std::endl;
+
+		std::vector<float> pixels;
+		for(int frame=0; frame<FRAME_COUNT; frame++)
+		{
+			telemetry.BeginFrame();
+			{
+				RPRTelemetry::Scope scope(telemetry, RPRTelemetry::PHASE_COMMIT);
+				const float angle = 2.0f * MY_PI * frame / FRAME_COUNT;
+				CHECK(rprCameraLookAt(camera, 20.0f * std::sin(angle), 5, 20.0f * std::cos(angle),   0, 1, 0,   0, 1, 0));
+				CHECK(rprFrameBufferClear(frame_buffer));
+			}
+			CHECK(telemetry.Render());
+			CHECK(telemetry.Resolve(frame_buffer, frame_buffer_resolved, false));
+			CHECK(telemetry.ReadFrameBuffer(frame_buffer_resolved, pixels));
+
+			RPRTelemetry::FrameMetrics metrics;
+			CHECK(telemetry.EndFrame(&metrics));
+			std::cout << "frame " << std::setw(2) << frame << ": " << std::fixed << std::setprecision(1)
+				<< metrics.iterationsPerSecond << " iterations/s, first pixel after " << metrics.timeToFirstPixel * 1000.0 << " ms, "
+				<< "render " << metrics.phaseSeconds[RPRTelemetry::PHASE_RENDER] * 1000.0 << " ms, "
+				<< "resolve " << metrics.phaseSeconds[RPRTelemetry::PHASE_RESOLVE] * 1000.0 << " ms, "
+				<< "readback " << metrics.phaseSeconds[RPRTelemetry::PHASE_READBACK] * 1000.0 << " ms, "
+				<< metrics.progressEvents << " progress updates" << std::endl;
+		}
+
+		std::cout << std::endl << telemetry.GetPrometheusText();
+	}
+
+
+	// Release the stuff we created
+	CHECK(rprObjectDelete(camera));camera=nullptr;
+	CHECK(rprObjectDelete(frame_buffer));frame_buffer=nullptr;
+	CHECK(rprObjectDelete(frame_buffer_resolved));frame_buffer_resolved=nullptr;
+	g_gc.GCClean();
+	CHECK(rprObjectDelete(scene));scene=nullptr;
+	CHECK(rprObjectDelete(matsys));matsys=nullptr;
+	CheckNoLeak(context);
+	CHECK(rprObjectDelete(context));context=nullptr; // Always delete the RPR Context in last.
+	return 0;
+}
@@ -0,0 +1,34 @@
+project "73_telemetry"
+    kind "ConsoleApp"
+    location "../build"
+    files { "../73_telemetry/**.h", "../73_telemetry/**.cpp"} 
+    files { "../common/common.cpp","../common/common.h"}
+    files { "../../RadeonProRender/rprTools/rprTelemetry.cpp","../../RadeonProRender/rprTools/rprTelemetry.h"}
+
+    -- remove filters for Visual Studio
+    vpaths { [""] = { 
+		"../73_telemetry/**.h", "../73_telemetry/**.cpp",
+		"../common/common.cpp","../common/common.h",
+		"../../RadeonProRender/rprTools/rprTelemetry.cpp", "../../RadeonProRender/rprTools/rprTelemetry.h"
+	} }
+
+    includedirs{ "../../RadeonProRender/inc" } 
+    
+    buildoptions "-std=c++14"
+
+    configuration {"x64"}
+    links {"RadeonProRender64"}
+
+    if os.istarget("linux") then
+		links {"pthread"}
+    end
+    if os.istarget("windows") then
+		links {"ws2_32"}
+    end
+
+    configuration {"x64", "Debug"}
+        targetdir "../Bin"
+    configuration {"x64", "Release"}
+        targetdir "../Bin"
+    configuration {}
+    
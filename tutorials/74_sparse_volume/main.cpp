@@ -0,0 +1,283 @@
+/*****************************************************************************\
+*
+*  Module Name    74_sparse_volume/main.cpp
+*  Project        Radeon ProRender rendering tutorial
+*
+*  Description    Radeon ProRender SDK tutorials: volume grids built with RPRSparseGridBuilder
+*
+*  Copyright(C) 2011-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+
+//
+// Shows how to build the grids of a volume with RPRSparseGridBuilder ( rprTools ).
+//
+// The scene of 51_volume: a density cylinder and a ramp along Y. The grids are first built as in 51_volume, with one
+// push_back per index and value, then with RPRSparseGridBuilder: the blocks of 8x8x8 voxels are filled by several threads,
+// the empty voxels are pruned and the grids are created with the indices of the active voxels only. The time and the memory of both are printed,
+// and the volume is rendered with the grids of the builder.
+//
+
+
+#include "RadeonProRender.h"
+#include "Math/mathutils.h"
+#include "../common/common.h"
+#include "../../RadeonProRender/rprTools/rprSparseGridBuilder.h"
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+RPRGarbageCollector g_gc;
+
+const unsigned int GRID_SIZE = 128;
+const float RADIUS_FADEOUT_START = 15.0f;
+const float RADIUS_FADEOUT_END = 40.0f;
+
+// distance to the axis of the cylinder
+float GetRadius(unsigned int x, unsigned int z)
+{
+	const float dx = (float)x - (float)GRID_SIZE / 2.0f;
+	const float dz = (float)z - (float)GRID_SIZE / 2.0f;
+	return sqrtf(dx * dx + dz * dz);
+}
+
+// "density" is a cylinder, "ramp" goes from 0 to 1 along Y inside the cylinder
+float GetDensity(unsigned int x, unsigned int z)
+{
+	const float radius = GetRadius(x, z);
+	if ( radius >= RADIUS_FADEOUT_END )
+		return 0.0f;
+	if ( radius <= RADIUS_FADEOUT_START )
+		return 1.0f;
+	return 1.0f - (radius - RADIUS_FADEOUT_START) / (RADIUS_FADEOUT_END - RADIUS_FADEOUT_START);
+}
+
+float GetRamp(unsigned int x, unsigned int y, unsigned int z)
+{
+	return GetRadius(x, z) < RADIUS_FADEOUT_END ? (float)y / (float)GRID_SIZE : 0.0f;
+}
+
+double SecondsSince(const std::chrono::steady_clock::time_point& start)
+{
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// the loop of 51_volume: 3 x 32-bit indices and 1 float per voxel
+void CreateGridsNaive(rpr_context context, rpr_grid* density, rpr_grid* ramp)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	std::vector<unsigned int> indicesList;
+	std::vector<float> densityValues;
+	std::vector<float> rampValues;
+	for(unsigned int x=0; x<GRID_SIZE; x++)
+	{
+		for(unsigned int y=0; y<GRID_SIZE; y++)
+		{
+			for(unsigned int z=0; z<GRID_SIZE; z++)
+			{
+				if ( GetRadius(x, z) < RADIUS_FADEOUT_END )
+				{
+					indicesList.push_back(x);
+					indicesList.push_back(y);
+					indicesList.push_back(z);
+					densityValues.push_back(GetDensity(x, z));
+					rampValues.push_back(GetRamp(x, y, z));
+				}
+			}
+		}
+	}
+
+	CHECK( rprContextCreateGrid(context, density,
+		GRID_SIZE,GRID_SIZE,GRID_SIZE,
+		&indicesList[0], indicesList.size()/3, RPR_GRID_INDICES_TOPOLOGY_XYZ_U32,
+		&densityValues[0], densityValues.size() * sizeof(float), 0
+		));
+	CHECK( rprContextCreateGrid(context, ramp,
+		GRID_SIZE,GRID_SIZE,GRID_SIZE,
+		&indicesList[0], indicesList.size()/3, RPR_GRID_INDICES_TOPOLOGY_XYZ_U32,
+		&rampValues[0], rampValues.size() * sizeof(float), 0
+		));
+
+	const size_t bytes = (indicesList.capacity() * sizeof(unsigned int)) + (densityValues.capacity() + rampValues.capacity()) * sizeof(float);
+	std::cout << "naive:   " << std::fixed << std::setprecision(1) << SecondsSince(start) * 1000.0 << " ms, "
+		<< indicesList.size() / 3 << " voxels, " << bytes / (1024 * 1024) << " MiB of arrays" << std::endl;
+}
+
+// the same grids with RPRSparseGridBuilder
+void CreateGridsSparse(rpr_context context, rpr_grid* density, rpr_grid* ramp)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	// the density is the same along Y
+	const auto getDensity = [](unsigned int x, unsigned int, unsigned int z) { return GetDensity(x, z); };
+	const std::pair<float(*)(unsigned int, unsigned int, unsigned int), rpr_grid*> grids[] = { { getDensity, density }, { GetRamp, ramp } };
+	for(const auto& grid : grids)
+	{
+		auto function = grid.first;
+		RPRSparseGridBuilder builder;
+		CHECK( builder.Build(GRID_SIZE, GRID_SIZE, GRID_SIZE, [function](unsigned int x0, unsigned int y0, unsigned int z0, float* values)
+		{
+			const unsigned int B = RPRSparseGridBuilder::BLOCK_SIZE;
+			for(unsigned int z=0; z<B; z++)
+				for(unsigned int y=0; y<B; y++)
+					for(unsigned int x=0; x<B; x++)
+						values[x + B * (y + B * z)] = function(x0 + x, y0 + y, z0 + z);
+		}) );
+		CHECK( builder.CreateGrid(context, grid.second) );
+
+		const RPRSparseGridBuilder::Stats stats = builder.GetStats();
+		std::cout << "  " << stats.activeVoxels << " voxels in " << stats.blocks << " blocks ( " << stats.constantBlocks << " constant ), "
+			<< "blocks " << stats.blockBytes / 1024 << " KiB, upload " << stats.uploadBytes / 1024 << " KiB instead of " << stats.naiveBytes / 1024 << " KiB, "
+			<< "build " << stats.buildSeconds * 1000.0 << " ms, expand " << stats.expandSeconds * 1000.0 << " ms, create " << stats.createSeconds * 1000.0 << " ms" << std::endl;
+	}
+
+	std::cout << "sparse:  " << std::fixed << std::setprecision(1) << SecondsSince(start) * 1000.0 << " ms" << std::endl;
+}
+
+
+int main()
+{
+	//	enable Radeon ProRender API trace
+	//	set this before any RPR API calls
+	//	rprContextSetParameterByKey1u(0,RPR_CONTEXT_TRACING_ENABLED,1);
+
+	std::cout << "-- Radeon ProRender SDK Demo --" << std::endl;
+
+	// the RPR context object.
+	rpr_context context = nullptr;
+
+	// Register the RPR DLL
+	rpr_int tahoePluginID = rprRegisterPlugin(RPR_PLUGIN_FILE_NAME);
+	CHECK_NE(tahoePluginID , -1);
+	rpr_int plugins[] = { tahoePluginID };
+	size_t pluginCount = sizeof(plugins) / sizeof(plugins[0]);
+
+	// Create context using a single GPU
+	CHECK( rprCreateContext(RPR_API_VERSION, plugins, pluginCount, g_ContextCreationFlags, g_contextProperties, NULL, &context) );
+
+	// Set the active plugin.
+	CHECK(  rprContextSetActivePlugin(context, plugins[0]) );
+
+	std::cout << "RPR Context creation succeeded." << std::endl;
+
+	rpr_material_system matsys = nullptr;
+	CHECK(rprContextCreateMaterialSystem(context, 0, &matsys));
+
+	rpr_scene scene = nullptr;
+	CHECK(rprContextCreateScene(context, &scene));
+	CHECK(rprContextSetScene(context, scene));
+
+	rpr_camera camera = nullptr;
+	CHECK(rprContextCreateCamera(context, &camera));
+	CHECK(rprCameraLookAt(camera, 2.5f,1.5f,3.5f, 0.0f,0.1f,0.0f, 0,1,0));
+	CHECK(rprSceneSetCamera(scene, camera));
+
+	CHECK( CreateAMDFloor(context, scene, matsys, g_gc, 0.20f, 0.20f,  0.0f,-1.0f,0.0f) );
+	CHECK( CreateNatureEnvLight(context, scene, g_gc, 0.8f) );
+
+	rpr_framebuffer_desc desc = { 640,480 };
+	rpr_framebuffer_format fmt = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	rpr_framebuffer frame_buffer = nullptr;
+	rpr_framebuffer frame_buffer_resolved = nullptr;
+	CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer));
+	CHECK( rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer_resolved) );
+	CHECK(rprContextSetAOV(context, RPR_AOV_COLOR, frame_buffer));
+
+	// volume shape, bounded by its transform
+	rpr_mesh_info mesh_properties[16];
+	mesh_properties[0] = (rpr_mesh_info)RPR_MESH_VOLUME_FLAG;
+	mesh_properties[1] = (rpr_mesh_info)1;
+	mesh_properties[2] = (rpr_mesh_info)0;
+	rpr_shape cube = nullptr;
+	CHECK( rprContextCreateMeshEx2(context,
+		nullptr,0,0,
+		nullptr,0,0,
+		nullptr,0,0,0,
+		nullptr,nullptr,nullptr,nullptr,0,
+		nullptr,0,nullptr,nullptr,nullptr,0,
+		mesh_properties,
+		&cube));
+	g_gc.GCAdd(cube);
+	RadeonProRender::matrix cubeTransform = RadeonProRender::scale(RadeonProRender::float3(1.0f, 2.0f, 1.0f));
+	CHECK(rprShapeSetTransform(cube, true, &cubeTransform.m00));
+	CHECK(rprSceneAttachShape(scene, cube));
+
+	// compare the construction of the grids
+	{
+		rpr_grid densityGrid = nullptr;
+		rpr_grid rampGrid = nullptr;
+		CreateGridsNaive(context, &densityGrid, &rampGrid);
+		CHECK(rprObjectDelete(densityGrid));
+		CHECK(rprObjectDelete(rampGrid));
+	}
+
+	rpr_grid densityGrid = nullptr;
+	rpr_grid rampGrid = nullptr;
+	CreateGridsSparse(context, &densityGrid, &rampGrid);
+
+	// material of 51_volume: density from the cylinder, color from the ramp through a red-green-blue texture
+	rpr_material_node densitySampler = nullptr;
+	CHECK(rprMaterialSystemCreateNode(matsys, RPR_MATERIAL_NODE_GRID_SAMPLER, &densitySampler));
+	g_gc.GCAdd(densitySampler);
+	CHECK(rprMaterialNodeSetInputGridDataByKey(densitySampler, RPR_MATERIAL_INPUT_DATA, densityGrid));
+
+	rpr_material_node rampSampler = nullptr;
+	CHECK(rprMaterialSystemCreateNode(matsys, RPR_MATERIAL_NODE_GRID_SAMPLER, &rampSampler));
+	g_gc.GCAdd(rampSampler);
+	CHECK(rprMaterialNodeSetInputGridDataByKey(rampSampler, RPR_MATERIAL_INPUT_DATA, rampGrid));
+
+	float rampData[] = {
+		1.f,0.f,0.f,
+		0.f,1.f,0.f,
+		0.f,0.f,1.f};
+	rpr_image_desc rampDesc = {};
+	rampDesc.image_width = 3;
+	rampDesc.image_height = 1;
+	rampDesc.image_row_pitch = rampDesc.image_width * sizeof(rpr_float) * 3;
+	rpr_image rampImage = nullptr;
+	CHECK(rprContextCreateImage(context, {3, RPR_COMPONENT_TYPE_FLOAT32}, &rampDesc, rampData, &rampImage));
+	g_gc.GCAdd(rampImage);
+
+	rpr_material_node rampTexture = nullptr;
+	CHECK(rprMaterialSystemCreateNode(matsys, RPR_MATERIAL_NODE_IMAGE_TEXTURE, &rampTexture));
+	g_gc.GCAdd(rampTexture);
+	CHECK(rprMaterialNodeSetInputImageDataByKey(rampTexture, RPR_MATERIAL_INPUT_DATA, rampImage));
+	CHECK(rprMaterialNodeSetInputNByKey(rampTexture, RPR_MATERIAL_INPUT_UV, rampSampler));
+	CHECK(rprMaterialNodeSetInputUByKey(rampTexture, RPR_MATERIAL_INPUT_WRAP_U, RPR_IMAGE_WRAP_TYPE_CLAMP_TO_EDGE));
+	CHECK(rprMaterialNodeSetInputUByKey(rampTexture, RPR_MATERIAL_INPUT_WRAP_V, RPR_IMAGE_WRAP_TYPE_CLAMP_TO_EDGE));
+
+	rpr_material_node materialVolume = nullptr;
+	CHECK(rprMaterialSystemCreateNode(matsys, RPR_MATERIAL_NODE_VOLUME, &materialVolume));
+	g_gc.GCAdd(materialVolume);
+	CHECK(rprMaterialNodeSetInputNByKey(materialVolume, RPR_MATERIAL_INPUT_DENSITYGRID, densitySampler));
+	CHECK(rprMaterialNodeSetInputFByKey(materialVolume, RPR_MATERIAL_INPUT_DENSITY, 10.0f, 0.0f, 0.0f, 0.0f));
+	CHECK(rprMaterialNodeSetInputNByKey(materialVolume, RPR_MATERIAL_INPUT_COLOR, rampTexture));
+	CHECK(rprShapeSetVolumeMaterial(cube, materialVolume));
+
+	CHECK(rprContextSetParameterByKey1u(context, RPR_CONTEXT_MAX_RECURSION, (rpr_uint)5));
+	CHECK(rprContextSetParameterByKey1u(context, RPR_CONTEXT_ITERATIONS, 3000));
+	CHECK(rprContextSetParameterByKey1f(context, RPR_CONTEXT_DISPLAY_GAMMA, 2.2f));
+
+	CHECK(rprContextRender(context));
+	CHECK(rprContextResolveFrameBuffer(context, frame_buffer, frame_buffer_resolved, false));
+	CHECK(rprFrameBufferSaveToFile(frame_buffer_resolved, "74_sparse_volume.png"));
+
+
+	// Release the stuff we created
+	CHECK(rprObjectDelete(densityGrid));densityGrid=nullptr;
+	CHECK(rprObjectDelete(rampGrid));rampGrid=nullptr;
+	CHECK(rprObjectDelete(camera));camera=nullptr;
+	CHECK(rprObjectDelete(frame_buffer));frame_buffer=nullptr;
+	CHECK(rprObjectDelete(frame_buffer_resolved));frame_buffer_resolved=nullptr;
+	g_gc.GCClean();
+	CHECK(rprObjectDelete(scene));scene=nullptr;
+	CHECK(rprObjectDelete(matsys));matsys=nullptr;
+	CheckNoLeak(context);
+	CHECK(rprObjectDelete(context));context=nullptr; // Always delete the RPR Context in last.
+	return 0;
+}
@@ -0,0 +1,31 @@
+project "74_sparse_volume"
+    kind "ConsoleApp"
+    location "../build"
+    files { "../74_sparse_volume/**.h", "../74_sparse_volume/**.cpp"} 
+    files { "../common/common.cpp","../common/common.h"}
+    files { "../../RadeonProRender/rprTools/rprSparseGridBuilder.cpp","../../RadeonProRender/rprTools/rprSparseGridBuilder.h"}
+
+    -- remove filters for Visual Studio
+    vpaths { [""] = { 
+		"../74_sparse_volume/**.h", "../74_sparse_volume/**.cpp",
+		"../common/common.cpp","../common/common.h",
+		"../../RadeonProRender/rprTools/rprSparseGridBuilder.cpp", "../../RadeonProRender/rprTools/rprSparseGridBuilder.h"
+	} }
+
+    includedirs{ "../../RadeonProRender/inc" } 
+    
+    buildoptions "-std=c++14"
+
+    configuration {"x64"}
+    links {"RadeonProRender64"}
+
+    if os.istarget("linux") then
+		links {"pthread"}
+    end
+
+    configuration {"x64", "Debug"}
+        targetdir "../Bin"
+    configuration {"x64", "Release"}
+        targetdir "../Bin"
+    configuration {}
+    
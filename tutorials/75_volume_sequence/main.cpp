@@ -0,0 +1,234 @@
+/*****************************************************************************\
+*
+*  Module Name    75_volume_sequence/main.cpp
+*  Project        Radeon ProRender rendering tutorial
+*
+*  Description    Radeon ProRender SDK tutorials: volume file sequence loaded with RPRVolumeLoader
+*
+*  Copyright(C) 2011-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+
+//
+// Shows how to render a sequence of volume files with RPRVolumeLoader ( rprTools ).
+//
+// The tutorial first writes FRAME_COUNT files of a rising smoke ball with RPRVolumeLoader::WriteFile: two grids, "density"
+// and "temperature", in the sparse format documented in rprVolumeLoader.h. The sequence is then rendered: while a frame is
+// rendered, the prefetch thread maps the next file and expands its leaves into the indices of rprContextCreateGrid, so that
+// LoadNext only creates the grids, with the values read directly from the mapped file.
+//
+
+
+#include "RadeonProRender.h"
+#include "Math/mathutils.h"
+#include "../common/common.h"
+#include "../../RadeonProRender/rprTools/rprVolumeLoader.h"
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+RPRGarbageCollector g_gc;
+
+const int FRAME_COUNT = 24;
+const unsigned int GRID_SIZE = 128;
+const unsigned int FRAME_ITERATIONS = 256;
+
+// smoke ball of frame: rises and grows, hot in its center
+void WriteFrame(const std::string& fileName, int frame)
+{
+	const float t = (float)frame / FRAME_COUNT;
+	const float centerY = GRID_SIZE * (0.25f + 0.5f * t);
+	const float radius = GRID_SIZE * (0.15f + 0.1f * t);
+
+	const std::vector<RPRVolumeLoader::GridDesc> grids = { { "density", 0.0f }, { "temperature", 0.0f } };
+	CHECK( RPRVolumeLoader::WriteFile(fileName, GRID_SIZE, GRID_SIZE, GRID_SIZE, grids, [&](unsigned int x0, unsigned int y0, unsigned int z0, float* const* values)
+	{
+		const unsigned int L = RPRVolumeLoader::LEAF_SIZE;
+		for(unsigned int z=0; z<L; z++)
+		{
+			for(unsigned int y=0; y<L; y++)
+			{
+				for(unsigned int x=0; x<L; x++)
+				{
+					const float dx = (float)(x0 + x) - GRID_SIZE / 2.0f;
+					const float dy = (float)(y0 + y) - centerY;
+					const float dz = (float)(z0 + z) - GRID_SIZE / 2.0f;
+					const float distance = sqrtf(dx * dx + dy * dy + dz * dz) / radius;
+					if ( distance >= 1.0f )
+						continue;
+					values[0][x + L * (y + L * z)] = 1.0f - distance * distance;
+					values[1][x + L * (y + L * z)] = (1.0f - distance) * (1.0f - t);
+				}
+			}
+		}
+	}) );
+}
+
+
+int main()
+{
+	//	enable Radeon ProRender API trace
+	//	set this before any RPR API calls
+	//	rprContextSetParameterByKey1u(0,RPR_CONTEXT_TRACING_ENABLED,1);
+
+	std::cout << "-- Radeon ProRender SDK Demo --" << std::endl;
+
+	std::vector<std::string> files;
+	for(int frame=0; frame<FRAME_COUNT; frame++)
+	{
+		files.push_back("75_volume_" + std::to_string(frame) + ".rprvol");
+		WriteFrame(files.back(), frame);
+	}
+	std::cout << FRAME_COUNT << " volume files written." << std::endl;
+
+	// the RPR context object.
+	rpr_context context = nullptr;
+
+	// Register the RPR DLL
+	rpr_int tahoePluginID = rprRegisterPlugin(RPR_PLUGIN_FILE_NAME);
+	CHECK_NE(tahoePluginID , -1);
+	rpr_int plugins[] = { tahoePluginID };
+	size_t pluginCount = sizeof(plugins) / sizeof(plugins[0]);
+
+	// Create context using a single GPU
+	CHECK( rprCreateContext(RPR_API_VERSION, plugins, pluginCount, g_ContextCreationFlags, g_contextProperties, NULL, &context) );
+
+	// Set the active plugin.
+	CHECK(  rprContextSetActivePlugin(context, plugins[0]) );
+
+	std::cout << "RPR Context creation succeeded." << std::endl;
+
+	rpr_material_system matsys = nullptr;
+	CHECK(rprContextCreateMaterialSystem(context, 0, &matsys));
+
+	rpr_scene scene = nullptr;
+	CHECK(rprContextCreateScene(context, &scene));
+	CHECK(rprContextSetScene(context, scene));
+
+	rpr_camera camera = nullptr;
+	CHECK(rprContextCreateCamera(context, &camera));
+	CHECK(rprCameraLookAt(camera, 2.5f,1.5f,3.5f, 0.0f,0.1f,0.0f, 0,1,0));
+	CHECK(rprSceneSetCamera(scene, camera));
+
+	CHECK( CreateAMDFloor(context, scene, matsys, g_gc, 0.20f, 0.20f,  0.0f,-1.0f,0.0f) );
+	CHECK( CreateNatureEnvLight(context, scene, g_gc, 0.8f) );
+
+	rpr_framebuffer_desc desc = { 640,480 };
+	rpr_framebuffer_format fmt = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	rpr_framebuffer frame_buffer = nullptr;
+	rpr_framebuffer frame_buffer_resolved = nullptr;
+	CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer));
+	CHECK( rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer_resolved) );
+	CHECK(rprContextSetAOV(context, RPR_AOV_COLOR, frame_buffer));
+
+	// volume shape, bounded by its transform
+	rpr_mesh_info mesh_properties[16];
+	mesh_properties[0] = (rpr_mesh_info)RPR_MESH_VOLUME_FLAG;
+	mesh_properties[1] = (rpr_mesh_info)1;
+	mesh_properties[2] = (rpr_mesh_info)0;
+	rpr_shape cube = nullptr;
+	CHECK( rprContextCreateMeshEx2(context,
+		nullptr,0,0,
+		nullptr,0,0,
+		nullptr,0,0,0,
+		nullptr,nullptr,nullptr,nullptr,0,
+		nullptr,0,nullptr,nullptr,nullptr,0,
+		mesh_properties,
+		&cube));
+	g_gc.GCAdd(cube);
+	RadeonProRender::matrix cubeTransform = RadeonProRender::scale(RadeonProRender::float3(1.0f, 2.0f, 1.0f));
+	CHECK(rprShapeSetTransform(cube, true, &cubeTransform.m00));
+	CHECK(rprSceneAttachShape(scene, cube));
+
+	// density from the "density" grid, color from the "temperature" grid through a gray-red-yellow ramp
+	rpr_material_node densitySampler = nullptr;
+	CHECK(rprMaterialSystemCreateNode(matsys, RPR_MATERIAL_NODE_GRID_SAMPLER, &densitySampler));
+	g_gc.GCAdd(densitySampler);
+
+	rpr_material_node temperatureSampler = nullptr;
+	CHECK(rprMaterialSystemCreateNode(matsys, RPR_MATERIAL_NODE_GRID_SAMPLER, &temperatureSampler));
+	g_gc.GCAdd(temperatureSampler);
+
+	float rampData[] = {
+		0.2f,0.2f,0.2f,
+		1.0f,0.2f,0.0f,
+		1.0f,0.9f,0.2f};
+	rpr_image_desc rampDesc = {};
+	rampDesc.image_width = 3;
+	rampDesc.image_height = 1;
+	rampDesc.image_row_pitch = rampDesc.image_width * sizeof(rpr_float) * 3;
+	rpr_image rampImage = nullptr;
+	CHECK(rprContextCreateImage(context, {3, RPR_COMPONENT_TYPE_FLOAT32}, &rampDesc, rampData, &rampImage));
+	g_gc.GCAdd(rampImage);
+
+	rpr_material_node rampTexture = nullptr;
+	CHECK(rprMaterialSystemCreateNode(matsys, RPR_MATERIAL_NODE_IMAGE_TEXTURE, &rampTexture));
+	g_gc.GCAdd(rampTexture);
+	CHECK(rprMaterialNodeSetInputImageDataByKey(rampTexture, RPR_MATERIAL_INPUT_DATA, rampImage));
+	CHECK(rprMaterialNodeSetInputNByKey(rampTexture, RPR_MATERIAL_INPUT_UV, temperatureSampler));
+	CHECK(rprMaterialNodeSetInputUByKey(rampTexture, RPR_MATERIAL_INPUT_WRAP_U, RPR_IMAGE_WRAP_TYPE_CLAMP_TO_EDGE));
+	CHECK(rprMaterialNodeSetInputUByKey(rampTexture, RPR_MATERIAL_INPUT_WRAP_V, RPR_IMAGE_WRAP_TYPE_CLAMP_TO_EDGE));
+
+	rpr_material_node materialVolume = nullptr;
+	CHECK(rprMaterialSystemCreateNode(matsys, RPR_MATERIAL_NODE_VOLUME, &materialVolume));
+	g_gc.GCAdd(materialVolume);
+	CHECK(rprMaterialNodeSetInputNByKey(materialVolume, RPR_MATERIAL_INPUT_DENSITYGRID, densitySampler));
+	CHECK(rprMaterialNodeSetInputFByKey(materialVolume, RPR_MATERIAL_INPUT_DENSITY, 10.0f, 0.0f, 0.0f, 0.0f));
+	CHECK(rprMaterialNodeSetInputNByKey(materialVolume, RPR_MATERIAL_INPUT_COLOR, rampTexture));
+	CHECK(rprShapeSetVolumeMaterial(cube, materialVolume));
+
+	CHECK(rprContextSetParameterByKey1u(context, RPR_CONTEXT_MAX_RECURSION, (rpr_uint)5));
+	CHECK(rprContextSetParameterByKey1u(context, RPR_CONTEXT_ITERATIONS, FRAME_ITERATIONS));
+	CHECK(rprContextSetParameterByKey1f(context, RPR_CONTEXT_DISPLAY_GAMMA, 2.2f));
+
+	// in a block: the loader and its files are released before the context
+	{
+		RPRVolumeLoader loader(files);
+		std::vector<rpr_grid> grids;
+		for(int frame=0; loader.HasNext(); frame++)
+		{
+			// grids of the previous frame
+			std::vector<rpr_grid> previousGrids;
+			previousGrids.swap(grids);
+
+			std::vector<RPRVolumeLoader::GridDesc> descs;
+			CHECK(loader.LoadNext(context, grids, &descs));
+			CHECK(rprMaterialNodeSetInputGridDataByKey(densitySampler, RPR_MATERIAL_INPUT_DATA, grids[0]));
+			CHECK(rprMaterialNodeSetInputGridDataByKey(temperatureSampler, RPR_MATERIAL_INPUT_DATA, grids[1]));
+			for(rpr_grid grid : previousGrids)
+				CHECK(rprObjectDelete(grid));
+
+			CHECK(rprFrameBufferClear(frame_buffer));
+			CHECK(rprContextRender(context));
+			CHECK(rprContextResolveFrameBuffer(context, frame_buffer, frame_buffer_resolved, false));
+			const std::string imageName = "75_" + std::to_string(frame) + ".png";
+			CHECK(rprFrameBufferSaveToFile(frame_buffer_resolved, imageName.c_str()));
+			std::cout << "frame " << frame << " rendered: " << imageName << std::endl;
+		}
+
+		for(rpr_grid grid : grids)
+			CHECK(rprObjectDelete(grid));
+
+		const RPRVolumeLoader::Stats stats = loader.GetStats();
+		std::cout << std::fixed << std::setprecision(1)
+			<< stats.framesLoaded << " frames, " << stats.activeVoxels << " voxels, " << stats.bytesRead / (1024 * 1024) << " MiB mapped" << std::endl
+			<< "prefetch thread: map " << stats.ioSeconds * 1000.0 << " ms, indices " << stats.indexSeconds * 1000.0 << " ms" << std::endl
+			<< "render thread: waited " << stats.waitSeconds * 1000.0 << " ms, rprContextCreateGrid " << stats.createSeconds * 1000.0 << " ms" << std::endl;
+	}
+
+
+	// Release the stuff we created
+	CHECK(rprObjectDelete(camera));camera=nullptr;
+	CHECK(rprObjectDelete(frame_buffer));frame_buffer=nullptr;
+	CHECK(rprObjectDelete(frame_buffer_resolved));frame_buffer_resolved=nullptr;
+	g_gc.GCClean();
+	CHECK(rprObjectDelete(scene));scene=nullptr;
+	CHECK(rprObjectDelete(matsys));matsys=nullptr;
+	CheckNoLeak(context);
+	CHECK(rprObjectDelete(context));context=nullptr; // Always delete the RPR Context in last.
+	return 0;
+}
@@ -0,0 +1,31 @@
+project "75_volume_sequence"
+    kind "ConsoleApp"
+    location "../build"
+    files { "../75_volume_sequence/**.h", "../75_volume_sequence/**.cpp"} 
+    files { "../common/common.cpp","../common/common.h"}
+    files { "../../RadeonProRender/rprTools/rprVolumeLoader.cpp","../../RadeonProRender/rprTools/rprVolumeLoader.h"}
+
+    -- remove filters for Visual Studio
+    vpaths { [""] = { 
+		"../75_volume_sequence/**.h", "../75_volume_sequence/**.cpp",
+		"../common/common.cpp","../common/common.h",
+		"../../RadeonProRender/rprTools/rprVolumeLoader.cpp", "../../RadeonProRender/rprTools/rprVolumeLoader.h"
+	} }
+
+    includedirs{ "../../RadeonProRender/inc" } 
+    
+    buildoptions "-std=c++14"
+
+    configuration {"x64"}
+    links {"RadeonProRender64"}
+
+    if os.istarget("linux") then
+		links {"pthread"}
+    end
+
+    configuration {"x64", "Debug"}
+        targetdir "../Bin"
+    configuration {"x64", "Release"}
+        targetdir "../Bin"
+    configuration {}
+    
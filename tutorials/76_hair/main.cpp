@@ -0,0 +1,208 @@
+/*****************************************************************************\
+*
+*  Module Name    76_hair/main.cpp
+*  Project        Radeon ProRender rendering tutorial
+*
+*  Description    Radeon ProRender SDK tutorials: groom of many strands built with RPRCurveBuilder
+*
+*  Copyright(C) 2011-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+
+//
+// Shows how to create a groom of many strands with RPRCurveBuilder ( rprTools ).
+//
+// A patch of STRAND_COUNT wavy strands is generated as arrays: the points of all the strands, the number of points of each
+// strand, a radius per point ( tapered strands ) and a uv per strand. RPRCurveBuilder converts them to Bezier segments with
+// several threads and splits the groom into several rpr_curve.
+// The groom is rendered from a close camera, then from a far camera with the decimation enabled: the strands thinner than a
+// pixel are removed, and the radius of the others increased, so that the groom keeps its look with less curve memory.
+//
+
+
+#include "RadeonProRender.h"
+#include "Math/mathutils.h"
+#include "../common/common.h"
+#include "../../RadeonProRender/rprTools/rprCurveBuilder.h"
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+RPRGarbageCollector g_gc;
+
+const int STRANDS_PER_SIDE = 400;
+const rpr_uint POINTS_PER_STRAND = 12;
+const float PATCH_WIDTH = 5.0f;
+const float STRAND_LENGTH = 1.5f;
+const float ROOT_RADIUS = 0.004f;
+
+// return a random float between 0.0 and 1.0
+float draw()
+{
+	return (rand()&RAND_MAX)/(float)RAND_MAX;
+}
+
+// groom arrays, as exported by a hair tool
+struct Groom
+{
+	std::vector<rpr_uint> pointCounts;
+	std::vector<float> points;
+	std::vector<float> pointRadius;
+	std::vector<float> uvs;
+};
+
+void CreateGroom(Groom& groom)
+{
+	for(int j=0; j<STRANDS_PER_SIDE; j++)
+	{
+		for(int i=0; i<STRANDS_PER_SIDE; i++)
+		{
+			const float u = (i + draw()) / STRANDS_PER_SIDE;
+			const float v = (j + draw()) / STRANDS_PER_SIDE;
+			const float phase = draw() * 2.0f * MY_PI;
+			for(rpr_uint k=0; k<POINTS_PER_STRAND; k++)
+			{
+				const float t = (float)k / (POINTS_PER_STRAND - 1);
+				groom.points.push_back((u - 0.5f) * PATCH_WIDTH + 0.05f * std::sin(phase + 8.0f * t));
+				groom.points.push_back(t * STRAND_LENGTH);
+				groom.points.push_back((v - 0.5f) * PATCH_WIDTH + 0.05f * std::cos(phase + 8.0f * t));
+				groom.pointRadius.push_back(ROOT_RADIUS * (1.0f - 0.8f * t));
+			}
+			groom.pointCounts.push_back(POINTS_PER_STRAND);
+			groom.uvs.push_back(u);
+			groom.uvs.push_back(v);
+		}
+	}
+}
+
+// create the curves of the groom, render them and save the image
+void RenderGroom(rpr_context context, rpr_scene scene, rpr_material_node material, const Groom& groom, const RPRCurveBuilder::Settings& settings,
+	rpr_framebuffer frame_buffer, rpr_framebuffer frame_buffer_resolved, const char* imageName)
+{
+	RPRCurveBuilder::Strands strands;
+	strands.count = groom.pointCounts.size();
+	strands.pointCounts = groom.pointCounts.data();
+	strands.points = groom.points.data();
+	strands.pointCount = groom.points.size() / 3;
+	strands.pointRadius = groom.pointRadius.data();
+	strands.uvs = groom.uvs.data();
+
+	RPRCurveBuilder builder(settings);
+	std::vector<rpr_curve> curves;
+	CHECK(builder.Build(context, strands, curves));
+	for(rpr_curve curve : curves)
+	{
+		CHECK(rprCurveSetMaterial(curve, material));
+		CHECK(rprSceneAttachCurve(scene, curve));
+	}
+
+	const RPRCurveBuilder::Stats stats = builder.GetStats();
+	std::cout << imageName << ": " << stats.keptStrands << " / " << stats.inputStrands << " strands, " << stats.segments << " segments in " << stats.curves << " rpr_curve, "
+		<< std::fixed << std::setprecision(1) << stats.bytes / (1024.0 * 1024.0) << " MiB instead of " << stats.naiveBytes / (1024.0 * 1024.0) << " MiB, "
+		<< "generate " << stats.generateSeconds * 1000.0 << " ms, create " << stats.createSeconds * 1000.0 << " ms" << std::endl;
+
+	CHECK(rprFrameBufferClear(frame_buffer));
+	CHECK(rprContextRender(context));
+	CHECK(rprContextResolveFrameBuffer(context, frame_buffer, frame_buffer_resolved, false));
+	CHECK(rprFrameBufferSaveToFile(frame_buffer_resolved, imageName));
+
+	for(rpr_curve curve : curves)
+	{
+		CHECK(rprSceneDetachCurve(scene, curve));
+		CHECK(rprObjectDelete(curve));
+	}
+}
+
+
+int main()
+{
+	//	enable Radeon ProRender API trace
+	//	set this before any RPR API calls
+	//	rprContextSetParameterByKey1u(0,RPR_CONTEXT_TRACING_ENABLED,1);
+
+	std::cout << "-- Radeon ProRender SDK Demo --" << std::endl;
+
+	// the RPR context object.
+	rpr_context context = nullptr;
+
+	// Register the RPR DLL
+	rpr_int tahoePluginID = rprRegisterPlugin(RPR_PLUGIN_FILE_NAME);
+	CHECK_NE(tahoePluginID , -1);
+	rpr_int plugins[] = { tahoePluginID };
+	size_t pluginCount = sizeof(plugins) / sizeof(plugins[0]);
+
+	// Create context using a single GPU
+	CHECK( rprCreateContext(RPR_API_VERSION, plugins, pluginCount, g_ContextCreationFlags, g_contextProperties, NULL, &context) );
+
+	// Set the active plugin.
+	CHECK(  rprContextSetActivePlugin(context, plugins[0]) );
+
+	std::cout << "RPR Context creation succeeded." << std::endl;
+
+	rpr_material_system matsys = nullptr;
+	CHECK(rprContextCreateMaterialSystem(context, 0, &matsys));
+
+	rpr_scene scene = nullptr;
+	CHECK(rprContextCreateScene(context, &scene));
+	CHECK(rprContextSetScene(context, scene));
+	CHECK( CreateNatureEnvLight(context, scene, g_gc, 0.8f)  );
+
+	const float focalLength = 75.0f;
+	rpr_camera camera = nullptr;
+	CHECK(rprContextCreateCamera(context, &camera));
+	CHECK(rprCameraSetFocalLength(camera, focalLength));
+	CHECK(rprSceneSetCamera(scene, camera));
+
+	CHECK( CreateAMDFloor(context, scene, matsys, g_gc, 1.0f, 1.0f)  );
+
+	rpr_framebuffer_desc desc = { 800,600 };
+	rpr_framebuffer_format fmt = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	rpr_framebuffer frame_buffer = nullptr;
+	rpr_framebuffer frame_buffer_resolved = nullptr;
+	CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer));
+	CHECK( rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer_resolved) );
+	CHECK(rprContextSetAOV(context, RPR_AOV_COLOR, frame_buffer));
+	CHECK(rprContextSetParameterByKey1u(context,RPR_CONTEXT_ITERATIONS,NUM_ITERATIONS));
+
+	rpr_material_node hairMaterial = nullptr;
+	CHECK(rprMaterialSystemCreateNode(matsys, RPR_MATERIAL_NODE_DIFFUSE, &hairMaterial));
+	g_gc.GCAdd(hairMaterial);
+	CHECK(rprMaterialNodeSetInputFByKey(hairMaterial, RPR_MATERIAL_INPUT_COLOR, 0.6f, 0.35f, 0.15f, 1.f));
+
+	Groom groom;
+	CreateGroom(groom);
+
+	// close view: all the strands
+	CHECK(rprCameraLookAt(camera, 0, 4, 10,   0, 0.5f, 0,   0, 1, 0));
+	RPRCurveBuilder::Settings settings;
+	RenderGroom(context, scene, hairMaterial, groom, settings, frame_buffer, frame_buffer_resolved, "76_hair_close.png");
+
+	// far view: the strands thinner than a pixel are decimated
+	const float cameraPosition[3] = { 0, 30, 80 };
+	CHECK(rprCameraLookAt(camera, cameraPosition[0], cameraPosition[1], cameraPosition[2],   0, 0.5f, 0,   0, 1, 0));
+
+	rpr_float sensorSize[2] = { 36.0f, 24.0f };
+	CHECK(rprCameraGetInfo(camera, RPR_CAMERA_SENSOR_SIZE, sizeof(sensorSize), sensorSize, nullptr));
+
+	settings.decimate = true;
+	settings.cameraPosition[0] = cameraPosition[0];
+	settings.cameraPosition[1] = cameraPosition[1];
+	settings.cameraPosition[2] = cameraPosition[2];
+	settings.pixelsPerUnit = RPRCurveBuilder::GetPixelsPerUnit(focalLength, sensorSize[1], desc.fb_height);
+	RenderGroom(context, scene, hairMaterial, groom, settings, frame_buffer, frame_buffer_resolved, "76_hair_far.png");
+
+
+	// Release the stuff we created
+	CHECK(rprObjectDelete(camera));camera=nullptr;
+	CHECK(rprObjectDelete(frame_buffer));frame_buffer=nullptr;
+	CHECK(rprObjectDelete(frame_buffer_resolved));frame_buffer_resolved=nullptr;
+	g_gc.GCClean();
+	CHECK(rprObjectDelete(scene));scene=nullptr;
+	CHECK(rprObjectDelete(matsys));matsys=nullptr;
+	CheckNoLeak(context);
+	CHECK(rprObjectDelete(context));context=nullptr; // Always delete the RPR Context in last.
+	return 0;
+}
@@ -0,0 +1,31 @@
+project "76_hair"
+    kind "ConsoleApp"
+    location "../build"
+    files { "../76_hair/**.h", "../76_hair/**.cpp"} 
+    files { "../common/common.cpp","../common/common.h"}
+    files { "../../RadeonProRender/rprTools/rprCurveBuilder.cpp","../../RadeonProRender/rprTools/rprCurveBuilder.h"}
+
+    -- remove filters for Visual Studio
+    vpaths { [""] = { 
+		"../76_hair/**.h", "../76_hair/**.cpp",
+		"../common/common.cpp","../common/common.h",
+		"../../RadeonProRender/rprTools/rprCurveBuilder.cpp", "../../RadeonProRender/rprTools/rprCurveBuilder.h"
+	} }
+
+    includedirs{ "../../RadeonProRender/inc" } 
+    
+    buildoptions "-std=c++14"
+
+    configuration {"x64"}
+    links {"RadeonProRender64"}
+
+    if os.istarget("linux") then
+		links {"pthread"}
+    end
+
+    configuration {"x64", "Debug"}
+        targetdir "../Bin"
+    configuration {"x64", "Release"}
+        targetdir "../Bin"
+    configuration {}
+    
@@ -0,0 +1,217 @@
+/*****************************************************************************\
+*
+*  Module Name    77_deformation_cache/main.cpp
+*  Project        Radeon ProRender rendering tutorial
+*
+*  Description    Radeon ProRender SDK tutorials: deformation motion blur played from RPRDeformationCache
+*
+*  Copyright(C) 2011-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+
+//
+// Shows how to play a deformation motion blur animation from a cache with RPRDeformationCache ( rprTools ).
+//
+// A waving cloth of CLOTH_RESOLUTION x CLOTH_RESOLUTION vertices is simulated for FRAME_COUNT frames, with KEYS_PER_FRAME keys
+// per frame ( RPR_MESH_MOTION_DIMENSION, see 13_deformation_motion_blur ), and written to a cache where each key is stored as
+// 16-bit deltas from the rest pose and octahedral normals.
+// The cache is then played: for each frame, the keys are decoded with several threads into buffers reused from frame to frame,
+// the mesh of the frame is created and rendered. The size of the cache is printed with the size of the same keys as floats.
+//
+
+
+#include "RadeonProRender.h"
+#include "Math/mathutils.h"
+#include "../common/common.h"
+#include "../../RadeonProRender/rprTools/rprDeformationCache.h"
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+RPRGarbageCollector g_gc;
+
+const int CLOTH_RESOLUTION = 300;
+const float CLOTH_SIZE = 4.0f;
+const unsigned FRAME_COUNT = 24;
+const unsigned KEYS_PER_FRAME = 3;
+const unsigned RENDERED_FRAMES[] = { 0, 8, 16 };
+const char* CACHE_FILE = "77_cloth.rprdef";
+
+// cloth hanging from its top edge, the wave growing toward the bottom
+void ClothPosition(float u, float v, float time, float* position, float* normal)
+{
+	const float amplitude = 0.3f * v;
+	const float phase = 6.0f * u + 4.0f * v - 3.0f * time;
+	position[0] = (u - 0.5f) * CLOTH_SIZE;
+	position[1] = (1.0f - v) * CLOTH_SIZE;
+	position[2] = amplitude * std::sin(phase);
+
+	// cross product of the derivatives along u and v
+	const float dzdu = amplitude * 6.0f * std::cos(phase) / CLOTH_SIZE;
+	const float dzdy = -(0.3f * std::sin(phase) + amplitude * 4.0f * std::cos(phase)) / CLOTH_SIZE;
+	const float length = std::sqrt(dzdu * dzdu + dzdy * dzdy + 1.0f);
+	normal[0] = -dzdu / length;
+	normal[1] = -dzdy / length;
+	normal[2] = 1.0f / length;
+}
+
+void WriteClothCache(std::vector<rpr_int>& indices, std::vector<rpr_int>& faceVertexCounts, std::vector<float>& texcoords)
+{
+	const unsigned vertexCount = CLOTH_RESOLUTION * CLOTH_RESOLUTION;
+	std::vector<float> rest(vertexCount * 3);
+	std::vector<float> restNormals(vertexCount * 3);
+	for(int j=0; j<CLOTH_RESOLUTION; j++)
+	{
+		for(int i=0; i<CLOTH_RESOLUTION; i++)
+		{
+			const float u = (float)i / (CLOTH_RESOLUTION - 1);
+			const float v = (float)j / (CLOTH_RESOLUTION - 1);
+			const int vertex = i + j * CLOTH_RESOLUTION;
+			ClothPosition(u, v, 0.0f, &rest[3 * vertex], &restNormals[3 * vertex]);
+			texcoords.push_back(u);
+			texcoords.push_back(v);
+		}
+	}
+	for(int j=0; j+1<CLOTH_RESOLUTION; j++)
+	{
+		for(int i=0; i+1<CLOTH_RESOLUTION; i++)
+		{
+			const int vertex = i + j * CLOTH_RESOLUTION;
+			indices.push_back(vertex);
+			indices.push_back(vertex + CLOTH_RESOLUTION);
+			indices.push_back(vertex + CLOTH_RESOLUTION + 1);
+			indices.push_back(vertex + 1);
+			faceVertexCounts.push_back(4);
+		}
+	}
+
+	// the keys of a frame cover the exposure of the camera: from the frame to the next one
+	auto key = [](unsigned frame, unsigned key, float* positions, float* normals)
+	{
+		const float time = (frame + (float)key / (KEYS_PER_FRAME - 1)) / 24.0f;
+		for(int j=0; j<CLOTH_RESOLUTION; j++)
+		{
+			for(int i=0; i<CLOTH_RESOLUTION; i++)
+			{
+				const int vertex = i + j * CLOTH_RESOLUTION;
+				ClothPosition((float)i / (CLOTH_RESOLUTION - 1), (float)j / (CLOTH_RESOLUTION - 1), time, &positions[3 * vertex], &normals[3 * vertex]);
+			}
+		}
+	};
+
+	float maxError = 0.0f;
+	CHECK(RPRDeformationCache::WriteFile(CACHE_FILE, vertexCount, rest.data(), FRAME_COUNT, KEYS_PER_FRAME, true, key, &maxError));
+	std::cout << "cache written, largest error of the positions: " << maxError << std::endl;
+}
+
+
+int main()
+{
+	//	enable Radeon ProRender API trace
+	//	set this before any RPR API calls
+	//	rprContextSetParameterByKey1u(0,RPR_CONTEXT_TRACING_ENABLED,1);
+
+	std::cout << "-- Radeon ProRender SDK Demo --" << std::endl;
+
+	// the RPR context object.
+	rpr_context context = nullptr;
+
+	// Register the RPR DLL
+	rpr_int tahoePluginID = rprRegisterPlugin(RPR_PLUGIN_FILE_NAME);
+	CHECK_NE(tahoePluginID , -1);
+	rpr_int plugins[] = { tahoePluginID };
+	size_t pluginCount = sizeof(plugins) / sizeof(plugins[0]);
+
+	// Create context using a single GPU
+	CHECK( rprCreateContext(RPR_API_VERSION, plugins, pluginCount, g_ContextCreationFlags, g_contextProperties, NULL, &context) );
+
+	// Set the active plugin.
+	CHECK(  rprContextSetActivePlugin(context, plugins[0]) );
+
+	std::cout << "RPR Context creation succeeded." << std::endl;
+
+	rpr_material_system matsys = nullptr;
+	CHECK(rprContextCreateMaterialSystem(context, 0, &matsys));
+
+	rpr_scene scene = nullptr;
+	CHECK(rprContextCreateScene(context, &scene));
+	CHECK(rprContextSetScene(context, scene));
+	CHECK( CreateNatureEnvLight(context, scene, g_gc, 0.8f)  );
+
+	rpr_camera camera = nullptr;
+	CHECK(rprContextCreateCamera(context, &camera));
+	CHECK(rprCameraLookAt(camera, 0, 3, 12,   0, 2, 0,   0, 1, 0));
+	CHECK(rprCameraSetFocalLength(camera, 50.0f));
+	// the exposure covers all the keys of a frame
+	CHECK(rprCameraSetExposure(camera, 1.0f));
+	CHECK(rprSceneSetCamera(scene, camera));
+
+	CHECK( CreateAMDFloor(context, scene, matsys, g_gc, 1.0f, 1.0f)  );
+
+	rpr_framebuffer_desc desc = { 800,600 };
+	rpr_framebuffer_format fmt = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	rpr_framebuffer frame_buffer = nullptr;
+	rpr_framebuffer frame_buffer_resolved = nullptr;
+	CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer));
+	CHECK( rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer_resolved) );
+	CHECK(rprContextSetAOV(context, RPR_AOV_COLOR, frame_buffer));
+	CHECK(rprContextSetParameterByKey1u(context,RPR_CONTEXT_ITERATIONS,NUM_ITERATIONS));
+
+	rpr_material_node clothMaterial = nullptr;
+	CHECK(rprMaterialSystemCreateNode(matsys, RPR_MATERIAL_NODE_DIFFUSE, &clothMaterial));
+	g_gc.GCAdd(clothMaterial);
+	CHECK(rprMaterialNodeSetInputFByKey(clothMaterial, RPR_MATERIAL_INPUT_COLOR, 0.7f, 0.1f, 0.1f, 1.f));
+
+	std::vector<rpr_int> indices;
+	std::vector<rpr_int> faceVertexCounts;
+	std::vector<float> texcoords;
+	WriteClothCache(indices, faceVertexCounts, texcoords);
+
+	RPRDeformationCache cache;
+	CHECK(cache.Open(CACHE_FILE));
+
+	RPRDeformationCache::Topology topology;
+	topology.indices = indices.data();
+	topology.faceVertexCounts = faceVertexCounts.data();
+	topology.faceCount = faceVertexCounts.size();
+	topology.texcoords = texcoords.data();
+
+	// play the cache: one mesh per frame, the mesh of the previous frame is deleted
+	for(unsigned frame : RENDERED_FRAMES)
+	{
+		rpr_shape cloth = nullptr;
+		CHECK(cache.CreateMesh(context, frame, topology, &cloth));
+		CHECK(rprShapeSetMaterial(cloth, clothMaterial));
+		CHECK(rprSceneAttachShape(scene, cloth));
+
+		CHECK(rprFrameBufferClear(frame_buffer));
+		CHECK(rprContextRender(context));
+		CHECK(rprContextResolveFrameBuffer(context, frame_buffer, frame_buffer_resolved, false));
+		const std::string imageName = "77_frame" + std::to_string(frame) + ".png";
+		CHECK(rprFrameBufferSaveToFile(frame_buffer_resolved, imageName.c_str()));
+
+		CHECK(rprSceneDetachShape(scene, cloth));
+		CHECK(rprObjectDelete(cloth));cloth=nullptr;
+	}
+
+	const RPRDeformationCache::Stats stats = cache.GetStats();
+	std::cout << "cache: " << std::fixed << std::setprecision(1) << stats.fileBytes / (1024.0 * 1024.0) << " MiB instead of " << stats.rawBytes / (1024.0 * 1024.0) << " MiB of float keys, "
+		<< stats.framesDecoded << " frames decoded in " << stats.decodeSeconds * 1000.0 << " ms, meshes created in " << stats.createSeconds * 1000.0 << " ms" << std::endl;
+	cache.Close();
+
+
+	// Release the stuff we created
+	CHECK(rprObjectDelete(camera));camera=nullptr;
+	CHECK(rprObjectDelete(frame_buffer));frame_buffer=nullptr;
+	CHECK(rprObjectDelete(frame_buffer_resolved));frame_buffer_resolved=nullptr;
+	g_gc.GCClean();
+	CHECK(rprObjectDelete(scene));scene=nullptr;
+	CHECK(rprObjectDelete(matsys));matsys=nullptr;
+	CheckNoLeak(context);
+	CHECK(rprObjectDelete(context));context=nullptr; // Always delete the RPR Context in last.
+	return 0;
+}
@@ -0,0 +1,31 @@
+project "77_deformation_cache"
+    kind "ConsoleApp"
+    location "../build"
+    files { "../77_deformation_cache/**.h", "../77_deformation_cache/**.cpp"} 
+    files { "../common/common.cpp","../common/common.h"}
+    files { "../../RadeonProRender/rprTools/rprDeformationCache.cpp","../../RadeonProRender/rprTools/rprDeformationCache.h"}
+
+    -- remove filters for Visual Studio
+    vpaths { [""] = { 
+		"../77_deformation_cache/**.h", "../77_deformation_cache/**.cpp",
+		"../common/common.cpp","../common/common.h",
+		"../../RadeonProRender/rprTools/rprDeformationCache.cpp", "../../RadeonProRender/rprTools/rprDeformationCache.h"
+	} }
+
+    includedirs{ "../../RadeonProRender/inc" } 
+    
+    buildoptions "-std=c++14"
+
+    configuration {"x64"}
+    links {"RadeonProRender64"}
+
+    if os.istarget("linux") then
+		links {"pthread"}
+    end
+
+    configuration {"x64", "Debug"}
+        targetdir "../Bin"
+    configuration {"x64", "Release"}
+        targetdir "../Bin"
+    configuration {}
+    
@@ -0,0 +1,155 @@
+/*****************************************************************************\
+*
+*  Module Name    78_mesh_instancing/main.cpp
+*  Project        Radeon ProRender rendering tutorial
+*
+*  Description    Radeon ProRender SDK tutorials: duplicated meshes replaced by instances with RPRMeshInstancer
+*
+*  Copyright(C) 2011-2021 Advanced Micro Devices, Inc. All rights reserved.
+*
+\*****************************************************************************/
+
+
+//
+// Shows how to replace the duplicated meshes of a scene by instances with RPRMeshInstancer ( rprTools ).
+//
+// The teapot is imported TEAPOTS_PER_SIDE x TEAPOTS_PER_SIDE times with ImportOBJ, as an importer of a CAD assembly would
+// create one mesh for each copy of a part. RPRMeshInstancer finds that all the meshes have the same arrays, keeps the first one
+// and replaces the others by instances of it, with their own transform and material. The scene renders the same, with the
+// memory of one teapot: the bytes of the mesh arrays saved are printed.
+//
+
+
+#include "RadeonProRender.h"
+#include "Math/mathutils.h"
+#include "../common/common.h"
+#include "../../RadeonProRender/rprTools/rprMeshInstancer.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+RPRGarbageCollector g_gc;
+
+const int TEAPOTS_PER_SIDE = 6;
+
+
+int main()
+{
+	//	enable Radeon ProRender API trace
+	//	set this before any RPR API calls
+	//	rprContextSetParameterByKey1u(0,RPR_CONTEXT_TRACING_ENABLED,1);
+
+	std::cout << "-- Radeon ProRender SDK Demo --" << std::endl;
+
+	// the RPR context object.
+	rpr_context context = nullptr;
+
+	// Register the RPR DLL
+	rpr_int tahoePluginID = rprRegisterPlugin(RPR_PLUGIN_FILE_NAME);
+	CHECK_NE(tahoePluginID , -1);
+	rpr_int plugins[] = { tahoePluginID };
+	size_t pluginCount = sizeof(plugins) / sizeof(plugins[0]);
+
+	// Create context using a single GPU
+	CHECK( rprCreateContext(RPR_API_VERSION, plugins, pluginCount, g_ContextCreationFlags, g_contextProperties, NULL, &context) );
+
+	// Set the active plugin.
+	CHECK(  rprContextSetActivePlugin(context, plugins[0]) );
+
+	std::cout << "RPR Context creation succeeded." << std::endl;
+
+	rpr_material_system matsys = nullptr;
+	CHECK(rprContextCreateMaterialSystem(context, 0, &matsys));
+
+	rpr_scene scene = nullptr;
+	CHECK(rprContextCreateScene(context, &scene));
+	CHECK(rprContextSetScene(context, scene));
+	CHECK( CreateNatureEnvLight(context, scene, g_gc, 0.8f)  );
+
+	rpr_camera camera = nullptr;
+	CHECK(rprContextCreateCamera(context, &camera));
+	CHECK(rprCameraLookAt(camera, 0, 12, 22,   0, 0, 0,   0, 1, 0));
+	CHECK(rprCameraSetFocalLength(camera, 50.0f));
+	CHECK(rprSceneSetCamera(scene, camera));
+
+	CHECK( CreateAMDFloor(context, scene, matsys, g_gc, 1.0f, 1.0f)  );
+
+	rpr_framebuffer_desc desc = { 800,600 };
+	rpr_framebuffer_format fmt = { 4, RPR_COMPONENT_TYPE_FLOAT32 };
+	rpr_framebuffer frame_buffer = nullptr;
+	rpr_framebuffer frame_buffer_resolved = nullptr;
+	CHECK(rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer));
+	CHECK( rprContextCreateFrameBuffer(context, fmt, &desc, &frame_buffer_resolved) );
+	CHECK(rprContextSetAOV(context, RPR_AOV_COLOR, frame_buffer));
+	CHECK(rprContextSetParameterByKey1u(context,RPR_CONTEXT_ITERATIONS,NUM_ITERATIONS));
+
+	// two materials, alternated on the teapots
+	rpr_material_node materials[2] = { nullptr, nullptr };
+	for(int i=0; i<2; i++)
+	{
+		CHECK(rprMaterialSystemCreateNode(matsys, RPR_MATERIAL_NODE_DIFFUSE, &materials[i]));
+		g_gc.GCAdd(materials[i]);
+	}
+	CHECK(rprMaterialNodeSetInputFByKey(materials[0], RPR_MATERIAL_INPUT_COLOR, 0.8f, 0.3f, 0.1f, 1.f));
+	CHECK(rprMaterialNodeSetInputFByKey(materials[1], RPR_MATERIAL_INPUT_COLOR, 0.1f, 0.3f, 0.8f, 1.f));
+
+	// one mesh per teapot, like the import of an assembly
+	std::vector<rpr_shape> teapots;
+	for(int j=0; j<TEAPOTS_PER_SIDE; j++)
+	{
+		for(int i=0; i<TEAPOTS_PER_SIDE; i++)
+		{
+			rpr_shape teapot = ImportOBJ("../../Resources/Meshes/teapot.obj",scene,context);
+			CHECK_NE(teapot, nullptr);
+			RadeonProRender::matrix m = RadeonProRender::translation(RadeonProRender::float3(3.0f * (i - 0.5f * (TEAPOTS_PER_SIDE - 1)), 0, 3.0f * (j - 0.5f * (TEAPOTS_PER_SIDE - 1))))
+				* RadeonProRender::rotation_y(0.5f * (i + j)) * RadeonProRender::scale(RadeonProRender::float3(0.5f, 0.5f, 0.5f));
+			CHECK(rprShapeSetTransform(teapot, RPR_TRUE, &m.m00));
+			CHECK(rprShapeSetMaterial(teapot, materials[(i + j) % 2]));
+			teapots.push_back(teapot);
+		}
+	}
+
+	// the copies deleted by the instancer are replaced by their instances in the list of the shapes to delete.
+	// A copy only detached ( parent of an instance ) is still ours: its instance is added to the list.
+	RPRMeshInstancer instancer;
+	CHECK(instancer.Process(context, scene));
+	for(const RPRMeshInstancer::Replacement& replacement : instancer.GetReplacements())
+	{
+		if ( replacement.deleted )
+			std::replace(teapots.begin(), teapots.end(), replacement.mesh, replacement.instance);
+		else
+			teapots.push_back(replacement.instance);
+	}
+
+	const RPRMeshInstancer::Stats stats = instancer.GetStats();
+	std::cout << stats.meshes << " meshes, " << stats.uniqueMeshes << " unique, " << stats.instances << " replaced by instances: "
+		<< std::fixed << std::setprecision(1) << stats.savedBytes / (1024.0 * 1024.0) << " MiB of " << stats.meshBytes / (1024.0 * 1024.0) << " MiB of mesh arrays saved, "
+		<< stats.detachedBytes / (1024.0 * 1024.0) << " MiB detached only, "
+		<< "read " << stats.readSeconds * 1000.0 << " ms, hash " << stats.hashSeconds * 1000.0 << " ms, compare " << stats.compareSeconds * 1000.0 << " ms, replace " << stats.replaceSeconds * 1000.0 << " ms" << std::endl;
+
+	CHECK(rprFrameBufferClear(frame_buffer));
+	CHECK(rprContextRender(context));
+	CHECK(rprContextResolveFrameBuffer(context, frame_buffer, frame_buffer_resolved, false));
+	CHECK(rprFrameBufferSaveToFile(frame_buffer_resolved, "78.png"));
+
+
+	// Release the stuff we created
+	// the instances first, then the mesh they use
+	for(auto it=teapots.rbegin(); it!=teapots.rend(); ++it)
+	{
+		CHECK(rprSceneDetachShape(scene, *it));
+		CHECK(rprObjectDelete(*it));
+	}
+	teapots.clear();
+	CHECK(rprObjectDelete(camera));camera=nullptr;
+	CHECK(rprObjectDelete(frame_buffer));frame_buffer=nullptr;
+	CHECK(rprObjectDelete(frame_buffer_resolved));frame_buffer_resolved=nullptr;
+	g_gc.GCClean();
+	CHECK(rprObjectDelete(scene));scene=nullptr;
+	CHECK(rprObjectDelete(matsys));matsys=nullptr;
+	CheckNoLeak(context);
+	CHECK(rprObjectDelete(context));context=nullptr; // Always delete the RPR Context in last.
+	return 0;
+}
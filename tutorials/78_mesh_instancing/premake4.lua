@@ -0,0 +1,33 @@
+project "78_mesh_instancing"
+    kind "ConsoleApp"
+    location "../build"
+    files { "../78_mesh_instancing/**.h", "../78_mesh_instancing/**.cpp"} 
+    files { "../common/common.cpp","../common/common.h"}
+    files { "../../RadeonProRender/rprTools/rprMeshInstancer.cpp","../../RadeonProRender/rprTools/rprMeshInstancer.h"}
+    files { "../../RadeonProRender/rprTools/rprRprsBufferStore.cpp","../../RadeonProRender/rprTools/rprRprsBufferStore.h"}
+
+    -- remove filters for Visual Studio
+    vpaths { [""] = { 
+		"../78_mesh_instancing/**.h", "../78_mesh_instancing/**.cpp",
+		"../common/common.cpp","../common/common.h",
+		"../../RadeonProRender/rprTools/rprMeshInstancer.cpp", "../../RadeonProRender/rprTools/rprMeshInstancer.h",
+		"../../RadeonProRender/rprTools/rprRprsBufferStore.cpp", "../../RadeonProRender/rprTools/rprRprsBufferStore.h"
+	} }
+
+    includedirs{ "../../RadeonProRender/inc" } 
+    
+    buildoptions "-std=c++14"
+
+    configuration {"x64"}
+    links {"RadeonProRender64", "RprLoadStore64"}
+
+    if os.istarget("linux") then
+		links {"pthread"}
+    end
+
+    configuration {"x64", "Debug"}
+        targetdir "../Bin"
+    configuration {"x64", "Release"}
+        targetdir "../Bin"
+    configuration {}
+    
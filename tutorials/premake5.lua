@@ -4,6 +4,12 @@ newoption {
 	description = "needed for CentOS 7 OS"
 }
 
+newoption {
+	trigger = "materialx",
+	value = "PATH",
+	description = "MaterialX SDK folder ( include/ and lib/ ), needed for the tutorials using rprTools/rprMtlxLoader"
+}
+
 
 function fileExists(name)
    local f=io.open(name,"r")
@@ -106,8 +112,25 @@ solution "Tutorials"
 	include "51_volume"
 	include "60_mesh_export"
 	include "61_mesh_import"
+	include "62_rprs_prefetch"
  	include "63_hybrid"
     include "64_mesh_obj_demo"
+    include "65_rprs_buffer_store"
+    include "66_scene_pool"
+    include "69_display_transform"
+    include "70_async_output"
+    include "71_png_writer"
+    include "72_convergence"
+    include "73_telemetry"
+    include "74_sparse_volume"
+    include "75_volume_sequence"
+    include "76_hair"
+    include "77_deformation_cache"
+    include "78_mesh_instancing"
+	if _OPTIONS["materialx"] ~= nil then
+		include "67_materialx_loader"
+		include "68_mtlx_textures"
+	end
 
 	if fileExists("./MultiTutorials/MultiTutorials.lua") then
 		dofile("./MultiTutorials/MultiTutorials.lua")